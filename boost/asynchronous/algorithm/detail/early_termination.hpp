@@ -0,0 +1,146 @@
+// Boost.Asynchronous library
+//  Copyright (C) Christophe Henry 2026
+//
+//  Use, modification and distribution is subject to the Boost
+//  Software License, Version 1.0.  (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// For more information, see http://www.boost.org
+
+#ifndef BOOST_ASYNCHRONOUS_EARLY_TERMINATION_HPP
+#define BOOST_ASYNCHRONOUS_EARLY_TERMINATION_HPP
+
+#include <atomic>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+
+namespace boost { namespace asynchronous
+{
+namespace detail
+{
+// shared by all tasks of a "find first" algorithm (find_first_of, search, mismatch, etc.)
+// Remembers the position (distance from the beginning of the whole range) of the leftmost match found so far.
+// Tasks starting right of this position cannot improve the result and can stop.
+struct find_first_token
+{
+    find_first_token()
+        : m_found(std::numeric_limits<std::size_t>::max())
+    {}
+    // true if a match was already found left of pos, so that working from pos on is useless
+    bool is_cancelled(std::size_t pos)const
+    {
+        return m_found.load(std::memory_order_relaxed) < pos;
+    }
+    void found(std::size_t pos)
+    {
+        std::size_t current = m_found.load(std::memory_order_relaxed);
+        while (pos < current && !m_found.compare_exchange_weak(current,pos,std::memory_order_relaxed))
+        {
+        }
+    }
+private:
+    std::atomic<std::size_t> m_found;
+};
+
+// leaves are divided into subarrays, the token is checked before each of them (same granularity as parallel_all_of)
+template <class Distance>
+Distance early_termination_block_size(Distance leaf_size)
+{
+    return leaf_size > 1000 ? leaf_size / 100 : leaf_size;
+}
+
+// Executes a find-like algorithm on [beg,end) subarray by subarray and stops as soon as a match left of the current
+// subarray is known.
+// algo(b,e) must return the first match in [b,e) or e.
+// overlap is the number of elements after a subarray which a match starting in this subarray can use (search for example)
+// offset is the distance between the beginning of the whole range and beg.
+// Returns the first match or end if none found or cancelled.
+template <class Iterator, class Algo>
+Iterator find_first_in_blocks(Iterator beg, Iterator end, std::size_t offset, std::size_t overlap,
+                              boost::asynchronous::detail::find_first_token& token, Algo&& algo)
+{
+    if constexpr (std::is_base_of<std::random_access_iterator_tag,
+                                  typename std::iterator_traits<Iterator>::iterator_category>::value)
+    {
+        auto const block = boost::asynchronous::detail::early_termination_block_size(end - beg);
+        for (Iterator b = beg; b != end;)
+        {
+            if (token.is_cancelled(offset + static_cast<std::size_t>(b - beg)))
+            {
+                return end;
+            }
+            Iterator e = (end - b > block) ? b + block : end;
+            Iterator last = (end - e > static_cast<decltype(end - e)>(overlap)) ? e + overlap : end;
+            Iterator res = algo(b,last);
+            // a match starting after e will be found with the next subarray
+            if (res != last && res < e)
+            {
+                token.found(offset + static_cast<std::size_t>(res - beg));
+                return res;
+            }
+            b = e;
+        }
+        return end;
+    }
+    else
+    {
+        // no cheap way to divide, check only once
+        if (token.is_cancelled(offset))
+        {
+            return end;
+        }
+        Iterator res = algo(beg,end);
+        if (res != end)
+        {
+            token.found(offset + static_cast<std::size_t>(std::distance(beg,res)));
+        }
+        return res;
+    }
+}
+
+// Executes an "all elements fulfil" algorithm on [beg,end) subarray by subarray and stops as soon as another task
+// found an element which does not.
+// algo(b,e) returns false if an element of [b,e) does not fulfil the condition.
+template <class Iterator, class Algo>
+bool all_in_blocks(Iterator beg, Iterator end, std::atomic_bool& stop_event, Algo&& algo)
+{
+    if constexpr (std::is_base_of<std::random_access_iterator_tag,
+                                  typename std::iterator_traits<Iterator>::iterator_category>::value)
+    {
+        auto const block = boost::asynchronous::detail::early_termination_block_size(end - beg);
+        for (Iterator b = beg; b != end;)
+        {
+            if (stop_event.load(std::memory_order_relaxed))
+            {
+                return false;
+            }
+            Iterator e = (end - b > block) ? b + block : end;
+            if (!algo(b,e))
+            {
+                stop_event = true;
+                return false;
+            }
+            b = e;
+        }
+        return true;
+    }
+    else
+    {
+        if (stop_event.load(std::memory_order_relaxed))
+        {
+            return false;
+        }
+        bool res = algo(beg,end);
+        if (!res)
+        {
+            stop_event = true;
+        }
+        return res;
+    }
+}
+
+}
+}}
+#endif // BOOST_ASYNCHRONOUS_EARLY_TERMINATION_HPP
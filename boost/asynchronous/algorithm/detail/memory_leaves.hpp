@@ -0,0 +1,285 @@
+// Boost.Asynchronous library
+//  Copyright (C) Christophe Henry 2026
+//
+//  Use, modification and distribution is subject to the Boost
+//  Software License, Version 1.0.  (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// For more information, see http://www.boost.org
+
+#ifndef BOOST_ASYNCHRONOUS_MEMORY_LEAVES_HPP
+#define BOOST_ASYNCHRONOUS_MEMORY_LEAVES_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <unistd.h>
+#endif
+
+#if defined(__SSE2__) && !defined(BOOST_ASYNCHRONOUS_NO_SIMD)
+#define BOOST_ASYNCHRONOUS_SSE2_STREAMING
+#include <emmintrin.h>
+#endif
+
+// Leaves of copy / move / fill / swap_ranges / placement algorithms.
+// For trivially copyable elements in contiguous memory, they work on bytes (memcpy, memset).
+// Ranges bigger than the last level cache are written with non-temporal stores, so that the destination
+// does not evict the working set of other tasks from the cache.
+namespace boost { namespace asynchronous
+{
+namespace detail
+{
+// true if [beg,end) and the destination are contiguous memory of the same trivially copyable type
+template <class Iterator, class OutIterator>
+constexpr bool is_trivial_copy_v =
+        std::contiguous_iterator<Iterator> && std::contiguous_iterator<OutIterator> &&
+        std::is_same<std::remove_cv_t<typename std::iterator_traits<Iterator>::value_type>,
+                     std::remove_cv_t<typename std::iterator_traits<OutIterator>::value_type>>::value &&
+        std::is_trivially_copyable<typename std::iterator_traits<Iterator>::value_type>::value &&
+        !std::is_const<std::remove_reference_t<std::iter_reference_t<OutIterator>>>::value;
+
+template <class Iterator, class T>
+constexpr bool is_trivial_fill_v =
+        std::contiguous_iterator<Iterator> &&
+        std::is_same<std::remove_cv_t<typename std::iterator_traits<Iterator>::value_type>,std::remove_cv_t<T>>::value &&
+        std::is_trivially_copyable<T>::value;
+
+// size in bytes from which non-temporal stores are used: last level cache size if known
+inline std::size_t non_temporal_threshold()
+{
+#ifdef BOOST_ASYNCHRONOUS_NON_TEMPORAL_THRESHOLD
+    return BOOST_ASYNCHRONOUS_NON_TEMPORAL_THRESHOLD;
+#else
+    static const std::size_t threshold = []()
+    {
+        long llc = -1;
+#if defined(_SC_LEVEL3_CACHE_SIZE)
+        llc = ::sysconf(_SC_LEVEL3_CACHE_SIZE);
+#endif
+        return llc > 0 ? static_cast<std::size_t>(llc) : static_cast<std::size_t>(32*1024*1024);
+    }();
+    return threshold;
+#endif
+}
+
+inline bool use_non_temporal(std::size_t bytes)
+{
+#ifdef BOOST_ASYNCHRONOUS_SSE2_STREAMING
+    return bytes >= boost::asynchronous::detail::non_temporal_threshold();
+#else
+    (void)bytes;
+    return false;
+#endif
+}
+// to be called once on the whole range by the top-level algorithm, the result is given to all leaves
+template <class Iterator, class OutIterator>
+bool use_non_temporal_copy(Iterator beg, Iterator end)
+{
+    if constexpr (boost::asynchronous::detail::is_trivial_copy_v<Iterator,OutIterator>)
+    {
+        return boost::asynchronous::detail::use_non_temporal(
+                    static_cast<std::size_t>(end - beg) * sizeof(typename std::iterator_traits<Iterator>::value_type));
+    }
+    else
+    {
+        return false;
+    }
+}
+template <class Iterator, class T>
+bool use_non_temporal_fill(Iterator beg, Iterator end)
+{
+    if constexpr (boost::asynchronous::detail::is_trivial_fill_v<Iterator,T>)
+    {
+        return boost::asynchronous::detail::use_non_temporal(static_cast<std::size_t>(end - beg) * sizeof(T));
+    }
+    else
+    {
+        return false;
+    }
+}
+
+inline void stream_copy(char* dst, const char* src, std::size_t n)
+{
+#ifdef BOOST_ASYNCHRONOUS_SSE2_STREAMING
+    // align destination on 16 bytes
+    std::size_t head = (16 - (reinterpret_cast<std::uintptr_t>(dst) & 15)) & 15;
+    head = std::min(head,n);
+    std::memcpy(dst,src,head);
+    dst += head;
+    src += head;
+    n -= head;
+    for (; n >= 64; n -= 64, dst += 64, src += 64)
+    {
+        __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+        __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 16));
+        __m128i c = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 32));
+        __m128i d = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + 48));
+        _mm_stream_si128(reinterpret_cast<__m128i*>(dst),a);
+        _mm_stream_si128(reinterpret_cast<__m128i*>(dst + 16),b);
+        _mm_stream_si128(reinterpret_cast<__m128i*>(dst + 32),c);
+        _mm_stream_si128(reinterpret_cast<__m128i*>(dst + 48),d);
+    }
+    for (; n >= 16; n -= 16, dst += 16, src += 16)
+    {
+        _mm_stream_si128(reinterpret_cast<__m128i*>(dst),_mm_loadu_si128(reinterpret_cast<const __m128i*>(src)));
+    }
+    std::memcpy(dst,src,n);
+    // make streamed data visible to other threads before the task completes
+    _mm_sfence();
+#else
+    std::memcpy(dst,src,n);
+#endif
+}
+
+#ifdef BOOST_ASYNCHRONOUS_SSE2_STREAMING
+// dst must be 16-byte aligned, pattern is 16 bytes
+inline void stream_pattern(char* dst, std::size_t n, __m128i pattern)
+{
+    for (; n >= 64; n -= 64, dst += 64)
+    {
+        _mm_stream_si128(reinterpret_cast<__m128i*>(dst),pattern);
+        _mm_stream_si128(reinterpret_cast<__m128i*>(dst + 16),pattern);
+        _mm_stream_si128(reinterpret_cast<__m128i*>(dst + 32),pattern);
+        _mm_stream_si128(reinterpret_cast<__m128i*>(dst + 48),pattern);
+    }
+    for (; n >= 16; n -= 16, dst += 16)
+    {
+        _mm_stream_si128(reinterpret_cast<__m128i*>(dst),pattern);
+    }
+    _mm_sfence();
+}
+#endif
+
+template <class Iterator, class OutIterator>
+OutIterator copy_leaf(Iterator beg, Iterator end, OutIterator out, bool non_temporal)
+{
+    if constexpr (boost::asynchronous::detail::is_trivial_copy_v<Iterator,OutIterator>)
+    {
+        using T = typename std::iterator_traits<Iterator>::value_type;
+        std::size_t n = static_cast<std::size_t>(end - beg);
+        if (n == 0)
+        {
+            return out;
+        }
+        auto dst = reinterpret_cast<char*>(std::to_address(out));
+        auto src = reinterpret_cast<const char*>(std::to_address(beg));
+        if (non_temporal)
+        {
+            boost::asynchronous::detail::stream_copy(dst,src,n * sizeof(T));
+        }
+        else
+        {
+            std::memmove(dst,src,n * sizeof(T));
+        }
+        return out + n;
+    }
+    else
+    {
+        (void)non_temporal;
+        return std::copy(beg,end,out);
+    }
+}
+
+// moving a trivially copyable object is copying it
+template <class Iterator, class OutIterator>
+OutIterator move_leaf(Iterator beg, Iterator end, OutIterator out, bool non_temporal)
+{
+    if constexpr (boost::asynchronous::detail::is_trivial_copy_v<Iterator,OutIterator>)
+    {
+        return boost::asynchronous::detail::copy_leaf(beg,end,out,non_temporal);
+    }
+    else
+    {
+        (void)non_temporal;
+        return std::move(beg,end,out);
+    }
+}
+
+template <class Iterator, class T>
+void fill_leaf(Iterator beg, Iterator end, T const& value, bool non_temporal)
+{
+    if constexpr (boost::asynchronous::detail::is_trivial_fill_v<Iterator,T>)
+    {
+        std::size_t n = static_cast<std::size_t>(end - beg);
+        if (n == 0)
+        {
+            return;
+        }
+        auto dst = reinterpret_cast<char*>(std::to_address(beg));
+        auto bytes = reinterpret_cast<const unsigned char*>(std::addressof(value));
+        // a value made of a single repeated byte (all chars, 0 for any type...) is a memset
+        if (std::all_of(bytes + 1,bytes + sizeof(T),[bytes](unsigned char c){return c == bytes[0];}) && !non_temporal)
+        {
+            std::memset(dst,bytes[0],n * sizeof(T));
+            return;
+        }
+#ifdef BOOST_ASYNCHRONOUS_SSE2_STREAMING
+        // repeat the value in a 16-byte pattern, possible if the size of T divides 16
+        // and if the element boundaries stay in phase after aligning on 16 bytes
+        if constexpr (16 % sizeof(T) == 0)
+        {
+            if (non_temporal && reinterpret_cast<std::uintptr_t>(dst) % sizeof(T) == 0)
+            {
+                std::size_t head = ((16 - (reinterpret_cast<std::uintptr_t>(dst) & 15)) & 15) / sizeof(T);
+                head = std::min(head,n);
+                std::fill(beg,beg + head,value);
+                alignas(16) unsigned char pattern[16];
+                for (std::size_t i = 0; i < 16; i += sizeof(T))
+                {
+                    std::memcpy(pattern + i,bytes,sizeof(T));
+                }
+                std::size_t body = (n - head) * sizeof(T) / 16 * 16;
+                boost::asynchronous::detail::stream_pattern(dst + head * sizeof(T),body,
+                                                            _mm_load_si128(reinterpret_cast<const __m128i*>(pattern)));
+                std::fill(beg + head + body / sizeof(T),end,value);
+                return;
+            }
+        }
+#endif
+        std::fill(beg,end,value);
+    }
+    else
+    {
+        (void)non_temporal;
+        std::fill(beg,end,value);
+    }
+}
+
+// swaps blocks through a small buffer instead of element by element
+template <class Iterator1, class Iterator2>
+Iterator2 swap_ranges_leaf(Iterator1 beg1, Iterator1 end1, Iterator2 beg2)
+{
+    if constexpr (boost::asynchronous::detail::is_trivial_copy_v<Iterator1,Iterator2> &&
+                  !std::is_const<std::remove_reference_t<std::iter_reference_t<Iterator1>>>::value)
+    {
+        using T = typename std::iterator_traits<Iterator1>::value_type;
+        std::size_t n = static_cast<std::size_t>(end1 - beg1) * sizeof(T);
+        auto p1 = reinterpret_cast<char*>(std::to_address(beg1));
+        auto p2 = reinterpret_cast<char*>(std::to_address(beg2));
+        char buffer[256];
+        while (n > 0)
+        {
+            std::size_t block = std::min(n,sizeof(buffer));
+            std::memcpy(buffer,p1,block);
+            std::memcpy(p1,p2,block);
+            std::memcpy(p2,buffer,block);
+            p1 += block;
+            p2 += block;
+            n -= block;
+        }
+        return beg2 + (end1 - beg1);
+    }
+    else
+    {
+        return std::swap_ranges(beg1,end1,beg2);
+    }
+}
+
+}
+}}
+#endif // BOOST_ASYNCHRONOUS_MEMORY_LEAVES_HPP
@@ -12,6 +12,7 @@
 
 #include <iterator>
 #include <type_traits>
+#include <utility>
 
 namespace boost { namespace asynchronous
 {
@@ -45,13 +46,33 @@ void safe_advance(Iterator& it, Distance n, Iterator end)
     safe_advance_helper(it,n,end,typename std::iterator_traits<Iterator>::iterator_category());
 }
 
+// iterators of segmented containers (segmented_vector) know a better cut than the middle: a segment boundary
+template <class Iterator, class Enable = void>
+struct has_cutoff_hint : std::false_type {};
+template <class Iterator>
+struct has_cutoff_hint<Iterator,std::void_t<decltype(std::declval<Iterator const&>().cutoff_hint(std::declval<Iterator const&>()))>>
+        : std::true_type {};
+
+template <class Iterator>
+Iterator middle_or_hint(Iterator it, Iterator end)
+{
+    if constexpr (boost::asynchronous::detail::has_cutoff_hint<Iterator>::value)
+    {
+        return it.cutoff_hint(end);
+    }
+    else
+    {
+        return it + (end-it)/2;
+    }
+}
+
 // finds the best position to cut a range in 2: in the middle if random access iterators, given cutoff otherwise
 template <class Iterator, class Distance>
 Iterator find_cutoff_helper(Iterator it, Distance n, Iterator end,std::random_access_iterator_tag)
 {
     if (end-it <= n)
         return end;
-    return it + (end-it)/2;
+    return boost::asynchronous::detail::middle_or_hint(it,end);
 }
 template <class Iterator, class Distance>
 Iterator find_cutoff_helper(Iterator it, Distance n, Iterator end,std::input_iterator_tag)
@@ -89,7 +110,8 @@ std::pair<It,It> find_cutoff_and_prev_helper(It it, Distance n, It end,std::rand
 {
     if (end-it <= n)
         return std::make_pair(end,end);
-    return std::make_pair(it -1 + (end-it)/2,it + (end-it)/2);
+    It middle = boost::asynchronous::detail::middle_or_hint(it,end);
+    return std::make_pair(middle - 1,middle);
 }
 template <class It, class Distance>
 std::pair<It,It> find_cutoff_and_prev_helper(It it, Distance n, It end,std::input_iterator_tag)
@@ -0,0 +1,227 @@
+// Boost.Asynchronous library
+//  Copyright (C) Christophe Henry 2026
+//
+//  Use, modification and distribution is subject to the Boost
+//  Software License, Version 1.0.  (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// For more information, see http://www.boost.org
+
+#ifndef BOOST_ASYNCHRONOUS_SEARCH_STRATEGIES_HPP
+#define BOOST_ASYNCHRONOUS_SEARCH_STRATEGIES_HPP
+
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+#if defined(__SSE2__) && (defined(__GNUC__) || defined(__clang__)) && !defined(BOOST_ASYNCHRONOUS_NO_SIMD)
+#define BOOST_ASYNCHRONOUS_SSE2_SEARCH
+#include <emmintrin.h>
+#endif
+
+namespace boost { namespace asynchronous
+{
+namespace detail
+{
+// predicate used by the search algorithms when the caller provides none.
+// Knowing it is a plain equality allows faster leaf algorithms.
+struct search_equal
+{
+    template <class T1, class T2>
+    bool operator()(T1 const& a, T2 const& b)const
+    {
+        return a == b;
+    }
+};
+
+template <class T, class Enable=void>
+struct is_std_hashable : std::false_type {};
+template <class T>
+struct is_std_hashable<T,std::void_t<decltype(std::hash<T>{}(std::declval<T const&>()))>> : std::true_type {};
+
+template <class Iterator>
+constexpr bool is_random_access_v =
+        std::is_base_of<std::random_access_iterator_tag,typename std::iterator_traits<Iterator>::iterator_category>::value;
+
+template <class Iterator>
+constexpr bool is_byte_contiguous_v =
+        std::contiguous_iterator<Iterator> &&
+        std::is_integral<typename std::iterator_traits<Iterator>::value_type>::value &&
+        sizeof(typename std::iterator_traits<Iterator>::value_type) == 1;
+
+// needles at least this long are searched with Boyer-Moore-Horspool
+constexpr std::size_t horspool_min_needle_size = 8;
+
+// Searches a byte needle: candidates are positions where the first and last bytes of the needle match,
+// only then are the remaining bytes compared.
+// Returns hay+n if not found.
+inline const unsigned char* byte_search(const unsigned char* hay, std::size_t n, const unsigned char* needle, std::size_t m)
+{
+    if (m == 0)
+    {
+        return hay;
+    }
+    if (m > n)
+    {
+        return hay + n;
+    }
+    const unsigned char first = needle[0];
+    const unsigned char last = needle[m - 1];
+    std::size_t i = 0;
+#ifdef BOOST_ASYNCHRONOUS_SSE2_SEARCH
+    if (m > 1)
+    {
+        const __m128i vfirst = _mm_set1_epi8(static_cast<char>(first));
+        const __m128i vlast = _mm_set1_epi8(static_cast<char>(last));
+        // compare 16 candidate positions at once, the last byte of the needle must stay inside the haystack
+        for (; i + m - 1 + 16 <= n; i += 16)
+        {
+            const __m128i block_first = _mm_loadu_si128(reinterpret_cast<const __m128i*>(hay + i));
+            const __m128i block_last = _mm_loadu_si128(reinterpret_cast<const __m128i*>(hay + i + m - 1));
+            unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(
+                        _mm_and_si128(_mm_cmpeq_epi8(block_first,vfirst),_mm_cmpeq_epi8(block_last,vlast))));
+            while (mask != 0)
+            {
+                const unsigned bit = static_cast<unsigned>(__builtin_ctz(mask));
+                if (m <= 2 || std::memcmp(hay + i + bit + 1,needle + 1,m - 2) == 0)
+                {
+                    return hay + i + bit;
+                }
+                mask &= mask - 1;
+            }
+        }
+    }
+#endif
+    // candidates start in [hay+i, stop)
+    const unsigned char* const stop = hay + (n - m) + 1;
+    const unsigned char* p = hay + i;
+    while (p < stop)
+    {
+        p = static_cast<const unsigned char*>(std::memchr(p,first,static_cast<std::size_t>(stop - p)));
+        if (p == nullptr)
+        {
+            break;
+        }
+        if (p[m - 1] == last && (m <= 2 || std::memcmp(p + 1,needle + 1,m - 2) == 0))
+        {
+            return p;
+        }
+        ++p;
+    }
+    return hay + n;
+}
+
+// Leaf search of parallel_search / parallel_find_end. Picks a strategy depending on iterators, value type and predicate:
+// - contiguous bytes: memchr / SIMD filtering on first and last byte
+// - random access, hashable values, long needle: Boyer-Moore-Horspool
+// - otherwise: std::search
+// Built once per leaf, then used on subranges of the haystack.
+template <class Iterator1, class Iterator2, class Func>
+struct leaf_searcher
+{
+    using value_type1 = typename std::iterator_traits<Iterator1>::value_type;
+    using value_type2 = typename std::iterator_traits<Iterator2>::value_type;
+    static constexpr bool plain_equality = std::is_same<Func,boost::asynchronous::detail::search_equal>::value;
+    // char and unsigned char are equal as bytes but not always after promotion
+    static constexpr bool use_bytes = plain_equality &&
+            std::is_same_v<std::remove_cv_t<value_type1>,std::remove_cv_t<value_type2>> &&
+            boost::asynchronous::detail::is_byte_contiguous_v<Iterator1> &&
+            boost::asynchronous::detail::is_byte_contiguous_v<Iterator2>;
+    static constexpr bool can_use_horspool = plain_equality && !use_bytes &&
+            boost::asynchronous::detail::is_random_access_v<Iterator1> &&
+            boost::asynchronous::detail::is_random_access_v<Iterator2> &&
+            std::is_same<value_type1,value_type2>::value &&
+            boost::asynchronous::detail::is_std_hashable<value_type1>::value;
+    using horspool_type = std::conditional_t<can_use_horspool,std::boyer_moore_horspool_searcher<Iterator2>,int>;
+
+    leaf_searcher(Iterator2 beg2, Iterator2 end2, Func const& func)
+        : beg2_(beg2),end2_(end2),func_(func),needle_size_(static_cast<std::size_t>(std::distance(beg2,end2)))
+    {
+        if constexpr (can_use_horspool)
+        {
+            if (needle_size_ >= boost::asynchronous::detail::horspool_min_needle_size)
+            {
+                horspool_.emplace(beg2,end2);
+            }
+        }
+    }
+
+    // first match in [beg1,end1) or end1
+    Iterator1 operator()(Iterator1 beg1, Iterator1 end1)const
+    {
+        if constexpr (use_bytes)
+        {
+            auto hay = reinterpret_cast<const unsigned char*>(std::to_address(beg1));
+            auto n = static_cast<std::size_t>(end1 - beg1);
+            auto needle = reinterpret_cast<const unsigned char*>(std::to_address(beg2_));
+            return beg1 + (boost::asynchronous::detail::byte_search(hay,n,needle,needle_size_) - hay);
+        }
+        else if constexpr (can_use_horspool)
+        {
+            if (horspool_)
+            {
+                return std::search(beg1,end1,*horspool_);
+            }
+        }
+        return std::search(beg1,end1,beg2_,end2_,func_);
+    }
+
+    // last match in [beg1,end1) or end1
+    Iterator1 find_last(Iterator1 beg1, Iterator1 end1)const
+    {
+        if constexpr (use_bytes || can_use_horspool)
+        {
+            // repeat the fast forward search, matches are rare compared to the haystack size
+            if (needle_size_ == 0)
+            {
+                return end1;
+            }
+            Iterator1 last = end1;
+            for (Iterator1 it = (*this)(beg1,end1); it != end1; it = (*this)(it + 1,end1))
+            {
+                last = it;
+            }
+            return last;
+        }
+        else
+        {
+            return std::find_end(beg1,end1,beg2_,end2_,func_);
+        }
+    }
+
+    std::size_t needle_size()const
+    {
+        return needle_size_;
+    }
+
+private:
+    Iterator2 beg2_;
+    Iterator2 end2_;
+    Func const& func_;
+    std::size_t needle_size_;
+    std::optional<horspool_type> horspool_;
+};
+
+// When a range is split at split, a match of size needle_size crossing the split point lies within
+// [split - (needle_size-1), split + (needle_size-1)), limited to [beg,end).
+template <class Iterator, class Distance>
+std::pair<Iterator,Iterator> search_overlap_range(Iterator beg, Iterator split, Iterator end, Distance needle_size)
+{
+    using difference_type = typename std::iterator_traits<Iterator>::difference_type;
+    difference_type d = needle_size > 0 ? static_cast<difference_type>(needle_size) - 1 : 0;
+    Iterator itbeg = beg;
+    difference_type dist_left = std::distance(beg,split);
+    std::advance(itbeg,dist_left - std::min(dist_left,d));
+    Iterator itend = split;
+    std::advance(itend,std::min(static_cast<difference_type>(std::distance(split,end)),d));
+    return std::make_pair(itbeg,itend);
+}
+
+}
+}}
+#endif // BOOST_ASYNCHRONOUS_SEARCH_STRATEGIES_HPP
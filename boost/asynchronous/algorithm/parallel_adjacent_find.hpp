@@ -25,6 +25,7 @@
 #include <boost/asynchronous/post.hpp>
 #include <boost/asynchronous/scheduler/serializable_task.hpp>
 #include <boost/asynchronous/algorithm/detail/safe_advance.hpp>
+#include <boost/asynchronous/algorithm/detail/early_termination.hpp>
 #include <boost/asynchronous/algorithm/detail/parallel_all_of_helper.hpp>
 #include <boost/asynchronous/detail/metafunctions.hpp>
 
@@ -38,12 +39,15 @@ template<class Iterator, class Func, class Job>
 struct parallel_adjacent_find_helper : public boost::asynchronous::continuation_task<Iterator>
 {
     parallel_adjacent_find_helper(Iterator begin, Iterator end, Func func,
-                                  long cutoff, std::string const & task_name, std::size_t prio)
+                                  long cutoff, std::shared_ptr<boost::asynchronous::detail::find_first_token> token,
+                                  std::size_t offset, std::string const & task_name, std::size_t prio)
         : boost::asynchronous::continuation_task<Iterator>(task_name)
         , begin_(begin)
         , end_(end)
         , func_(std::move(func))
         , cutoff_(cutoff)
+        , token_(std::move(token))
+        , offset_(offset)
         , task_name_(std::move(task_name))
         , prio_(prio)
     {}
@@ -61,7 +65,19 @@ struct parallel_adjacent_find_helper : public boost::asynchronous::continuation_
             // if not at end, recurse, otherwise execute here
             if (it == end_)
             {
-                task_res.set_value(std::adjacent_find(begin_, end_, func_));
+                auto const& func = func_;
+                // a pair starting at the end of a subarray uses the first element of the next one
+                task_res.set_value(boost::asynchronous::detail::find_first_in_blocks(
+                                       begin_,end_,offset_,1,*token_,
+                                       [&func](Iterator b, Iterator e)
+                                       {
+                                           return std::adjacent_find(b,e,func);
+                                       }));
+            }
+            else if (token_->is_cancelled(offset_))
+            {
+                // a match was already found left of us
+                task_res.set_value(end_);
             }
             else
             {
@@ -94,8 +110,9 @@ struct parallel_adjacent_find_helper : public boost::asynchronous::continuation_
                         }
                     },
                     // recursive tasks
-                    parallel_adjacent_find_helper<Iterator, Func, Job>(begin_, it, func_, cutoff_, task_name_, prio_),
-                    parallel_adjacent_find_helper<Iterator, Func, Job>(it, end_, func_, cutoff_, task_name_, prio_)
+                    parallel_adjacent_find_helper<Iterator, Func, Job>(begin_, it, func_, cutoff_, token_, offset_, task_name_, prio_),
+                    parallel_adjacent_find_helper<Iterator, Func, Job>(it, end_, func_, cutoff_, token_,
+                                                                       offset_ + std::distance(begin_, it), task_name_, prio_)
                 );
             }
         }
@@ -109,6 +126,8 @@ struct parallel_adjacent_find_helper : public boost::asynchronous::continuation_
     Iterator end_;
     Func func_;
     long cutoff_;
+    std::shared_ptr<boost::asynchronous::detail::find_first_token> token_;
+    std::size_t offset_;
     std::string task_name_;
     std::size_t prio_;
 };
@@ -126,7 +145,7 @@ parallel_adjacent_find(Iterator beg, Iterator end,Func func,long cutoff,
 {
     return boost::asynchronous::top_level_callback_continuation_job<Iterator,Job>
             (boost::asynchronous::detail::parallel_adjacent_find_helper<Iterator,Func,Job>
-                (beg,end,func,cutoff,task_name,prio));
+                (beg,end,func,cutoff,std::make_shared<boost::asynchronous::detail::find_first_token>(),0,task_name,prio));
 }
 
 template <class Iterator,class Job=BOOST_ASYNCHRONOUS_DEFAULT_JOB>
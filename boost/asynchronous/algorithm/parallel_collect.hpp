@@ -0,0 +1,293 @@
+// Boost.Asynchronous library
+//  Copyright (C) Christophe Henry 2026
+//
+//  Use, modification and distribution is subject to the Boost
+//  Software License, Version 1.0.  (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// For more information, see http://www.boost.org
+
+#ifndef BOOST_ASYNCHRONOUS_PARALLEL_COLLECT_HPP
+#define BOOST_ASYNCHRONOUS_PARALLEL_COLLECT_HPP
+
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#include <boost/asynchronous/callable_any.hpp>
+#include <boost/asynchronous/continuation_task.hpp>
+#include <boost/asynchronous/post.hpp>
+#include <boost/asynchronous/algorithm/detail/safe_advance.hpp>
+#include <boost/asynchronous/detail/metafunctions.hpp>
+
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+
+// Ordered collection of results produced in parallel, each chunk producing a variable number of elements.
+// Part 1: each leaf fills its own buffer, the buffers and their sizes are kept in a tree with the shape of the task tree.
+// Part 2: the size of the root gives the size of the result, which is allocated once. The offset of each leaf is the sum
+// of the sizes of the subtrees left of it (prefix sum along the tree), leaves then move their elements in parallel
+// to their final place.
+namespace boost { namespace asynchronous
+{
+namespace detail
+{
+// tree structure containing the results of part 1
+template <class ReturnRange>
+struct collect_data
+{
+    collect_data(std::size_t size=0, ReturnRange values = ReturnRange())
+        : size_(size)
+        , values_(std::move(values))
+        , data_()
+    {}
+    collect_data(collect_data&& rhs) =default;
+    collect_data& operator=(collect_data&& rhs)=default;
+
+    // number of elements in this subtree
+    std::size_t size_;
+    // elements produced by this leaf
+    ReturnRange values_;
+    // subnodes (binary tree), empty for leaves
+    std::vector<collect_data> data_;
+};
+
+// true if the result can be allocated in one go and written in parallel
+template <class ReturnRange>
+struct can_collect_in_place : std::integral_constant<bool,
+        std::is_default_constructible<typename ReturnRange::value_type>::value &&
+        std::is_constructible<ReturnRange,std::size_t>::value &&
+        std::is_base_of<std::random_access_iterator_tag,
+                        typename std::iterator_traits<decltype(boost::begin(std::declval<ReturnRange&>()))>::iterator_category>::value>
+{};
+
+// fallback: concatenation in order
+template <class ReturnRange>
+void collect_in_order(boost::asynchronous::detail::collect_data<ReturnRange>& data, ReturnRange& res)
+{
+    if (data.data_.empty())
+    {
+        std::move(boost::begin(data.values_),boost::end(data.values_),std::back_inserter(res));
+    }
+    else
+    {
+        for (auto& sub : data.data_)
+        {
+            boost::asynchronous::detail::collect_in_order(sub,res);
+        }
+    }
+}
+
+template <class Iterator, class Produce, class ReturnRange, class Job>
+struct parallel_collect_part1_helper: public boost::asynchronous::continuation_task<boost::asynchronous::detail::collect_data<ReturnRange>>
+{
+    parallel_collect_part1_helper(Iterator beg, Iterator end, Produce produce,long cutoff,
+                                  const std::string& task_name, std::size_t prio)
+        : boost::asynchronous::continuation_task<boost::asynchronous::detail::collect_data<ReturnRange>>(task_name),
+          beg_(beg),end_(end),produce_(std::move(produce)),cutoff_(cutoff),prio_(prio)
+    {}
+    void operator()()
+    {
+        boost::asynchronous::continuation_result<boost::asynchronous::detail::collect_data<ReturnRange>> task_res = this->this_task_result();
+        try
+        {
+            // advance up to cutoff
+            Iterator it = boost::asynchronous::detail::find_cutoff(beg_,cutoff_,end_);
+            // if not at end, recurse, otherwise execute here
+            if (it == end_)
+            {
+                ReturnRange values;
+                produce_(beg_,end_,values);
+                std::size_t size = static_cast<std::size_t>(std::distance(boost::begin(values),boost::end(values)));
+                task_res.set_value(boost::asynchronous::detail::collect_data<ReturnRange>(size,std::move(values)));
+            }
+            else
+            {
+                boost::asynchronous::create_callback_continuation_job<Job>(
+                            // called when subtasks are done, set our result
+                            [task_res](std::tuple<boost::asynchronous::expected<boost::asynchronous::detail::collect_data<ReturnRange>>,
+                                                  boost::asynchronous::expected<boost::asynchronous::detail::collect_data<ReturnRange>> > res) mutable
+                            {
+                                try
+                                {
+                                    auto res_left = std::move(std::get<0>(res).get());
+                                    auto res_right = std::move(std::get<1>(res).get());
+                                    boost::asynchronous::detail::collect_data<ReturnRange> res_all(res_left.size_ + res_right.size_);
+                                    res_all.data_.reserve(2);
+                                    res_all.data_.push_back(std::move(res_left));
+                                    res_all.data_.push_back(std::move(res_right));
+                                    task_res.set_value(std::move(res_all));
+                                }
+                                catch(...)
+                                {
+                                    task_res.set_exception(std::current_exception());
+                                }
+                            },
+                            // recursive tasks
+                            parallel_collect_part1_helper<Iterator,Produce,ReturnRange,Job>
+                                (beg_,it,produce_,cutoff_,this->get_name(),prio_),
+                            parallel_collect_part1_helper<Iterator,Produce,ReturnRange,Job>
+                                (it,end_,produce_,cutoff_,this->get_name(),prio_)
+                );
+            }
+        }
+        catch(...)
+        {
+            task_res.set_exception(std::current_exception());
+        }
+    }
+    Iterator beg_;
+    Iterator end_;
+    Produce produce_;
+    long cutoff_;
+    std::size_t prio_;
+};
+
+// follows the tree of part 1, no need for a cutoff
+template <class OutIterator, class ReturnRange, class Job>
+struct parallel_collect_part2_helper: public boost::asynchronous::continuation_task<void>
+{
+    parallel_collect_part2_helper(OutIterator out, std::size_t offset, boost::asynchronous::detail::collect_data<ReturnRange> data,
+                                  const std::string& task_name, std::size_t prio)
+        : boost::asynchronous::continuation_task<void>(task_name),
+          out_(out),offset_(offset),data_(std::move(data)),prio_(prio)
+    {}
+    void operator()()
+    {
+        boost::asynchronous::continuation_result<void> task_res = this_task_result();
+        try
+        {
+            if (data_.data_.empty())
+            {
+                std::move(boost::begin(data_.values_),boost::end(data_.values_),out_ + offset_);
+                task_res.set_value();
+            }
+            else
+            {
+                std::size_t left_size = data_.data_[0].size_;
+                boost::asynchronous::create_callback_continuation_job<Job>(
+                            // called when subtasks are done, set our result
+                            [task_res](std::tuple<boost::asynchronous::expected<void>,boost::asynchronous::expected<void> > res) mutable
+                            {
+                                try
+                                {
+                                    std::get<0>(res).get();
+                                    std::get<1>(res).get();
+                                    task_res.set_value();
+                                }
+                                catch(...)
+                                {
+                                    task_res.set_exception(std::current_exception());
+                                }
+                            },
+                            // recursive tasks
+                            parallel_collect_part2_helper<OutIterator,ReturnRange,Job>
+                                (out_,offset_,std::move(data_.data_[0]),this->get_name(),prio_),
+                            parallel_collect_part2_helper<OutIterator,ReturnRange,Job>
+                                (out_,offset_ + left_size,std::move(data_.data_[1]),this->get_name(),prio_)
+                );
+            }
+        }
+        catch(...)
+        {
+            task_res.set_exception(std::current_exception());
+        }
+    }
+    OutIterator out_;
+    std::size_t offset_;
+    boost::asynchronous::detail::collect_data<ReturnRange> data_;
+    std::size_t prio_;
+};
+
+template <class Iterator, class Produce, class ReturnRange, class Job>
+struct parallel_collect_helper: public boost::asynchronous::continuation_task<ReturnRange>
+{
+    parallel_collect_helper(Iterator beg, Iterator end, Produce produce,long cutoff,
+                            const std::string& task_name, std::size_t prio)
+        : boost::asynchronous::continuation_task<ReturnRange>(task_name),
+          beg_(beg),end_(end),produce_(std::move(produce)),cutoff_(cutoff),prio_(prio)
+    {}
+    void operator()()
+    {
+        boost::asynchronous::continuation_result<ReturnRange> task_res = this->this_task_result();
+        try
+        {
+            auto cont = boost::asynchronous::top_level_callback_continuation_job<boost::asynchronous::detail::collect_data<ReturnRange>,Job>
+                    (boost::asynchronous::detail::parallel_collect_part1_helper<Iterator,Produce,ReturnRange,Job>
+                        (beg_,end_,std::move(produce_),cutoff_,this->get_name(),prio_));
+            auto task_name = this->get_name();
+            auto prio = prio_;
+            cont.on_done([task_res,task_name,prio]
+                         (std::tuple<boost::asynchronous::expected<boost::asynchronous::detail::collect_data<ReturnRange>> >&& res)
+            {
+                try
+                {
+                    auto data = std::move(std::get<0>(res).get());
+                    if constexpr (boost::asynchronous::detail::can_collect_in_place<ReturnRange>::value)
+                    {
+                        // allocate once, then every leaf writes at its offset
+                        auto all = std::make_shared<ReturnRange>(data.size_);
+                        auto cont2 = boost::asynchronous::top_level_callback_continuation_job<void,Job>
+                                (boost::asynchronous::detail::parallel_collect_part2_helper<decltype(boost::begin(*all)),ReturnRange,Job>
+                                    (boost::begin(*all),0,std::move(data),task_name,prio));
+                        cont2.on_done([task_res,all](std::tuple<boost::asynchronous::expected<void> >&& res2)
+                        {
+                            try
+                            {
+                                // get to check that no exception
+                                std::get<0>(res2).get();
+                                task_res.set_value(std::move(*all));
+                            }
+                            catch(...)
+                            {
+                                task_res.set_exception(std::current_exception());
+                            }
+                        });
+                    }
+                    else
+                    {
+                        ReturnRange all;
+                        boost::asynchronous::detail::collect_in_order(data,all);
+                        task_res.set_value(std::move(all));
+                    }
+                }
+                catch(...)
+                {
+                    task_res.set_exception(std::current_exception());
+                }
+            });
+        }
+        catch(...)
+        {
+            task_res.set_exception(std::current_exception());
+        }
+    }
+    Iterator beg_;
+    Iterator end_;
+    Produce produce_;
+    long cutoff_;
+    std::size_t prio_;
+};
+}
+
+// Calls produce(b,e,out) on chunks [b,e) of [beg,end) in parallel. produce appends any number of elements to out (ReturnRange&).
+// Returns the concatenation of all outputs in the order of the chunks.
+// Usage: parallel_collect<std::vector<Foo>>(beg,end,produce,cutoff)
+template <class ReturnRange, class Iterator, class Produce, class Job=BOOST_ASYNCHRONOUS_DEFAULT_JOB>
+boost::asynchronous::detail::callback_continuation<ReturnRange,Job>
+parallel_collect(Iterator beg, Iterator end, Produce produce,long cutoff,
+#ifdef BOOST_ASYNCHRONOUS_REQUIRE_ALL_ARGUMENTS
+                 const std::string& task_name, std::size_t prio=0)
+#else
+                 const std::string& task_name="", std::size_t prio=0)
+#endif
+{
+    return boost::asynchronous::top_level_callback_continuation_job<ReturnRange,Job>
+            (boost::asynchronous::detail::parallel_collect_helper<Iterator,Produce,ReturnRange,Job>
+                (beg,end,std::move(produce),cutoff,task_name,prio));
+}
+
+}}
+#endif // BOOST_ASYNCHRONOUS_PARALLEL_COLLECT_HPP
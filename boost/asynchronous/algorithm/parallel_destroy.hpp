@@ -0,0 +1,223 @@
+// Boost.Asynchronous library
+//  Copyright (C) Christophe Henry 2026
+//
+//  Use, modification and distribution is subject to the Boost
+//  Software License, Version 1.0.  (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// For more information, see http://www.boost.org
+
+#ifndef BOOST_ASYNCHRONOUS_PARALLEL_DESTROY_HPP
+#define BOOST_ASYNCHRONOUS_PARALLEL_DESTROY_HPP
+
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+#include <boost/asynchronous/detail/any_interruptible.hpp>
+#include <boost/asynchronous/callable_any.hpp>
+#include <boost/asynchronous/detail/continuation_impl.hpp>
+#include <boost/asynchronous/continuation_task.hpp>
+#include <boost/asynchronous/post.hpp>
+#include <boost/asynchronous/algorithm/parallel_for.hpp>
+
+// number of outer elements released by a task of deferred_destroy
+#ifndef BOOST_ASYNCHRONOUS_DEFERRED_DESTROY_CUTOFF
+#define BOOST_ASYNCHRONOUS_DEFERRED_DESTROY_CUTOFF 1024
+#endif
+
+namespace boost { namespace asynchronous
+{
+// lowest priority short of shutdown jobs: the last queue of schedulers having several
+constexpr std::size_t deferred_destroy_prio = std::numeric_limits<std::size_t>::max() - 1;
+
+namespace detail
+{
+template <class T, class Enable=void>
+struct is_destroy_range : std::false_type {};
+template <class T>
+struct is_destroy_range<T,std::void_t<decltype(std::declval<T&>().begin()),decltype(std::declval<T&>().end())>>
+    : std::true_type {};
+
+template <class T, class Enable=void>
+struct has_destroy_mapped_type : std::false_type {};
+template <class T>
+struct has_destroy_mapped_type<T,std::void_t<typename T::mapped_type>> : std::true_type {};
+
+// what a parallel release of the elements of Container can do:
+// release the mapped values of maps, move out the elements of other containers, nothing if elements are
+// const (sets) or trivially destructible
+template <class Container, class Enable=void>
+struct destroy_release_kind
+{
+    typedef typename Container::value_type value_type;
+    typedef decltype(*std::declval<Container&>().begin()) reference;
+    enum { mapped = 0 };
+    enum { elements = !std::is_trivially_destructible<value_type>::value &&
+                      !std::is_const<typename std::remove_reference<reference>::type>::value &&
+                      std::is_move_constructible<value_type>::value };
+};
+template <class Container>
+struct destroy_release_kind<Container,typename std::enable_if<has_destroy_mapped_type<Container>::value>::type>
+{
+    typedef typename Container::mapped_type mapped_type;
+    enum { mapped = !std::is_trivially_destructible<mapped_type>::value && std::is_move_constructible<mapped_type>::value };
+    enum { elements = 0 };
+};
+
+template <class Container>
+struct destroy_release_possible
+    : std::integral_constant<bool,destroy_release_kind<Container>::mapped || destroy_release_kind<Container>::elements>
+{};
+
+// leaves elements in a moved-from state, cheap to destroy afterwards
+template <class Container>
+struct destroy_release_range
+{
+    typedef decltype(std::declval<Container&>().begin()) iterator;
+    void operator()(iterator beg, iterator end) const
+    {
+        for (; beg != end; ++beg)
+        {
+            release(beg);
+        }
+    }
+    template <class C = Container>
+    static typename std::enable_if<destroy_release_kind<C>::mapped>::type release(iterator it)
+    {
+        typename C::mapped_type tmp(std::move(it->second));
+    }
+    template <class C = Container>
+    static typename std::enable_if<destroy_release_kind<C>::elements>::type release(iterator it)
+    {
+        typename C::value_type tmp(std::move(*it));
+    }
+};
+
+template <class T, class Job, class Enable=void>
+struct parallel_destroy_helper: public boost::asynchronous::continuation_task<void>
+{
+    parallel_destroy_helper(std::shared_ptr<T> obj, long, const std::string& task_name, std::size_t)
+        : boost::asynchronous::continuation_task<void>(task_name)
+        , obj_(std::move(obj))
+    {}
+    void operator()()
+    {
+        boost::asynchronous::continuation_result<void> task_res = this_task_result();
+        try
+        {
+            // nothing to do in parallel
+            obj_.reset();
+            task_res.set_value();
+        }
+        catch(...)
+        {
+            task_res.set_exception(std::current_exception());
+        }
+    }
+    std::shared_ptr<T> obj_;
+};
+
+template <class T, class Job>
+struct parallel_destroy_helper<T,Job,typename std::enable_if<
+        std::conjunction<boost::asynchronous::detail::is_destroy_range<T>,
+                         boost::asynchronous::detail::destroy_release_possible<T>>::value>::type>
+    : public boost::asynchronous::continuation_task<void>
+{
+    parallel_destroy_helper(std::shared_ptr<T> obj, long cutoff, const std::string& task_name, std::size_t prio)
+        : boost::asynchronous::continuation_task<void>(task_name)
+        , obj_(std::move(obj)),cutoff_(cutoff),prio_(prio)
+    {}
+    void operator()()
+    {
+        boost::asynchronous::continuation_result<void> task_res = this_task_result();
+        try
+        {
+            std::shared_ptr<T> obj = std::move(obj_);
+            auto beg = obj->begin();
+            auto end = obj->end();
+            boost::asynchronous::create_callback_continuation_job<Job>(
+                // called when the elements are released, the container is now cheap to destroy
+                [task_res,obj](std::tuple<boost::asynchronous::expected<void> > res) mutable
+                {
+                    try
+                    {
+                        std::get<0>(res).get();
+                        obj.reset();
+                        task_res.set_value();
+                    }
+                    catch(...)
+                    {
+                        task_res.set_exception(std::current_exception());
+                    }
+                },
+                boost::asynchronous::parallel_for<decltype(beg),boost::asynchronous::detail::destroy_release_range<T>,Job>
+                    (beg,end,boost::asynchronous::detail::destroy_release_range<T>(),cutoff_,this->get_name(),prio_)
+            );
+        }
+        catch(...)
+        {
+            task_res.set_exception(std::current_exception());
+        }
+    }
+    std::shared_ptr<T> obj_;
+    long cutoff_;
+    std::size_t prio_;
+};
+}
+
+// Destroys a container in parallel: elements (or mapped values of maps) are released by tasks of cutoff elements,
+// then the emptied container is destroyed. Objects which are not containers are simply destroyed.
+template <class T, class Job=BOOST_ASYNCHRONOUS_DEFAULT_JOB>
+typename std::enable_if<!std::is_lvalue_reference<T>::value,boost::asynchronous::detail::callback_continuation<void,Job>>::type
+parallel_destroy(T&& obj, long cutoff,
+#ifdef BOOST_ASYNCHRONOUS_REQUIRE_ALL_ARGUMENTS
+                 const std::string& task_name, std::size_t prio)
+#else
+                 const std::string& task_name="", std::size_t prio=0)
+#endif
+{
+    typedef typename std::decay<T>::type object_type;
+    return boost::asynchronous::top_level_callback_continuation_job<void,Job>
+            (boost::asynchronous::detail::parallel_destroy_helper<object_type,Job>
+                (std::make_shared<object_type>(std::move(obj)),cutoff,task_name,prio));
+}
+
+// Takes ownership of obj and destroys it in the given threadpool, in parallel if it is a container, without waiting.
+// For servants, whose thread should not pay for destroying big results. If the scheduler is not valid, obj is
+// destroyed at once.
+template <class S, class T>
+typename std::enable_if<!std::is_lvalue_reference<T>::value>::type
+#ifdef BOOST_ASYNCHRONOUS_REQUIRE_ALL_ARGUMENTS
+deferred_destroy(S const& scheduler, T&& obj, long cutoff, const std::string& task_name, std::size_t prio)
+#else
+deferred_destroy(S const& scheduler, T&& obj, long cutoff=BOOST_ASYNCHRONOUS_DEFERRED_DESTROY_CUTOFF,
+                 const std::string& task_name="deferred_destroy",
+                 std::size_t prio=boost::asynchronous::deferred_destroy_prio)
+#endif
+{
+    typedef typename std::decay<T>::type object_type;
+    typedef typename S::job_type job_type;
+    if (!scheduler.is_valid())
+    {
+        object_type destroyed(std::move(obj));
+        return;
+    }
+    auto holder = std::make_shared<object_type>(std::move(obj));
+    // the future is not waited for
+    boost::asynchronous::post_future(scheduler,
+        [holder,cutoff,task_name,prio]()mutable
+        {
+            std::shared_ptr<object_type> h(std::move(holder));
+            return boost::asynchronous::top_level_callback_continuation_job<void,job_type>
+                    (boost::asynchronous::detail::parallel_destroy_helper<object_type,job_type>
+                        (std::move(h),cutoff,task_name,prio));
+        },
+        task_name,prio);
+}
+
+}}
+#endif // BOOST_ASYNCHRONOUS_PARALLEL_DESTROY_HPP
@@ -25,6 +25,7 @@
 #include <boost/asynchronous/post.hpp>
 #include <boost/asynchronous/scheduler/serializable_task.hpp>
 #include <boost/asynchronous/algorithm/detail/safe_advance.hpp>
+#include <boost/asynchronous/algorithm/detail/early_termination.hpp>
 #include <boost/asynchronous/algorithm/detail/parallel_all_of_helper.hpp>
 #include <boost/asynchronous/detail/metafunctions.hpp>
 
@@ -37,10 +38,11 @@ template <class Iterator1, class Iterator2, class Func,class Job>
 struct parallel_equal_helper: public boost::asynchronous::continuation_task<bool>
 {
     parallel_equal_helper(Iterator1 beg1, Iterator1 end1,Iterator2 beg2, Func func,long cutoff,
+                        std::shared_ptr<std::atomic_bool> stop_event,
                         const std::string& task_name, std::size_t prio)
         : boost::asynchronous::continuation_task<bool>(task_name)
         , beg1_(beg1),end1_(end1), beg2_(beg2)
-        ,func_(std::move(func)),cutoff_(cutoff),prio_(prio)
+        ,func_(std::move(func)),cutoff_(cutoff),stop_event_(std::move(stop_event)),prio_(prio)
     {}
     void operator()()
     {
@@ -52,7 +54,22 @@ struct parallel_equal_helper: public boost::asynchronous::continuation_task<bool
             // if not at end, recurse, otherwise execute here
             if (it == end1_)
             {
-                task_res.set_value(std::equal(beg1_,end1_,beg2_,func_));
+                auto beg1 = beg1_;
+                auto beg2 = beg2_;
+                auto& func = func_;
+                task_res.set_value(boost::asynchronous::detail::all_in_blocks(
+                                       beg1_,end1_,*stop_event_,
+                                       [beg1,beg2,&func](Iterator1 b, Iterator1 e)
+                                       {
+                                           auto b2 = beg2;
+                                           std::advance(b2,std::distance(beg1,b));
+                                           return std::equal(b,e,b2,func);
+                                       }));
+            }
+            else if (*stop_event_)
+            {
+                // a difference was already found
+                task_res.set_value(false);
             }
             else
             {
@@ -74,8 +91,8 @@ struct parallel_equal_helper: public boost::asynchronous::continuation_task<bool
                                 }
                             },
                             // recursive tasks
-                            parallel_equal_helper<Iterator1,Iterator2,Func,Job>(beg1_,it,beg2_,func_,cutoff_,this->get_name(),prio_),
-                            parallel_equal_helper<Iterator1,Iterator2,Func,Job>(it,end1_,beg2,func_,cutoff_,this->get_name(),prio_)
+                            parallel_equal_helper<Iterator1,Iterator2,Func,Job>(beg1_,it,beg2_,func_,cutoff_,stop_event_,this->get_name(),prio_),
+                            parallel_equal_helper<Iterator1,Iterator2,Func,Job>(it,end1_,beg2,func_,cutoff_,stop_event_,this->get_name(),prio_)
                 );
             }
         }
@@ -89,16 +106,18 @@ struct parallel_equal_helper: public boost::asynchronous::continuation_task<bool
     Iterator2 beg2_;
     Func func_;
     long cutoff_;
+    std::shared_ptr<std::atomic_bool> stop_event_;
     std::size_t prio_;
 };
 template <class Iterator1, class Iterator2,class Job>
 struct parallel_equal_helper2: public boost::asynchronous::continuation_task<bool>
 {
     parallel_equal_helper2(Iterator1 beg1, Iterator1 end1,Iterator2 beg2,long cutoff,
+                        std::shared_ptr<std::atomic_bool> stop_event,
                         const std::string& task_name, std::size_t prio)
         : boost::asynchronous::continuation_task<bool>(task_name)
         , beg1_(beg1),end1_(end1), beg2_(beg2)
-        ,cutoff_(cutoff),prio_(prio)
+        ,cutoff_(cutoff),stop_event_(std::move(stop_event)),prio_(prio)
     {}
     void operator()()
     {
@@ -110,7 +129,21 @@ struct parallel_equal_helper2: public boost::asynchronous::continuation_task<boo
             // if not at end, recurse, otherwise execute here
             if (it == end1_)
             {
-                task_res.set_value(std::equal(beg1_,end1_,beg2_));
+                auto beg1 = beg1_;
+                auto beg2 = beg2_;
+                task_res.set_value(boost::asynchronous::detail::all_in_blocks(
+                                       beg1_,end1_,*stop_event_,
+                                       [beg1,beg2](Iterator1 b, Iterator1 e)
+                                       {
+                                           auto b2 = beg2;
+                                           std::advance(b2,std::distance(beg1,b));
+                                           return std::equal(b,e,b2);
+                                       }));
+            }
+            else if (*stop_event_)
+            {
+                // a difference was already found
+                task_res.set_value(false);
             }
             else
             {
@@ -132,8 +165,8 @@ struct parallel_equal_helper2: public boost::asynchronous::continuation_task<boo
                                 }
                             },
                             // recursive tasks
-                            parallel_equal_helper2<Iterator1,Iterator2,Job>(beg1_,it,beg2_,cutoff_,this->get_name(),prio_),
-                            parallel_equal_helper2<Iterator1,Iterator2,Job>(it,end1_,beg2,cutoff_,this->get_name(),prio_)
+                            parallel_equal_helper2<Iterator1,Iterator2,Job>(beg1_,it,beg2_,cutoff_,stop_event_,this->get_name(),prio_),
+                            parallel_equal_helper2<Iterator1,Iterator2,Job>(it,end1_,beg2,cutoff_,stop_event_,this->get_name(),prio_)
                 );
             }
         }
@@ -146,6 +179,7 @@ struct parallel_equal_helper2: public boost::asynchronous::continuation_task<boo
     Iterator1 end1_;
     Iterator2 beg2_;
     long cutoff_;
+    std::shared_ptr<std::atomic_bool> stop_event_;
     std::size_t prio_;
 };
 }
@@ -163,7 +197,7 @@ parallel_equal(Iterator1 beg1, Iterator1 end1,Iterator2 beg2,Func func,long cuto
 {
     return boost::asynchronous::top_level_callback_continuation_job<bool,Job>
             (boost::asynchronous::detail::parallel_equal_helper<Iterator1,Iterator2,Func,Job>
-                (beg1,end1,beg2,func,cutoff,task_name,prio));
+                (beg1,end1,beg2,func,cutoff,std::make_shared<std::atomic_bool>(false),task_name,prio));
 }
 
 template <class Iterator1,class Iterator2,
@@ -178,7 +212,7 @@ parallel_equal(Iterator1 beg1, Iterator1 end1,Iterator2 beg2,long cutoff,
 {
     return boost::asynchronous::top_level_callback_continuation_job<bool,Job>
             (boost::asynchronous::detail::parallel_equal_helper2<Iterator1,Iterator2,Job>
-                (beg1,end1,beg2,cutoff,task_name,prio));
+                (beg1,end1,beg2,cutoff,std::make_shared<std::atomic_bool>(false),task_name,prio));
 }
 
 }}
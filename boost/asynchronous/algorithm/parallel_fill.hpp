@@ -18,11 +18,74 @@
 #include <boost/asynchronous/detail/continuation_impl.hpp>
 #include <boost/asynchronous/post.hpp>
 #include <boost/asynchronous/scheduler/serializable_task.hpp>
+#include <boost/asynchronous/algorithm/detail/safe_advance.hpp>
+#include <boost/asynchronous/algorithm/detail/memory_leaves.hpp>
 #include <boost/asynchronous/detail/metafunctions.hpp>
 
 
 namespace boost { namespace asynchronous {
 
+namespace detail
+{
+template <class Iterator, class Value, class Job>
+struct parallel_fill_helper: public boost::asynchronous::continuation_task<void>
+{
+    parallel_fill_helper(Iterator beg, Iterator end, Value value, long cutoff, bool non_temporal,
+                         const std::string& task_name, std::size_t prio)
+        : boost::asynchronous::continuation_task<void>(task_name),
+          beg_(beg),end_(end),value_(std::move(value)),cutoff_(cutoff),non_temporal_(non_temporal),prio_(prio)
+    {}
+    void operator()()
+    {
+        boost::asynchronous::continuation_result<void> task_res = this_task_result();
+        try
+        {
+            // advance up to cutoff
+            Iterator it = boost::asynchronous::detail::find_cutoff(beg_,cutoff_,end_);
+            // if not at end, recurse, otherwise execute here
+            if (it == end_)
+            {
+                boost::asynchronous::detail::fill_leaf(beg_,end_,value_,non_temporal_);
+                task_res.set_value();
+            }
+            else
+            {
+                boost::asynchronous::create_callback_continuation_job<Job>(
+                        // called when subtasks are done, set our result
+                        [task_res](std::tuple<boost::asynchronous::expected<void>,boost::asynchronous::expected<void> > res) mutable
+                        {
+                            try
+                            {
+                                // get to check that no exception
+                                std::get<0>(res).get();
+                                std::get<1>(res).get();
+                                task_res.set_value();
+                            }
+                            catch(...)
+                            {
+                                task_res.set_exception(std::current_exception());
+                            }
+                        },
+                        // recursive tasks
+                        parallel_fill_helper<Iterator,Value,Job>(beg_,it,value_,cutoff_,non_temporal_,this->get_name(),prio_),
+                        parallel_fill_helper<Iterator,Value,Job>(it,end_,value_,cutoff_,non_temporal_,this->get_name(),prio_)
+                );
+            }
+        }
+        catch(...)
+        {
+            task_res.set_exception(std::current_exception());
+        }
+    }
+    Iterator beg_;
+    Iterator end_;
+    Value value_;
+    long cutoff_;
+    bool non_temporal_;
+    std::size_t prio_;
+};
+}
+
 // Iterators
 template <class Iterator, class Value, class Job=BOOST_ASYNCHRONOUS_DEFAULT_JOB>
 boost::asynchronous::detail::callback_continuation<void, Job>
@@ -33,12 +96,10 @@ parallel_fill(Iterator beg, Iterator end, const Value& value, long cutoff,
             const std::string& task_name="", std::size_t prio=0)
 #endif
 {
-    auto l = [value](const typename std::iterator_traits<Iterator>::value_type& ref)
-    {
-        const_cast<typename std::iterator_traits<Iterator>::value_type&>(ref) = value;
-    };
-    return boost::asynchronous::parallel_for<Iterator,decltype(l),Job>(beg, end,std::move(l),
-                                                                       cutoff, task_name, prio);
+    // leaves use memset / non-temporal stores for trivially copyable values in contiguous memory
+    return boost::asynchronous::top_level_callback_continuation_job<void,Job>
+            (boost::asynchronous::detail::parallel_fill_helper<Iterator,Value,Job>
+                (beg,end,value,cutoff,boost::asynchronous::detail::use_non_temporal_fill<Iterator,Value>(beg,end),task_name,prio));
 }
 
 // Moved range
@@ -26,6 +26,7 @@
 #include <boost/asynchronous/post.hpp>
 #include <boost/asynchronous/scheduler/serializable_task.hpp>
 #include <boost/asynchronous/algorithm/detail/safe_advance.hpp>
+#include <boost/asynchronous/algorithm/parallel_collect.hpp>
 #include <boost/asynchronous/detail/metafunctions.hpp>
 
 #include <boost/range/begin.hpp>
@@ -62,7 +63,40 @@ template <class Range, class Func>
 void find_all(Range& rng, Func fn) {
     boost::remove_erase_if(rng , boost::asynchronous::detail::not_<Func>(std::move(fn)));
 }
-    
+
+// leaf of parallel_collect: appends the found elements of a chunk
+template <class Func>
+struct find_all_producer
+{
+    template <class Iterator, class ReturnRange>
+    void operator()(Iterator beg, Iterator end, ReturnRange& ret)const
+    {
+        boost::asynchronous::detail::find_all(boost::make_iterator_range(beg,end),func_,ret);
+    }
+    Func func_;
+};
+
+// found elements of all leaves are written directly at their final place instead of being concatenated at every level
+template <class ReturnRange, class Job, class Iterator, class Func, class... Keep>
+void parallel_find_all_collect(boost::asynchronous::continuation_result<ReturnRange> task_res,
+                               Iterator beg, Iterator end, Func const& func, long cutoff,
+                               const std::string& task_name, std::size_t prio, Keep... keep)
+{
+    auto cont = boost::asynchronous::parallel_collect<ReturnRange,Iterator,boost::asynchronous::detail::find_all_producer<Func>,Job>
+            (beg,end,boost::asynchronous::detail::find_all_producer<Func>{func},cutoff,task_name,prio);
+    // keep holds what must live until completion (moved ranges)
+    cont.on_done([task_res,keep...](std::tuple<boost::asynchronous::expected<ReturnRange> >&& res)
+    {
+        try
+        {
+            task_res.set_value(std::move(std::get<0>(res).get()));
+        }
+        catch(...)
+        {
+            task_res.set_exception(std::current_exception());
+        }
+    });
+}
 }
 
 // version for iterators
@@ -81,38 +115,8 @@ struct parallel_find_all_helper: public boost::asynchronous::continuation_task<R
         boost::asynchronous::continuation_result<ReturnRange> task_res = this->this_task_result();
         try
         {
-            // advance up to cutoff
-            Iterator it = boost::asynchronous::detail::find_cutoff(beg_,cutoff_,end_);
-            // if not at end, recurse, otherwise execute here
-            if (it == end_)
-            {
-                ReturnRange ret(beg_,it);
-                boost::asynchronous::detail::find_all(ret,func_);
-                task_res.set_value(std::move(ret));
-            }
-            else
-            {
-                boost::asynchronous::create_callback_continuation_job<Job>(
-                    // called when subtasks are done, set our result
-                    [task_res]
-                    (std::tuple<boost::asynchronous::expected<ReturnRange>,boost::asynchronous::expected<ReturnRange>> res) mutable
-                    {
-                        try
-                        {
-                            ReturnRange rt = std::move(std::get<0>(res).get());
-                            boost::range::push_back(rt, std::move(std::get<1>(res).get()));
-                            task_res.set_value(std::move(rt));
-                        }
-                        catch(...)
-                        {
-                            task_res.set_exception(std::current_exception());
-                        }
-                    },
-                    // recursive tasks
-                    parallel_find_all_helper<Iterator,Func,ReturnRange,Job>(beg_,it,func_,cutoff_,this->get_name(),prio_),
-                    parallel_find_all_helper<Iterator,Func,ReturnRange,Job>(it,end_,func_,cutoff_,this->get_name(),prio_)
-                );
-            }
+            boost::asynchronous::detail::parallel_find_all_collect<ReturnRange,Job>(
+                        task_res,beg_,end_,func_,cutoff_,this->get_name(),prio_);
         }
         catch(...)
         {
@@ -157,40 +161,8 @@ struct parallel_find_all_range_helper: public boost::asynchronous::continuation_
         boost::asynchronous::continuation_result<ReturnRange> task_res = this->this_task_result();
         try
         {
-            // advance up to cutoff
-            auto it = boost::asynchronous::detail::find_cutoff(boost::begin(range_),cutoff_,boost::end(range_));
-            // if not at end, recurse, otherwise execute here
-            if (it == boost::end(range_))
-            {
-                ReturnRange ret(boost::begin(range_),it);
-                boost::asynchronous::detail::find_all(ret,func_);
-                task_res.set_value(std::move(ret));
-            }
-            else
-            {
-                boost::asynchronous::create_callback_continuation_job<Job>(
-                            // called when subtasks are done, set our result
-                            [task_res]
-                            (std::tuple<boost::asynchronous::expected<ReturnRange>,boost::asynchronous::expected<ReturnRange>> res) mutable
-                            {
-                                try
-                                {
-                                    ReturnRange rt = std::move(std::get<0>(res).get());
-                                    boost::range::push_back(rt, std::move(std::get<1>(res).get()));
-                                    task_res.set_value(std::move(rt));
-                                }
-                                catch(...)
-                                {
-                                    task_res.set_exception(std::current_exception());
-                                }
-                            },
-                            // recursive tasks
-                            parallel_find_all_helper<decltype(boost::begin(range_)),Func,ReturnRange,Job>(
-                                        boost::begin(range_),it,func_,cutoff_,this->get_name(),prio_),
-                            parallel_find_all_helper<decltype(boost::begin(range_)),Func,ReturnRange,Job>(
-                                        it,boost::end(range_),func_,cutoff_,this->get_name(),prio_)
-                        );
-            }
+            boost::asynchronous::detail::parallel_find_all_collect<ReturnRange,Job>(
+                        task_res,boost::begin(range_),boost::end(range_),func_,cutoff_,this->get_name(),prio_);
         }
         catch(...)
         {
@@ -232,40 +204,8 @@ struct parallel_find_all_range_move_helper: public boost::asynchronous::continua
         try
         {
             std::shared_ptr<Range> range = std::move(range_);
-            // advance up to cutoff
-            auto it = boost::asynchronous::detail::find_cutoff(boost::begin(*range),cutoff_,boost::end(*range));
-            // if not at end, recurse, otherwise execute here
-            if (it == boost::end(*range))
-            {
-                ReturnRange ret(boost::begin(*range),it);
-                boost::asynchronous::detail::find_all(ret,func_);
-                task_res.set_value(std::move(ret));
-            }
-            else
-            {
-                boost::asynchronous::create_callback_continuation_job<Job>(
-                    // called when subtasks are done, set our result
-                    [task_res,range]
-                    (std::tuple<boost::asynchronous::expected<ReturnRange>,boost::asynchronous::expected<ReturnRange>> res) mutable
-                    {
-                        try
-                        {
-                            ReturnRange rt = std::move(std::get<0>(res).get());
-                            boost::range::push_back(rt, std::move(std::get<1>(res).get()));
-                            task_res.set_value(std::move(rt));
-                        }
-                        catch(...)
-                        {
-                            task_res.set_exception(std::current_exception());
-                        }
-                    },
-                    // recursive tasks
-                    boost::asynchronous::detail::parallel_find_all_helper<decltype(boost::begin(*range)),Func,ReturnRange,Job>(
-                                boost::begin(*range),it,func_,cutoff_,this->get_name(),prio_),
-                    boost::asynchronous::detail::parallel_find_all_helper<decltype(boost::begin(*range)),Func,ReturnRange,Job>(
-                                it,boost::end(*range),func_,cutoff_,this->get_name(),prio_)
-                );
-            }
+            boost::asynchronous::detail::parallel_find_all_collect<ReturnRange,Job>(
+                        task_res,boost::begin(*range),boost::end(*range),func_,cutoff_,this->get_name(),prio_,range);
         }
         catch(...)
         {
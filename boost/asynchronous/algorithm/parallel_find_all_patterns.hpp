@@ -0,0 +1,420 @@
+// Boost.Asynchronous library
+//  Copyright (C) Christophe Henry 2026
+//
+//  Use, modification and distribution is subject to the Boost
+//  Software License, Version 1.0.  (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// For more information, see http://www.boost.org
+
+#ifndef BOOST_ASYNCHRONOUS_PARALLEL_FIND_ALL_PATTERNS_HPP
+#define BOOST_ASYNCHRONOUS_PARALLEL_FIND_ALL_PATTERNS_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <boost/asynchronous/callable_any.hpp>
+#include <boost/asynchronous/detail/continuation_impl.hpp>
+#include <boost/asynchronous/continuation_task.hpp>
+#include <boost/asynchronous/post.hpp>
+#include <boost/asynchronous/algorithm/detail/safe_advance.hpp>
+#include <boost/asynchronous/detail/metafunctions.hpp>
+
+#include <boost/range/begin.hpp>
+#include <boost/range/end.hpp>
+#include <boost/range/algorithm_ext/push_back.hpp>
+
+namespace boost { namespace asynchronous
+{
+
+// Searches a range ("text") for many patterns at once using the Aho-Corasick algorithm.
+// The automaton is built once, then chunks of the text are scanned in parallel, each chunk overlapping the next one
+// by the length of the longest pattern - 1 so that no match is lost.
+// Returns all matches as (position of the first element of the match, index of the pattern) sorted by position,
+// then pattern index.
+
+namespace detail
+{
+template <class T>
+struct aho_corasick_automaton
+{
+    using state_type = std::uint32_t;
+    // 1-byte symbols are mapped to the alphabet with a lookup table, others with a binary search
+    static constexpr bool byte_symbols = (sizeof(T) == 1) && std::is_integral<T>::value;
+
+    template <class Patterns>
+    explicit aho_corasick_automaton(Patterns const& patterns)
+    {
+        // compact alphabet: only symbols used in patterns get an index, all others map to 0
+        for (auto const& p : patterns)
+        {
+            symbols_.insert(symbols_.end(),boost::begin(p),boost::end(p));
+        }
+        std::sort(symbols_.begin(),symbols_.end());
+        symbols_.erase(std::unique(symbols_.begin(),symbols_.end()),symbols_.end());
+        alphabet_size_ = symbols_.size() + 1;
+        if constexpr (byte_symbols)
+        {
+            std::fill(std::begin(byte_map_),std::end(byte_map_),0);
+            for (std::size_t i = 0; i < symbols_.size(); ++i)
+            {
+                byte_map_[static_cast<unsigned char>(symbols_[i])] = static_cast<state_type>(i + 1);
+            }
+        }
+
+        // build the trie. During construction, 0 means "no transition" as the root is never a child
+        std::vector<std::vector<std::size_t>> outputs(1);
+        depth_.push_back(0);
+        table_.assign(alphabet_size_,0);
+        std::size_t pattern_index = 0;
+        for (auto const& p : patterns)
+        {
+            std::size_t len = 0;
+            state_type s = 0;
+            for (auto it = boost::begin(p); it != boost::end(p); ++it,++len)
+            {
+                std::size_t sym = symbol(*it);
+                if (table_[s * alphabet_size_ + sym] == 0)
+                {
+                    table_[s * alphabet_size_ + sym] = static_cast<state_type>(depth_.size());
+                    depth_.push_back(depth_[s] + 1);
+                    outputs.emplace_back();
+                    table_.resize(table_.size() + alphabet_size_,0);
+                }
+                s = table_[s * alphabet_size_ + sym];
+            }
+            lengths_.push_back(len);
+            max_length_ = std::max(max_length_,len);
+            // an empty pattern is never found
+            if (len != 0)
+            {
+                outputs[s].push_back(pattern_index);
+            }
+            ++pattern_index;
+        }
+
+        // breadth-first: compute failure links, complete the transition table and merge outputs of failure states
+        std::vector<state_type> failure(depth_.size(),0);
+        std::deque<state_type> todo;
+        for (std::size_t sym = 0; sym < alphabet_size_; ++sym)
+        {
+            if (table_[sym] != 0)
+            {
+                todo.push_back(table_[sym]);
+            }
+        }
+        while (!todo.empty())
+        {
+            state_type s = todo.front();
+            todo.pop_front();
+            outputs[s].insert(outputs[s].end(),outputs[failure[s]].begin(),outputs[failure[s]].end());
+            for (std::size_t sym = 0; sym < alphabet_size_; ++sym)
+            {
+                state_type& next = table_[s * alphabet_size_ + sym];
+                if (next != 0)
+                {
+                    failure[next] = table_[failure[s] * alphabet_size_ + sym];
+                    todo.push_back(next);
+                }
+                else
+                {
+                    next = table_[failure[s] * alphabet_size_ + sym];
+                }
+            }
+        }
+
+        // flatten outputs, sorted so that a state reports its patterns in index order
+        output_begin_.reserve(outputs.size() + 1);
+        for (auto& o : outputs)
+        {
+            std::sort(o.begin(),o.end());
+            output_begin_.push_back(output_ids_.size());
+            output_ids_.insert(output_ids_.end(),o.begin(),o.end());
+        }
+        output_begin_.push_back(output_ids_.size());
+
+        // symbols which can start a match. Used to skip quickly over the text while at the root
+        first_.assign(alphabet_size_,false);
+        for (std::size_t sym = 1; sym < alphabet_size_; ++sym)
+        {
+            if (table_[sym] != 0)
+            {
+                first_[sym] = true;
+                ++first_count_;
+                first_symbol_ = symbols_[sym - 1];
+            }
+        }
+    }
+
+    std::size_t symbol(T const& c)const
+    {
+        if constexpr (byte_symbols)
+        {
+            return byte_map_[static_cast<unsigned char>(c)];
+        }
+        else
+        {
+            auto it = std::lower_bound(symbols_.begin(),symbols_.end(),c);
+            return (it != symbols_.end() && !(c < *it)) ? static_cast<std::size_t>(it - symbols_.begin()) + 1 : 0;
+        }
+    }
+
+    // skips elements which cannot start a match
+    template <class Iterator>
+    Iterator skip_to_candidate(Iterator it, Iterator end)const
+    {
+        if constexpr (byte_symbols && std::contiguous_iterator<Iterator>)
+        {
+            if (first_count_ == 1 && it != end)
+            {
+                auto p = std::to_address(it);
+                auto found = static_cast<const T*>(std::memchr(p,static_cast<unsigned char>(first_symbol_),
+                                                               static_cast<std::size_t>(end - it)));
+                return found == nullptr ? end : it + (found - p);
+            }
+        }
+        return std::find_if(it,end,[this](T const& c){return first_[symbol(c)];});
+    }
+
+    // scans [beg,end), beg being at position offset of the whole text
+    // and calls f(position,pattern index) for every match starting before limit.
+    template <class Iterator, class Functor>
+    void scan(Iterator beg, Iterator end, std::size_t offset, std::size_t limit, Functor&& f)const
+    {
+        state_type s = 0;
+        std::size_t pos = offset;
+        for (Iterator it = beg; it != end;)
+        {
+            if (s == 0)
+            {
+                Iterator next = skip_to_candidate(it,end);
+                pos += static_cast<std::size_t>(std::distance(it,next));
+                it = next;
+                if (it == end || pos >= limit)
+                {
+                    break;
+                }
+            }
+            s = table_[s * alphabet_size_ + symbol(*it)];
+            ++it;
+            ++pos;
+            // the current candidate starts too late, the next chunk will handle it
+            if (pos - depth_[s] >= limit)
+            {
+                break;
+            }
+            for (std::size_t o = output_begin_[s]; o != output_begin_[s + 1]; ++o)
+            {
+                std::size_t id = output_ids_[o];
+                if (pos - lengths_[id] < limit)
+                {
+                    f(pos - lengths_[id],id);
+                }
+            }
+        }
+    }
+
+    std::size_t max_length()const
+    {
+        return max_length_;
+    }
+
+private:
+    std::vector<T> symbols_;
+    std::size_t alphabet_size_ = 1;
+    state_type byte_map_[byte_symbols ? 256 : 1];
+    // dense transition table: states x alphabet
+    std::vector<state_type> table_;
+    std::vector<std::size_t> depth_;
+    std::vector<std::size_t> lengths_;
+    std::size_t max_length_ = 0;
+    std::vector<std::size_t> output_begin_;
+    std::vector<std::size_t> output_ids_;
+    std::vector<bool> first_;
+    std::size_t first_count_ = 0;
+    T first_symbol_ = T();
+};
+
+template <class Iterator, class Automaton, class Job>
+struct parallel_find_all_patterns_helper
+        : public boost::asynchronous::continuation_task<std::vector<std::pair<std::size_t,std::size_t>>>
+{
+    using result_type = std::vector<std::pair<std::size_t,std::size_t>>;
+
+    parallel_find_all_patterns_helper(Iterator beg, Iterator end, Iterator text_end,
+                                      std::shared_ptr<const Automaton> automaton, std::size_t offset,
+                                      long cutoff, const std::string& task_name, std::size_t prio)
+        : boost::asynchronous::continuation_task<result_type>(task_name)
+        , beg_(beg),end_(end),text_end_(text_end),automaton_(std::move(automaton)),offset_(offset),cutoff_(cutoff),prio_(prio)
+    {}
+    void operator()()const
+    {
+        boost::asynchronous::continuation_result<result_type> task_res = this->this_task_result();
+        try
+        {
+            // advance up to cutoff
+            Iterator it = boost::asynchronous::detail::find_cutoff(beg_,cutoff_,end_);
+            // if not at end, recurse, otherwise execute here
+            if (it == end_)
+            {
+                // matches starting in our chunk may end in the next one
+                Iterator padded = end_;
+                if (automaton_->max_length() > 1)
+                {
+                    boost::asynchronous::detail::safe_advance(padded,automaton_->max_length() - 1,text_end_);
+                }
+                result_type res;
+                automaton_->scan(beg_,padded,offset_,offset_ + static_cast<std::size_t>(std::distance(beg_,end_)),
+                                 [&res](std::size_t pos, std::size_t id){res.emplace_back(pos,id);});
+                // the automaton reports matches in order of their end
+                std::sort(res.begin(),res.end());
+                task_res.set_value(std::move(res));
+            }
+            else
+            {
+                boost::asynchronous::create_callback_continuation_job<Job>(
+                    // called when subtasks are done, set our result
+                    [task_res]
+                    (std::tuple<boost::asynchronous::expected<result_type>,boost::asynchronous::expected<result_type>> res) mutable
+                    {
+                        try
+                        {
+                            result_type rt = std::move(std::get<0>(res).get());
+                            boost::range::push_back(rt, std::move(std::get<1>(res).get()));
+                            task_res.set_value(std::move(rt));
+                        }
+                        catch(...)
+                        {
+                            task_res.set_exception(std::current_exception());
+                        }
+                    },
+                    // recursive tasks
+                    parallel_find_all_patterns_helper<Iterator,Automaton,Job>
+                        (beg_,it,text_end_,automaton_,offset_,cutoff_,this->get_name(),prio_),
+                    parallel_find_all_patterns_helper<Iterator,Automaton,Job>
+                        (it,end_,text_end_,automaton_,offset_ + static_cast<std::size_t>(std::distance(beg_,it)),
+                         cutoff_,this->get_name(),prio_)
+                );
+            }
+        }
+        catch(...)
+        {
+            task_res.set_exception(std::current_exception());
+        }
+    }
+    Iterator beg_;
+    Iterator end_;
+    Iterator text_end_;
+    std::shared_ptr<const Automaton> automaton_;
+    std::size_t offset_;
+    long cutoff_;
+    std::size_t prio_;
+};
+}
+
+// version for iterators
+// patterns is a range of ranges (for example std::vector<std::string>) of the same value type as the text
+template <class Iterator, class Patterns, class Job=BOOST_ASYNCHRONOUS_DEFAULT_JOB>
+boost::asynchronous::detail::callback_continuation<std::vector<std::pair<std::size_t,std::size_t>>,Job>
+parallel_find_all_patterns(Iterator beg, Iterator end, Patterns const& patterns, long cutoff,
+#ifdef BOOST_ASYNCHRONOUS_REQUIRE_ALL_ARGUMENTS
+             const std::string& task_name, std::size_t prio=0)
+#else
+             const std::string& task_name="", std::size_t prio=0)
+#endif
+{
+    using automaton_type = boost::asynchronous::detail::aho_corasick_automaton<typename std::iterator_traits<Iterator>::value_type>;
+    return boost::asynchronous::top_level_callback_continuation_job<std::vector<std::pair<std::size_t,std::size_t>>,Job>
+            (boost::asynchronous::detail::parallel_find_all_patterns_helper<Iterator,automaton_type,Job>
+                (beg,end,end,std::make_shared<const automaton_type>(patterns),0,cutoff,task_name,prio));
+}
+
+// version for a text returned as continuation
+namespace detail
+{
+template <class Continuation, class Automaton, class Job>
+struct parallel_find_all_patterns_continuation_range_helper
+        : public boost::asynchronous::continuation_task<std::vector<std::pair<std::size_t,std::size_t>>>
+{
+    using result_type = std::vector<std::pair<std::size_t,std::size_t>>;
+
+    parallel_find_all_patterns_continuation_range_helper(Continuation c,std::shared_ptr<const Automaton> automaton,long cutoff,
+                                                         const std::string& task_name, std::size_t prio)
+        : boost::asynchronous::continuation_task<result_type>(task_name)
+        , cont_(std::move(c)),automaton_(std::move(automaton)),cutoff_(cutoff),prio_(prio)
+    {}
+    void operator()()
+    {
+        boost::asynchronous::continuation_result<result_type> task_res = this->this_task_result();
+        try
+        {
+            auto automaton = automaton_;
+            auto cutoff = cutoff_;
+            auto task_name = this->get_name();
+            auto prio = prio_;
+            cont_.on_done([task_res,automaton,cutoff,task_name,prio]
+                          (std::tuple<boost::asynchronous::expected<typename Continuation::return_type> >&& continuation_res) mutable
+            {
+                try
+                {
+                    auto res = std::make_shared<typename Continuation::return_type>(std::move(std::get<0>(continuation_res).get()));
+                    using iterator_type = decltype(boost::begin(*res));
+                    auto new_continuation = boost::asynchronous::top_level_callback_continuation_job<result_type,Job>
+                            (boost::asynchronous::detail::parallel_find_all_patterns_helper<iterator_type,Automaton,Job>
+                                (boost::begin(*res),boost::end(*res),boost::end(*res),automaton,0,cutoff,task_name,prio));
+                    new_continuation.on_done([res,task_res](std::tuple<boost::asynchronous::expected<result_type> >&& new_continuation_res)
+                    {
+                        try
+                        {
+                            task_res.set_value(std::move(std::get<0>(new_continuation_res).get()));
+                        }
+                        catch(...)
+                        {
+                            task_res.set_exception(std::current_exception());
+                        }
+                    });
+                }
+                catch(...)
+                {
+                    task_res.set_exception(std::current_exception());
+                }
+            });
+        }
+        catch(...)
+        {
+            task_res.set_exception(std::current_exception());
+        }
+    }
+    Continuation cont_;
+    std::shared_ptr<const Automaton> automaton_;
+    long cutoff_;
+    std::size_t prio_;
+};
+}
+
+template <class Range, class Patterns, class Job=typename Range::job_type>
+typename std::enable_if<boost::asynchronous::detail::has_is_continuation_task<Range>::value,
+                        boost::asynchronous::detail::callback_continuation<std::vector<std::pair<std::size_t,std::size_t>>,Job> >::type
+parallel_find_all_patterns(Range range, Patterns const& patterns, long cutoff,
+#ifdef BOOST_ASYNCHRONOUS_REQUIRE_ALL_ARGUMENTS
+             const std::string& task_name, std::size_t prio=0)
+#else
+             const std::string& task_name="", std::size_t prio=0)
+#endif
+{
+    using automaton_type = boost::asynchronous::detail::aho_corasick_automaton<
+            typename std::iterator_traits<decltype(boost::begin(std::declval<typename Range::return_type&>()))>::value_type>;
+    return boost::asynchronous::top_level_callback_continuation_job<std::vector<std::pair<std::size_t,std::size_t>>,Job>
+            (boost::asynchronous::detail::parallel_find_all_patterns_continuation_range_helper<Range,automaton_type,Job>
+                (std::move(range),std::make_shared<const automaton_type>(patterns),cutoff,task_name,prio));
+}
+
+}}
+#endif // BOOST_ASYNCHRONOUS_PARALLEL_FIND_ALL_PATTERNS_HPP
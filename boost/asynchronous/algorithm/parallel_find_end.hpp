@@ -23,6 +23,7 @@
 #include <boost/asynchronous/post.hpp>
 #include <boost/asynchronous/scheduler/serializable_task.hpp>
 #include <boost/asynchronous/algorithm/detail/safe_advance.hpp>
+#include <boost/asynchronous/algorithm/detail/search_strategies.hpp>
 #include <boost/asynchronous/detail/metafunctions.hpp>
 
 #include <boost/range/begin.hpp>
@@ -54,15 +55,16 @@ struct parallel_find_end_helper: public boost::asynchronous::continuation_task<I
             // if not at end, recurse, otherwise execute here
             if (it == end1_)
             {
-                task_res.set_value(std::find_end(beg1_,end1_,beg2_,end2_,func_));
+                boost::asynchronous::detail::leaf_searcher<Iterator1,Iterator2,Func> searcher(beg2_,end2_,func_);
+                task_res.set_value(searcher.find_last(beg1_,end1_));
             }
             else
             {
                 auto beg1 = beg1_;
                 auto end1 = end1_;
-                auto beg2 = end2_;
+                auto beg2 = beg2_;
                 auto end2 = end2_;
-                auto func = std::move(func_);
+                auto func = func_;
                 boost::asynchronous::create_callback_continuation_job<Job>(
                             // called when subtasks are done, set our result
                             [task_res,it,beg1,end1,beg2,end2,func]
@@ -80,13 +82,11 @@ struct parallel_find_end_helper: public boost::asynchronous::continuation_task<I
                                     else
                                     {
                                         // check in overlap region
-                                        auto itbeg = beg1;
-                                        auto itend = it;
-                                        auto dist2 = std::distance(beg2,end2);
-
-                                        std::advance(itbeg, std::distance(beg1,it) - dist2);
-                                        std::advance(itend, dist2);
-                                        auto itoverlap = std::find_end(itbeg,itend,beg2,end2,func);
+                                        boost::asynchronous::detail::leaf_searcher<Iterator1,Iterator2,Func> searcher(beg2,end2,func);
+                                        auto overlap = boost::asynchronous::detail::search_overlap_range(beg1,it,end1,searcher.needle_size());
+                                        auto itbeg = overlap.first;
+                                        auto itend = overlap.second;
+                                        auto itoverlap = searcher.find_last(itbeg,itend);
                                         if(itoverlap != itend)
                                         {
                                             task_res.set_value(std::move(itoverlap));
@@ -155,15 +155,10 @@ parallel_find_end(Iterator1 beg1, Iterator1 end1,Iterator2 beg2, Iterator2 end2,
              const std::string& task_name="", std::size_t prio=0)
 #endif
 {
-    auto l = [](const typename std::iterator_traits<Iterator1>::value_type& i,
-                const typename std::iterator_traits<Iterator2>::value_type& j)
-    {
-        return i == j;
-    };
-
+    // plain equality allows the leaves to use faster algorithms (memchr, SIMD, Boyer-Moore-Horspool)
     return boost::asynchronous::top_level_callback_continuation_job<Iterator1,Job>
-            (boost::asynchronous::detail::parallel_find_end_helper<Iterator1,Iterator2,decltype(l),Job>
-               (beg1,end1,beg2,end2,std::move(l),cutoff,task_name,prio));
+            (boost::asynchronous::detail::parallel_find_end_helper<Iterator1,Iterator2,boost::asynchronous::detail::search_equal,Job>
+               (beg1,end1,beg2,end2,boost::asynchronous::detail::search_equal(),cutoff,task_name,prio));
 }
 
 // version for 2nd range returned as continuation
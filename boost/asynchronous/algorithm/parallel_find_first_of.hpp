@@ -23,6 +23,7 @@
 #include <boost/asynchronous/post.hpp>
 #include <boost/asynchronous/scheduler/serializable_task.hpp>
 #include <boost/asynchronous/algorithm/detail/safe_advance.hpp>
+#include <boost/asynchronous/algorithm/detail/early_termination.hpp>
 #include <boost/asynchronous/detail/metafunctions.hpp>
 
 #include <boost/range/begin.hpp>
@@ -39,9 +40,11 @@ template <class Iterator1,class Iterator2, class Func, class Job>
 struct parallel_find_first_of_helper: public boost::asynchronous::continuation_task<Iterator1>
 {
     parallel_find_first_of_helper(Iterator1 beg1, Iterator1 end1,Iterator2 beg2, Iterator2 end2,Func func,
-                                  long cutoff,const std::string& task_name, std::size_t prio)
+                                  long cutoff,std::shared_ptr<boost::asynchronous::detail::find_first_token> token,
+                                  std::size_t offset,const std::string& task_name, std::size_t prio)
         : boost::asynchronous::continuation_task<Iterator1>(task_name)
-        , beg1_(beg1),end1_(end1),beg2_(beg2),end2_(end2),func_(std::move(func)),cutoff_(cutoff),prio_(prio)
+        , beg1_(beg1),end1_(end1),beg2_(beg2),end2_(end2),func_(std::move(func)),cutoff_(cutoff)
+        , token_(std::move(token)),offset_(offset),prio_(prio)
     {}
 
     void operator()()
@@ -54,7 +57,20 @@ struct parallel_find_first_of_helper: public boost::asynchronous::continuation_t
             // if not at end, recurse, otherwise execute here
             if (it == end1_)
             {
-                task_res.set_value(std::find_first_of(beg1_,end1_,beg2_,end2_,func_));
+                auto beg2 = beg2_;
+                auto end2 = end2_;
+                auto& func = func_;
+                task_res.set_value(boost::asynchronous::detail::find_first_in_blocks(
+                                       beg1_,end1_,offset_,0,*token_,
+                                       [beg2,end2,&func](Iterator1 b, Iterator1 e)
+                                       {
+                                           return std::find_first_of(b,e,beg2,end2,func);
+                                       }));
+            }
+            else if (token_->is_cancelled(offset_))
+            {
+                // a match was already found left of us
+                task_res.set_value(end1_);
             }
             else
             {
@@ -80,9 +96,10 @@ struct parallel_find_first_of_helper: public boost::asynchronous::continuation_t
                             },
                             // recursive tasks
                             parallel_find_first_of_helper<Iterator1,Iterator2,Func,Job>
-                                    (beg1_,it,beg2_,end2_,func_,cutoff_,this->get_name(),prio_),
+                                    (beg1_,it,beg2_,end2_,func_,cutoff_,token_,offset_,this->get_name(),prio_),
                             parallel_find_first_of_helper<Iterator1,Iterator2,Func,Job>
-                                    (it,end1_,beg2_,end2_,func_,cutoff_,this->get_name(),prio_)
+                                    (it,end1_,beg2_,end2_,func_,cutoff_,token_,offset_ + std::distance(beg1_,it),
+                                     this->get_name(),prio_)
                    );
             }
         }
@@ -98,6 +115,8 @@ struct parallel_find_first_of_helper: public boost::asynchronous::continuation_t
     Iterator2 end2_;
     Func func_;
     long cutoff_;
+    std::shared_ptr<boost::asynchronous::detail::find_first_token> token_;
+    std::size_t offset_;
     std::size_t prio_;
 };
 
@@ -113,7 +132,8 @@ parallel_find_first_of(Iterator1 beg1, Iterator1 end1,Iterator2 beg2, Iterator2
 {
     return boost::asynchronous::top_level_callback_continuation_job<Iterator1,Job>
             (boost::asynchronous::detail::parallel_find_first_of_helper<Iterator1,Iterator2,Func,Job>
-               (beg1,end1,beg2,end2,std::move(func),cutoff,task_name,prio));
+               (beg1,end1,beg2,end2,std::move(func),cutoff,
+                std::make_shared<boost::asynchronous::detail::find_first_token>(),0,task_name,prio));
 }
 
 template <class Iterator1,class Iterator2, class Job=BOOST_ASYNCHRONOUS_DEFAULT_JOB>
@@ -132,7 +152,8 @@ parallel_find_first_of(Iterator1 beg1, Iterator1 end1,Iterator2 beg2, Iterator2
     };
     return boost::asynchronous::top_level_callback_continuation_job<Iterator1,Job>
             (boost::asynchronous::detail::parallel_find_first_of_helper<Iterator1,Iterator2,decltype(l),Job>
-               (beg1,end1,beg2,end2,std::move(l),cutoff,task_name,prio));
+               (beg1,end1,beg2,end2,std::move(l),cutoff,
+                std::make_shared<boost::asynchronous::detail::find_first_token>(),0,task_name,prio));
 }
 
 // version for 2nd range returned as continuation
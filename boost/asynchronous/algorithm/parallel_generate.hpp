@@ -10,6 +10,9 @@
 #ifndef BOOST_ASYNCHRONOUS_PARALLEL_GENERATE_HPP
 #define BOOST_ASYNCHRONOUS_PARALLEL_GENERATE_HPP
 
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
 #include <type_traits>
 #include <boost/asynchronous/algorithm/parallel_for.hpp>
 #include <boost/asynchronous/callable_any.hpp>
@@ -19,6 +22,7 @@
 #include <boost/asynchronous/post.hpp>
 #include <boost/asynchronous/scheduler/serializable_task.hpp>
 #include <boost/asynchronous/detail/metafunctions.hpp>
+#include <boost/asynchronous/helpers/philox_engine.hpp>
 
 
 namespace boost { namespace asynchronous {
@@ -93,6 +97,54 @@ parallel_generate(Range range, Func func, long cutoff,
                                                                     cutoff, task_name, prio);
 }
 
+namespace detail
+{
+// element i gets distribution(philox4x32(seed,i)), with a fresh copy of the distribution,
+// so that the result depends neither on the cutoff nor on which thread executes which part
+template <class Iterator, class Distribution>
+struct generate_random_range
+{
+    void operator()(Iterator beg, Iterator end) const
+    {
+        constexpr std::size_t batch = 64;
+        std::uint32_t w0[batch], w1[batch], w2[batch], w3[batch];
+        std::uint64_t index = static_cast<std::uint64_t>(std::distance(first_,beg));
+        while (beg != end)
+        {
+            const std::size_t n = static_cast<std::size_t>(std::min<std::ptrdiff_t>(batch,std::distance(beg,end)));
+            // most of the work, done for a batch of elements at once
+            boost::asynchronous::philox4x32::first_blocks(seed_,index,n,w0,w1,w2,w3);
+            for (std::size_t i = 0; i < n; ++i, ++beg)
+            {
+                boost::asynchronous::philox4x32 engine(seed_,index + i,{{w0[i],w1[i],w2[i],w3[i]}});
+                Distribution distribution(distribution_);
+                *beg = distribution(engine);
+            }
+            index += n;
+        }
+    }
+    Iterator first_;
+    Distribution distribution_;
+    std::uint64_t seed_;
+};
+}
+
+// Reproducible random values: fills [beg,end) with values of distribution, bit-identical for a given seed
+// whatever the cutoff, the number of threads or the order of execution. Iterators must be random access.
+template <class Iterator, class Distribution, class Job=BOOST_ASYNCHRONOUS_DEFAULT_JOB>
+boost::asynchronous::detail::callback_continuation<void, Job>
+parallel_generate_random(Iterator beg, Iterator end, Distribution distribution, std::uint64_t seed, long cutoff,
+#ifdef BOOST_ASYNCHRONOUS_REQUIRE_ALL_ARGUMENTS
+            const std::string& task_name, std::size_t prio=0)
+#else
+            const std::string& task_name="", std::size_t prio=0)
+#endif
+{
+    typedef boost::asynchronous::detail::generate_random_range<Iterator,Distribution> leaf_type;
+    return boost::asynchronous::parallel_for<Iterator,leaf_type,Job>(beg, end,leaf_type{beg,std::move(distribution),seed},
+                                                                     cutoff, task_name, prio);
+}
+
 }}
 
 #endif // BOOST_ASYNCHRONOUS_PARALLEL_GENERATE_HPP
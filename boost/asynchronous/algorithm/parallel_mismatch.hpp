@@ -25,6 +25,7 @@
 #include <boost/asynchronous/post.hpp>
 #include <boost/asynchronous/scheduler/serializable_task.hpp>
 #include <boost/asynchronous/algorithm/detail/safe_advance.hpp>
+#include <boost/asynchronous/algorithm/detail/early_termination.hpp>
 #include <boost/asynchronous/algorithm/detail/parallel_all_of_helper.hpp>
 #include <boost/asynchronous/detail/metafunctions.hpp>
 
@@ -38,10 +39,11 @@ template <class Iterator1, class Iterator2, class Func,class Job>
 struct parallel_mismatch_helper: public boost::asynchronous::continuation_task<std::pair<Iterator1,Iterator2>>
 {
     parallel_mismatch_helper(Iterator1 beg1, Iterator1 end1,Iterator2 beg2, Func func,long cutoff,
+                        std::shared_ptr<boost::asynchronous::detail::find_first_token> token, std::size_t offset,
                         const std::string& task_name, std::size_t prio)
         : boost::asynchronous::continuation_task<std::pair<Iterator1,Iterator2>>(task_name)
         , beg1_(beg1),end1_(end1), beg2_(beg2)
-        ,func_(std::move(func)),cutoff_(cutoff),prio_(prio)
+        ,func_(std::move(func)),cutoff_(cutoff),token_(std::move(token)),offset_(offset),prio_(prio)
     {}
     void operator()()
     {
@@ -53,7 +55,26 @@ struct parallel_mismatch_helper: public boost::asynchronous::continuation_task<s
             // if not at end, recurse, otherwise execute here
             if (it == end1_)
             {
-                task_res.set_value(std::mismatch(beg1_,end1_,beg2_,func_));
+                auto beg1 = beg1_;
+                auto beg2 = beg2_;
+                auto& func = func_;
+                Iterator1 res = boost::asynchronous::detail::find_first_in_blocks(
+                                       beg1_,end1_,offset_,0,*token_,
+                                       [beg1,beg2,&func](Iterator1 b, Iterator1 e)
+                                       {
+                                           auto b2 = beg2;
+                                           std::advance(b2,std::distance(beg1,b));
+                                           return std::mismatch(b,e,b2,func).first;
+                                       });
+                std::advance(beg2,std::distance(beg1,res));
+                task_res.set_value(std::make_pair(res,beg2));
+            }
+            else if (token_->is_cancelled(offset_))
+            {
+                // a mismatch was already found left of us
+                auto beg2 = beg2_;
+                std::advance(beg2,std::distance(beg1_,end1_));
+                task_res.set_value(std::make_pair(end1_,beg2));
             }
             else
             {
@@ -76,8 +97,10 @@ struct parallel_mismatch_helper: public boost::asynchronous::continuation_task<s
                                 }
                             },
                             // recursive tasks
-                            parallel_mismatch_helper<Iterator1,Iterator2,Func,Job>(beg1_,it,beg2_,func_,cutoff_,this->get_name(),prio_),
-                            parallel_mismatch_helper<Iterator1,Iterator2,Func,Job>(it,end1_,beg2,func_,cutoff_,this->get_name(),prio_)
+                            parallel_mismatch_helper<Iterator1,Iterator2,Func,Job>(beg1_,it,beg2_,func_,cutoff_,token_,offset_,
+                                                                                   this->get_name(),prio_),
+                            parallel_mismatch_helper<Iterator1,Iterator2,Func,Job>(it,end1_,beg2,func_,cutoff_,token_,
+                                                                                   offset_ + std::distance(beg1_,it),this->get_name(),prio_)
                 );
             }
         }
@@ -91,16 +114,19 @@ struct parallel_mismatch_helper: public boost::asynchronous::continuation_task<s
     Iterator2 beg2_;
     Func func_;
     long cutoff_;
+    std::shared_ptr<boost::asynchronous::detail::find_first_token> token_;
+    std::size_t offset_;
     std::size_t prio_;
 };
 template <class Iterator1, class Iterator2,class Job>
 struct parallel_mismatch_helper2: public boost::asynchronous::continuation_task<std::pair<Iterator1,Iterator2>>
 {
     parallel_mismatch_helper2(Iterator1 beg1, Iterator1 end1,Iterator2 beg2,long cutoff,
+                        std::shared_ptr<boost::asynchronous::detail::find_first_token> token, std::size_t offset,
                         const std::string& task_name, std::size_t prio)
         : boost::asynchronous::continuation_task<std::pair<Iterator1,Iterator2>>(task_name)
         , beg1_(beg1),end1_(end1), beg2_(beg2)
-        ,cutoff_(cutoff),prio_(prio)
+        ,cutoff_(cutoff),token_(std::move(token)),offset_(offset),prio_(prio)
     {}
     void operator()()
     {
@@ -112,7 +138,25 @@ struct parallel_mismatch_helper2: public boost::asynchronous::continuation_task<
             // if not at end, recurse, otherwise execute here
             if (it == end1_)
             {
-                task_res.set_value(std::mismatch(beg1_,end1_,beg2_));
+                auto beg1 = beg1_;
+                auto beg2 = beg2_;
+                Iterator1 res = boost::asynchronous::detail::find_first_in_blocks(
+                                       beg1_,end1_,offset_,0,*token_,
+                                       [beg1,beg2](Iterator1 b, Iterator1 e)
+                                       {
+                                           auto b2 = beg2;
+                                           std::advance(b2,std::distance(beg1,b));
+                                           return std::mismatch(b,e,b2).first;
+                                       });
+                std::advance(beg2,std::distance(beg1,res));
+                task_res.set_value(std::make_pair(res,beg2));
+            }
+            else if (token_->is_cancelled(offset_))
+            {
+                // a mismatch was already found left of us
+                auto beg2 = beg2_;
+                std::advance(beg2,std::distance(beg1_,end1_));
+                task_res.set_value(std::make_pair(end1_,beg2));
             }
             else
             {
@@ -135,8 +179,10 @@ struct parallel_mismatch_helper2: public boost::asynchronous::continuation_task<
                                 }
                             },
                             // recursive tasks
-                            parallel_mismatch_helper2<Iterator1,Iterator2,Job>(beg1_,it,beg2_,cutoff_,this->get_name(),prio_),
-                            parallel_mismatch_helper2<Iterator1,Iterator2,Job>(it,end1_,beg2,cutoff_,this->get_name(),prio_)
+                            parallel_mismatch_helper2<Iterator1,Iterator2,Job>(beg1_,it,beg2_,cutoff_,token_,offset_,
+                                                                               this->get_name(),prio_),
+                            parallel_mismatch_helper2<Iterator1,Iterator2,Job>(it,end1_,beg2,cutoff_,token_,
+                                                                               offset_ + std::distance(beg1_,it),this->get_name(),prio_)
                 );
             }
         }
@@ -149,6 +195,8 @@ struct parallel_mismatch_helper2: public boost::asynchronous::continuation_task<
     Iterator1 end1_;
     Iterator2 beg2_;
     long cutoff_;
+    std::shared_ptr<boost::asynchronous::detail::find_first_token> token_;
+    std::size_t offset_;
     std::size_t prio_;
 };
 }
@@ -166,7 +214,7 @@ parallel_mismatch(Iterator1 beg1, Iterator1 end1,Iterator2 beg2,Func func,long c
 {
     return boost::asynchronous::top_level_callback_continuation_job<std::pair<Iterator1,Iterator2>,Job>
             (boost::asynchronous::detail::parallel_mismatch_helper<Iterator1,Iterator2,Func,Job>
-                (beg1,end1,beg2,func,cutoff,task_name,prio));
+                (beg1,end1,beg2,func,cutoff,std::make_shared<boost::asynchronous::detail::find_first_token>(),0,task_name,prio));
 }
 
 template <class Iterator1,class Iterator2,
@@ -181,7 +229,7 @@ parallel_mismatch(Iterator1 beg1, Iterator1 end1,Iterator2 beg2,long cutoff,
 {
     return boost::asynchronous::top_level_callback_continuation_job<std::pair<Iterator1,Iterator2>,Job>
             (boost::asynchronous::detail::parallel_mismatch_helper2<Iterator1,Iterator2,Job>
-                (beg1,end1,beg2,cutoff,task_name,prio));
+                (beg1,end1,beg2,cutoff,std::make_shared<boost::asynchronous::detail::find_first_token>(),0,task_name,prio));
 }
 
 }}
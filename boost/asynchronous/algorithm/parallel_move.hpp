@@ -23,6 +23,7 @@
 #include <boost/asynchronous/post.hpp>
 #include <boost/asynchronous/scheduler/serializable_task.hpp>
 #include <boost/asynchronous/algorithm/detail/safe_advance.hpp>
+#include <boost/asynchronous/algorithm/detail/memory_leaves.hpp>
 #include <boost/asynchronous/detail/metafunctions.hpp>
 
 #include <boost/range/begin.hpp>
@@ -41,12 +42,14 @@ namespace detail
 template<class Iterator, class ResultIterator, class Job>
 struct parallel_move_helper : public boost::asynchronous::continuation_task<void>
 {
-    parallel_move_helper(Iterator begin, Iterator end, ResultIterator result, long cutoff, std::string const & task_name, std::size_t prio)
+    parallel_move_helper(Iterator begin, Iterator end, ResultIterator result, long cutoff, bool non_temporal,
+                         std::string const & task_name, std::size_t prio)
         : boost::asynchronous::continuation_task<void>(task_name)
         , begin_(begin)
         , end_(end)
         , result_(result)
         , cutoff_(cutoff)
+        , non_temporal_(non_temporal)
         , task_name_(std::move(task_name))
         , prio_(prio)
     {}
@@ -65,7 +68,7 @@ struct parallel_move_helper : public boost::asynchronous::continuation_task<void
             // if not at end, recurse, otherwise execute here
             if (it == end_)
             {
-                std::move(begin_, it, result_);
+                boost::asynchronous::detail::move_leaf(begin_, it, result_, non_temporal_);
                 task_res.set_value();
             }
             else
@@ -88,8 +91,8 @@ struct parallel_move_helper : public boost::asynchronous::continuation_task<void
                         }
                     },
                     // recursive tasks
-                    parallel_move_helper<Iterator, ResultIterator, Job>(begin_, it, result_, cutoff_, task_name_, prio_),
-                    parallel_move_helper<Iterator, ResultIterator, Job>(it, end_, result_ + dist, cutoff_, task_name_, prio_)
+                    parallel_move_helper<Iterator, ResultIterator, Job>(begin_, it, result_, cutoff_, non_temporal_, task_name_, prio_),
+                    parallel_move_helper<Iterator, ResultIterator, Job>(it, end_, result_ + dist, cutoff_, non_temporal_, task_name_, prio_)
                 );
             }
         }
@@ -103,6 +106,7 @@ struct parallel_move_helper : public boost::asynchronous::continuation_task<void
     Iterator end_;
     ResultIterator result_;
     long cutoff_;
+    bool non_temporal_;
     std::string task_name_;
     std::size_t prio_;
 };
@@ -119,7 +123,10 @@ parallel_move(Iterator begin, Iterator end, ResultIterator result, long cutoff,
 #endif
 {
     return boost::asynchronous::top_level_callback_continuation_job<void, Job>
-               (boost::asynchronous::detail::parallel_move_helper<Iterator, ResultIterator, Job>(begin, end, result, cutoff, task_name, prio));
+               (boost::asynchronous::detail::parallel_move_helper<Iterator, ResultIterator, Job>
+                    (begin, end, result, cutoff,
+                     boost::asynchronous::detail::use_non_temporal_copy<Iterator,ResultIterator>(begin,end),
+                     task_name, prio));
 }
 
 
@@ -150,10 +157,12 @@ struct parallel_move_range_move_helper: public boost::asynchronous::continuation
             // advance up to cutoff
             auto it = boost::asynchronous::detail::find_cutoff(boost::begin(*range),cutoff_,boost::end(*range));
             std::size_t dist = std::distance(boost::begin(*range), it);
+            bool non_temporal = boost::asynchronous::detail::use_non_temporal_copy<decltype(boost::begin(*range)),ResultIterator>
+                    (boost::begin(*range),boost::end(*range));
             // if not at end, recurse, otherwise execute here
             if (it == boost::end(*range))
             {
-                std::move(boost::begin(*range),it,out_);
+                boost::asynchronous::detail::move_leaf(boost::begin(*range),it,out_,non_temporal);
                 task_res.set_value(std::move(*range));
             }
             else
@@ -177,9 +186,9 @@ struct parallel_move_range_move_helper: public boost::asynchronous::continuation
                             },
                             // recursive tasks (via iterators)
                             boost::asynchronous::detail::parallel_move_helper<decltype(boost::begin(*range_)),ResultIterator,Job>
-                                (boost::begin(*range),it,out_,cutoff_,this->get_name(),prio_),
+                                (boost::begin(*range),it,out_,cutoff_,non_temporal,this->get_name(),prio_),
                             boost::asynchronous::detail::parallel_move_helper<decltype(boost::begin(*range_)),ResultIterator,Job>
-                                (it,boost::end(*range),out_ + dist,cutoff_,this->get_name(),prio_)
+                                (it,boost::end(*range),out_ + dist,cutoff_,non_temporal,this->get_name(),prio_)
                 );
             }
         }
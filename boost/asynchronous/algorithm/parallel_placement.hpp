@@ -19,6 +19,7 @@
 #include <boost/asynchronous/detail/continuation_impl.hpp>
 #include <boost/asynchronous/continuation_task.hpp>
 #include <boost/asynchronous/algorithm/detail/safe_advance.hpp>
+#include <boost/asynchronous/algorithm/detail/memory_leaves.hpp>
 #include <boost/asynchronous/detail/metafunctions.hpp>
 
 namespace boost { namespace asynchronous
@@ -226,9 +227,10 @@ namespace detail
 template <class T, class Job>
 struct parallel_placement_helper_raw: public boost::asynchronous::continuation_task<boost::asynchronous::detail::parallel_placement_helper_result>
 {
-    parallel_placement_helper_raw(std::size_t beg, std::size_t end,char* data,T init,long cutoff,const std::string& task_name, std::size_t prio)
+    parallel_placement_helper_raw(std::size_t beg, std::size_t end,char* data,T init,long cutoff,bool non_temporal,
+                                  const std::string& task_name, std::size_t prio)
         : boost::asynchronous::continuation_task<boost::asynchronous::detail::parallel_placement_helper_result>(task_name),
-          beg_(beg),end_(end),data_(data),init_(init),cutoff_(cutoff),prio_(prio)
+          beg_(beg),end_(end),data_(data),init_(init),cutoff_(cutoff),non_temporal_(non_temporal),prio_(prio)
     {
     }
     void operator()()
@@ -239,6 +241,16 @@ struct parallel_placement_helper_raw: public boost::asynchronous::continuation_t
             // advance up to cutoff
             auto it =(end_-beg_ <= (std::size_t)cutoff_)? end_: beg_ + (end_-beg_)/2;
             // if not at end, recurse, otherwise execute here
+            if constexpr (std::is_trivially_copyable<T>::value)
+            {
+                if (it == end_)
+                {
+                    // copying bytes creates trivially copyable objects, cannot throw
+                    boost::asynchronous::detail::fill_leaf(((T*)data_) + beg_,((T*)data_) + end_,init_,non_temporal_);
+                    task_res.set_value(std::make_pair(boost::asynchronous::detail::parallel_placement_helper_enum::success,std::exception_ptr()));
+                    return;
+                }
+            }
             if (it == end_)
             {
                 for (std::size_t i = 0; i < (end_ - beg_); ++i)
@@ -312,9 +324,9 @@ struct parallel_placement_helper_raw: public boost::asynchronous::continuation_t
                             },
                             // recursive tasks
                             boost::asynchronous::detail::parallel_placement_helper_raw<T,Job>
-                                    (beg_,it,data_,init_,cutoff_,this->get_name(),prio_),
+                                    (beg_,it,data_,init_,cutoff_,non_temporal_,this->get_name(),prio_),
                             boost::asynchronous::detail::parallel_placement_helper_raw<T,Job>
-                                    (it,end_,data_,init_,cutoff_,this->get_name(),prio_)
+                                    (it,end_,data_,init_,cutoff_,non_temporal_,this->get_name(),prio_)
                  );
             }
         }
@@ -328,6 +340,7 @@ struct parallel_placement_helper_raw: public boost::asynchronous::continuation_t
     char* data_;
     T init_;
     long cutoff_;
+    bool non_temporal_;
     std::size_t prio_;
 };
 }
@@ -342,7 +355,10 @@ parallel_placement(std::size_t beg, std::size_t end, char* data,T init,long cuto
 #endif
 {
    return boost::asynchronous::top_level_callback_continuation_job<boost::asynchronous::detail::parallel_placement_helper_result,Job>
-            (boost::asynchronous::detail::parallel_placement_helper_raw<T,Job>(beg,end,data,init,cutoff,task_name,prio));
+            (boost::asynchronous::detail::parallel_placement_helper_raw<T,Job>
+                (beg,end,data,init,cutoff,
+                 std::is_trivially_copyable<T>::value && boost::asynchronous::detail::use_non_temporal((end-beg)*sizeof(T)),
+                 task_name,prio));
 }
 
 namespace detail
@@ -351,9 +367,9 @@ template <class T, class Iterator, class Ptr, class Job>
 struct parallel_placement_iterators_helper: public boost::asynchronous::continuation_task<boost::asynchronous::detail::parallel_placement_helper_result>
 {
     parallel_placement_iterators_helper(std::size_t beg, std::size_t end,Iterator beg2,
-                                        Ptr data,long cutoff,const std::string& task_name, std::size_t prio)
+                                        Ptr data,long cutoff,bool non_temporal,const std::string& task_name, std::size_t prio)
         : boost::asynchronous::continuation_task<boost::asynchronous::detail::parallel_placement_helper_result>(task_name),
-          beg_(beg),end_(end),beg2_(beg2),data_(data),cutoff_(cutoff),prio_(prio)
+          beg_(beg),end_(end),beg2_(beg2),data_(data),cutoff_(cutoff),non_temporal_(non_temporal),prio_(prio)
     {
     }
     void operator()()
@@ -364,6 +380,16 @@ struct parallel_placement_iterators_helper: public boost::asynchronous::continua
             // advance up to cutoff
             auto it =(end_-beg_ <= (std::size_t)cutoff_)? end_: beg_ + (end_-beg_)/2;
             auto it2 = beg2_;
+            if constexpr (boost::asynchronous::detail::is_trivial_copy_v<Iterator,T*>)
+            {
+                if (it == end_)
+                {
+                    // copying bytes creates trivially copyable objects, cannot throw
+                    boost::asynchronous::detail::copy_leaf(it2,it2 + (end_ - beg_),((T*)data_.get()) + beg_,non_temporal_);
+                    task_res.set_value(std::make_pair(boost::asynchronous::detail::parallel_placement_helper_enum::success,std::exception_ptr()));
+                    return;
+                }
+            }
             // if not at end, recurse, otherwise execute here
             if (it == end_)
             {
@@ -440,9 +466,9 @@ struct parallel_placement_iterators_helper: public boost::asynchronous::continua
                             },
                             // recursive tasks
                             boost::asynchronous::detail::parallel_placement_iterators_helper<T,Iterator,Ptr,Job>
-                                    (beg_,it,it2,data_,cutoff_,this->get_name(),prio_),
+                                    (beg_,it,it2,data_,cutoff_,non_temporal_,this->get_name(),prio_),
                             boost::asynchronous::detail::parallel_placement_iterators_helper<T,Iterator,Ptr,Job>
-                                    (it,end_,it2b,data_,cutoff_,this->get_name(),prio_)
+                                    (it,end_,it2b,data_,cutoff_,non_temporal_,this->get_name(),prio_)
                  );
             }
         }
@@ -456,6 +482,7 @@ struct parallel_placement_iterators_helper: public boost::asynchronous::continua
     Iterator beg2_;
     Ptr data_;
     long cutoff_;
+    bool non_temporal_;
     std::size_t prio_;
 };
 }
@@ -470,7 +497,10 @@ parallel_placement(std::size_t beg, std::size_t end, Iterator beg2, Ptr data,lon
 #endif
 {
    return boost::asynchronous::top_level_callback_continuation_job<boost::asynchronous::detail::parallel_placement_helper_result,Job>
-            (boost::asynchronous::detail::parallel_placement_iterators_helper<T,Iterator,Ptr,Job>(beg,end,beg2,data,cutoff,task_name,prio));
+            (boost::asynchronous::detail::parallel_placement_iterators_helper<T,Iterator,Ptr,Job>
+                (beg,end,beg2,data,cutoff,
+                 boost::asynchronous::detail::is_trivial_copy_v<Iterator,T*> && boost::asynchronous::detail::use_non_temporal((end-beg)*sizeof(T)),
+                 task_name,prio));
 }
 
 namespace detail
@@ -23,6 +23,8 @@
 #include <boost/asynchronous/post.hpp>
 #include <boost/asynchronous/scheduler/serializable_task.hpp>
 #include <boost/asynchronous/algorithm/detail/safe_advance.hpp>
+#include <boost/asynchronous/algorithm/detail/early_termination.hpp>
+#include <boost/asynchronous/algorithm/detail/search_strategies.hpp>
 #include <boost/asynchronous/detail/metafunctions.hpp>
 
 #include <boost/range/begin.hpp>
@@ -39,9 +41,11 @@ template <class Iterator1,class Iterator2, class Func, class Job>
 struct parallel_search_helper: public boost::asynchronous::continuation_task<Iterator1>
 {
     parallel_search_helper(Iterator1 beg1, Iterator1 end1,Iterator2 beg2, Iterator2 end2,Func func,
-                                  long cutoff,const std::string& task_name, std::size_t prio)
+                                  long cutoff,std::shared_ptr<boost::asynchronous::detail::find_first_token> token,
+                                  std::size_t offset,const std::string& task_name, std::size_t prio)
         : boost::asynchronous::continuation_task<Iterator1>(task_name)
-        , beg1_(beg1),end1_(end1),beg2_(beg2),end2_(end2),func_(std::move(func)),cutoff_(cutoff),prio_(prio)
+        , beg1_(beg1),end1_(end1),beg2_(beg2),end2_(end2),func_(std::move(func)),cutoff_(cutoff)
+        , token_(std::move(token)),offset_(offset),prio_(prio)
     {}
 
     void operator()()
@@ -54,15 +58,24 @@ struct parallel_search_helper: public boost::asynchronous::continuation_task<Ite
             // if not at end, recurse, otherwise execute here
             if (it == end1_)
             {
-                task_res.set_value(std::search(beg1_,end1_,beg2_,end2_,func_));
+                boost::asynchronous::detail::leaf_searcher<Iterator1,Iterator2,Func> searcher(beg2_,end2_,func_);
+                // a match starting in a subarray can use the next needle size - 1 elements
+                auto dist2 = searcher.needle_size();
+                task_res.set_value(boost::asynchronous::detail::find_first_in_blocks(
+                                       beg1_,end1_,offset_,(dist2 > 0 ? dist2 - 1 : 0),*token_,searcher));
+            }
+            else if (token_->is_cancelled(offset_))
+            {
+                // a match was already found left of us
+                task_res.set_value(end1_);
             }
             else
             {
                 auto beg1 = beg1_;
                 auto end1 = end1_;
-                auto beg2 = end2_;
+                auto beg2 = beg2_;
                 auto end2 = end2_;
-                auto func = std::move(func_);
+                auto func = func_;
                 boost::asynchronous::create_callback_continuation_job<Job>(
                             // called when subtasks are done, set our result
                             [task_res,it,beg1,end1,beg2,end2,func]
@@ -80,12 +93,11 @@ struct parallel_search_helper: public boost::asynchronous::continuation_task<Ite
                                     else
                                     {
                                         // check in overlap region
-                                        auto itbeg = beg1;
-                                        auto itend = it;
-                                        auto dist2 = std::distance(beg2,end2);
-                                        std::advance(itbeg, std::distance(beg1,it) - dist2);
-                                        std::advance(itend, dist2);
-                                        auto itoverlap = std::search(itbeg,itend,beg2,end2,func);
+                                        boost::asynchronous::detail::leaf_searcher<Iterator1,Iterator2,Func> searcher(beg2,end2,func);
+                                        auto overlap = boost::asynchronous::detail::search_overlap_range(beg1,it,end1,searcher.needle_size());
+                                        auto itbeg = overlap.first;
+                                        auto itend = overlap.second;
+                                        auto itoverlap = searcher(itbeg,itend);
                                         if(itoverlap != itend)
                                         {
                                             task_res.set_value(std::move(itoverlap));
@@ -109,9 +121,10 @@ struct parallel_search_helper: public boost::asynchronous::continuation_task<Ite
                             },
                             // recursive tasks
                             parallel_search_helper<Iterator1,Iterator2,Func,Job>
-                                    (beg1_,it,beg2_,end2_,func_,cutoff_,this->get_name(),prio_),
+                                    (beg1_,it,beg2_,end2_,func_,cutoff_,token_,offset_,this->get_name(),prio_),
                             parallel_search_helper<Iterator1,Iterator2,Func,Job>
-                                    (it,end1_,beg2_,end2_,func_,cutoff_,this->get_name(),prio_)
+                                    (it,end1_,beg2_,end2_,func_,cutoff_,token_,offset_ + std::distance(beg1_,it),
+                                     this->get_name(),prio_)
                    );
             }
         }
@@ -127,6 +140,8 @@ struct parallel_search_helper: public boost::asynchronous::continuation_task<Ite
     Iterator2 end2_;
     Func func_;
     long cutoff_;
+    std::shared_ptr<boost::asynchronous::detail::find_first_token> token_;
+    std::size_t offset_;
     std::size_t prio_;
 };
 }
@@ -142,7 +157,8 @@ parallel_search(Iterator1 beg1, Iterator1 end1,Iterator2 beg2, Iterator2 end2,Fu
 {
     return boost::asynchronous::top_level_callback_continuation_job<Iterator1,Job>
             (boost::asynchronous::detail::parallel_search_helper<Iterator1,Iterator2,Func,Job>
-               (beg1,end1,beg2,end2,std::move(func),cutoff,task_name,prio));
+               (beg1,end1,beg2,end2,std::move(func),cutoff,
+                std::make_shared<boost::asynchronous::detail::find_first_token>(),0,task_name,prio));
 }
 
 template <class Iterator1,class Iterator2, class Job=BOOST_ASYNCHRONOUS_DEFAULT_JOB>
@@ -154,15 +170,11 @@ parallel_search(Iterator1 beg1, Iterator1 end1,Iterator2 beg2, Iterator2 end2,lo
              const std::string& task_name="", std::size_t prio=0)
 #endif
 {
-    auto l = [](const typename std::iterator_traits<Iterator1>::value_type& i,
-                const typename std::iterator_traits<Iterator2>::value_type& j)
-    {
-        return i == j;
-    };
-
+    // plain equality allows the leaves to use faster algorithms (memchr, SIMD, Boyer-Moore-Horspool)
     return boost::asynchronous::top_level_callback_continuation_job<Iterator1,Job>
-            (boost::asynchronous::detail::parallel_search_helper<Iterator1,Iterator2,decltype(l),Job>
-               (beg1,end1,beg2,end2,std::move(l),cutoff,task_name,prio));
+            (boost::asynchronous::detail::parallel_search_helper<Iterator1,Iterator2,boost::asynchronous::detail::search_equal,Job>
+               (beg1,end1,beg2,end2,boost::asynchronous::detail::search_equal(),cutoff,
+                std::make_shared<boost::asynchronous::detail::find_first_token>(),0,task_name,prio));
 }
 
 // version for 2nd range returned as continuation
@@ -22,6 +22,8 @@
 #include <boost/asynchronous/post.hpp>
 #include <boost/asynchronous/scheduler/serializable_task.hpp>
 #include <boost/asynchronous/algorithm/detail/safe_advance.hpp>
+#include <boost/asynchronous/algorithm/detail/early_termination.hpp>
+#include <boost/asynchronous/algorithm/detail/search_strategies.hpp>
 #include <boost/asynchronous/detail/metafunctions.hpp>
 
 namespace boost { namespace asynchronous
@@ -34,9 +36,11 @@ template <class Iterator1,class Size, class T, class Func, class Job>
 struct parallel_search_n_helper: public boost::asynchronous::continuation_task<Iterator1>
 {
     parallel_search_n_helper(Iterator1 beg1, Iterator1 end1,Size count, const T& value,Func func,
-                                  long cutoff,const std::string& task_name, std::size_t prio)
+                                  long cutoff,std::shared_ptr<boost::asynchronous::detail::find_first_token> token,
+                                  std::size_t offset,const std::string& task_name, std::size_t prio)
         : boost::asynchronous::continuation_task<Iterator1>(task_name)
-        , beg1_(beg1),end1_(end1),count_(count),value_(value),func_(std::move(func)),cutoff_(cutoff),prio_(prio)
+        , beg1_(beg1),end1_(end1),count_(count),value_(value),func_(std::move(func)),cutoff_(cutoff)
+        , token_(std::move(token)),offset_(offset),prio_(prio)
     {}
 
     void operator()()
@@ -49,7 +53,21 @@ struct parallel_search_n_helper: public boost::asynchronous::continuation_task<I
             // if not at end, recurse, otherwise execute here
             if (it == end1_)
             {
-                task_res.set_value(std::search_n(beg1_,end1_,count_,value_,func_));
+                auto count = count_;
+                auto& value = value_;
+                auto& func = func_;
+                // a match starting in a subarray can use the next count - 1 elements
+                task_res.set_value(boost::asynchronous::detail::find_first_in_blocks(
+                                       beg1_,end1_,offset_,(count > 0 ? static_cast<std::size_t>(count) - 1 : 0),*token_,
+                                       [count,&value,&func](Iterator1 b, Iterator1 e)
+                                       {
+                                           return std::search_n(b,e,count,value,func);
+                                       }));
+            }
+            else if (token_->is_cancelled(offset_))
+            {
+                // a match was already found left of us
+                task_res.set_value(end1_);
             }
             else
             {
@@ -57,7 +75,7 @@ struct parallel_search_n_helper: public boost::asynchronous::continuation_task<I
                 auto end1 = end1_;
                 auto count = count_;
                 auto value = value_;
-                auto func = std::move(func_);
+                auto func = func_;
                 boost::asynchronous::create_callback_continuation_job<Job>(
                             // called when subtasks are done, set our result
                             [task_res,it,beg1,end1,count,value,func]
@@ -75,10 +93,9 @@ struct parallel_search_n_helper: public boost::asynchronous::continuation_task<I
                                     else
                                     {
                                         // check in overlap region
-                                        auto itbeg = beg1;
-                                        auto itend = it;
-                                        std::advance(itbeg, std::distance(beg1,it) - count);
-                                        std::advance(itend, count);
+                                        auto overlap = boost::asynchronous::detail::search_overlap_range(beg1,it,end1,count);
+                                        auto itbeg = overlap.first;
+                                        auto itend = overlap.second;
                                         auto itoverlap = std::search_n(itbeg,itend,count,value,func);
                                         if(itoverlap != itend)
                                         {
@@ -103,9 +120,10 @@ struct parallel_search_n_helper: public boost::asynchronous::continuation_task<I
                             },
                             // recursive tasks
                             parallel_search_n_helper<Iterator1,Size,T,Func,Job>
-                                    (beg1_,it,count_,value_,func_,cutoff_,this->get_name(),prio_),
+                                    (beg1_,it,count_,value_,func_,cutoff_,token_,offset_,this->get_name(),prio_),
                             parallel_search_n_helper<Iterator1,Size,T,Func,Job>
-                                    (it,end1_,count_,value_,func_,cutoff_,this->get_name(),prio_)
+                                    (it,end1_,count_,value_,func_,cutoff_,token_,offset_ + std::distance(beg1_,it),
+                                     this->get_name(),prio_)
                    );
             }
         }
@@ -121,6 +139,8 @@ struct parallel_search_n_helper: public boost::asynchronous::continuation_task<I
     T value_;
     Func func_;
     long cutoff_;
+    std::shared_ptr<boost::asynchronous::detail::find_first_token> token_;
+    std::size_t offset_;
     std::size_t prio_;
 };
 }
@@ -136,7 +156,8 @@ parallel_search_n(Iterator1 beg1,Iterator1 end1, Size count, const T& value,Func
 {
     return boost::asynchronous::top_level_callback_continuation_job<Iterator1,Job>
             (boost::asynchronous::detail::parallel_search_n_helper<Iterator1,Size,T,Func,Job>
-               (beg1,end1,count,value,std::move(func),cutoff,task_name,prio));
+               (beg1,end1,count,value,std::move(func),cutoff,
+                std::make_shared<boost::asynchronous::detail::find_first_token>(),0,task_name,prio));
 }
 
 template <class Iterator1, class Size, class T, class Job=BOOST_ASYNCHRONOUS_DEFAULT_JOB>
@@ -156,7 +177,8 @@ parallel_search_n(Iterator1 beg1,Iterator1 end1, Size count, const T& value,long
 
     return boost::asynchronous::top_level_callback_continuation_job<Iterator1,Job>
             (boost::asynchronous::detail::parallel_search_n_helper<Iterator1,Size,T,decltype(l),Job>
-               (beg1,end1,count,value,std::move(l),cutoff,task_name,prio));
+               (beg1,end1,count,value,std::move(l),cutoff,
+                std::make_shared<boost::asynchronous::detail::find_first_token>(),0,task_name,prio));
 }
 
 
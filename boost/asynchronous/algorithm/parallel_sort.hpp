@@ -35,6 +35,7 @@
 #include <boost/asynchronous/algorithm/detail/parallel_sort_helper.hpp>
 #include <boost/asynchronous/algorithm/parallel_placement.hpp>
 #include <boost/asynchronous/container/algorithms.hpp>
+#include <boost/asynchronous/helpers/scratch_memory_pool.hpp>
 
 #include <boost/range/begin.hpp>
 #include <boost/range/end.hpp>
@@ -274,12 +275,13 @@ struct parallel_sort_fast_helper: public boost::asynchronous::continuation_task<
     }
     else
     {
-        merge_memory_ = std::shared_ptr<char>(new char[size * sizeof(typename std::iterator_traits<Iterator>::value_type)],
-                                             [](char* p){delete[] p;});
+        merge_memory_ = boost::asynchronous::scratch_memory_pool::default_pool().allocate
+                (size * sizeof(typename std::iterator_traits<Iterator>::value_type));
     }
 #else
-    std::shared_ptr<char> merge_memory_(new char[size * sizeof(typename std::iterator_traits<Iterator>::value_type)],
-                                        [](char* p){delete[] p;});
+    // reused from one sort to the next, avoids page-faulting the buffer each time
+    std::shared_ptr<char> merge_memory_ = boost::asynchronous::scratch_memory_pool::default_pool().allocate
+            (size * sizeof(typename std::iterator_traits<Iterator>::value_type));
 #endif
 
 #ifdef BOOST_ASYNCHRONOUS_TIMING
@@ -0,0 +1,146 @@
+// Boost.Asynchronous library
+//  Copyright (C) Christophe Henry 2026
+//
+//  Use, modification and distribution is subject to the Boost
+//  Software License, Version 1.0.  (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// For more information, see http://www.boost.org
+#ifndef BOOST_ASYNCHRONOUS_PARALLEL_SPLIT_RECORDS_HPP
+#define BOOST_ASYNCHRONOUS_PARALLEL_SPLIT_RECORDS_HPP
+
+#include <cstring>
+#include <iterator>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include <boost/asynchronous/detail/any_interruptible.hpp>
+#include <boost/asynchronous/callable_any.hpp>
+#include <boost/asynchronous/detail/continuation_impl.hpp>
+#include <boost/asynchronous/continuation_task.hpp>
+#include <boost/asynchronous/post.hpp>
+#include <boost/asynchronous/detail/metafunctions.hpp>
+
+namespace boost { namespace asynchronous
+{
+namespace detail
+{
+// records of [beg,end), each one ending with delimiter (not included), except maybe the last one
+inline void split_records(const char* beg, const char* end, char delimiter, std::vector<std::string_view>& records)
+{
+    while (beg != end)
+    {
+        const char* found = static_cast<const char*>(std::memchr(beg,delimiter,static_cast<std::size_t>(end - beg)));
+        if (found == nullptr)
+        {
+            records.emplace_back(beg,static_cast<std::size_t>(end - beg));
+            return;
+        }
+        records.emplace_back(beg,static_cast<std::size_t>(found - beg));
+        beg = found + 1;
+    }
+}
+
+template <class Job>
+struct parallel_split_records_helper: public boost::asynchronous::continuation_task<std::vector<std::string_view>>
+{
+    parallel_split_records_helper(const char* beg, const char* end, char delimiter, long cutoff,
+                                  const std::string& task_name, std::size_t prio)
+        : boost::asynchronous::continuation_task<std::vector<std::string_view>>(task_name)
+        , beg_(beg),end_(end),delimiter_(delimiter),cutoff_(cutoff),prio_(prio)
+    {}
+
+    void operator()()
+    {
+        boost::asynchronous::continuation_result<std::vector<std::string_view>> task_res = this->this_task_result();
+        try
+        {
+            // cut in the middle, then move the cut just after the next delimiter so that no record crosses it
+            const char* it = end_;
+            if (end_ - beg_ > cutoff_)
+            {
+                const char* middle = beg_ + (end_ - beg_) / 2;
+                const char* found = static_cast<const char*>(std::memchr(middle,delimiter_,static_cast<std::size_t>(end_ - middle)));
+                it = (found == nullptr) ? end_ : found + 1;
+            }
+            // if not at end, recurse, otherwise execute here
+            if (it == end_)
+            {
+                std::vector<std::string_view> records;
+                boost::asynchronous::detail::split_records(beg_,end_,delimiter_,records);
+                task_res.set_value(std::move(records));
+            }
+            else
+            {
+                boost::asynchronous::create_callback_continuation_job<Job>(
+                            // called when subtasks are done, set our result
+                            [task_res]
+                            (std::tuple<boost::asynchronous::expected<std::vector<std::string_view>>,
+                                        boost::asynchronous::expected<std::vector<std::string_view>>> res) mutable
+                            {
+                                try
+                                {
+                                    std::vector<std::string_view> rt = std::move(std::get<0>(res).get());
+                                    std::vector<std::string_view> rt2 = std::move(std::get<1>(res).get());
+                                    rt.insert(rt.end(),rt2.begin(),rt2.end());
+                                    task_res.set_value(std::move(rt));
+                                }
+                                catch(...)
+                                {
+                                    task_res.set_exception(std::current_exception());
+                                }
+                            },
+                            // recursive tasks
+                            parallel_split_records_helper<Job>(beg_,it,delimiter_,cutoff_,this->get_name(),prio_),
+                            parallel_split_records_helper<Job>(it,end_,delimiter_,cutoff_,this->get_name(),prio_)
+                );
+            }
+        }
+        catch(...)
+        {
+            task_res.set_exception(std::current_exception());
+        }
+    }
+
+    const char* beg_;
+    const char* end_;
+    char delimiter_;
+    long cutoff_;
+    std::size_t prio_;
+};
+}
+
+// splits [beg,end) into records separated by delimiter (for example lines of a mapped_file).
+// cutoff is in bytes.
+// The returned views point into [beg,end), which must stay valid as long as the records are used.
+template <class Job=BOOST_ASYNCHRONOUS_DEFAULT_JOB>
+boost::asynchronous::detail::callback_continuation<std::vector<std::string_view>,Job>
+parallel_split_records(const char* beg, const char* end, char delimiter, long cutoff,
+#ifdef BOOST_ASYNCHRONOUS_REQUIRE_ALL_ARGUMENTS
+                       const std::string& task_name, std::size_t prio=0)
+#else
+                       const std::string& task_name="", std::size_t prio=0)
+#endif
+{
+    return boost::asynchronous::top_level_callback_continuation_job<std::vector<std::string_view>,Job>
+            (boost::asynchronous::detail::parallel_split_records_helper<Job>(beg,end,delimiter,cutoff,task_name,prio));
+}
+
+// version for contiguous ranges of char held only by reference (mapped_file, std::string, std::vector<char>, etc.)
+template <class Range, class Job=BOOST_ASYNCHRONOUS_DEFAULT_JOB>
+typename std::enable_if<!boost::asynchronous::detail::has_is_continuation_task<Range>::value,
+                        boost::asynchronous::detail::callback_continuation<std::vector<std::string_view>,Job> >::type
+parallel_split_records(Range const& range, char delimiter, long cutoff,
+#ifdef BOOST_ASYNCHRONOUS_REQUIRE_ALL_ARGUMENTS
+                       const std::string& task_name, std::size_t prio=0)
+#else
+                       const std::string& task_name="", std::size_t prio=0)
+#endif
+{
+    const char* beg = std::data(range);
+    return boost::asynchronous::parallel_split_records<Job>(beg,beg + std::size(range),delimiter,cutoff,task_name,prio);
+}
+
+}}
+#endif // BOOST_ASYNCHRONOUS_PARALLEL_SPLIT_RECORDS_HPP
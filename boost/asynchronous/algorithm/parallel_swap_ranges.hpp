@@ -16,6 +16,7 @@
 #include <boost/asynchronous/continuation_task.hpp>
 #include <boost/asynchronous/post.hpp>
 #include <boost/asynchronous/algorithm/detail/safe_advance.hpp>
+#include <boost/asynchronous/algorithm/detail/memory_leaves.hpp>
 #include <boost/asynchronous/detail/metafunctions.hpp>
 
 namespace boost { namespace asynchronous
@@ -39,7 +40,7 @@ struct parallel_swap_ranges_helper: public boost::asynchronous::continuation_tas
             Iterator1 it1 = boost::asynchronous::detail::find_cutoff(beg1_,cutoff_,end1_);
             if (it1 == end1_)
             {
-                task_res.set_value(std::swap_ranges(beg1_,end1_,beg2_));
+                task_res.set_value(boost::asynchronous::detail::swap_ranges_leaf(beg1_,end1_,beg2_));
             }
             else
             {
@@ -18,11 +18,14 @@
 
 #include <boost/asynchronous/exceptions.hpp>
 #include <boost/asynchronous/detail/metafunctions.hpp>
+#include <boost/asynchronous/detail/servant_epoch.hpp>
 
 // call_if_alive provides a protection for trackable_servant: check if the servant is still alive before calling it
 // (through a post_callback for example).
 // call_if_alive_exec provides an optimization: execute a task posted by a servant only if the servant is still alive.
 // This is done through use of a weak pointer to the servant.
+// call_if_epoch_alive is call_if_alive for callbacks executed in the servant thread: it checks an epoch_token of the servant,
+// which does not need reference counting if the servant lives in a single thread.
 
 namespace boost { namespace asynchronous
 {
@@ -112,6 +115,43 @@ struct call_if_alive<Func,T,void>
     std::weak_ptr<T> m_tracked;
 };
 
+template <class Func, class R>
+struct call_if_epoch_alive
+{
+    call_if_epoch_alive(Func f, boost::asynchronous::detail::epoch_token tracked):m_wrapped(std::move(f)),m_tracked(std::move(tracked)){}
+    call_if_epoch_alive(call_if_epoch_alive&& rhs)noexcept
+        : m_wrapped(std::move(rhs.m_wrapped))
+        , m_tracked(std::move(rhs.m_tracked))
+    {}
+    call_if_epoch_alive(call_if_epoch_alive const& rhs)noexcept
+        : m_wrapped(std::move(const_cast<call_if_epoch_alive&>(rhs).m_wrapped))
+        , m_tracked(std::move(const_cast<call_if_epoch_alive&>(rhs).m_tracked))
+    {}
+    call_if_epoch_alive& operator= (call_if_epoch_alive&& rhs)noexcept
+    {
+        std::swap(m_wrapped,rhs.m_wrapped);
+        std::swap(m_tracked,rhs.m_tracked);
+        return *this;
+    }
+    call_if_epoch_alive& operator= (call_if_epoch_alive const& rhs)noexcept
+    {
+        m_wrapped = std::move(const_cast<call_if_epoch_alive&>(rhs).m_wrapped);
+        m_tracked = std::move(const_cast<call_if_epoch_alive&>(rhs).m_tracked);
+        return *this;
+    }
+    template <typename... Arg>
+    R operator()(Arg... arg)
+    {
+        // call only if tracked object is alive
+        if (m_tracked.alive())
+            return m_wrapped(std::move(arg)...);
+        return R();
+    }
+
+    Func m_wrapped;
+    boost::asynchronous::detail::epoch_token m_tracked;
+};
+
 template <class Func, class T,class R,class Enable=void>
 struct call_if_alive_exec
 {
@@ -253,6 +293,12 @@ call_if_alive<F,T,R> check_alive(F const& func, std::weak_ptr<T> tracked)
 #endif
 
 
+template <class F, class R=void>
+call_if_epoch_alive<F,R> check_alive(F func, boost::asynchronous::detail::epoch_token tracked)
+{
+    return call_if_epoch_alive<F,R>(std::move(func),std::move(tracked));
+}
+
 #ifndef BOOST_NO_RVALUE_REFERENCES
 template <class F, class T>
 auto check_alive_before_exec(F func, std::shared_ptr<T> tracked) -> call_if_alive_exec<F,T,decltype(func())>
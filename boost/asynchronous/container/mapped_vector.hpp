@@ -0,0 +1,365 @@
+// Boost.Asynchronous library
+//  Copyright (C) Christophe Henry 2026
+//
+//  Use, modification and distribution is subject to the Boost
+//  Software License, Version 1.0.  (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// For more information, see http://www.boost.org
+
+#ifndef BOOST_ASYNCHRONOUS_CONTAINER_MAPPED_VECTOR_HPP
+#define BOOST_ASYNCHRONOUS_CONTAINER_MAPPED_VECTOR_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <ios>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <typeinfo>
+#include <utility>
+
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+#include <boost/asynchronous/algorithm/parallel_for.hpp>
+
+namespace boost { namespace asynchronous
+{
+enum class mapped_vector_mode
+{
+    // shared read-only mapping of the file
+    read_only,
+    // writable, changes are private to the process and never written back
+    copy_on_write,
+    // writable, changes are written back to the file
+    read_write
+};
+
+namespace detail
+{
+// file header, 64 bytes so that the data following it stays aligned
+struct mapped_vector_header
+{
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t header_size;
+    std::uint64_t size;
+    std::uint64_t element_size;
+    std::uint64_t type_hash;
+    char reserved[24];
+};
+static_assert(sizeof(mapped_vector_header) == 64,"mapped_vector_header must be 64 bytes");
+
+constexpr char mapped_vector_magic[8] = {'B','A','S','Y','N','V','E','C'};
+
+// identifies the element type. Stable for a given compiler, not across compilers
+template <class T>
+std::uint64_t mapped_vector_type_hash()
+{
+    // FNV-1a
+    std::uint64_t h = 14695981039346656037ull;
+    for (const char* c = typeid(T).name(); *c; ++c)
+    {
+        h = (h ^ static_cast<unsigned char>(*c)) * 1099511628211ull;
+    }
+    return (h ^ sizeof(T)) * 1099511628211ull;
+}
+
+// touches every page of the range so that the page faults are taken by the calling worker
+inline void mapped_vector_prefetch(const char* beg, const char* end)
+{
+    if (beg == end)
+    {
+        return;
+    }
+    const std::size_t page = boost::interprocess::mapped_region::get_page_size();
+    std::uintptr_t start = reinterpret_cast<std::uintptr_t>(beg) / page * page;
+    volatile char sink = 0;
+    for (std::uintptr_t p = start < reinterpret_cast<std::uintptr_t>(beg) ? start + page : start;
+         p < reinterpret_cast<std::uintptr_t>(end); p += page)
+    {
+        sink = sink + *reinterpret_cast<const volatile char*>(p);
+    }
+    // first page, possibly shared with the previous range or the header
+    sink = sink + *reinterpret_cast<const volatile char*>(beg);
+    (void)sink;
+}
+
+template <class T>
+struct mapped_vector_prefetch_range
+{
+    void operator()(const T* beg, const T* end) const
+    {
+        boost::asynchronous::detail::mapped_vector_prefetch(reinterpret_cast<const char*>(beg),
+                                                            reinterpret_cast<const char*>(end));
+    }
+};
+}
+
+// Vector of trivially copyable elements mapped from a file. Opening costs a mapping, pages are read on first access
+// (or ahead of time with prefetch/parallel_prefetch). begin()/end() are pointers, usable with all algorithms.
+// Files are written with save(). Without header, the whole file is the data.
+template <class T, boost::asynchronous::mapped_vector_mode Mode = boost::asynchronous::mapped_vector_mode::read_only>
+class mapped_vector
+{
+    static_assert(std::is_trivially_copyable<T>::value,"mapped_vector requires trivially copyable elements");
+    static_assert(alignof(T) <= sizeof(boost::asynchronous::detail::mapped_vector_header),"mapped_vector element alignment too big");
+public:
+    typedef std::size_t                 size_type;
+    typedef T                           value_type;
+    typedef typename std::conditional<Mode == boost::asynchronous::mapped_vector_mode::read_only,const T,T>::type element_type;
+    typedef element_type*               iterator;
+    typedef const T*                    const_iterator;
+    typedef element_type&               reference;
+    typedef T const&                    const_reference;
+    typedef element_type*               pointer;
+    typedef const T*                    const_pointer;
+
+    mapped_vector() noexcept = default;
+    // maps the file. Throws std::system_error (std::filesystem::filesystem_error) if the file cannot be found,
+    // boost::interprocess::interprocess_exception if it cannot be mapped, std::runtime_error if the header
+    // does not match T, or without header if the file size is not a multiple of sizeof(T)
+    explicit mapped_vector(std::string const& path, bool with_header = true,
+                           std::uint64_t type_hash = boost::asynchronous::detail::mapped_vector_type_hash<T>())
+    {
+        const std::size_t file_size = static_cast<std::size_t>(std::filesystem::file_size(path));
+        // an empty file cannot be mapped
+        if (file_size != 0)
+        {
+            const boost::interprocess::mode_t file_mode =
+                    (Mode == boost::asynchronous::mapped_vector_mode::read_write) ? boost::interprocess::read_write
+                                                                                   : boost::interprocess::read_only;
+            const boost::interprocess::mode_t region_mode =
+                    (Mode == boost::asynchronous::mapped_vector_mode::read_only)     ? boost::interprocess::read_only :
+                    (Mode == boost::asynchronous::mapped_vector_mode::copy_on_write) ? boost::interprocess::copy_on_write
+                                                                                      : boost::interprocess::read_write;
+            // the region stays valid after the file mapping is gone
+            boost::interprocess::file_mapping mapping(path.c_str(),file_mode);
+            m_region = boost::interprocess::mapped_region(mapping,region_mode,0,file_size);
+        }
+        char* mapping = static_cast<char*>(m_region.get_address());
+
+        std::size_t offset = 0;
+        if (with_header)
+        {
+            boost::asynchronous::detail::mapped_vector_header header;
+            if (file_size < sizeof(header))
+            {
+                throw std::runtime_error("mapped_vector: no header in " + path);
+            }
+            std::memcpy(&header,mapping,sizeof(header));
+            if (std::memcmp(header.magic,boost::asynchronous::detail::mapped_vector_magic,sizeof(header.magic)) != 0 ||
+                header.element_size != sizeof(T) || header.type_hash != type_hash ||
+                header.header_size < sizeof(header) || header.header_size > file_size || header.header_size % alignof(T) != 0 ||
+                header.size > (file_size - header.header_size) / sizeof(T))
+            {
+                throw std::runtime_error("mapped_vector: header of " + path + " does not match element type or file size");
+            }
+            offset = header.header_size;
+            m_size = static_cast<size_type>(header.size);
+        }
+        else
+        {
+            // nothing tells the element type, at least the size must match
+            if (file_size % sizeof(T) != 0)
+            {
+                throw std::runtime_error("mapped_vector: size of " + path + " is not a multiple of the element size");
+            }
+            m_size = file_size / sizeof(T);
+        }
+        m_data = reinterpret_cast<element_type*>(mapping + offset);
+    }
+    mapped_vector(mapped_vector&& rhs) noexcept
+        : m_region(std::move(rhs.m_region))
+        , m_data(std::exchange(rhs.m_data,nullptr))
+        , m_size(std::exchange(rhs.m_size,0))
+    {}
+    mapped_vector& operator=(mapped_vector&& rhs) noexcept
+    {
+        if (this != &rhs)
+        {
+            m_region = std::move(rhs.m_region);
+            m_data = std::exchange(rhs.m_data,nullptr);
+            m_size = std::exchange(rhs.m_size,0);
+        }
+        return *this;
+    }
+    mapped_vector(mapped_vector const&) = delete;
+    mapped_vector& operator=(mapped_vector const&) = delete;
+
+    // writes [first,last) to a file which can then be mapped. Throws std::system_error if the file cannot be written
+    template <class InputIt>
+    static void save(std::string const& path, InputIt first, InputIt last, bool with_header = true,
+                     std::uint64_t type_hash = boost::asynchronous::detail::mapped_vector_type_hash<T>())
+    {
+        std::ofstream out(path,std::ios::binary | std::ios::trunc);
+        auto check = [&out,&path]()
+        {
+            if (!out)
+            {
+                throw std::system_error(std::make_error_code(std::io_errc::stream),"mapped_vector: cannot write " + path);
+            }
+        };
+        check();
+        if (with_header)
+        {
+            // placeholder, size is known at the end
+            boost::asynchronous::detail::mapped_vector_header header{};
+            out.write(reinterpret_cast<const char*>(&header),sizeof(header));
+        }
+        // buffered, InputIt might not be contiguous
+        const std::size_t buffer_elements = std::max<std::size_t>(1,65536 / sizeof(T));
+        std::unique_ptr<char[]> buffer(new char[buffer_elements * sizeof(T)]);
+        std::size_t in_buffer = 0;
+        std::uint64_t count = 0;
+        for (; first != last; ++first)
+        {
+            T const& value = *first;
+            std::memcpy(buffer.get() + in_buffer * sizeof(T),&value,sizeof(T));
+            ++count;
+            if (++in_buffer == buffer_elements)
+            {
+                out.write(buffer.get(),static_cast<std::streamsize>(in_buffer * sizeof(T)));
+                check();
+                in_buffer = 0;
+            }
+        }
+        out.write(buffer.get(),static_cast<std::streamsize>(in_buffer * sizeof(T)));
+        if (with_header)
+        {
+            boost::asynchronous::detail::mapped_vector_header header{};
+            std::memcpy(header.magic,boost::asynchronous::detail::mapped_vector_magic,sizeof(header.magic));
+            header.version = 1;
+            header.header_size = sizeof(header);
+            header.size = count;
+            header.element_size = sizeof(T);
+            header.type_hash = type_hash;
+            out.seekp(0);
+            out.write(reinterpret_cast<const char*>(&header),sizeof(header));
+        }
+        out.close();
+        check();
+    }
+
+    iterator begin() noexcept
+    {
+        return m_data;
+    }
+    iterator end() noexcept
+    {
+        return m_data + m_size;
+    }
+    const_iterator begin() const noexcept
+    {
+        return m_data;
+    }
+    const_iterator end() const noexcept
+    {
+        return m_data + m_size;
+    }
+    const_iterator cbegin() const noexcept
+    {
+        return m_data;
+    }
+    const_iterator cend() const noexcept
+    {
+        return m_data + m_size;
+    }
+    pointer data() noexcept
+    {
+        return m_data;
+    }
+    const_pointer data() const noexcept
+    {
+        return m_data;
+    }
+    reference operator[](size_type n)
+    {
+        return m_data[n];
+    }
+    const_reference operator[](size_type n) const
+    {
+        return m_data[n];
+    }
+    reference at(size_type n)
+    {
+        if (n >= m_size)
+        {
+            throw std::out_of_range("boost::asynchronous::mapped_vector::at");
+        }
+        return m_data[n];
+    }
+    const_reference at(size_type n) const
+    {
+        if (n >= m_size)
+        {
+            throw std::out_of_range("boost::asynchronous::mapped_vector::at");
+        }
+        return m_data[n];
+    }
+    size_type size() const noexcept
+    {
+        return m_size;
+    }
+    bool empty() const noexcept
+    {
+        return m_size == 0;
+    }
+
+    // tells the system that the whole file will be needed soon, returns at once
+    void advise_willneed() const
+    {
+        if (m_region.get_size() != 0)
+        {
+            m_region.advise(boost::interprocess::mapped_region::advice_willneed);
+        }
+    }
+    // reads the whole data in the calling thread. See parallel_prefetch to share the work between workers
+    void prefetch() const
+    {
+        advise_willneed();
+        boost::asynchronous::detail::mapped_vector_prefetch(reinterpret_cast<const char*>(begin()),
+                                                            reinterpret_cast<const char*>(end()));
+    }
+    // with read_write, writes changes back to the file, waiting for completion
+    void sync() const
+    {
+        if (Mode == boost::asynchronous::mapped_vector_mode::read_write && m_region.get_size() != 0 &&
+            !m_region.flush(0,0,false))
+        {
+            throw std::runtime_error("mapped_vector: flush failed");
+        }
+    }
+
+private:
+    // advise and flush do not change the mapping
+    mutable boost::interprocess::mapped_region m_region;
+    element_type* m_data = nullptr;
+    size_type m_size = 0;
+};
+
+// reads the pages of a mapped_vector ahead, cutoff elements per task. The vector must outlive the continuation
+template <class T, boost::asynchronous::mapped_vector_mode Mode, class Job=BOOST_ASYNCHRONOUS_DEFAULT_JOB>
+boost::asynchronous::detail::callback_continuation<void,Job>
+parallel_prefetch(boost::asynchronous::mapped_vector<T,Mode> const& v, long cutoff,
+#ifdef BOOST_ASYNCHRONOUS_REQUIRE_ALL_ARGUMENTS
+                  const std::string& task_name, std::size_t prio)
+#else
+                  const std::string& task_name="", std::size_t prio=0)
+#endif
+{
+    v.advise_willneed();
+    return boost::asynchronous::parallel_for<const T*,boost::asynchronous::detail::mapped_vector_prefetch_range<T>,Job>(
+                v.begin(),v.end(),boost::asynchronous::detail::mapped_vector_prefetch_range<T>(),
+                cutoff,task_name,prio);
+}
+
+}}
+#endif // BOOST_ASYNCHRONOUS_CONTAINER_MAPPED_VECTOR_HPP
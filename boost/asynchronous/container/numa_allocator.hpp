@@ -0,0 +1,238 @@
+// Boost.Asynchronous library
+//  Copyright (C) Christophe Henry 2026
+//
+//  Use, modification and distribution is subject to the Boost
+//  Software License, Version 1.0.  (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// For more information, see http://www.boost.org
+
+#ifndef BOOST_ASYNCHRONOUS_CONTAINER_NUMA_ALLOCATOR_HPP
+#define BOOST_ASYNCHRONOUS_CONTAINER_NUMA_ALLOCATOR_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <fstream>
+#include <memory>
+#include <new>
+#include <string>
+#include <vector>
+
+#if defined(__linux__) && !defined(BOOST_ASYNCHRONOUS_NO_NUMA)
+#define BOOST_ASYNCHRONOUS_LINUX_NUMA
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <linux/mempolicy.h>
+#endif
+
+// An allocator placing the pages of big allocations on NUMA nodes, for use with asynchronous::vector.
+// Placement is set with mbind before the pages are touched, so it does not depend on which worker
+// of the threadpool runs the constructors.
+// No dependency on libnuma: the system call is used directly. On other systems, or with
+// BOOST_ASYNCHRONOUS_NO_NUMA, it is a std::allocator.
+namespace boost { namespace asynchronous
+{
+enum class numa_policy
+{
+    // no placement, first touch decides
+    none,
+    // pages are distributed round-robin on all nodes
+    interleave,
+    // the range is cut in one contiguous chunk per node, the way parallel algorithms cut it
+    node_local
+};
+
+namespace detail
+{
+// number of nodes, as the highest online node + 1, read once
+inline unsigned int numa_node_count()
+{
+    static const unsigned int nodes = []()
+    {
+        unsigned int res = 1;
+#ifdef BOOST_ASYNCHRONOUS_LINUX_NUMA
+        // format is for example "0-1" or "0,2-3"
+        std::ifstream online("/sys/devices/system/node/online");
+        std::string line;
+        if (online && std::getline(online,line))
+        {
+            std::string number;
+            for (char c : line + ",")
+            {
+                if (c >= '0' && c <= '9')
+                {
+                    number += c;
+                }
+                else if (!number.empty())
+                {
+                    res = std::max(res,static_cast<unsigned int>(std::stoul(number)) + 1);
+                    number.clear();
+                }
+            }
+        }
+#endif
+        // one unsigned long as node mask
+        return std::min(res,static_cast<unsigned int>(sizeof(unsigned long) * 8 - 1));
+    }();
+    return nodes;
+}
+
+// boundaries of the chunks obtained by cutting [beg,end) in 2, depth times, as find_cutoff does
+inline void numa_halving_bounds(std::size_t beg, std::size_t end, unsigned int depth, std::vector<std::size_t>& bounds)
+{
+    if (depth == 0)
+    {
+        bounds.push_back(end);
+        return;
+    }
+    std::size_t middle = beg + (end - beg) / 2;
+    boost::asynchronous::detail::numa_halving_bounds(beg,middle,depth - 1,bounds);
+    boost::asynchronous::detail::numa_halving_bounds(middle,end,depth - 1,bounds);
+}
+
+#ifdef BOOST_ASYNCHRONOUS_LINUX_NUMA
+inline std::size_t numa_page_size()
+{
+    static const std::size_t page = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+    return page;
+}
+
+inline void numa_mbind(char* addr, std::size_t bytes, int mode, unsigned long mask)
+{
+    if (bytes == 0)
+    {
+        return;
+    }
+    // placement is only a hint, a kernel without NUMA support returns an error which we ignore
+    ::syscall(SYS_mbind,addr,bytes,mode,&mask,sizeof(unsigned long) * 8,0);
+}
+
+// applies the policy to a page-aligned memory area of elements of the given size
+inline void numa_place(char* data, std::size_t n, std::size_t element_size, boost::asynchronous::numa_policy policy)
+{
+    unsigned int nodes = boost::asynchronous::detail::numa_node_count();
+    if (policy == boost::asynchronous::numa_policy::interleave)
+    {
+        unsigned long mask = (nodes >= sizeof(unsigned long) * 8) ? ~0UL : ((1UL << nodes) - 1);
+        boost::asynchronous::detail::numa_mbind(data,n * element_size,MPOL_INTERLEAVE,mask);
+    }
+    else if (policy == boost::asynchronous::numa_policy::node_local)
+    {
+        // cut as the algorithms will, until we have at least one chunk per node
+        unsigned int depth = 0;
+        while ((1u << depth) < nodes)
+        {
+            ++depth;
+        }
+        std::vector<std::size_t> bounds(1,0);
+        boost::asynchronous::detail::numa_halving_bounds(0,n,depth,bounds);
+        const std::size_t page = boost::asynchronous::detail::numa_page_size();
+        const std::size_t chunks = bounds.size() - 1;
+        for (std::size_t i = 0; i < chunks; ++i)
+        {
+            // a page shared by two chunks goes to the first one
+            std::size_t first = (bounds[i] * element_size + page - 1) / page * page;
+            std::size_t last = (i + 1 == chunks) ? n * element_size : (bounds[i + 1] * element_size + page - 1) / page * page;
+            if (i == 0)
+            {
+                first = 0;
+            }
+            if (last <= first)
+            {
+                continue;
+            }
+            // preferred and not bind: if a node is full, memory comes from another one
+            unsigned long node = static_cast<unsigned long>(i * nodes / chunks);
+            boost::asynchronous::detail::numa_mbind(data + first,last - first,MPOL_PREFERRED,1UL << node);
+        }
+    }
+}
+#endif
+}
+
+template <class T>
+class numa_allocator
+{
+public:
+    typedef T value_type;
+
+    // below this size, memory comes from std::allocator: not worth a mapping of its own
+#ifdef BOOST_ASYNCHRONOUS_NUMA_ALLOCATOR_MIN_BYTES
+    static constexpr std::size_t min_bytes = BOOST_ASYNCHRONOUS_NUMA_ALLOCATOR_MIN_BYTES;
+#else
+    static constexpr std::size_t min_bytes = 1024 * 1024;
+#endif
+
+    explicit numa_allocator(boost::asynchronous::numa_policy policy = boost::asynchronous::numa_policy::interleave) noexcept
+        : m_policy(policy)
+    {}
+    template <class U>
+    numa_allocator(numa_allocator<U> const& rhs) noexcept
+        : m_policy(rhs.policy())
+    {}
+
+    boost::asynchronous::numa_policy policy() const noexcept
+    {
+        return m_policy;
+    }
+
+    T* allocate(std::size_t n)
+    {
+        if (!mapped(n))
+        {
+            return std::allocator<T>().allocate(n);
+        }
+#ifdef BOOST_ASYNCHRONOUS_LINUX_NUMA
+        void* p = ::mmap(nullptr,n * sizeof(T),PROT_READ | PROT_WRITE,MAP_PRIVATE | MAP_ANONYMOUS,-1,0);
+        if (p == MAP_FAILED)
+        {
+            throw std::bad_alloc();
+        }
+        // nothing is touched yet, the policy decides where pages go on first write
+        boost::asynchronous::detail::numa_place(static_cast<char*>(p),n,sizeof(T),m_policy);
+        return static_cast<T*>(p);
+#else
+        return nullptr;
+#endif
+    }
+    void deallocate(T* p, std::size_t n) noexcept
+    {
+        if (!mapped(n))
+        {
+            std::allocator<T>().deallocate(p,n);
+            return;
+        }
+#ifdef BOOST_ASYNCHRONOUS_LINUX_NUMA
+        ::munmap(p,n * sizeof(T));
+#endif
+    }
+
+private:
+    // same answer for allocate and deallocate of the same size
+    bool mapped(std::size_t n) const noexcept
+    {
+#ifdef BOOST_ASYNCHRONOUS_LINUX_NUMA
+        return m_policy != boost::asynchronous::numa_policy::none && n * sizeof(T) >= min_bytes;
+#else
+        (void)n;
+        return false;
+#endif
+    }
+
+    boost::asynchronous::numa_policy m_policy;
+};
+
+template <class T, class U>
+bool operator==(numa_allocator<T> const& lhs, numa_allocator<U> const& rhs) noexcept
+{
+    return lhs.policy() == rhs.policy();
+}
+template <class T, class U>
+bool operator!=(numa_allocator<T> const& lhs, numa_allocator<U> const& rhs) noexcept
+{
+    return !(lhs == rhs);
+}
+
+}}
+#endif // BOOST_ASYNCHRONOUS_CONTAINER_NUMA_ALLOCATOR_HPP
@@ -0,0 +1,626 @@
+// Boost.Asynchronous library
+//  Copyright (C) Christophe Henry 2026
+//
+//  Use, modification and distribution is subject to the Boost
+//  Software License, Version 1.0.  (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// For more information, see http://www.boost.org
+
+#ifndef BOOST_ASYNCHRONOUS_CONTAINER_SEGMENTED_VECTOR_HPP
+#define BOOST_ASYNCHRONOUS_CONTAINER_SEGMENTED_VECTOR_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+namespace boost { namespace asynchronous
+{
+// A vector made of segments which never move: segment 0 has first_segment_size elements,
+// segment k>0 has first_segment_size * 2^(k-1), so that segment k starts at first_segment_size * 2^(k-1).
+// Growing allocates a new segment instead of reallocating and moving everything, and
+// push_back / emplace_back / grow_by can be called concurrently from many threads, lock-free if T is
+// nothrow default constructible, otherwise serialized by a mutex.
+// Other members (clear, reserve, copy, destruction) must not run concurrently with anything else.
+// Elements are counted in size() once constructed, in the order their slots were reserved.
+// If a constructor throws, the elements built by the call are destroyed and the exception is rethrown. The slots
+// are given back, unless other threads reserved slots after them in the meantime, in which case they hold
+// value-initialized elements.
+// Iterators are random access. Parallel algorithms cut ranges at segment boundaries (see find_cutoff),
+// so that each task works on memory of one segment.
+template <class T, class Alloc = std::allocator<T>>
+class segmented_vector;
+
+namespace detail
+{
+template <class T, class Alloc, bool Const>
+class segmented_vector_iterator
+{
+    typedef typename std::conditional<Const,
+                                      boost::asynchronous::segmented_vector<T,Alloc> const,
+                                      boost::asynchronous::segmented_vector<T,Alloc>>::type container_type;
+public:
+    typedef std::random_access_iterator_tag                 iterator_category;
+    typedef T                                               value_type;
+    typedef std::ptrdiff_t                                  difference_type;
+    typedef typename std::conditional<Const,T const*,T*>::type pointer;
+    typedef typename std::conditional<Const,T const&,T&>::type reference;
+
+    segmented_vector_iterator() noexcept = default;
+    segmented_vector_iterator(container_type* v, std::size_t index) noexcept
+        : v_(v),index_(index)
+    {}
+    // iterator => const_iterator
+    template <bool OtherConst, class = typename std::enable_if<Const && !OtherConst>::type>
+    segmented_vector_iterator(segmented_vector_iterator<T,Alloc,OtherConst> const& rhs) noexcept
+        : v_(rhs.container()),index_(rhs.index())
+    {}
+
+    reference operator*() const
+    {
+        return (*v_)[index_];
+    }
+    pointer operator->() const
+    {
+        return std::addressof((*v_)[index_]);
+    }
+    reference operator[](difference_type n) const
+    {
+        return (*v_)[index_ + n];
+    }
+    segmented_vector_iterator& operator++() noexcept
+    {
+        ++index_;
+        return *this;
+    }
+    segmented_vector_iterator operator++(int) noexcept
+    {
+        segmented_vector_iterator res(*this);
+        ++index_;
+        return res;
+    }
+    segmented_vector_iterator& operator--() noexcept
+    {
+        --index_;
+        return *this;
+    }
+    segmented_vector_iterator operator--(int) noexcept
+    {
+        segmented_vector_iterator res(*this);
+        --index_;
+        return res;
+    }
+    segmented_vector_iterator& operator+=(difference_type n) noexcept
+    {
+        index_ += n;
+        return *this;
+    }
+    segmented_vector_iterator& operator-=(difference_type n) noexcept
+    {
+        index_ -= n;
+        return *this;
+    }
+    friend segmented_vector_iterator operator+(segmented_vector_iterator it, difference_type n) noexcept
+    {
+        return it += n;
+    }
+    friend segmented_vector_iterator operator+(difference_type n, segmented_vector_iterator it) noexcept
+    {
+        return it += n;
+    }
+    friend segmented_vector_iterator operator-(segmented_vector_iterator it, difference_type n) noexcept
+    {
+        return it -= n;
+    }
+    friend difference_type operator-(segmented_vector_iterator const& lhs, segmented_vector_iterator const& rhs) noexcept
+    {
+        return static_cast<difference_type>(lhs.index_) - static_cast<difference_type>(rhs.index_);
+    }
+    friend bool operator==(segmented_vector_iterator const& lhs, segmented_vector_iterator const& rhs) noexcept
+    {
+        return lhs.index_ == rhs.index_;
+    }
+    friend bool operator!=(segmented_vector_iterator const& lhs, segmented_vector_iterator const& rhs) noexcept
+    {
+        return lhs.index_ != rhs.index_;
+    }
+    friend bool operator<(segmented_vector_iterator const& lhs, segmented_vector_iterator const& rhs) noexcept
+    {
+        return lhs.index_ < rhs.index_;
+    }
+    friend bool operator>(segmented_vector_iterator const& lhs, segmented_vector_iterator const& rhs) noexcept
+    {
+        return lhs.index_ > rhs.index_;
+    }
+    friend bool operator<=(segmented_vector_iterator const& lhs, segmented_vector_iterator const& rhs) noexcept
+    {
+        return lhs.index_ <= rhs.index_;
+    }
+    friend bool operator>=(segmented_vector_iterator const& lhs, segmented_vector_iterator const& rhs) noexcept
+    {
+        return lhs.index_ >= rhs.index_;
+    }
+
+    // used by find_cutoff: the segment boundary in (*this,end) closest to the middle, or the middle if none
+    segmented_vector_iterator cutoff_hint(segmented_vector_iterator const& end) const noexcept
+    {
+        std::size_t middle = index_ + (end.index_ - index_) / 2;
+        std::size_t best = middle;
+        std::size_t best_distance = static_cast<std::size_t>(-1);
+        std::size_t first_segment = v_->segment_of(index_) + 1;
+        std::size_t last_segment = v_->segment_of(end.index_ - 1);
+        for (std::size_t k = first_segment; k <= last_segment; ++k)
+        {
+            std::size_t boundary = v_->segment_start(k);
+            std::size_t distance = boundary > middle ? boundary - middle : middle - boundary;
+            if (distance < best_distance)
+            {
+                best = boundary;
+                best_distance = distance;
+            }
+        }
+        return segmented_vector_iterator(v_,best);
+    }
+
+    container_type* container() const noexcept
+    {
+        return v_;
+    }
+    std::size_t index() const noexcept
+    {
+        return index_;
+    }
+
+private:
+    container_type* v_ = nullptr;
+    std::size_t index_ = 0;
+};
+}
+
+template <class T, class Alloc>
+class segmented_vector
+{
+    typedef std::allocator_traits<Alloc> alloc_traits;
+public:
+    typedef T                   value_type;
+    typedef std::size_t         size_type;
+    typedef std::ptrdiff_t      difference_type;
+    typedef T&                  reference;
+    typedef T const&            const_reference;
+    typedef T*                  pointer;
+    typedef T const*            const_pointer;
+    typedef Alloc               allocator_type;
+    typedef boost::asynchronous::detail::segmented_vector_iterator<T,Alloc,false> iterator;
+    typedef boost::asynchronous::detail::segmented_vector_iterator<T,Alloc,true>  const_iterator;
+    typedef std::reverse_iterator<iterator>         reverse_iterator;
+    typedef std::reverse_iterator<const_iterator>   const_reverse_iterator;
+
+    enum { default_first_segment_size = 1024 };
+    // enough for any size_t index
+    enum { max_segments = 64 };
+
+    // first_segment_size is rounded up to a power of 2
+    explicit segmented_vector(size_type first_segment_size = default_first_segment_size, Alloc const& alloc = Alloc())
+        : m_first_segment_log(std::bit_width(std::max<size_type>(first_segment_size,1) - 1))
+        , m_allocator(alloc)
+    {
+        for (auto& s : m_segments)
+        {
+            s.store(nullptr,std::memory_order_relaxed);
+        }
+    }
+    segmented_vector(size_type n, T const& value, size_type first_segment_size = default_first_segment_size, Alloc const& alloc = Alloc())
+        : segmented_vector(first_segment_size,alloc)
+    {
+        grow_by(n,value);
+    }
+    segmented_vector(std::initializer_list<T> init, size_type first_segment_size = default_first_segment_size, Alloc const& alloc = Alloc())
+        : segmented_vector(first_segment_size,alloc)
+    {
+        for (auto const& v : init)
+        {
+            push_back(v);
+        }
+    }
+    segmented_vector(segmented_vector const& rhs)
+        : segmented_vector(rhs.first_segment_size(),alloc_traits::select_on_container_copy_construction(rhs.m_allocator))
+    {
+        reserve(rhs.size());
+        for (auto const& v : rhs)
+        {
+            push_back(v);
+        }
+    }
+    segmented_vector(segmented_vector&& rhs) noexcept
+        : m_first_segment_log(rhs.m_first_segment_log)
+        , m_allocator(std::move(rhs.m_allocator))
+    {
+        m_size.store(rhs.m_size.load(std::memory_order_relaxed),std::memory_order_relaxed);
+        m_reserved.store(rhs.m_reserved.load(std::memory_order_relaxed),std::memory_order_relaxed);
+        rhs.m_size.store(0,std::memory_order_relaxed);
+        rhs.m_reserved.store(0,std::memory_order_relaxed);
+        for (size_type k = 0; k < max_segments; ++k)
+        {
+            m_segments[k].store(rhs.m_segments[k].load(std::memory_order_relaxed),std::memory_order_relaxed);
+            rhs.m_segments[k].store(nullptr,std::memory_order_relaxed);
+        }
+    }
+    segmented_vector& operator=(segmented_vector rhs) noexcept
+    {
+        swap(rhs);
+        return *this;
+    }
+    ~segmented_vector()
+    {
+        clear();
+        for (size_type k = 0; k < max_segments; ++k)
+        {
+            T* s = m_segments[k].load(std::memory_order_relaxed);
+            if (s != nullptr)
+            {
+                alloc_traits::deallocate(m_allocator,s,segment_size(k));
+            }
+        }
+    }
+
+    void swap(segmented_vector& rhs) noexcept
+    {
+        std::swap(m_first_segment_log,rhs.m_first_segment_log);
+        std::swap(m_allocator,rhs.m_allocator);
+        size_type s = m_size.load(std::memory_order_relaxed);
+        m_size.store(rhs.m_size.load(std::memory_order_relaxed),std::memory_order_relaxed);
+        rhs.m_size.store(s,std::memory_order_relaxed);
+        s = m_reserved.load(std::memory_order_relaxed);
+        m_reserved.store(rhs.m_reserved.load(std::memory_order_relaxed),std::memory_order_relaxed);
+        rhs.m_reserved.store(s,std::memory_order_relaxed);
+        for (size_type k = 0; k < max_segments; ++k)
+        {
+            T* p = m_segments[k].load(std::memory_order_relaxed);
+            m_segments[k].store(rhs.m_segments[k].load(std::memory_order_relaxed),std::memory_order_relaxed);
+            rhs.m_segments[k].store(p,std::memory_order_relaxed);
+        }
+    }
+
+    // concurrent growth
+    iterator push_back(T const& value)
+    {
+        return emplace_back(value);
+    }
+    iterator push_back(T&& value)
+    {
+        return emplace_back(std::move(value));
+    }
+    template <class... Args>
+    iterator emplace_back(Args&&... args)
+    {
+        return grow_with(1,[&](size_type index)
+        {
+            alloc_traits::construct(m_allocator,std::addressof((*this)[index]),std::forward<Args>(args)...);
+        });
+    }
+    // appends n copies of value, returns an iterator to the first one
+    iterator grow_by(size_type n, T const& value = T())
+    {
+        return grow_with(n,[&](size_type index)
+        {
+            alloc_traits::construct(m_allocator,std::addressof((*this)[index]),value);
+        });
+    }
+    template <class InputIt, class = typename std::enable_if<!std::is_integral<InputIt>::value>::type>
+    iterator grow_by(InputIt first, InputIt last)
+    {
+        size_type n = static_cast<size_type>(std::distance(first,last));
+        // called in index order
+        return grow_with(n,[&](size_type index)
+        {
+            alloc_traits::construct(m_allocator,std::addressof((*this)[index]),*first);
+            ++first;
+        });
+    }
+
+    // not concurrent
+    void reserve(size_type n)
+    {
+        allocate_segments(0,n);
+    }
+    // destroys all elements, keeps the segments
+    void clear() noexcept
+    {
+        destroy(0,m_size.load(std::memory_order_relaxed));
+        m_size.store(0,std::memory_order_relaxed);
+        m_reserved.store(0,std::memory_order_relaxed);
+    }
+
+    // number of constructed elements. Elements other threads are still constructing are not counted
+    size_type size() const noexcept
+    {
+        return m_size.load(std::memory_order_acquire);
+    }
+    bool empty() const noexcept
+    {
+        return size() == 0;
+    }
+    // number of elements which fit in the allocated segments
+    size_type capacity() const noexcept
+    {
+        size_type k = 0;
+        while (k < max_segments && m_segments[k].load(std::memory_order_acquire) != nullptr)
+        {
+            ++k;
+        }
+        return k == 0 ? 0 : segment_start(k - 1) + segment_size(k - 1);
+    }
+    size_type max_size() const noexcept
+    {
+        return alloc_traits::max_size(m_allocator);
+    }
+    allocator_type get_allocator() const
+    {
+        return m_allocator;
+    }
+
+    reference operator[](size_type index)
+    {
+        size_type k = segment_of(index);
+        return m_segments[k].load(std::memory_order_acquire)[index - segment_start(k)];
+    }
+    const_reference operator[](size_type index) const
+    {
+        size_type k = segment_of(index);
+        return m_segments[k].load(std::memory_order_acquire)[index - segment_start(k)];
+    }
+    reference at(size_type index)
+    {
+        if (index >= size())
+        {
+            throw std::out_of_range("segmented_vector::at");
+        }
+        return (*this)[index];
+    }
+    const_reference at(size_type index) const
+    {
+        if (index >= size())
+        {
+            throw std::out_of_range("segmented_vector::at");
+        }
+        return (*this)[index];
+    }
+    reference front()
+    {
+        return (*this)[0];
+    }
+    const_reference front() const
+    {
+        return (*this)[0];
+    }
+    reference back()
+    {
+        return (*this)[size() - 1];
+    }
+    const_reference back() const
+    {
+        return (*this)[size() - 1];
+    }
+
+    iterator begin() noexcept
+    {
+        return iterator(this,0);
+    }
+    iterator end() noexcept
+    {
+        return iterator(this,size());
+    }
+    const_iterator begin() const noexcept
+    {
+        return const_iterator(this,0);
+    }
+    const_iterator end() const noexcept
+    {
+        return const_iterator(this,size());
+    }
+    const_iterator cbegin() const noexcept
+    {
+        return begin();
+    }
+    const_iterator cend() const noexcept
+    {
+        return end();
+    }
+    reverse_iterator rbegin() noexcept
+    {
+        return reverse_iterator(end());
+    }
+    reverse_iterator rend() noexcept
+    {
+        return reverse_iterator(begin());
+    }
+    const_reverse_iterator rbegin() const noexcept
+    {
+        return const_reverse_iterator(end());
+    }
+    const_reverse_iterator rend() const noexcept
+    {
+        return const_reverse_iterator(begin());
+    }
+
+    // segment table
+    size_type first_segment_size() const noexcept
+    {
+        return size_type(1) << m_first_segment_log;
+    }
+    size_type segment_of(size_type index) const noexcept
+    {
+        return static_cast<size_type>(std::bit_width(index >> m_first_segment_log));
+    }
+    size_type segment_start(size_type k) const noexcept
+    {
+        return k == 0 ? 0 : (size_type(1) << (m_first_segment_log + k - 1));
+    }
+    size_type segment_size(size_type k) const noexcept
+    {
+        return k == 0 ? first_segment_size() : segment_start(k);
+    }
+    // number of segments holding elements
+    size_type segment_count() const noexcept
+    {
+        size_type n = size();
+        return n == 0 ? 0 : segment_of(n - 1) + 1;
+    }
+    // contiguous memory of the elements of segment k
+    T* segment_data(size_type k) noexcept
+    {
+        return m_segments[k].load(std::memory_order_acquire);
+    }
+    T const* segment_data(size_type k) const noexcept
+    {
+        return m_segments[k].load(std::memory_order_acquire);
+    }
+
+private:
+    // a slot whose construction failed can be filled if other threads reserved after it
+    static constexpr bool lock_free_growth = std::is_nothrow_default_constructible<T>::value;
+
+    // reserves n slots, constructs them in index order with construct_at(index) and counts them in size()
+    template <class Construct>
+    iterator grow_with(size_type n, Construct construct_at)
+    {
+        if constexpr (lock_free_growth)
+        {
+            // segments are allocated before reserving, so that a failed allocation leaves nothing reserved
+            size_type first = m_reserved.load(std::memory_order_relaxed);
+            do
+            {
+                allocate_segments(first,first + n);
+            }
+            while (!m_reserved.compare_exchange_weak(first,first + n,std::memory_order_relaxed));
+
+            size_type built = first;
+            try
+            {
+                for (; built < first + n; ++built)
+                {
+                    construct_at(built);
+                }
+            }
+            catch(...)
+            {
+                destroy(first,built);
+                size_type expected = first + n;
+                if (!m_reserved.compare_exchange_strong(expected,first,std::memory_order_relaxed))
+                {
+                    // slots reserved after ours can only be counted after ours
+                    for (size_type i = first; i < first + n; ++i)
+                    {
+                        alloc_traits::construct(m_allocator,std::addressof((*this)[i]));
+                    }
+                    publish(first,first + n);
+                }
+                throw;
+            }
+            publish(first,first + n);
+            return iterator(this,first);
+        }
+        else
+        {
+            std::lock_guard<std::mutex> lock(m_growth_mutex);
+            size_type first = m_reserved.load(std::memory_order_relaxed);
+            allocate_segments(first,first + n);
+            size_type built = first;
+            try
+            {
+                for (; built < first + n; ++built)
+                {
+                    construct_at(built);
+                }
+            }
+            catch(...)
+            {
+                destroy(first,built);
+                throw;
+            }
+            m_reserved.store(first + n,std::memory_order_relaxed);
+            m_size.store(first + n,std::memory_order_release);
+            return iterator(this,first);
+        }
+    }
+    // counts [first,last) in size() once all slots before first are counted
+    void publish(size_type first, size_type last) noexcept
+    {
+        while (m_size.load(std::memory_order_acquire) != first)
+        {
+            std::this_thread::yield();
+        }
+        m_size.store(last,std::memory_order_release);
+    }
+    void destroy(size_type first, size_type last) noexcept
+    {
+        for (size_type i = first; i < last; ++i)
+        {
+            alloc_traits::destroy(m_allocator,std::addressof((*this)[i]));
+        }
+    }
+
+    // makes sure segments holding [first,last) exist. Concurrent callers race with a CAS, losers free their segment
+    void allocate_segments(size_type first, size_type last)
+    {
+        if (first >= last)
+        {
+            return;
+        }
+        size_type last_segment = segment_of(last - 1);
+        if (last_segment >= max_segments)
+        {
+            throw std::length_error("segmented_vector too big");
+        }
+        for (size_type k = segment_of(first); k <= last_segment; ++k)
+        {
+            if (m_segments[k].load(std::memory_order_acquire) != nullptr)
+            {
+                continue;
+            }
+            T* s = alloc_traits::allocate(m_allocator,segment_size(k));
+            T* expected = nullptr;
+            if (!m_segments[k].compare_exchange_strong(expected,s,std::memory_order_acq_rel,std::memory_order_acquire))
+            {
+                alloc_traits::deallocate(m_allocator,s,segment_size(k));
+            }
+        }
+    }
+
+    // constructed elements
+    std::atomic<size_type> m_size{0};
+    // slots given to growing threads, some may still be under construction
+    std::atomic<size_type> m_reserved{0};
+    std::mutex m_growth_mutex;
+    std::atomic<T*> m_segments[max_segments];
+    size_type m_first_segment_log;
+    Alloc m_allocator;
+};
+
+template <class T, class Alloc>
+bool operator==(segmented_vector<T,Alloc> const& lhs, segmented_vector<T,Alloc> const& rhs)
+{
+    return lhs.size() == rhs.size() && std::equal(lhs.begin(),lhs.end(),rhs.begin());
+}
+template <class T, class Alloc>
+bool operator!=(segmented_vector<T,Alloc> const& lhs, segmented_vector<T,Alloc> const& rhs)
+{
+    return !(lhs == rhs);
+}
+template <class T, class Alloc>
+void swap(segmented_vector<T,Alloc>& lhs, segmented_vector<T,Alloc>& rhs) noexcept
+{
+    lhs.swap(rhs);
+}
+
+}}
+#endif // BOOST_ASYNCHRONOUS_CONTAINER_SEGMENTED_VECTOR_HPP
@@ -0,0 +1,478 @@
+// Boost.Asynchronous library
+//  Copyright (C) Christophe Henry 2026
+//
+//  Use, modification and distribution is subject to the Boost
+//  Software License, Version 1.0.  (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// For more information, see http://www.boost.org
+
+#ifndef BOOST_ASYNCHRONOUS_CONTAINER_SOA_VECTOR_HPP
+#define BOOST_ASYNCHRONOUS_CONTAINER_SOA_VECTOR_HPP
+
+#include <cstddef>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include <boost/asynchronous/container/vector.hpp>
+
+namespace boost { namespace asynchronous
+{
+namespace detail
+{
+// reference to a row of a soa_vector: a tuple of references to the fields, which can be assigned from / converted to
+// the value type (std::tuple<Fields...>) and swapped, so that algorithms moving elements around (sort...) work.
+template <class... Fields>
+struct soa_reference : public std::tuple<Fields&...>
+{
+    typedef std::tuple<Fields&...> base_type;
+    using base_type::base_type;
+    soa_reference(soa_reference const&) = default;
+
+    // assigns through the references
+    soa_reference& operator=(soa_reference const& rhs)
+    {
+        base_type::operator=(static_cast<base_type const&>(rhs));
+        return *this;
+    }
+    soa_reference& operator=(soa_reference&& rhs)
+    {
+        assign_move(rhs,std::index_sequence_for<Fields...>());
+        return *this;
+    }
+    template <class... U>
+    soa_reference& operator=(std::tuple<U...> const& rhs)
+    {
+        base_type::operator=(rhs);
+        return *this;
+    }
+    template <class... U>
+    soa_reference& operator=(std::tuple<U...>&& rhs)
+    {
+        base_type::operator=(std::move(rhs));
+        return *this;
+    }
+    operator std::tuple<Fields...>() const
+    {
+        return std::tuple<Fields...>(static_cast<base_type const&>(*this));
+    }
+
+    friend void swap(soa_reference lhs, soa_reference rhs)
+    {
+        lhs.swap_fields(rhs,std::index_sequence_for<Fields...>());
+    }
+
+private:
+    template <std::size_t... I>
+    void assign_move(soa_reference& rhs, std::index_sequence<I...>)
+    {
+        ((std::get<I>(*this) = std::move(std::get<I>(rhs))),...);
+    }
+    template <std::size_t... I>
+    void swap_fields(soa_reference& rhs, std::index_sequence<I...>)
+    {
+        using std::swap;
+        (swap(std::get<I>(*this),std::get<I>(rhs)),...);
+    }
+};
+
+// random access iterator walking all columns at the same index
+template <bool Const, class... Fields>
+class soa_iterator
+{
+public:
+    typedef std::random_access_iterator_tag                                         iterator_category;
+    typedef std::tuple<Fields...>                                                   value_type;
+    typedef std::ptrdiff_t                                                          difference_type;
+    typedef typename std::conditional<Const,soa_reference<const Fields...>,soa_reference<Fields...>>::type reference;
+    typedef void                                                                    pointer;
+    typedef typename std::conditional<Const,std::tuple<const Fields*...>,std::tuple<Fields*...>>::type columns_type;
+
+    soa_iterator() = default;
+    soa_iterator(columns_type columns, difference_type index)
+        : m_columns(columns), m_index(index)
+    {}
+    // iterator to const_iterator
+    template <bool C = Const, class = typename std::enable_if<C>::type>
+    soa_iterator(soa_iterator<false,Fields...> const& rhs)
+        : m_columns(rhs.columns()), m_index(rhs.index())
+    {}
+
+    reference operator*() const
+    {
+        return deref(m_index,std::index_sequence_for<Fields...>());
+    }
+    reference operator[](difference_type n) const
+    {
+        return deref(m_index + n,std::index_sequence_for<Fields...>());
+    }
+    soa_iterator& operator++()
+    {
+        ++m_index;
+        return *this;
+    }
+    soa_iterator operator++(int)
+    {
+        soa_iterator tmp(*this);
+        ++m_index;
+        return tmp;
+    }
+    soa_iterator& operator--()
+    {
+        --m_index;
+        return *this;
+    }
+    soa_iterator operator--(int)
+    {
+        soa_iterator tmp(*this);
+        --m_index;
+        return tmp;
+    }
+    soa_iterator& operator+=(difference_type n)
+    {
+        m_index += n;
+        return *this;
+    }
+    soa_iterator& operator-=(difference_type n)
+    {
+        m_index -= n;
+        return *this;
+    }
+    friend soa_iterator operator+(soa_iterator it, difference_type n)
+    {
+        return it += n;
+    }
+    friend soa_iterator operator+(difference_type n, soa_iterator it)
+    {
+        return it += n;
+    }
+    friend soa_iterator operator-(soa_iterator it, difference_type n)
+    {
+        return it -= n;
+    }
+    friend difference_type operator-(soa_iterator const& lhs, soa_iterator const& rhs)
+    {
+        return lhs.m_index - rhs.m_index;
+    }
+    friend bool operator==(soa_iterator const& lhs, soa_iterator const& rhs)
+    {
+        return lhs.m_index == rhs.m_index;
+    }
+    friend bool operator!=(soa_iterator const& lhs, soa_iterator const& rhs)
+    {
+        return lhs.m_index != rhs.m_index;
+    }
+    friend bool operator<(soa_iterator const& lhs, soa_iterator const& rhs)
+    {
+        return lhs.m_index < rhs.m_index;
+    }
+    friend bool operator>(soa_iterator const& lhs, soa_iterator const& rhs)
+    {
+        return lhs.m_index > rhs.m_index;
+    }
+    friend bool operator<=(soa_iterator const& lhs, soa_iterator const& rhs)
+    {
+        return lhs.m_index <= rhs.m_index;
+    }
+    friend bool operator>=(soa_iterator const& lhs, soa_iterator const& rhs)
+    {
+        return lhs.m_index >= rhs.m_index;
+    }
+
+    // position, and start of the columns, for algorithms working on one column of a range
+    difference_type index() const
+    {
+        return m_index;
+    }
+    columns_type columns() const
+    {
+        return m_columns;
+    }
+    template <std::size_t I>
+    auto column() const -> decltype(std::get<I>(columns_type()))
+    {
+        return std::get<I>(m_columns) + m_index;
+    }
+
+private:
+    template <std::size_t... I>
+    reference deref(difference_type index, std::index_sequence<I...>) const
+    {
+        return reference(std::get<I>(m_columns)[index]...);
+    }
+
+    columns_type m_columns;
+    difference_type m_index = 0;
+};
+}
+
+// Vector of records stored as one contiguous column per field (struct of arrays).
+// Passes touching a few fields only read these columns, and column<I>() gives a vector with pointer iterators,
+// for which algorithms use their contiguous fast paths.
+// begin()/end() are zip iterators over rows, usable with the library algorithms.
+// Columns are boost::asynchronous::vector, so with a scheduler construction, resize and destruction are done in parallel.
+// As for vector, these members wait for the scheduler and must not be called from within it.
+template <class Job, class... Fields>
+class basic_soa_vector
+{
+public:
+    typedef std::size_t                                                 size_type;
+    typedef std::tuple<Fields...>                                       value_type;
+    typedef boost::asynchronous::detail::soa_reference<Fields...>       reference;
+    typedef boost::asynchronous::detail::soa_reference<const Fields...> const_reference;
+    typedef boost::asynchronous::detail::soa_iterator<false,Fields...>  iterator;
+    typedef boost::asynchronous::detail::soa_iterator<true,Fields...>   const_iterator;
+    typedef std::tuple<boost::asynchronous::vector<Fields,Job>...>      columns_type;
+    template <std::size_t I>
+    using column_type = typename std::tuple_element<I,columns_type>::type;
+
+    enum { column_count = sizeof...(Fields) };
+
+    // no scheduler, serial
+    basic_soa_vector() = default;
+    explicit basic_soa_vector(size_type n)
+        : m_columns(boost::asynchronous::vector<Fields,Job>(n)...)
+    {}
+    basic_soa_vector(boost::asynchronous::any_shared_scheduler_proxy<Job> scheduler,long cutoff,
+#ifdef BOOST_ASYNCHRONOUS_REQUIRE_ALL_ARGUMENTS
+                     const std::string& task_name, std::size_t prio)
+#else
+                     const std::string& task_name="", std::size_t prio=0)
+#endif
+        : m_columns(boost::asynchronous::vector<Fields,Job>(scheduler,cutoff,task_name,prio)...)
+    {}
+    // n default-constructed rows, placed in parallel
+    basic_soa_vector(boost::asynchronous::any_shared_scheduler_proxy<Job> scheduler,long cutoff,
+                     size_type n,
+#ifdef BOOST_ASYNCHRONOUS_REQUIRE_ALL_ARGUMENTS
+                     const std::string& task_name, std::size_t prio)
+#else
+                     const std::string& task_name="", std::size_t prio=0)
+#endif
+        : m_columns(boost::asynchronous::vector<Fields,Job>(scheduler,cutoff,n,task_name,prio)...)
+    {}
+    // n rows with a copy of the given value
+    basic_soa_vector(boost::asynchronous::any_shared_scheduler_proxy<Job> scheduler,long cutoff,
+                     size_type n, value_type const& value,
+#ifdef BOOST_ASYNCHRONOUS_REQUIRE_ALL_ARGUMENTS
+                     const std::string& task_name, std::size_t prio)
+#else
+                     const std::string& task_name="", std::size_t prio=0)
+#endif
+        : basic_soa_vector(scheduler,cutoff,n,value,task_name,prio,std::index_sequence_for<Fields...>())
+    {}
+
+    // columns
+    template <std::size_t I>
+    column_type<I>& column()
+    {
+        return std::get<I>(m_columns);
+    }
+    template <std::size_t I>
+    column_type<I> const& column() const
+    {
+        return std::get<I>(m_columns);
+    }
+
+    iterator begin()
+    {
+        return iterator(data(),0);
+    }
+    iterator end()
+    {
+        return iterator(data(),static_cast<std::ptrdiff_t>(size()));
+    }
+    const_iterator begin() const
+    {
+        return const_iterator(data(),0);
+    }
+    const_iterator end() const
+    {
+        return const_iterator(data(),static_cast<std::ptrdiff_t>(size()));
+    }
+    const_iterator cbegin() const
+    {
+        return begin();
+    }
+    const_iterator cend() const
+    {
+        return end();
+    }
+
+    reference operator[](size_type n)
+    {
+        return begin()[static_cast<std::ptrdiff_t>(n)];
+    }
+    const_reference operator[](size_type n) const
+    {
+        return begin()[static_cast<std::ptrdiff_t>(n)];
+    }
+    reference at(size_type n)
+    {
+        if (n >= size())
+        {
+            throw std::out_of_range("boost::asynchronous::soa_vector::at");
+        }
+        return (*this)[n];
+    }
+    const_reference at(size_type n) const
+    {
+        if (n >= size())
+        {
+            throw std::out_of_range("boost::asynchronous::soa_vector::at");
+        }
+        return (*this)[n];
+    }
+
+    size_type size() const
+    {
+        return std::get<0>(m_columns).size();
+    }
+    bool empty() const
+    {
+        return size() == 0;
+    }
+    size_type capacity() const
+    {
+        return std::get<0>(m_columns).capacity();
+    }
+
+    void push_back(Fields const&... values)
+    {
+        push_back_helper(std::forward_as_tuple(values...),std::index_sequence_for<Fields...>());
+    }
+    void push_back(value_type const& value)
+    {
+        push_back_helper(value,std::index_sequence_for<Fields...>());
+    }
+    void pop_back()
+    {
+        std::apply([](auto&... c){(c.pop_back(),...);},m_columns);
+    }
+    void reserve(size_type n)
+    {
+        std::apply([n](auto&... c){(c.reserve(n),...);},m_columns);
+    }
+    void resize(size_type n)
+    {
+        grow_columns([n](auto& c, auto){c.resize(n);},std::index_sequence_for<Fields...>());
+    }
+    void resize(size_type n, value_type const& value)
+    {
+        resize_helper(n,value,std::index_sequence_for<Fields...>());
+    }
+    void clear()
+    {
+        std::apply([](auto&... c){(c.clear(),...);},m_columns);
+    }
+    void swap(basic_soa_vector& other) noexcept
+    {
+        std::swap(m_columns,other.m_columns);
+    }
+    friend void swap(basic_soa_vector& lhs, basic_soa_vector& rhs) noexcept
+    {
+        lhs.swap(rhs);
+    }
+
+    // see vector
+    void set_scheduler(boost::asynchronous::any_shared_scheduler_proxy<Job> scheduler)
+    {
+        std::apply([&scheduler](auto&... c){(c.set_scheduler(scheduler),...);},m_columns);
+    }
+    void release_scheduler()
+    {
+        std::apply([](auto&... c){(c.release_scheduler(),...);},m_columns);
+    }
+    long get_cutoff()const
+    {
+        return std::get<0>(m_columns).get_cutoff();
+    }
+    void set_cutoff(long cutoff)
+    {
+        std::apply([cutoff](auto&... c){(c.set_cutoff(cutoff),...);},m_columns);
+    }
+    std::string get_name() const
+    {
+        return std::get<0>(m_columns).get_name();
+    }
+    void set_name(std::string const& n)
+    {
+        std::apply([&n](auto&... c){(c.set_name(n),...);},m_columns);
+    }
+    std::size_t get_prio()const
+    {
+        return std::get<0>(m_columns).get_prio();
+    }
+    void set_prio(std::size_t p)
+    {
+        std::apply([p](auto&... c){(c.set_prio(p),...);},m_columns);
+    }
+
+    friend bool operator==(basic_soa_vector const& lhs, basic_soa_vector const& rhs)
+    {
+        return lhs.m_columns == rhs.m_columns;
+    }
+    friend bool operator!=(basic_soa_vector const& lhs, basic_soa_vector const& rhs)
+    {
+        return !(lhs == rhs);
+    }
+
+private:
+    template <std::size_t... I>
+    basic_soa_vector(boost::asynchronous::any_shared_scheduler_proxy<Job> scheduler,long cutoff,
+                     size_type n, value_type const& value,
+                     const std::string& task_name, std::size_t prio, std::index_sequence<I...>)
+        : m_columns(boost::asynchronous::vector<Fields,Job>(scheduler,cutoff,n,std::get<I>(value),task_name,prio)...)
+    {}
+    typename iterator::columns_type data()
+    {
+        return std::apply([](auto&... c){return typename iterator::columns_type(c.data()...);},m_columns);
+    }
+    typename const_iterator::columns_type data() const
+    {
+        return std::apply([](auto const&... c){return typename const_iterator::columns_type(c.data()...);},m_columns);
+    }
+    template <class Tuple, std::size_t... I>
+    void push_back_helper(Tuple const& values, std::index_sequence<I...> seq)
+    {
+        grow_columns([&values](auto& c, auto i){c.push_back(std::get<decltype(i)::value>(values));},seq);
+    }
+    template <std::size_t... I>
+    void resize_helper(size_type n, value_type const& value, std::index_sequence<I...> seq)
+    {
+        grow_columns([n,&value](auto& c, auto i){c.resize(n,std::get<decltype(i)::value>(value));},seq);
+    }
+    // calls change(column, integral_constant<index>) for each column in order.
+    // If one throws, the columns already changed are brought back to the previous size, so that all columns keep the same size
+    template <class Change, std::size_t... I>
+    void grow_columns(Change change, std::index_sequence<I...>)
+    {
+        const size_type old_size = size();
+        std::size_t changed = 0;
+        try
+        {
+            ((change(std::get<I>(m_columns),std::integral_constant<std::size_t,I>()),++changed),...);
+        }
+        catch(...)
+        {
+            // elements added to a column are destroyed, removed ones cannot come back.
+            // resize needs a value, moved from an element about to be destroyed so that fields need no default constructor
+            ((I < changed && std::get<I>(m_columns).size() > old_size
+                ? std::get<I>(m_columns).resize(old_size,std::move(std::get<I>(m_columns).back()))
+                : void()),...);
+            throw;
+        }
+    }
+
+    columns_type m_columns;
+};
+
+template <class... Fields>
+using soa_vector = boost::asynchronous::basic_soa_vector<BOOST_ASYNCHRONOUS_DEFAULT_JOB,Fields...>;
+
+}}
+#endif // BOOST_ASYNCHRONOUS_CONTAINER_SOA_VECTOR_HPP
@@ -0,0 +1,620 @@
+// Boost.Asynchronous library
+//  Copyright (C) Christophe Henry 2026
+//
+//  Use, modification and distribution is subject to the Boost
+//  Software License, Version 1.0.  (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// For more information, see http://www.boost.org
+
+#ifndef BOOST_ASYNCHRONOUS_CONTAINER_UNORDERED_MAP_HPP
+#define BOOST_ASYNCHRONOUS_CONTAINER_UNORDERED_MAP_HPP
+
+#include <atomic>
+#include <bit>
+#include <cstdint>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <boost/asynchronous/continuation_task.hpp>
+#include <boost/asynchronous/detail/continuation_impl.hpp>
+#include <boost/asynchronous/algorithm/detail/safe_advance.hpp>
+
+namespace boost { namespace asynchronous
+{
+// A concurrent hash map. Keys are distributed on shards (power of 2, chosen at construction), each one being
+// an open-addressing table (linear probing, no tombstones) protected by its own reader/writer lock:
+// lookups of a shard run concurrently, writes lock only their shard, different shards never wait for each other.
+// Shards grow independently, so a rehash never stops the whole map.
+// As references to elements would not survive concurrent writes, values are copied out (find) or
+// accessed in place under the shard lock (visit, cvisit).
+// Bulk operations (parallel_insert, parallel_for_each, parallel_erase_if, parallel_rehash) are continuations
+// working on groups of shards in parallel.
+template <class Key, class T, class Hash = std::hash<Key>, class KeyEqual = std::equal_to<Key>>
+class unordered_map
+{
+public:
+    typedef Key                     key_type;
+    typedef T                       mapped_type;
+    typedef std::pair<Key,T>        value_type;
+    typedef std::size_t             size_type;
+    typedef Hash                    hasher;
+    typedef KeyEqual                key_equal;
+
+    enum { default_shard_count = 256 };
+
+    // shard_count is rounded up to a power of 2
+    explicit unordered_map(size_type shard_count = default_shard_count, Hash const& hash = Hash(), KeyEqual const& equal = KeyEqual())
+        : m_shard_log(std::bit_width(std::max<size_type>(shard_count,1) - 1))
+        , m_shards(new shard[size_type(1) << m_shard_log])
+        , m_hash(hash)
+        , m_equal(equal)
+    {}
+    unordered_map(unordered_map const& rhs)
+        : m_shard_log(rhs.m_shard_log)
+        , m_shards(new shard[size_type(1) << rhs.m_shard_log])
+        , m_hash(rhs.m_hash)
+        , m_equal(rhs.m_equal)
+    {
+        for (size_type i = 0; i < shard_count(); ++i)
+        {
+            std::shared_lock<std::shared_mutex> lock(rhs.m_shards[i].mutex_);
+            m_shards[i].slots_ = rhs.m_shards[i].slots_;
+            m_shards[i].size_.store(rhs.m_shards[i].size_.load(std::memory_order_relaxed),std::memory_order_relaxed);
+        }
+    }
+    // not noexcept: rhs is left usable, with a newly allocated single shard
+    unordered_map(unordered_map&& rhs)
+        : m_shard_log(rhs.m_shard_log)
+        , m_shards(std::move(rhs.m_shards))
+        , m_hash(std::move(rhs.m_hash))
+        , m_equal(std::move(rhs.m_equal))
+    {
+        // leave rhs usable, with a single shard
+        rhs.m_shard_log = 0;
+        rhs.m_shards.reset(new shard[1]);
+    }
+    unordered_map& operator=(unordered_map rhs) noexcept
+    {
+        std::swap(m_shard_log,rhs.m_shard_log);
+        std::swap(m_shards,rhs.m_shards);
+        std::swap(m_hash,rhs.m_hash);
+        std::swap(m_equal,rhs.m_equal);
+        return *this;
+    }
+
+    // inserts if key not present. Returns true if inserted
+    bool insert(value_type const& v)
+    {
+        return emplace(v.first,v.second);
+    }
+    bool insert(value_type&& v)
+    {
+        return emplace(std::move(v.first),std::move(v.second));
+    }
+    template <class K, class... Args>
+    bool emplace(K&& key, Args&&... args)
+    {
+        std::size_t h = hash(key);
+        shard& s = get_shard(h);
+        std::unique_lock<std::shared_mutex> lock(s.mutex_);
+        std::size_t pos = 0;
+        if (s.find(key,h,m_equal,pos))
+        {
+            return false;
+        }
+        s.insert_new(h,*this,std::forward<K>(key),std::forward<Args>(args)...);
+        return true;
+    }
+    // inserts or replaces the value. Returns true if inserted
+    template <class K, class V>
+    bool insert_or_assign(K&& key, V&& value)
+    {
+        std::size_t h = hash(key);
+        shard& s = get_shard(h);
+        std::unique_lock<std::shared_mutex> lock(s.mutex_);
+        std::size_t pos = 0;
+        if (s.find(key,h,m_equal,pos))
+        {
+            s.slots_[pos]->second = std::forward<V>(value);
+            return false;
+        }
+        s.insert_new(h,*this,std::forward<K>(key),std::forward<V>(value));
+        return true;
+    }
+
+    // copy of the value if present
+    std::optional<T> find(Key const& key) const
+    {
+        std::size_t h = hash(key);
+        shard& s = get_shard(h);
+        std::shared_lock<std::shared_mutex> lock(s.mutex_);
+        std::size_t pos = 0;
+        if (s.find(key,h,m_equal,pos))
+        {
+            return s.slots_[pos]->second;
+        }
+        return std::nullopt;
+    }
+    bool contains(Key const& key) const
+    {
+        std::size_t h = hash(key);
+        shard& s = get_shard(h);
+        std::shared_lock<std::shared_mutex> lock(s.mutex_);
+        std::size_t pos = 0;
+        return s.find(key,h,m_equal,pos);
+    }
+    // calls func(T&) under the shard write lock if present. Returns true if found
+    template <class Func>
+    bool visit(Key const& key, Func&& func)
+    {
+        std::size_t h = hash(key);
+        shard& s = get_shard(h);
+        std::unique_lock<std::shared_mutex> lock(s.mutex_);
+        std::size_t pos = 0;
+        if (s.find(key,h,m_equal,pos))
+        {
+            func(s.slots_[pos]->second);
+            return true;
+        }
+        return false;
+    }
+    // calls func(T const&) under the shard read lock if present. Returns true if found
+    template <class Func>
+    bool cvisit(Key const& key, Func&& func) const
+    {
+        std::size_t h = hash(key);
+        shard& s = get_shard(h);
+        std::shared_lock<std::shared_mutex> lock(s.mutex_);
+        std::size_t pos = 0;
+        if (s.find(key,h,m_equal,pos))
+        {
+            func(static_cast<T const&>(s.slots_[pos]->second));
+            return true;
+        }
+        return false;
+    }
+
+    size_type erase(Key const& key)
+    {
+        std::size_t h = hash(key);
+        shard& s = get_shard(h);
+        std::unique_lock<std::shared_mutex> lock(s.mutex_);
+        std::size_t pos = 0;
+        if (!s.find(key,h,m_equal,pos))
+        {
+            return 0;
+        }
+        s.erase_at(pos,*this);
+        return 1;
+    }
+
+    // sum of the shard sizes, exact only without concurrent writes
+    size_type size() const noexcept
+    {
+        size_type res = 0;
+        for (size_type i = 0; i < shard_count(); ++i)
+        {
+            res += shard_size(i);
+        }
+        return res;
+    }
+    bool empty() const noexcept
+    {
+        return size() == 0;
+    }
+    void clear()
+    {
+        for (size_type i = 0; i < shard_count(); ++i)
+        {
+            std::unique_lock<std::shared_mutex> lock(m_shards[i].mutex_);
+            m_shards[i].slots_.clear();
+            m_shards[i].size_.store(0,std::memory_order_relaxed);
+        }
+    }
+    // makes room for n elements without growing. See parallel_rehash for the parallel version
+    void rehash(size_type n)
+    {
+        for (size_type i = 0; i < shard_count(); ++i)
+        {
+            rehash_shard(i,n);
+        }
+    }
+    hasher hash_function() const
+    {
+        return m_hash;
+    }
+    key_equal key_eq() const
+    {
+        return m_equal;
+    }
+
+    // shard interface, for parallel algorithms
+    size_type shard_count() const noexcept
+    {
+        return size_type(1) << m_shard_log;
+    }
+    size_type shard_size(size_type i) const noexcept
+    {
+        return m_shards[i].size_.load(std::memory_order_relaxed);
+    }
+    // calls func(Key const&, T&) for every element of shard i, under its write lock
+    template <class Func>
+    void for_each_in_shard(size_type i, Func& func)
+    {
+        std::unique_lock<std::shared_mutex> lock(m_shards[i].mutex_);
+        for (auto& slot : m_shards[i].slots_)
+        {
+            if (slot)
+            {
+                func(static_cast<Key const&>(slot->first),slot->second);
+            }
+        }
+    }
+    // erases elements of shard i for which pred(Key const&, T const&) is true. Returns number erased
+    template <class Pred>
+    size_type erase_if_in_shard(size_type i, Pred& pred)
+    {
+        shard& s = m_shards[i];
+        std::unique_lock<std::shared_mutex> lock(s.mutex_);
+        size_type erased = 0;
+        std::size_t pos = 0;
+        while (pos < s.slots_.size())
+        {
+            auto& slot = s.slots_[pos];
+            if (slot && pred(static_cast<Key const&>(slot->first),static_cast<T const&>(slot->second)))
+            {
+                // backward shift may move a not yet visited element here, visit pos again
+                s.erase_at(pos,*this);
+                ++erased;
+            }
+            else
+            {
+                ++pos;
+            }
+        }
+        return erased;
+    }
+    // makes room for n elements of the whole map in shard i
+    void rehash_shard(size_type i, size_type n)
+    {
+        shard& s = m_shards[i];
+        std::unique_lock<std::shared_mutex> lock(s.mutex_);
+        s.grow_to(shard::capacity_for(n / shard_count() + 1),*this);
+    }
+
+private:
+    // mixes the user hash (murmur3 finalizer) so that every bit depends on all bits of the user hash:
+    // shards take the high bits, slots the low bits. Identity hashes of keys with a power of 2 stride
+    // would otherwise all share their low bits and fall into one cluster
+    std::size_t hash(Key const& key) const
+    {
+        std::uint64_t h = static_cast<std::uint64_t>(m_hash(key));
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdull;
+        h ^= h >> 33;
+        h *= 0xc4ceb9fe1a85ec53ull;
+        h ^= h >> 33;
+        return static_cast<std::size_t>(h);
+    }
+
+    // aligned to avoid false sharing between locks of neighbour shards
+    struct alignas(64) shard
+    {
+        // at most 3/4 full
+        static std::size_t capacity_for(std::size_t n)
+        {
+            return std::bit_ceil(std::max<std::size_t>(8,n + n / 3 + 1));
+        }
+        std::size_t home(std::size_t h) const
+        {
+            return h & (slots_.size() - 1);
+        }
+        template <class K>
+        bool find(K const& key, std::size_t h, KeyEqual const& equal, std::size_t& pos) const
+        {
+            if (slots_.empty())
+            {
+                return false;
+            }
+            pos = home(h);
+            while (slots_[pos])
+            {
+                if (equal(slots_[pos]->first,key))
+                {
+                    return true;
+                }
+                pos = (pos + 1) & (slots_.size() - 1);
+            }
+            return false;
+        }
+        template <class K, class... Args>
+        void insert_new(std::size_t h, unordered_map const& map, K&& key, Args&&... args)
+        {
+            std::size_t n = size_.load(std::memory_order_relaxed);
+            if (slots_.empty() || (n + 1) * 4 > slots_.size() * 3)
+            {
+                grow_to(capacity_for(n + 1) * 2,map);
+            }
+            std::size_t pos = home(h);
+            while (slots_[pos])
+            {
+                pos = (pos + 1) & (slots_.size() - 1);
+            }
+            slots_[pos].emplace(std::piecewise_construct,
+                                std::forward_as_tuple(std::forward<K>(key)),
+                                std::forward_as_tuple(std::forward<Args>(args)...));
+            size_.store(n + 1,std::memory_order_relaxed);
+        }
+        void grow_to(std::size_t capacity, unordered_map const& map)
+        {
+            if (capacity <= slots_.size())
+            {
+                return;
+            }
+            std::vector<std::optional<value_type>> old(capacity);
+            old.swap(slots_);
+            for (auto& slot : old)
+            {
+                if (slot)
+                {
+                    std::size_t pos = home(map.hash(slot->first));
+                    while (slots_[pos])
+                    {
+                        pos = (pos + 1) & (slots_.size() - 1);
+                    }
+                    slots_[pos] = std::move(slot);
+                }
+            }
+        }
+        // backward shift deletion: moves following elements of the cluster back so that no lookup stops early
+        void erase_at(std::size_t pos, unordered_map const& map)
+        {
+            const std::size_t mask = slots_.size() - 1;
+            slots_[pos].reset();
+            std::size_t next = (pos + 1) & mask;
+            while (slots_[next])
+            {
+                std::size_t h = map.hash(slots_[next]->first);
+                std::size_t wanted = home(h);
+                // can the element at next move to the hole at pos?
+                bool movable = (pos <= next) ? (wanted <= pos || wanted > next)
+                                             : (wanted <= pos && wanted > next);
+                if (movable)
+                {
+                    slots_[pos] = std::move(slots_[next]);
+                    slots_[next].reset();
+                    pos = next;
+                }
+                next = (next + 1) & mask;
+            }
+            size_.store(size_.load(std::memory_order_relaxed) - 1,std::memory_order_relaxed);
+        }
+
+        mutable std::shared_mutex mutex_;
+        std::vector<std::optional<value_type>> slots_;
+        // readable without lock for size estimates
+        std::atomic<std::size_t> size_{0};
+    };
+
+    shard& get_shard(std::size_t h) const
+    {
+        // high bits, so that slots (low bits) of a shard stay well distributed
+        return m_shards[m_shard_log == 0 ? 0 : (h >> (sizeof(std::size_t) * 8 - m_shard_log))];
+    }
+
+    size_type m_shard_log;
+    std::unique_ptr<shard[]> m_shards;
+    Hash m_hash;
+    KeyEqual m_equal;
+};
+
+namespace detail
+{
+// works on shards [beg,end), cut in 2 until the elements of the shards do not exceed cutoff.
+// Op(shard index) returns a count, which are summed
+template <class Map, class Op, class Job>
+struct unordered_map_shards_helper: public boost::asynchronous::continuation_task<std::size_t>
+{
+    unordered_map_shards_helper(Map* map, std::size_t beg, std::size_t end, Op op, long cutoff,
+                                const std::string& task_name, std::size_t prio)
+        : boost::asynchronous::continuation_task<std::size_t>(task_name)
+        , map_(map),beg_(beg),end_(end),op_(std::move(op)),cutoff_(cutoff),prio_(prio)
+    {}
+    void operator()()
+    {
+        boost::asynchronous::continuation_result<std::size_t> task_res = this->this_task_result();
+        try
+        {
+            std::size_t elements = 0;
+            for (std::size_t i = beg_; i < end_; ++i)
+            {
+                elements += map_->shard_size(i);
+            }
+            if (end_ - beg_ <= 1 || elements <= static_cast<std::size_t>(cutoff_))
+            {
+                std::size_t res = 0;
+                for (std::size_t i = beg_; i < end_; ++i)
+                {
+                    res += op_(*map_,i);
+                }
+                task_res.set_value(res);
+                return;
+            }
+            std::size_t middle = beg_ + (end_ - beg_) / 2;
+            boost::asynchronous::create_callback_continuation_job<Job>(
+                // called when subtasks are done, set our result
+                [task_res](std::tuple<boost::asynchronous::expected<std::size_t>,boost::asynchronous::expected<std::size_t>> res) mutable
+                {
+                    try
+                    {
+                        task_res.set_value(std::get<0>(res).get() + std::get<1>(res).get());
+                    }
+                    catch(...)
+                    {
+                        task_res.set_exception(std::current_exception());
+                    }
+                },
+                // recursive tasks
+                unordered_map_shards_helper<Map,Op,Job>(map_,beg_,middle,op_,cutoff_,this->get_name(),prio_),
+                unordered_map_shards_helper<Map,Op,Job>(map_,middle,end_,op_,cutoff_,this->get_name(),prio_)
+            );
+        }
+        catch(...)
+        {
+            task_res.set_exception(std::current_exception());
+        }
+    }
+    Map* map_;
+    std::size_t beg_;
+    std::size_t end_;
+    Op op_;
+    long cutoff_;
+    std::size_t prio_;
+};
+
+template <class Map, class Iterator, class Job>
+struct unordered_map_insert_helper: public boost::asynchronous::continuation_task<std::size_t>
+{
+    unordered_map_insert_helper(Map* map, Iterator beg, Iterator end, long cutoff, const std::string& task_name, std::size_t prio)
+        : boost::asynchronous::continuation_task<std::size_t>(task_name)
+        , map_(map),beg_(beg),end_(end),cutoff_(cutoff),prio_(prio)
+    {}
+    void operator()()
+    {
+        boost::asynchronous::continuation_result<std::size_t> task_res = this->this_task_result();
+        try
+        {
+            // advance up to cutoff
+            Iterator it = boost::asynchronous::detail::find_cutoff(beg_,cutoff_,end_);
+            // if not at end, recurse, otherwise execute here
+            if (it == end_)
+            {
+                std::size_t res = 0;
+                for (; beg_ != end_; ++beg_)
+                {
+                    res += map_->insert(*beg_) ? 1 : 0;
+                }
+                task_res.set_value(res);
+                return;
+            }
+            boost::asynchronous::create_callback_continuation_job<Job>(
+                // called when subtasks are done, set our result
+                [task_res](std::tuple<boost::asynchronous::expected<std::size_t>,boost::asynchronous::expected<std::size_t>> res) mutable
+                {
+                    try
+                    {
+                        task_res.set_value(std::get<0>(res).get() + std::get<1>(res).get());
+                    }
+                    catch(...)
+                    {
+                        task_res.set_exception(std::current_exception());
+                    }
+                },
+                // recursive tasks
+                unordered_map_insert_helper<Map,Iterator,Job>(map_,beg_,it,cutoff_,this->get_name(),prio_),
+                unordered_map_insert_helper<Map,Iterator,Job>(map_,it,end_,cutoff_,this->get_name(),prio_)
+            );
+        }
+        catch(...)
+        {
+            task_res.set_exception(std::current_exception());
+        }
+    }
+    Map* map_;
+    Iterator beg_;
+    Iterator end_;
+    long cutoff_;
+    std::size_t prio_;
+};
+}
+
+// Bulk operations. The map must outlive the continuation. They can run concurrently with other operations on the map.
+
+// inserts [beg,end) of value_type, keys already present are left unchanged. Returns the number of inserted elements
+template <class Key, class T, class Hash, class KeyEqual, class Iterator, class Job=BOOST_ASYNCHRONOUS_DEFAULT_JOB>
+boost::asynchronous::detail::callback_continuation<std::size_t,Job>
+parallel_insert(boost::asynchronous::unordered_map<Key,T,Hash,KeyEqual>& map, Iterator beg, Iterator end, long cutoff,
+#ifdef BOOST_ASYNCHRONOUS_REQUIRE_ALL_ARGUMENTS
+                const std::string& task_name, std::size_t prio)
+#else
+                const std::string& task_name="", std::size_t prio=0)
+#endif
+{
+    return boost::asynchronous::top_level_callback_continuation_job<std::size_t,Job>
+            (boost::asynchronous::detail::unordered_map_insert_helper<boost::asynchronous::unordered_map<Key,T,Hash,KeyEqual>,Iterator,Job>
+                (&map,beg,end,cutoff,task_name,prio));
+}
+
+// calls func(Key const&, T&) on every element. cutoff is the number of elements handled by a task.
+// Returns the number of visited elements
+template <class Key, class T, class Hash, class KeyEqual, class Func, class Job=BOOST_ASYNCHRONOUS_DEFAULT_JOB>
+boost::asynchronous::detail::callback_continuation<std::size_t,Job>
+parallel_for_each(boost::asynchronous::unordered_map<Key,T,Hash,KeyEqual>& map, Func func, long cutoff,
+#ifdef BOOST_ASYNCHRONOUS_REQUIRE_ALL_ARGUMENTS
+                  const std::string& task_name, std::size_t prio)
+#else
+                  const std::string& task_name="", std::size_t prio=0)
+#endif
+{
+    typedef boost::asynchronous::unordered_map<Key,T,Hash,KeyEqual> map_type;
+    auto op = [func](map_type& m, std::size_t i) mutable
+    {
+        m.for_each_in_shard(i,func);
+        return m.shard_size(i);
+    };
+    return boost::asynchronous::top_level_callback_continuation_job<std::size_t,Job>
+            (boost::asynchronous::detail::unordered_map_shards_helper<map_type,decltype(op),Job>
+                (&map,0,map.shard_count(),std::move(op),cutoff,task_name,prio));
+}
+
+// erases elements for which pred(Key const&, T const&) is true. Returns the number of erased elements
+template <class Key, class T, class Hash, class KeyEqual, class Pred, class Job=BOOST_ASYNCHRONOUS_DEFAULT_JOB>
+boost::asynchronous::detail::callback_continuation<std::size_t,Job>
+parallel_erase_if(boost::asynchronous::unordered_map<Key,T,Hash,KeyEqual>& map, Pred pred, long cutoff,
+#ifdef BOOST_ASYNCHRONOUS_REQUIRE_ALL_ARGUMENTS
+                  const std::string& task_name, std::size_t prio)
+#else
+                  const std::string& task_name="", std::size_t prio=0)
+#endif
+{
+    typedef boost::asynchronous::unordered_map<Key,T,Hash,KeyEqual> map_type;
+    auto op = [pred](map_type& m, std::size_t i) mutable
+    {
+        return m.erase_if_in_shard(i,pred);
+    };
+    return boost::asynchronous::top_level_callback_continuation_job<std::size_t,Job>
+            (boost::asynchronous::detail::unordered_map_shards_helper<map_type,decltype(op),Job>
+                (&map,0,map.shard_count(),std::move(op),cutoff,task_name,prio));
+}
+
+// makes room for n elements, shards being rehashed in parallel. Returns the number of elements
+template <class Key, class T, class Hash, class KeyEqual, class Job=BOOST_ASYNCHRONOUS_DEFAULT_JOB>
+boost::asynchronous::detail::callback_continuation<std::size_t,Job>
+parallel_rehash(boost::asynchronous::unordered_map<Key,T,Hash,KeyEqual>& map, std::size_t n, long cutoff,
+#ifdef BOOST_ASYNCHRONOUS_REQUIRE_ALL_ARGUMENTS
+                const std::string& task_name, std::size_t prio)
+#else
+                const std::string& task_name="", std::size_t prio=0)
+#endif
+{
+    typedef boost::asynchronous::unordered_map<Key,T,Hash,KeyEqual> map_type;
+    auto op = [n](map_type& m, std::size_t i)
+    {
+        m.rehash_shard(i,n);
+        return m.shard_size(i);
+    };
+    return boost::asynchronous::top_level_callback_continuation_job<std::size_t,Job>
+            (boost::asynchronous::detail::unordered_map_shards_helper<map_type,decltype(op),Job>
+                (&map,0,map.shard_count(),std::move(op),cutoff,task_name,prio));
+}
+
+}}
+#endif // BOOST_ASYNCHRONOUS_CONTAINER_UNORDERED_MAP_HPP
@@ -24,6 +24,7 @@
 #include <boost/asynchronous/any_shared_scheduler_proxy.hpp>
 #include <boost/asynchronous/post.hpp>
 #include <boost/asynchronous/detail/move_bind.hpp>
+#include <boost/asynchronous/helpers/scratch_memory_pool.hpp>
 
 namespace boost { namespace asynchronous
 {
@@ -108,7 +109,7 @@ public:
     , m_allocator(alloc)
     {
         std::shared_ptr<T> raw (m_allocator.allocate(default_capacity),
-                                  [this](T* p){this->m_allocator.deallocate(p,default_capacity);});
+                                  [alloc=m_allocator](T* p)mutable{alloc.deallocate(p,default_capacity);});
 
         m_data =  std::make_shared<boost::asynchronous::placement_deleter<T,Job,std::shared_ptr<T>>>(0,raw,m_cutoff,m_task_name,m_prio);
     }
@@ -124,7 +125,7 @@ public:
         , m_capacity(n)
         , m_allocator(alloc)
     {
-        std::shared_ptr<T> raw (m_allocator.allocate(n),[this,n](T* p){this->m_allocator.deallocate(p,n);});
+        std::shared_ptr<T> raw (m_allocator.allocate(n),[alloc=m_allocator,n](T* p)mutable{alloc.deallocate(p,n);});
         m_data =  std::make_shared<boost::asynchronous::placement_deleter<T,Job,std::shared_ptr<T>>>(n,raw,m_cutoff,m_task_name,m_prio);
         boost::asynchronous::detail::serial_placement<T,std::size_t>((std::size_t)0,n,(char*)raw.get(),value);
     }
@@ -139,7 +140,7 @@ public:
         auto n = std::distance(first,last);
         m_size=n;
         m_capacity=n;
-        std::shared_ptr<T> raw (m_allocator.allocate(n),[this,n](T* p){this->m_allocator.deallocate(p,n);});
+        std::shared_ptr<T> raw (m_allocator.allocate(n),[alloc=m_allocator,n](T* p)mutable{alloc.deallocate(p,n);});
         m_data =  std::make_shared<boost::asynchronous::placement_deleter<T,Job,std::shared_ptr<T>>>(n,raw,m_cutoff,m_task_name,m_prio);
         boost::asynchronous::detail::serial_placement_it<T,std::size_t,InputIt>((std::size_t)0,n,(char*)raw.get(),first);
     }
@@ -154,7 +155,7 @@ public:
         auto first = init.begin();
         m_size=n;
         m_capacity=n;
-        std::shared_ptr<T> raw (m_allocator.allocate(n),[this,n](T* p){this->m_allocator.deallocate(p,n);});
+        std::shared_ptr<T> raw (m_allocator.allocate(n),[alloc=m_allocator,n](T* p)mutable{alloc.deallocate(p,n);});
         m_data =  std::make_shared<boost::asynchronous::placement_deleter<T,Job,std::shared_ptr<T>>>(n,raw,m_cutoff,m_task_name,m_prio);
         boost::asynchronous::detail::serial_placement_it<T,std::size_t,decltype(first)>((std::size_t)0,n,(char*)raw.get(),first);
     }
@@ -189,7 +190,7 @@ public:
         , m_capacity(n)
         , m_allocator(alloc)
     {
-        std::shared_ptr<T> raw (m_allocator.allocate(n),[this,n](T* p){this->m_allocator.deallocate(p,n);});
+        std::shared_ptr<T> raw (m_allocator.allocate(n),[alloc=m_allocator,n](T* p)mutable{alloc.deallocate(p,n);});
         m_data =  std::make_shared<boost::asynchronous::placement_deleter<T,Job,std::shared_ptr<T>>>(n,raw,cutoff,task_name,prio);
         if (m_scheduler.is_valid())
         {
@@ -222,7 +223,7 @@ public:
         , m_allocator(alloc)
     {
         std::shared_ptr<T> raw (m_allocator.allocate(default_capacity),
-                                  [this](T* p){this->m_allocator.deallocate(p,default_capacity);});
+                                  [alloc=m_allocator](T* p)mutable{alloc.deallocate(p,default_capacity);});
 
         m_data =  std::make_shared<boost::asynchronous::placement_deleter<T,Job,std::shared_ptr<T>>>(0,raw,cutoff,task_name,prio);
     }
@@ -242,7 +243,7 @@ public:
         , m_capacity(n)
         , m_allocator(alloc)
     {
-        std::shared_ptr<T> raw (m_allocator.allocate(n),[this,n](T* p){this->m_allocator.deallocate(p,n);});
+        std::shared_ptr<T> raw (m_allocator.allocate(n),[alloc=m_allocator,n](T* p)mutable{alloc.deallocate(p,n);});
 
         m_data =  std::make_shared<boost::asynchronous::placement_deleter<T,Job,std::shared_ptr<T>>>(n,raw,cutoff,task_name,prio);
         if (m_scheduler.is_valid())
@@ -278,7 +279,7 @@ public:
         auto n = std::distance(first,last);
         m_size=n;
         m_capacity=n;
-        std::shared_ptr<T> raw (m_allocator.allocate(n),[this,n](T* p){this->m_allocator.deallocate(p,n);});
+        std::shared_ptr<T> raw (m_allocator.allocate(n),[alloc=m_allocator,n](T* p)mutable{alloc.deallocate(p,n);});
         m_data =  std::make_shared<boost::asynchronous::placement_deleter<T,Job,std::shared_ptr<T>>>(n,raw,cutoff,task_name,prio);
         if (m_scheduler.is_valid())
         {
@@ -321,47 +322,28 @@ public:
         auto n = other.size();
         m_size=n;
         m_capacity=n;
-        std::shared_ptr<T> raw (m_allocator.allocate(n),[this,n](T* p){this->m_allocator.deallocate(p,n);});
+        std::shared_ptr<T> raw (m_allocator.allocate(n),[alloc=m_allocator,n](T* p)mutable{alloc.deallocate(p,n);});
         auto cutoff = m_cutoff;
         auto task_name = m_task_name;
         auto prio = m_prio;
         m_data =  std::make_shared<boost::asynchronous::placement_deleter<T,Job,std::shared_ptr<T>>>(n,raw,cutoff,task_name,prio);
-        if (m_scheduler.is_valid())
-        {
-            auto fu = boost::asynchronous::post_future(m_scheduler,
-            [n,raw,cutoff,task_name,prio]()mutable
-            {
-                return boost::asynchronous::parallel_placement<T,Job>
-                            (0,n,(char*)raw.get(),T(),cutoff,task_name+"_vector_ctor_placement",prio);
-            },
-            task_name+"vector_ctor",prio);
-            // if exception, will be forwarded
-            fu.get();
-        }
-        else
-        {
-            boost::asynchronous::detail::serial_placement<T,std::size_t>((std::size_t)0,n,(char*)raw.get(),T());
-        }
-
-        // copy
-        auto beg_it = begin();
-        auto other_end_it = other.end();
+        // copy-construct in place instead of default-constructing then copying (memcpy for trivially copyable types)
         auto other_beg_it = other.begin();
         if (m_scheduler.is_valid())
         {
-            auto fu2 = boost::asynchronous::post_future(m_scheduler,
-            [beg_it,other_end_it,other_beg_it,cutoff,task_name,prio]()mutable
+            auto fu = boost::asynchronous::post_future(m_scheduler,
+            [n,raw,other_beg_it,cutoff,task_name,prio]()mutable
             {
-                return boost::asynchronous::parallel_copy<const_iterator,iterator,Job>
-                        (other_beg_it,other_end_it,beg_it,cutoff,task_name+"_vector_copy",prio);
+                return boost::asynchronous::parallel_placement<T,const_iterator,std::shared_ptr<T>,Job>
+                            (0,n,other_beg_it,raw,cutoff,task_name+"_vector_copy",prio);
             },
             task_name+"_vector_copy_top",prio);
             // if exception, will be forwarded
-            fu2.get();
+            fu.get();
         }
         else
         {
-            std::copy(other_beg_it,other_end_it,beg_it);
+            boost::asynchronous::detail::serial_placement_it<T,std::size_t,const_iterator>((std::size_t)0,n,(char*)raw.get(),other_beg_it);
         }
     }
     vector( boost::asynchronous::any_shared_scheduler_proxy<Job> scheduler,long cutoff,
@@ -371,17 +353,18 @@ public:
 #else
             const std::string& task_name="", std::size_t prio=0
 #endif
-           ,const Alloc& = Alloc() )
+           ,const Alloc& alloc = Alloc() )
      : m_scheduler(scheduler)
      , m_cutoff(cutoff)
      , m_task_name(task_name)
      , m_prio(prio)
+     , m_allocator(alloc)
     {
         auto n = std::distance(init.begin(),init.end());
         auto first = init.begin();
         m_size=n;
         m_capacity=n;
-        std::shared_ptr<T> raw (m_allocator.allocate(n),[this,n](T* p){this->m_allocator.deallocate(p,n);});
+        std::shared_ptr<T> raw (m_allocator.allocate(n),[alloc=m_allocator,n](T* p)mutable{alloc.deallocate(p,n);});
         m_data =  std::make_shared<boost::asynchronous::placement_deleter<T,Job,std::shared_ptr<T>>>(n,raw,cutoff,task_name,prio);
         if (m_scheduler.is_valid())
         {
@@ -932,7 +915,7 @@ public:
             auto n = cur_end-last;
 
             // create temporary buffer
-            std::shared_ptr<char> raw (new char[n * sizeof(T)],[](char* p){delete[] p;});
+            std::shared_ptr<char> raw = boost::asynchronous::scratch_memory_pool::default_pool().allocate(n * sizeof(T));
             if (m_scheduler.is_valid())
             {
                 auto fu = boost::asynchronous::post_future(m_scheduler,
@@ -1060,7 +1043,7 @@ public:
         // we need move twice data after pos as parallel_move does not support overlapping ranges
         // first we create a temporary buffer and move our data after pos to temporary buffer
         auto n = cend() - pos;
-        std::shared_ptr<char> raw (new char[n * sizeof(T)],[](char* p){delete[] p;});
+        std::shared_ptr<char> raw = boost::asynchronous::scratch_memory_pool::default_pool().allocate(n * sizeof(T));
         auto cutoff = m_cutoff;
         auto task_name = m_task_name;
         auto prio = m_prio;
@@ -1205,7 +1188,7 @@ public:
         // we need move twice data after pos as parallel_move does not support overlapping ranges
         // first we create a temporary buffer and move our data after pos to temporary buffer
         auto n = cend() - pos;
-        std::shared_ptr<char> raw (new char[n * sizeof(T)],[](char* p){delete[] p;});
+        std::shared_ptr<char> raw = boost::asynchronous::scratch_memory_pool::default_pool().allocate(n * sizeof(T));
         auto cutoff = m_cutoff;
         auto task_name = m_task_name;
         auto prio = m_prio;
@@ -1373,7 +1356,7 @@ public:
         // we need move twice data after pos as parallel_move does not support overlapping ranges
         // first we create a temporary buffer and move our data after pos to temporary buffer
         auto n = cend() - pos;
-        std::shared_ptr<char> raw (new char[n * sizeof(T)],[](char* p){delete[] p;});
+        std::shared_ptr<char> raw = boost::asynchronous::scratch_memory_pool::default_pool().allocate(n * sizeof(T));
         auto cutoff = m_cutoff;
         auto task_name = m_task_name;
         auto prio = m_prio;
@@ -1510,7 +1493,7 @@ public:
         // we need move twice data after pos as parallel_move does not support overlapping ranges
         // first we create a temporary buffer and move our data after pos to temporary buffer
         auto n = cend() - pos;
-        std::shared_ptr<char> raw (new char[n * sizeof(T)],[](char* p){delete[] p;});
+        std::shared_ptr<char> raw = boost::asynchronous::scratch_memory_pool::default_pool().allocate(n * sizeof(T));
         auto cutoff = m_cutoff;
         auto task_name = m_task_name;
         auto prio = m_prio;
@@ -1680,7 +1663,7 @@ public:
         // we need move twice data after pos as parallel_move does not support overlapping ranges
         // first we create a temporary buffer and move our data after pos to temporary buffer
         auto n = cend() - pos;
-        std::shared_ptr<char> raw (new char[n * sizeof(T)],[](char* p){delete[] p;});
+        std::shared_ptr<char> raw = boost::asynchronous::scratch_memory_pool::default_pool().allocate(n * sizeof(T));
         auto cutoff = m_cutoff;
         auto task_name = m_task_name;
         auto prio = m_prio;
@@ -1917,7 +1900,7 @@ private:
 
     std::size_t reallocate_helper(size_type new_memory)
     {
-        std::shared_ptr<T> raw (m_allocator.allocate(new_memory),[this,new_memory](T* p){this->m_allocator.deallocate(p,new_memory);});
+        std::shared_ptr<T> raw (m_allocator.allocate(new_memory),[alloc=m_allocator,new_memory](T* p)mutable{alloc.deallocate(p,new_memory);});
 
         // create our current number of objects with placement new
         auto n = m_size;
@@ -2028,7 +2011,7 @@ private:
                 auto prio = m_prio;
                 auto beg = m_begin; auto end =m_end;
 
-                std::shared_ptr<T> raw (m_allocator.allocate(new_memory),[this,new_memory,alloc](T* p)mutable{alloc.deallocate(p,new_memory);});
+                std::shared_ptr<T> raw (m_allocator.allocate(new_memory),[new_memory,alloc](T* p)mutable{alloc.deallocate(p,new_memory);});
 
                 auto cont_p = boost::asynchronous::parallel_placement<T,Job>
                         (0,m_size,(char*)raw.get(),T(),m_cutoff,this->get_name()+"vector_reallocate_placement",m_prio);
@@ -0,0 +1,168 @@
+// Boost.Asynchronous library
+//  Copyright (C) Christophe Henry 2026
+//
+//  Use, modification and distribution is subject to the Boost
+//  Software License, Version 1.0.  (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// For more information, see http://www.boost.org
+
+#ifndef BOOST_ASYNCHRONOUS_DETAIL_CALL_BATCHER_HPP
+#define BOOST_ASYNCHRONOUS_DETAIL_CALL_BATCHER_HPP
+
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <boost/asynchronous/any_scheduler.hpp>
+#include <boost/asynchronous/callable_any.hpp>
+#include <boost/asynchronous/job_traits.hpp>
+
+namespace boost { namespace asynchronous
+{
+// what a servant member declared with BOOST_ASYNC_BATCH_MEMBER receives: the arguments of all calls of the batch, in order
+template <typename... Args>
+using call_batch = std::vector<std::tuple<Args...>>;
+
+namespace detail
+{
+// argument types of the servant member called once per call
+template <class MemFn>
+struct batched_member_traits;
+
+template <class S, class R, typename... Args>
+struct batched_member_traits<R (S::*)(Args...)>
+{
+    typedef std::tuple<typename std::decay<Args>::type...> arguments_type;
+};
+template <class S, class R, typename... Args>
+struct batched_member_traits<R (S::*)(Args...) const>
+{
+    typedef std::tuple<typename std::decay<Args>::type...> arguments_type;
+};
+
+// argument types of the servant member called once per batch, taking a call_batch&
+template <class MemFn>
+struct batch_member_traits;
+
+template <class S, class R, class Batch>
+struct batch_member_traits<R (S::*)(Batch)>
+{
+    typedef typename std::decay<Batch>::type::value_type arguments_type;
+};
+
+// Gathers calls to a servant member made through a servant_proxy: the first call of a batch posts a job, calls made
+// until this job is executed are added to the batch, at the cost of a short lock instead of a job, a queue node and a wake-up.
+// The job then calls the servant member once per call, or once with the whole batch (PerBatch).
+template <class Servant, class Job, class MemFn, bool PerBatch>
+class call_batcher : public std::enable_shared_from_this<call_batcher<Servant,Job,MemFn,PerBatch>>
+{
+public:
+    typedef typename std::conditional<PerBatch,
+                                      boost::asynchronous::detail::batch_member_traits<MemFn>,
+                                      boost::asynchronous::detail::batched_member_traits<MemFn>
+                                     >::type::arguments_type arguments_type;
+
+    call_batcher(std::shared_ptr<Servant> servant, boost::asynchronous::any_weak_scheduler<Job> scheduler,
+                 MemFn fn, std::size_t prio, std::shared_ptr<bool const> constructed)
+        : m_servant(std::move(servant)), m_scheduler(std::move(scheduler)), m_fn(fn), m_prio(prio)
+        , m_constructed(std::move(constructed))
+    {}
+
+    template <typename... Args>
+    void push(Args&&... args)
+    {
+        bool first = false;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            first = m_calls.empty();
+            m_calls.emplace_back(std::forward<Args>(args)...);
+        }
+        if (first)
+        {
+            boost::asynchronous::any_shared_scheduler<Job> s = m_scheduler.lock();
+            if (s.is_valid())
+            {
+                s.post(typename boost::asynchronous::job_traits<Job>::wrapper_type(
+                           boost::asynchronous::any_callable(drain_job{this->shared_from_this()})),
+                       m_prio);
+            }
+        }
+    }
+
+private:
+    struct drain_job
+    {
+        void operator()()
+        {
+            m_batcher->drain();
+        }
+        std::shared_ptr<call_batcher> m_batcher;
+    };
+
+    // executed in the servant thread, so only one drain runs at a time
+    void drain()
+    {
+        std::vector<arguments_type> calls(std::move(m_spare));
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            calls.swap(m_calls);
+        }
+        // dropped if the servant was created asynchronously and its constructor threw
+        if (!m_constructed || *m_constructed)
+        {
+            execute(calls,std::integral_constant<bool,PerBatch>());
+        }
+        calls.clear();
+        // keep the capacity for the next batch
+        m_spare = std::move(calls);
+    }
+    void execute(std::vector<arguments_type>& calls, std::true_type)
+    {
+        ((*m_servant).*m_fn)(calls);
+    }
+    void execute(std::vector<arguments_type>& calls, std::false_type)
+    {
+        for (auto& c : calls)
+        {
+            // like for a posted call, an exception is ignored and must not cancel the next calls
+            try
+            {
+                call(c,std::make_index_sequence<std::tuple_size<arguments_type>::value>());
+            }
+            catch(std::exception&){}
+        }
+    }
+    template <std::size_t... I>
+    void call(arguments_type& c, std::index_sequence<I...>)
+    {
+        ((*m_servant).*m_fn)(std::move(std::get<I>(c))...);
+    }
+
+    std::shared_ptr<Servant> m_servant;
+    boost::asynchronous::any_weak_scheduler<Job> m_scheduler;
+    MemFn m_fn;
+    const std::size_t m_prio;
+    // set for a servant created asynchronously: false until constructed
+    std::shared_ptr<bool const> m_constructed;
+    std::mutex m_mutex;
+    std::vector<arguments_type> m_calls;
+    std::vector<arguments_type> m_spare;
+};
+
+template <bool PerBatch, class Servant, class Job, class MemFn>
+std::shared_ptr<boost::asynchronous::detail::call_batcher<Servant,Job,MemFn,PerBatch>>
+make_call_batcher(std::shared_ptr<Servant> servant, boost::asynchronous::any_weak_scheduler<Job> scheduler,
+                  MemFn fn, std::size_t prio, std::shared_ptr<bool const> constructed = std::shared_ptr<bool const>())
+{
+    return std::make_shared<boost::asynchronous::detail::call_batcher<Servant,Job,MemFn,PerBatch>>(
+                std::move(servant),std::move(scheduler),fn,prio,std::move(constructed));
+}
+}
+}}
+#endif // BOOST_ASYNCHRONOUS_DETAIL_CALL_BATCHER_HPP
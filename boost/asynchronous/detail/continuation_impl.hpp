@@ -27,6 +27,7 @@
 #include <boost/asynchronous/scheduler/detail/interrupt_state.hpp>
 #include <boost/asynchronous/expected.hpp>
 #include <boost/asynchronous/scheduler/tss_scheduler.hpp>
+#include <boost/asynchronous/helpers/task_memory_pool.hpp>
 
 
 namespace boost { namespace asynchronous {
@@ -197,7 +198,9 @@ public:
     {
         // create only when asked
         if (!m_promise)
-            const_cast<continuation_task<Return>&>(*this).m_promise = std::make_shared<std::promise<Return>>();
+            const_cast<continuation_task<Return>&>(*this).m_promise =
+                std::allocate_shared<std::promise<Return>>(boost::asynchronous::task_allocator<std::promise<Return>>(),
+                                                       std::allocator_arg,boost::asynchronous::task_allocator<char>());
         return m_promise->get_future();
     }
 
@@ -205,7 +208,9 @@ public:
     {
         // create only when asked
         if (!m_promise)
-            const_cast<continuation_task<Return>&>(*this).m_promise = std::make_shared<std::promise<Return>>();
+            const_cast<continuation_task<Return>&>(*this).m_promise =
+                std::allocate_shared<std::promise<Return>>(boost::asynchronous::task_allocator<std::promise<Return>>(),
+                                                       std::allocator_arg,boost::asynchronous::task_allocator<char>());
         return m_promise;
     }
     std::string get_name()const
@@ -292,7 +297,9 @@ public:
     {
         // create only when asked
         if (!m_promise)
-            const_cast<continuation_task<void>&>(*this).m_promise = std::make_shared<std::promise<void>>();
+            const_cast<continuation_task<void>&>(*this).m_promise =
+                std::allocate_shared<std::promise<void>>(boost::asynchronous::task_allocator<std::promise<void>>(),
+                                                       std::allocator_arg,boost::asynchronous::task_allocator<char>());
         return m_promise->get_future();
     }
 
@@ -300,7 +307,9 @@ public:
     {
         // create only when asked
         if (!m_promise)
-            const_cast<continuation_task<void>&>(*this).m_promise = std::make_shared<std::promise<void>>();
+            const_cast<continuation_task<void>&>(*this).m_promise =
+                std::allocate_shared<std::promise<void>>(boost::asynchronous::task_allocator<std::promise<void>>(),
+                                                       std::allocator_arg,boost::asynchronous::task_allocator<char>());
         return m_promise;
     }
     std::string get_name()const
@@ -715,7 +724,7 @@ struct callback_continuation
                           Args&&... args)
     : m_state(state)
     , m_timeout(d)
-    , m_finished(std::make_shared<subtask_finished>(std::move(t),!!m_state,(m_timeout.count() != 0)))
+    , m_finished(std::allocate_shared<subtask_finished>(boost::asynchronous::task_allocator<subtask_finished>(),std::move(t),!!m_state,(m_timeout.count() != 0)))
     , m_post_policy(post_policy)
     {
         // remember when we started
@@ -747,7 +756,7 @@ struct callback_continuation
                           Args&&... args)
     : m_state(state)
     , m_timeout(d)
-    , m_finished(std::make_shared<subtask_finished>(std::move(t),!!m_state,(m_timeout.count() != 0)))
+    , m_finished(std::allocate_shared<subtask_finished>(boost::asynchronous::task_allocator<subtask_finished>(),std::move(t),!!m_state,(m_timeout.count() != 0)))
     , m_post_policy(post_policy)
     {
         // remember when we started
@@ -777,7 +786,7 @@ struct callback_continuation
                           std::tuple<Args...> args)
     : m_state(state)
     , m_timeout(d)
-    , m_finished(std::make_shared<subtask_finished>(std::move(t),!!m_state,(m_timeout.count() != 0)))
+    , m_finished(std::allocate_shared<subtask_finished>(boost::asynchronous::task_allocator<subtask_finished>(),std::move(t),!!m_state,(m_timeout.count() != 0)))
     , m_post_policy(post_policy)
     {
         // remember when we started
@@ -1248,7 +1257,7 @@ struct callback_continuation_as_seq
                           std::vector<Args> args)
     : m_state(state)
     , m_timeout(d)
-    , m_finished(std::make_shared<subtask_finished>(args.size(),!!m_state,(m_timeout.count() != 0)))
+    , m_finished(std::allocate_shared<subtask_finished>(boost::asynchronous::task_allocator<subtask_finished>(),args.size(),!!m_state,(m_timeout.count() != 0)))
     {
         // remember when we started
         m_start = std::chrono::high_resolution_clock::now();
@@ -1278,7 +1287,7 @@ struct callback_continuation_as_seq
                           std::vector<boost::asynchronous::detail::callback_continuation<Return,Job>> args_)
     : m_state(state)
     , m_timeout(d)
-    , m_finished(std::make_shared<subtask_finished>(args_.size(),!!m_state,(m_timeout.count() != 0)))
+    , m_finished(std::allocate_shared<subtask_finished>(boost::asynchronous::task_allocator<subtask_finished>(),args_.size(),!!m_state,(m_timeout.count() != 0)))
     {
         // remember when we started
         m_start = std::chrono::high_resolution_clock::now();
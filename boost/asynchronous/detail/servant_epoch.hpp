@@ -0,0 +1,205 @@
+// Boost.Asynchronous library
+//  Copyright (C) Christophe Henry 2026
+//
+//  Use, modification and distribution is subject to the Boost
+//  Software License, Version 1.0.  (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// For more information, see http://www.boost.org
+
+#ifndef BOOST_ASYNCHRONOUS_DETAIL_SERVANT_EPOCH_HPP
+#define BOOST_ASYNCHRONOUS_DETAIL_SERVANT_EPOCH_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <boost/thread/thread.hpp>
+
+// Lifetime tracking of servants living in a single-thread scheduler, without reference counting.
+// Each such thread has a table of generation counters. A servant owns a slot and increments its generation
+// when destroyed. A callback remembers the slot and the generation it was created with, and compares them
+// in the servant thread before executing: a plain load instead of a weak_ptr copy and lock.
+// Servants living in several threads use the usual weak_ptr tracking.
+// A servant migrating to another thread marks its slot as moved: callbacks created before stay tracked but
+// are not executed in place in the old thread any more. The servant then gets a slot in its new thread.
+
+namespace boost { namespace asynchronous { namespace detail
+{
+// one per thread. Shared by the servants of the thread so that a servant destroyed after its thread
+// can still invalidate its slot.
+struct servant_epoch_table
+{
+    // set in a slot whose servant left the owner thread
+    static constexpr std::uint64_t moved_flag = std::uint64_t(1) << 63;
+
+    servant_epoch_table(): m_owner(boost::this_thread::get_id()){}
+
+    static std::shared_ptr<servant_epoch_table> const& current()
+    {
+        thread_local std::shared_ptr<servant_epoch_table> table = std::make_shared<servant_epoch_table>();
+        return table;
+    }
+    // only called by the owner thread
+    std::atomic<std::uint64_t>* acquire()
+    {
+        if (!m_free.empty())
+        {
+            std::atomic<std::uint64_t>* slot = m_free.back();
+            m_free.pop_back();
+            return slot;
+        }
+        // deque does not move its elements
+        m_slots.emplace_back(0);
+        return &m_slots.back();
+    }
+    void release(std::atomic<std::uint64_t>* slot)
+    {
+        // outstanding callbacks see another generation
+        std::uint64_t generation = slot->fetch_add(1,std::memory_order_release);
+        // a servant destroyed in another thread, or which moved, leaves its slot unused
+        if (boost::this_thread::get_id() == m_owner && (generation & moved_flag) == 0)
+        {
+            m_free.push_back(slot);
+        }
+    }
+
+    const boost::thread::id m_owner;
+    std::deque<std::atomic<std::uint64_t>> m_slots;
+    std::vector<std::atomic<std::uint64_t>*> m_free;
+};
+
+// what a callback keeps to know if its servant is alive
+struct epoch_token
+{
+    epoch_token() = default;
+    epoch_token(std::atomic<std::uint64_t> const* slot, std::uint64_t generation, boost::thread::id owner)
+        : m_slot(slot), m_generation(generation), m_owner(owner)
+    {}
+    explicit epoch_token(std::weak_ptr<void> fallback)
+        : m_fallback(std::move(fallback))
+    {}
+
+    // true if checked without reference counting, in the owner thread
+    bool is_local()const
+    {
+        return m_slot != nullptr;
+    }
+    // true if the calling thread is the one of the servant
+    bool in_owner_thread()const
+    {
+        return m_slot != nullptr && boost::this_thread::get_id() == m_owner &&
+               (m_slot->load(std::memory_order_relaxed) & boost::asynchronous::detail::servant_epoch_table::moved_flag) == 0;
+    }
+    // to be called from the servant thread if is_local()
+    bool alive()const
+    {
+        if (m_slot != nullptr)
+        {
+            return (m_slot->load(std::memory_order_acquire) & ~boost::asynchronous::detail::servant_epoch_table::moved_flag) == m_generation;
+        }
+        return !m_fallback.expired();
+    }
+
+    std::atomic<std::uint64_t> const* m_slot = nullptr;
+    std::uint64_t m_generation = 0;
+    boost::thread::id m_owner;
+    std::weak_ptr<void> m_fallback;
+};
+
+// owned by a servant
+class servant_epoch
+{
+public:
+    // not tracked by epoch
+    servant_epoch() = default;
+    // tracked in the table of the calling thread, which must be the only thread of the servant
+    explicit servant_epoch(bool)
+        : m_table(boost::asynchronous::detail::servant_epoch_table::current())
+        , m_slot(m_table->acquire())
+        , m_generation(m_slot->load(std::memory_order_relaxed))
+    {}
+    servant_epoch(servant_epoch&& rhs) noexcept
+        : m_table(std::move(rhs.m_table))
+        , m_slot(rhs.m_slot)
+        , m_generation(rhs.m_generation)
+        , m_retired(std::move(rhs.m_retired))
+    {
+        rhs.m_slot = nullptr;
+    }
+    servant_epoch& operator=(servant_epoch&& rhs) noexcept
+    {
+        if (this != &rhs)
+        {
+            reset();
+            m_table = std::move(rhs.m_table);
+            m_slot = rhs.m_slot;
+            m_generation = rhs.m_generation;
+            m_retired = std::move(rhs.m_retired);
+            rhs.m_slot = nullptr;
+        }
+        return *this;
+    }
+    servant_epoch(servant_epoch const&) = delete;
+    servant_epoch& operator=(servant_epoch const&) = delete;
+    ~servant_epoch()
+    {
+        reset();
+    }
+    bool is_active()const
+    {
+        return m_slot != nullptr;
+    }
+    epoch_token token()const
+    {
+        return epoch_token(m_slot,m_generation,m_table->m_owner);
+    }
+    // the servant leaves the owner thread, which must be the calling thread. The slot stays valid until the servant is
+    // destroyed, but is not seen as local any more.
+    void retire()
+    {
+        if (m_slot != nullptr)
+        {
+            m_slot->fetch_or(boost::asynchronous::detail::servant_epoch_table::moved_flag,std::memory_order_release);
+            m_retired.emplace_back(std::move(m_table),m_slot);
+            m_slot = nullptr;
+        }
+    }
+    // tracked again in the table of the calling thread, the new single thread of the servant
+    void attach()
+    {
+        if (m_slot == nullptr)
+        {
+            m_table = boost::asynchronous::detail::servant_epoch_table::current();
+            m_slot = m_table->acquire();
+            m_generation = m_slot->load(std::memory_order_relaxed);
+        }
+    }
+private:
+    void reset()
+    {
+        if (m_slot != nullptr)
+        {
+            m_table->release(m_slot);
+            m_slot = nullptr;
+        }
+        m_table.reset();
+        for (auto& retired : m_retired)
+        {
+            retired.first->release(retired.second);
+        }
+        m_retired.clear();
+    }
+    std::shared_ptr<boost::asynchronous::detail::servant_epoch_table> m_table;
+    std::atomic<std::uint64_t>* m_slot = nullptr;
+    std::uint64_t m_generation = 0;
+    // slots of the threads the servant left
+    std::vector<std::pair<std::shared_ptr<boost::asynchronous::detail::servant_epoch_table>,std::atomic<std::uint64_t>*>> m_retired;
+};
+
+}}} // boost::asynchronous::detail
+
+#endif // BOOST_ASYNCHRONOUS_DETAIL_SERVANT_EPOCH_HPP
@@ -0,0 +1,84 @@
+// Boost.Asynchronous library
+//  Copyright (C) Christophe Henry 2026
+//
+//  Use, modification and distribution is subject to the Boost
+//  Software License, Version 1.0.  (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// For more information, see http://www.boost.org
+
+#ifndef BOOST_ASYNCHRONOUS_MAPPED_FILE_HPP
+#define BOOST_ASYNCHRONOUS_MAPPED_FILE_HPP
+
+#include <cstddef>
+#include <filesystem>
+#include <string>
+#include <string_view>
+
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+
+namespace boost { namespace asynchronous
+{
+// read-only memory-mapped file, seen as a contiguous range of char.
+// Can be given to any parallel algorithm, for example parallel_split_records.
+// The mapping is released in the destructor, the file must stay alive until all algorithms using it are done.
+class mapped_file
+{
+public:
+    typedef char value_type;
+    typedef const char* iterator;
+    typedef const char* const_iterator;
+    typedef std::size_t size_type;
+
+    // throws boost::interprocess::interprocess_exception or std::filesystem::filesystem_error if the file cannot be mapped
+    explicit mapped_file(std::string const& path)
+        : size_(static_cast<std::size_t>(std::filesystem::file_size(path)))
+    {
+        // an empty file cannot be mapped
+        if (size_ != 0)
+        {
+            mapping_ = boost::interprocess::file_mapping(path.c_str(),boost::interprocess::read_only);
+            region_ = boost::interprocess::mapped_region(mapping_,boost::interprocess::read_only,0,size_);
+            // the whole file will be needed soon, by all threads
+            region_.advise(boost::interprocess::mapped_region::advice_willneed);
+        }
+    }
+    mapped_file(mapped_file&&) = default;
+    mapped_file& operator=(mapped_file&&) = default;
+    mapped_file(mapped_file const&) = delete;
+    mapped_file& operator=(mapped_file const&) = delete;
+
+    const char* data() const
+    {
+        return static_cast<const char*>(region_.get_address());
+    }
+    const char* begin() const
+    {
+        return data();
+    }
+    const char* end() const
+    {
+        return data() + size_;
+    }
+    std::size_t size() const
+    {
+        return size_;
+    }
+    bool empty() const
+    {
+        return size_ == 0;
+    }
+    std::string_view view() const
+    {
+        return std::string_view(data(),size_);
+    }
+
+private:
+    std::size_t size_;
+    boost::interprocess::file_mapping mapping_;
+    boost::interprocess::mapped_region region_;
+};
+
+}}
+#endif // BOOST_ASYNCHRONOUS_MAPPED_FILE_HPP
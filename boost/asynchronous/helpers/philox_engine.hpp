@@ -0,0 +1,173 @@
+// Boost.Asynchronous library
+//  Copyright (C) Christophe Henry 2026
+//
+//  Use, modification and distribution is subject to the Boost
+//  Software License, Version 1.0.  (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// For more information, see http://www.boost.org
+
+#ifndef BOOST_ASYNCHRONOUS_PHILOX_ENGINE_HPP
+#define BOOST_ASYNCHRONOUS_PHILOX_ENGINE_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace boost { namespace asynchronous
+{
+
+// Counter-based random engine (Philox4x32-10, Salmon et al., "Parallel random numbers: as easy as 1, 2, 3").
+// Output n of a stream is a pure function of (seed, stream, n): there is no state to share or to seed per thread,
+// any element of any stream can be reached at once with discard(), and different streams are independent.
+// Conforms to the UniformRandomBitGenerator concept.
+class philox4x32
+{
+public:
+    typedef std::uint32_t result_type;
+    typedef std::array<std::uint32_t,4> counter_type;
+    typedef std::array<std::uint32_t,2> key_type;
+    static constexpr std::size_t rounds = 10;
+
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return 0xFFFFFFFFu; }
+
+    explicit philox4x32(std::uint64_t seed = 0, std::uint64_t stream = 0) noexcept
+    {
+        this->seed(seed,stream);
+    }
+    // engine whose first block was already computed, by first_blocks
+    philox4x32(std::uint64_t seed, std::uint64_t stream, counter_type const& first_block) noexcept
+        : key_(make_key(seed)), stream_(stream), block_(1), buffer_(first_block), index_(0)
+    {}
+
+    void seed(std::uint64_t seed, std::uint64_t stream = 0) noexcept
+    {
+        key_ = make_key(seed);
+        stream_ = stream;
+        block_ = 0;
+        index_ = 4;
+    }
+
+    result_type operator()() noexcept
+    {
+        if (index_ == 4)
+        {
+            buffer_ = block(make_counter(block_,stream_),key_);
+            ++block_;
+            index_ = 0;
+        }
+        return buffer_[index_++];
+    }
+
+    // skips z outputs in constant time
+    void discard(unsigned long long z) noexcept
+    {
+        const std::uint64_t left = 4 - index_;
+        if (z <= left)
+        {
+            index_ += static_cast<unsigned>(z);
+            return;
+        }
+        z -= left;
+        block_ += z / 4;
+        index_ = 4;
+        if (z % 4 != 0)
+        {
+            buffer_ = block(make_counter(block_,stream_),key_);
+            ++block_;
+            index_ = static_cast<unsigned>(z % 4);
+        }
+    }
+
+    // the 4 outputs of the Philox4x32-10 bijection for a counter and a key
+    static counter_type block(counter_type ctr, key_type key) noexcept
+    {
+        for (std::size_t r = 0; r < rounds; ++r)
+        {
+            if (r != 0)
+            {
+                key[0] += 0x9E3779B9u;
+                key[1] += 0xBB67AE85u;
+            }
+            const std::uint64_t p0 = static_cast<std::uint64_t>(0xD2511F53u) * ctr[0];
+            const std::uint64_t p1 = static_cast<std::uint64_t>(0xCD9E8D57u) * ctr[2];
+            ctr = {{static_cast<std::uint32_t>(p1 >> 32) ^ ctr[1] ^ key[0], static_cast<std::uint32_t>(p1),
+                    static_cast<std::uint32_t>(p0 >> 32) ^ ctr[3] ^ key[1], static_cast<std::uint32_t>(p0)}};
+        }
+        return ctr;
+    }
+
+    // first blocks of count consecutive streams starting at first_stream, written in structure-of-arrays form
+    // (out[w][i] is word w of stream first_stream+i) so that the loop vectorizes
+    static void first_blocks(std::uint64_t seed, std::uint64_t first_stream, std::size_t count,
+                             std::uint32_t* out0, std::uint32_t* out1, std::uint32_t* out2, std::uint32_t* out3) noexcept
+    {
+        const key_type key = make_key(seed);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            const std::uint64_t stream = first_stream + i;
+            std::uint32_t c0 = 0;
+            std::uint32_t c1 = 0;
+            std::uint32_t c2 = static_cast<std::uint32_t>(stream);
+            std::uint32_t c3 = static_cast<std::uint32_t>(stream >> 32);
+            std::uint32_t k0 = key[0];
+            std::uint32_t k1 = key[1];
+            for (std::size_t r = 0; r < rounds; ++r)
+            {
+                if (r != 0)
+                {
+                    k0 += 0x9E3779B9u;
+                    k1 += 0xBB67AE85u;
+                }
+                const std::uint64_t p0 = static_cast<std::uint64_t>(0xD2511F53u) * c0;
+                const std::uint64_t p1 = static_cast<std::uint64_t>(0xCD9E8D57u) * c2;
+                const std::uint32_t n0 = static_cast<std::uint32_t>(p1 >> 32) ^ c1 ^ k0;
+                const std::uint32_t n2 = static_cast<std::uint32_t>(p0 >> 32) ^ c3 ^ k1;
+                c1 = static_cast<std::uint32_t>(p1);
+                c3 = static_cast<std::uint32_t>(p0);
+                c0 = n0;
+                c2 = n2;
+            }
+            out0[i] = c0;
+            out1[i] = c1;
+            out2[i] = c2;
+            out3[i] = c3;
+        }
+    }
+
+    friend bool operator==(philox4x32 const& lhs, philox4x32 const& rhs) noexcept
+    {
+        return lhs.key_ == rhs.key_ && lhs.stream_ == rhs.stream_ && lhs.position() == rhs.position();
+    }
+    friend bool operator!=(philox4x32 const& lhs, philox4x32 const& rhs) noexcept
+    {
+        return !(lhs == rhs);
+    }
+
+private:
+    static key_type make_key(std::uint64_t seed) noexcept
+    {
+        return {{static_cast<std::uint32_t>(seed), static_cast<std::uint32_t>(seed >> 32)}};
+    }
+    static counter_type make_counter(std::uint64_t block, std::uint64_t stream) noexcept
+    {
+        return {{static_cast<std::uint32_t>(block), static_cast<std::uint32_t>(block >> 32),
+                 static_cast<std::uint32_t>(stream), static_cast<std::uint32_t>(stream >> 32)}};
+    }
+    // index of the next output in the stream
+    std::uint64_t position() const noexcept
+    {
+        return block_ * 4 - (4 - index_);
+    }
+
+    key_type key_;
+    std::uint64_t stream_;
+    // next block to compute
+    std::uint64_t block_;
+    counter_type buffer_;
+    unsigned index_;
+};
+
+}}
+#endif // BOOST_ASYNCHRONOUS_PHILOX_ENGINE_HPP
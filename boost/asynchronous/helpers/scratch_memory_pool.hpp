@@ -0,0 +1,269 @@
+// Boost.Asynchronous library
+//  Copyright (C) Christophe Henry 2026
+//
+//  Use, modification and distribution is subject to the Boost
+//  Software License, Version 1.0.  (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// For more information, see http://www.boost.org
+
+#ifndef BOOST_ASYNCHRONOUS_SCRATCH_MEMORY_POOL_HPP
+#define BOOST_ASYNCHRONOUS_SCRATCH_MEMORY_POOL_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <vector>
+
+#if defined(__linux__) && !defined(BOOST_ASYNCHRONOUS_NO_HUGE_PAGES)
+#define BOOST_ASYNCHRONOUS_LINUX_HUGE_PAGES
+#include <sys/mman.h>
+#endif
+
+// maximum size of the blocks kept for reuse by a pool, unless given to its constructor or set_max_cached.
+// Kept small as the default pool lives until the end of the process, applications sorting big ranges repeatedly
+// can raise it with scratch_memory_pool::default_pool().set_max_cached()
+#ifndef BOOST_ASYNCHRONOUS_SCRATCH_MEMORY_MAX_CACHED
+#define BOOST_ASYNCHRONOUS_SCRATCH_MEMORY_MAX_CACHED (8*1024*1024)
+#endif
+
+namespace boost { namespace asynchronous
+{
+namespace detail
+{
+struct scratch_memory_pool_state
+{
+    // size of a transparent huge page on x86-64 and most aarch64 configurations
+    static constexpr std::size_t huge_page_size = 2 * 1024 * 1024;
+    static constexpr std::size_t min_block_size = 4096;
+
+    explicit scratch_memory_pool_state(std::size_t max_cached)
+        : max_cached_(max_cached)
+    {}
+    ~scratch_memory_pool_state()
+    {
+        release();
+    }
+
+    // blocks are sized in powers of 2 so that buffers of similar sizes share them
+    static std::size_t block_size(std::size_t bytes)
+    {
+        std::size_t res = min_block_size;
+        while (res < bytes)
+        {
+            res *= 2;
+        }
+        return res;
+    }
+
+    char* take(std::size_t size)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto it = blocks_.find(size);
+            if (it != blocks_.end() && !it->second.empty())
+            {
+                char* p = it->second.back();
+                it->second.pop_back();
+                cached_ -= size;
+                return p;
+            }
+        }
+        return allocate_block(size);
+    }
+    void give_back(char* p, std::size_t size) noexcept
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (cached_ + size <= max_cached_)
+            {
+                try
+                {
+                    blocks_[size].push_back(p);
+                    cached_ += size;
+                    return;
+                }
+                catch(...)
+                {
+                    // cannot keep it, free it
+                }
+            }
+        }
+        free_block(p,size);
+    }
+    void release() noexcept
+    {
+        std::map<std::size_t,std::vector<char*>> blocks;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            blocks.swap(blocks_);
+            cached_ = 0;
+        }
+        for (auto& b : blocks)
+        {
+            for (char* p : b.second)
+            {
+                free_block(p,b.first);
+            }
+        }
+    }
+    // frees cached blocks, biggest first, until at most keep_bytes are cached
+    void trim(std::size_t keep_bytes) noexcept
+    {
+        std::vector<std::pair<char*,std::size_t>> to_free;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            for (auto it = blocks_.rbegin(); it != blocks_.rend() && cached_ > keep_bytes; ++it)
+            {
+                while (!it->second.empty() && cached_ > keep_bytes)
+                {
+                    try
+                    {
+                        to_free.emplace_back(it->second.back(),it->first);
+                    }
+                    catch(...)
+                    {
+                        // freed under the lock instead
+                        free_block(it->second.back(),it->first);
+                    }
+                    it->second.pop_back();
+                    cached_ -= it->first;
+                }
+            }
+        }
+        for (auto const& b : to_free)
+        {
+            free_block(b.first,b.second);
+        }
+    }
+    void set_max_cached(std::size_t max_cached) noexcept
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            max_cached_ = max_cached;
+        }
+        trim(max_cached);
+    }
+    std::size_t cached_bytes() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return cached_;
+    }
+
+    static char* allocate_block(std::size_t size)
+    {
+#ifdef BOOST_ASYNCHRONOUS_LINUX_HUGE_PAGES
+        if (size >= huge_page_size)
+        {
+#ifdef BOOST_ASYNCHRONOUS_SCRATCH_MEMORY_HUGETLB
+            // reserved huge pages (vm.nr_hugepages), if any left
+            void* huge = ::mmap(nullptr,size,PROT_READ | PROT_WRITE,MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB,-1,0);
+            if (huge != MAP_FAILED)
+            {
+                return static_cast<char*>(huge);
+            }
+#endif
+            // over-allocate to align on a huge page, then give back head and tail
+            void* raw = ::mmap(nullptr,size + huge_page_size,PROT_READ | PROT_WRITE,MAP_PRIVATE | MAP_ANONYMOUS,-1,0);
+            if (raw == MAP_FAILED)
+            {
+                throw std::bad_alloc();
+            }
+            std::uintptr_t start = reinterpret_cast<std::uintptr_t>(raw);
+            std::uintptr_t aligned = (start + huge_page_size - 1) / huge_page_size * huge_page_size;
+            if (aligned != start)
+            {
+                ::munmap(raw,aligned - start);
+            }
+            std::size_t tail = huge_page_size - (aligned - start);
+            if (tail != 0)
+            {
+                ::munmap(reinterpret_cast<char*>(aligned) + size,tail);
+            }
+            // a hint, ignored if transparent huge pages are disabled
+            ::madvise(reinterpret_cast<char*>(aligned),size,MADV_HUGEPAGE);
+            return reinterpret_cast<char*>(aligned);
+        }
+#endif
+        return static_cast<char*>(::operator new(size));
+    }
+    static void free_block(char* p, std::size_t size) noexcept
+    {
+#ifdef BOOST_ASYNCHRONOUS_LINUX_HUGE_PAGES
+        if (size >= huge_page_size)
+        {
+            ::munmap(p,size);
+            return;
+        }
+#else
+        (void)size;
+#endif
+        ::operator delete(p);
+    }
+
+    mutable std::mutex mutex_;
+    std::map<std::size_t,std::vector<char*>> blocks_;
+    std::size_t cached_ = 0;
+    std::size_t max_cached_;
+};
+}
+
+// Pool of raw memory for temporary buffers of algorithms (merge memory of parallel_sort, vector temporaries...).
+// Freed buffers are kept for the next ones instead of being returned to the system, which avoids
+// page-faulting the whole buffer again at each call. Buffers of 2MB or more are aligned on and
+// backed by huge pages when the system supports it.
+// Buffers keep the pool alive, so a pool can be destroyed while buffers are still in use.
+class scratch_memory_pool
+{
+public:
+    explicit scratch_memory_pool(std::size_t max_cached_bytes = BOOST_ASYNCHRONOUS_SCRATCH_MEMORY_MAX_CACHED)
+        : state_(std::make_shared<boost::asynchronous::detail::scratch_memory_pool_state>(max_cached_bytes))
+    {}
+
+    // uninitialized memory of at least the given size, given back to the pool when the last copy is destroyed
+    std::shared_ptr<char> allocate(std::size_t bytes)
+    {
+        std::size_t size = boost::asynchronous::detail::scratch_memory_pool_state::block_size(bytes);
+        auto state = state_;
+        return std::shared_ptr<char>(state->take(size),[state,size](char* p){state->give_back(p,size);});
+    }
+
+    // frees all cached blocks. Blocks in use are not affected
+    void release() noexcept
+    {
+        state_->release();
+    }
+
+    // frees cached blocks, biggest first, until at most keep_bytes are cached. Blocks in use are not affected
+    void trim(std::size_t keep_bytes = 0) noexcept
+    {
+        state_->trim(keep_bytes);
+    }
+
+    // changes the maximum size of the blocks kept for reuse and frees those above it
+    void set_max_cached(std::size_t max_cached_bytes) noexcept
+    {
+        state_->set_max_cached(max_cached_bytes);
+    }
+
+    std::size_t cached_bytes() const
+    {
+        return state_->cached_bytes();
+    }
+
+    // pool used by the library's algorithms and containers
+    static scratch_memory_pool& default_pool()
+    {
+        static scratch_memory_pool pool;
+        return pool;
+    }
+
+private:
+    std::shared_ptr<boost::asynchronous::detail::scratch_memory_pool_state> state_;
+};
+
+}}
+#endif // BOOST_ASYNCHRONOUS_SCRATCH_MEMORY_POOL_HPP
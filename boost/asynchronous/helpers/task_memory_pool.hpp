@@ -0,0 +1,293 @@
+// Boost.Asynchronous library
+//  Copyright (C) Christophe Henry 2026
+//
+//  Use, modification and distribution is subject to the Boost
+//  Software License, Version 1.0.  (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// For more information, see http://www.boost.org
+
+#ifndef BOOST_ASYNCHRONOUS_TASK_MEMORY_POOL_HPP
+#define BOOST_ASYNCHRONOUS_TASK_MEMORY_POOL_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <mutex>
+#include <new>
+#include <vector>
+
+// number of blocks moved at once between a thread cache and the shared pool
+#ifndef BOOST_ASYNCHRONOUS_TASK_MEMORY_POOL_BATCH
+#define BOOST_ASYNCHRONOUS_TASK_MEMORY_POOL_BATCH 64
+#endif
+
+namespace boost { namespace asynchronous
+{
+namespace detail
+{
+// Small blocks (up to max_block_size) are sorted in size classes of 16 bytes.
+// Each thread keeps a free list per class, refilled from and given back to shared lists by batches,
+// so that most allocations and deallocations take no lock.
+struct task_memory_pool_shared
+{
+    static constexpr std::size_t granularity = 16;
+    static constexpr std::size_t max_block_size = 512;
+    static constexpr std::size_t classes = max_block_size / granularity;
+    static constexpr std::size_t chunk_size = 64 * 1024;
+    static constexpr std::size_t batch = BOOST_ASYNCHRONOUS_TASK_MEMORY_POOL_BATCH;
+
+    struct node
+    {
+        node* next;
+    };
+
+    static std::size_t class_of(std::size_t bytes)
+    {
+        return bytes == 0 ? 0 : (bytes - 1) / granularity;
+    }
+    static std::size_t class_size(std::size_t c)
+    {
+        return (c + 1) * granularity;
+    }
+
+    // takes up to batch blocks of class c, carving a new chunk if none left. Returns the number taken
+    std::size_t take(std::size_t c, node*& head)
+    {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (heads_[c] != nullptr)
+            {
+                std::size_t taken = 0;
+                node* first = heads_[c];
+                node* last = first;
+                while (++taken < batch && last->next != nullptr)
+                {
+                    last = last->next;
+                }
+                heads_[c] = last->next;
+                last->next = head;
+                head = first;
+                return taken;
+            }
+        }
+        // new chunk, carved outside of the lock. The caller gets a batch, the rest is shared
+        const std::size_t size = class_size(c);
+        const std::size_t count = chunk_size / size;
+        char* chunk = static_cast<char*>(::operator new(chunk_size));
+        for (std::size_t i = 0; i + 1 < count; ++i)
+        {
+            reinterpret_cast<node*>(chunk + i * size)->next = reinterpret_cast<node*>(chunk + (i + 1) * size);
+        }
+        const std::size_t taken = std::min(batch,count);
+        node* last_taken = reinterpret_cast<node*>(chunk + (taken - 1) * size);
+        node* rest = last_taken->next;
+        last_taken->next = head;
+        head = reinterpret_cast<node*>(chunk);
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            chunks_.push_back(chunk);
+            if (taken < count)
+            {
+                reinterpret_cast<node*>(chunk + (count - 1) * size)->next = heads_[c];
+                heads_[c] = rest;
+            }
+        }
+        return taken;
+    }
+    // gives back the list [first,last]
+    void give_back(std::size_t c, node* first, node* last) noexcept
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        last->next = heads_[c];
+        heads_[c] = first;
+    }
+    std::size_t chunk_count() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return chunks_.size();
+    }
+
+    // never destroyed: thread caches may give blocks back during static destruction
+    static task_memory_pool_shared& instance()
+    {
+        static task_memory_pool_shared* pool = new task_memory_pool_shared;
+        return *pool;
+    }
+
+    mutable std::mutex mutex_;
+    node* heads_[classes] = {};
+    std::vector<char*> chunks_;
+};
+
+struct task_memory_pool_cache
+{
+    typedef boost::asynchronous::detail::task_memory_pool_shared shared_type;
+    typedef shared_type::node node;
+
+    ~task_memory_pool_cache()
+    {
+        destroyed() = true;
+        for (std::size_t c = 0; c < shared_type::classes; ++c)
+        {
+            if (heads_[c] != nullptr)
+            {
+                node* last = heads_[c];
+                while (last->next != nullptr)
+                {
+                    last = last->next;
+                }
+                shared_type::instance().give_back(c,heads_[c],last);
+            }
+        }
+    }
+    void* allocate(std::size_t c)
+    {
+        if (heads_[c] == nullptr)
+        {
+            counts_[c] += shared_type::instance().take(c,heads_[c]);
+        }
+        node* n = heads_[c];
+        heads_[c] = n->next;
+        --counts_[c];
+        return n;
+    }
+    void deallocate(void* p, std::size_t c) noexcept
+    {
+        node* n = static_cast<node*>(p);
+        n->next = heads_[c];
+        heads_[c] = n;
+        // memory freed by another thread than the one allocating it accumulates here, return a batch
+        if (++counts_[c] >= 2 * shared_type::batch)
+        {
+            node* first = heads_[c];
+            node* last = first;
+            for (std::size_t i = 1; i < shared_type::batch; ++i)
+            {
+                last = last->next;
+            }
+            heads_[c] = last->next;
+            counts_[c] -= shared_type::batch;
+            shared_type::instance().give_back(c,first,last);
+        }
+    }
+    // trivially destructible, readable while other thread_local objects are being destroyed
+    static bool& destroyed()
+    {
+        static thread_local bool d = false;
+        return d;
+    }
+    static task_memory_pool_cache& instance()
+    {
+        static thread_local task_memory_pool_cache cache;
+        return cache;
+    }
+
+    node* heads_[shared_type::classes] = {};
+    std::size_t counts_[shared_type::classes] = {};
+};
+}
+
+// Thread-caching pool for the small, short-lived objects created by continuations: callback_continuation states,
+// promises of continuation_task and post_future. A parallel algorithm creates such objects for every task,
+// so taking them from a per-thread cache instead of global new avoids allocator contention.
+// Memory is kept for reuse and never given back to the system.
+// Define BOOST_ASYNCHRONOUS_NO_TASK_MEMORY_POOL to use global new instead.
+struct task_memory_pool
+{
+    static void* allocate(std::size_t bytes)
+    {
+#ifndef BOOST_ASYNCHRONOUS_NO_TASK_MEMORY_POOL
+        if (bytes <= boost::asynchronous::detail::task_memory_pool_shared::max_block_size)
+        {
+            std::size_t c = boost::asynchronous::detail::task_memory_pool_shared::class_of(bytes);
+            if (!boost::asynchronous::detail::task_memory_pool_cache::destroyed())
+            {
+                return boost::asynchronous::detail::task_memory_pool_cache::instance().allocate(c);
+            }
+            // thread ending, go to the shared lists
+            boost::asynchronous::detail::task_memory_pool_shared::node* head = nullptr;
+            boost::asynchronous::detail::task_memory_pool_shared::instance().take(c,head);
+            void* res = head;
+            head = head->next;
+            if (head != nullptr)
+            {
+                boost::asynchronous::detail::task_memory_pool_shared::node* last = head;
+                while (last->next != nullptr)
+                {
+                    last = last->next;
+                }
+                boost::asynchronous::detail::task_memory_pool_shared::instance().give_back(c,head,last);
+            }
+            return res;
+        }
+#endif
+        return ::operator new(bytes);
+    }
+    static void deallocate(void* p, std::size_t bytes) noexcept
+    {
+#ifndef BOOST_ASYNCHRONOUS_NO_TASK_MEMORY_POOL
+        if (bytes <= boost::asynchronous::detail::task_memory_pool_shared::max_block_size)
+        {
+            std::size_t c = boost::asynchronous::detail::task_memory_pool_shared::class_of(bytes);
+            if (!boost::asynchronous::detail::task_memory_pool_cache::destroyed())
+            {
+                boost::asynchronous::detail::task_memory_pool_cache::instance().deallocate(p,c);
+            }
+            else
+            {
+                auto* n = static_cast<boost::asynchronous::detail::task_memory_pool_shared::node*>(p);
+                boost::asynchronous::detail::task_memory_pool_shared::instance().give_back(c,n,n);
+            }
+            return;
+        }
+#endif
+        ::operator delete(p);
+    }
+    // number of 64KB chunks taken from the system so far
+    static std::size_t chunk_count()
+    {
+        return boost::asynchronous::detail::task_memory_pool_shared::instance().chunk_count();
+    }
+};
+
+// allocator using task_memory_pool, for allocate_shared and std::promise
+template <class T>
+struct task_allocator
+{
+    typedef T value_type;
+
+    task_allocator() noexcept = default;
+    template <class U>
+    task_allocator(task_allocator<U> const&) noexcept {}
+
+    T* allocate(std::size_t n)
+    {
+        if (alignof(T) > boost::asynchronous::detail::task_memory_pool_shared::granularity)
+        {
+            return static_cast<T*>(::operator new(n * sizeof(T),std::align_val_t(alignof(T))));
+        }
+        return static_cast<T*>(boost::asynchronous::task_memory_pool::allocate(n * sizeof(T)));
+    }
+    void deallocate(T* p, std::size_t n) noexcept
+    {
+        if (alignof(T) > boost::asynchronous::detail::task_memory_pool_shared::granularity)
+        {
+            ::operator delete(p,std::align_val_t(alignof(T)));
+            return;
+        }
+        boost::asynchronous::task_memory_pool::deallocate(p,n * sizeof(T));
+    }
+    template <class U>
+    bool operator==(task_allocator<U> const&) const noexcept
+    {
+        return true;
+    }
+    template <class U>
+    bool operator!=(task_allocator<U> const&) const noexcept
+    {
+        return false;
+    }
+};
+
+}}
+#endif // BOOST_ASYNCHRONOUS_TASK_MEMORY_POOL_HPP
@@ -16,6 +16,7 @@
 #include <future>
 #include <cstdint>
 #include <iostream>
+#include <algorithm>
 
 #include <boost/uuid/uuid.hpp>
 
@@ -46,14 +47,26 @@ struct local_subscription
         Topic, // topic entry for this scheduler
         subscriber_t>; //callback
 
+    // topics like channel_topic provide an index to find subscribers without checking each of them
+    static constexpr bool indexed = boost::asynchronous::subscription::topic_index<Topic, std::int64_t>::value;
+
     void cleanup_subscriber()
     {
+        if (m_marked_subscribers == 0)
+        {
+            return;
+        }
+        m_marked_subscribers = 0;
         for (auto it = m_internal_subscribers.begin(); it != m_internal_subscribers.end(); ) 
         {
             if (std::get<bool>((*it).second))
             {
                 // remove waiting subscription
                 boost::asynchronous::subscription::get_waiting_subscribes().erase((*it).first);
+                if constexpr (indexed)
+                {
+                    m_internal_index.erase(std::get<Topic>((*it).second).view(), (*it).first);
+                }
                 it = m_internal_subscribers.erase(it);
             }
             else
@@ -66,6 +79,15 @@ struct local_subscription
     template <class Sub>
     void subscribe(Sub&& sub, std::int64_t token, Topic const& topic)
     {
+        if constexpr (indexed)
+        {
+            auto it = m_internal_subscribers.find(token);
+            if (it != m_internal_subscribers.end())
+            {
+                m_internal_index.erase(std::get<Topic>((*it).second).view(), token);
+            }
+            m_internal_index.insert(topic.view(), token);
+        }
         m_internal_subscribers.insert_or_assign(token, std::make_tuple(std::forward<Sub>(sub),topic, false));
     }
 
@@ -82,6 +104,7 @@ struct local_subscription
         if (it == m_scheduler_subscribers.end())
         {
             m_scheduler_subscribers.emplace_back(std::make_tuple(std::move(scheduler_id), topic, std::forward<Sub>(sub)));
+            m_scheduler_index_valid = false;
         }
         else
         {
@@ -99,7 +122,11 @@ struct local_subscription
             auto it = m_internal_subscribers.find(token);
             if (it != m_internal_subscribers.end() && std::get<Topic>((*it).second) == topic)
             {
-                std::get<bool>((*it).second) = true; // mark as removeable
+                if (!std::get<bool>((*it).second))
+                {
+                    std::get<bool>((*it).second) = true; // mark as removeable
+                    ++m_marked_subscribers;
+                }
             }
         }
         else
@@ -108,6 +135,10 @@ struct local_subscription
             if (it != m_internal_subscribers.end() && std::get<Topic>((*it).second) == topic)
             {
                 // we can immediately remove
+                if constexpr (indexed)
+                {
+                    m_internal_index.erase(topic.view(), token);
+                }
                 m_internal_subscribers.erase(it);
                 // remove waiting subscription
                 boost::asynchronous::subscription::get_waiting_subscribes().erase(token);
@@ -134,6 +165,11 @@ struct local_subscription
     
     void cleanup_deleted_schedulers()
     {
+        if (m_deleted_scheduler_subscribers.empty())
+        {
+            return;
+        }
+        m_scheduler_index_valid = false;
         m_scheduler_subscribers.erase(
             std::remove_if(m_scheduler_subscribers.begin(), m_scheduler_subscribers.end(),
                 [&](auto const& sub) 
@@ -163,11 +199,35 @@ struct local_subscription
         // inform first other schedulers
         // to avoid event order inversion in case processing an event would send another event
         // external schedulers execute publishing asynchronously and therefore are not counted as handling the event
-        for (auto& sched_sub : m_scheduler_subscribers)
+        if constexpr (indexed)
         {
-            if (std::get<Topic>(sched_sub).matches(other_topic))
+            if (!m_scheduler_index_valid)
             {
-                std::get<subscriber_t>(sched_sub)(e, other_topic);
+                // rebuilt after scheduler (un)subscriptions, which are rare
+                m_scheduler_index.clear();
+                for (std::size_t i = 0; i < m_scheduler_subscribers.size(); ++i)
+                {
+                    m_scheduler_index.insert(std::get<Topic>(m_scheduler_subscribers[i]).view(), i);
+                }
+                m_scheduler_index_valid = true;
+            }
+            std::vector<std::size_t> matched;
+            m_scheduler_index.match(other_topic.view(), matched);
+            // in subscription order
+            std::sort(matched.begin(), matched.end());
+            for (std::size_t i : matched)
+            {
+                std::get<subscriber_t>(m_scheduler_subscribers[i])(e, other_topic);
+            }
+        }
+        else
+        {
+            for (auto& sched_sub : m_scheduler_subscribers)
+            {
+                if (std::get<Topic>(sched_sub).matches(other_topic))
+                {
+                    std::get<subscriber_t>(sched_sub)(e, other_topic);
+                }
             }
         }
         bool res = publish_internal(std::forward<Ev>(e), other_topic);
@@ -180,26 +240,41 @@ struct local_subscription
     {
         ++m_publish_counter;
         bool someone_handled = false;
-        for (auto it = m_internal_subscribers.begin(); it != m_internal_subscribers.end();++it)
+        auto notify = [&](internal_subscriber_t& subscriber)
         {
-            if (std::get<subscriber_t>((*it).second) && !std::get<bool>((*it).second) && std::get<Topic>((*it).second).matches(other_topic))
+            std::optional<bool> handled = (std::get<subscriber_t>(subscriber))(e, other_topic);
+            if (handled.has_value() && handled.value())
             {
-                std::optional<bool> handled;
-                if constexpr (std::is_same_v<Topic, boost::asynchronous::subscription::no_topic>)
-                {
-                    handled = (std::get<subscriber_t>((*it).second))(e, other_topic);
-                }
-                else
-                {
-                    handled = (std::get<subscriber_t>((*it).second))(e, other_topic);
-                }
-                if (handled.has_value() && handled.value())
+                someone_handled = true;
+            }
+            else
+            {
+                std::get<bool>(subscriber) = true;
+                ++m_marked_subscribers;
+            }
+        };
+        if constexpr (indexed)
+        {
+            // only the matching subscribers, in subscription order
+            std::vector<std::int64_t> matched;
+            m_internal_index.match(other_topic.view(), matched);
+            std::sort(matched.begin(), matched.end());
+            for (std::int64_t token : matched)
+            {
+                auto it = m_internal_subscribers.find(token);
+                if (it != m_internal_subscribers.end() && std::get<subscriber_t>((*it).second) && !std::get<bool>((*it).second))
                 {
-                    someone_handled = true;
+                    notify((*it).second);
                 }
-                else
+            }
+        }
+        else
+        {
+            for (auto it = m_internal_subscribers.begin(); it != m_internal_subscribers.end();++it)
+            {
+                if (std::get<subscriber_t>((*it).second) && !std::get<bool>((*it).second) && std::get<Topic>((*it).second).matches(other_topic))
                 {
-                    std::get<bool>((*it).second) = true;
+                    notify((*it).second);
                 }
             }
         }
@@ -215,10 +290,17 @@ struct local_subscription
     }
 
     std::int16_t                                                        m_publish_counter = 0;
+    // subscribers marked as removeable, cleanup is not needed if none
+    std::size_t                                                         m_marked_subscribers = 0;
     std::map<std::int64_t, internal_subscriber_t>                       m_internal_subscribers;
     std::vector<scheduler_subscriber_t>                                 m_scheduler_subscribers;
     // in order not to invalidate iterators during publish, remember deleted ids and cleanup later
     std::vector< std::tuple<boost::uuids::uuid, std::optional<Topic>>>  m_deleted_scheduler_subscribers;
+    // tokens of m_internal_subscribers by topic
+    typename boost::asynchronous::subscription::topic_index<Topic, std::int64_t>::type m_internal_index;
+    // positions in m_scheduler_subscribers by topic
+    typename boost::asynchronous::subscription::topic_index<Topic, std::size_t>::type  m_scheduler_index;
+    bool                                                                m_scheduler_index_valid = false;
 };
 
 // inline thread local subscriptions
@@ -0,0 +1,107 @@
+// Boost.Asynchronous library
+//  Copyright (C) Christophe Henry 2026
+//
+//  Use, modification and distribution is subject to the Boost
+//  Software License, Version 1.0.  (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// For more information, see http://www.boost.org
+
+#ifndef BOOST_ASYNCHRONOUS_NOTIFICATION_BATCH_HPP
+#define BOOST_ASYNCHRONOUS_NOTIFICATION_BATCH_HPP
+
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include <boost/asynchronous/post.hpp>
+
+// Delivery of events to the schedulers subscribed to them with trackable_servant::subscribe_batched.
+// Instead of one job per event and destination, events for a scheduler thread are appended to a buffer shared by all publishers,
+// and one flush job delivers all events appended until it starts executing, or at most BOOST_ASYNCHRONOUS_NOTIFICATION_BATCH of them.
+// Events are delivered in the order they were appended, whichever thread published them, and never later than they would
+// have with one job per event. They can however be delivered before jobs posted to the destination after the flush job,
+// including calls made by the publisher between two events, which is why batching is not the default.
+
+// maximum number of events delivered by one flush job
+#ifndef BOOST_ASYNCHRONOUS_NOTIFICATION_BATCH
+#define BOOST_ASYNCHRONOUS_NOTIFICATION_BATCH 256
+#endif
+
+namespace boost { namespace asynchronous { namespace subscription
+{
+class notification_batch : public std::enable_shared_from_this<notification_batch>
+{
+public:
+    using events_t = std::vector<std::function<void()>>;
+
+    // called by publishers, from any thread
+    template <class Scheduler>
+    void post(Scheduler const& sched, std::function<void()> deliver, std::string const& task_name, std::size_t prio)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!m_open || m_open->size() >= BOOST_ASYNCHRONOUS_NOTIFICATION_BATCH)
+        {
+            // the flush jobs are posted in the order their events were appended
+            m_open = std::make_shared<events_t>();
+            m_open->reserve(16);
+            boost::asynchronous::post_future(sched,
+                [this_ = shared_from_this(), events = m_open]()
+                {
+                    this_->flush(events);
+                },
+                task_name, prio);
+        }
+        m_open->push_back(std::move(deliver));
+    }
+
+private:
+    // called in the destination thread
+    void flush(std::shared_ptr<events_t> const& events)
+    {
+        events_t todo;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            // events published from now on need a new flush job, they must not come before jobs posted in between
+            if (m_open == events)
+            {
+                m_open.reset();
+            }
+            todo.swap(*events);
+        }
+        for (auto& deliver : todo)
+        {
+            try
+            {
+                deliver();
+            }
+            catch (...)
+            {
+                // as with one job per event, a failing subscriber does not prevent delivering the next events
+            }
+        }
+    }
+
+    std::mutex                  m_mutex;
+    // events not delivered yet, whose flush job did not start
+    std::shared_ptr<events_t>   m_open;
+};
+
+// the buffer of the events for this thread, one per priority
+inline std::shared_ptr<notification_batch> get_notification_batch_(std::size_t prio)
+{
+    static thread_local std::map<std::size_t, std::shared_ptr<notification_batch>> batches;
+    std::shared_ptr<notification_batch>& batch = batches[prio];
+    if (!batch)
+    {
+        batch = std::make_shared<notification_batch>();
+    }
+    return batch;
+}
+
+}}}
+#endif // BOOST_ASYNCHRONOUS_NOTIFICATION_BATCH_HPP
@@ -0,0 +1,206 @@
+// Boost.Asynchronous library
+//  Copyright (C) Christophe Henry 2026
+//
+//  Use, modification and distribution is subject to the Boost
+//  Software License, Version 1.0.  (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// For more information, see http://www.boost.org
+
+#ifndef BOOST_ASYNCHRONOUS_NOTIFICATION_TOPIC_TRIE_HPP
+#define BOOST_ASYNCHRONOUS_NOTIFICATION_TOPIC_TRIE_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Index of subscribed channel topics, one node per path segment, with a separate branch for the wildcard.
+// Finding the subscribers of a published topic walks its segments, costing O(depth + matches)
+// instead of one channel_topic::matches per subscriber. Same rules as channel_topic::matches:
+// a subscribed topic matches the published topic, its subchannels, and "." matches any single segment.
+
+namespace boost { namespace asynchronous { namespace subscription
+{
+template <class Value, char Separator = '/', char Wildcard = '.'>
+class topic_trie
+{
+public:
+    void insert(std::string_view topic, Value v)
+    {
+        topic = trim_trailing_separator(topic);
+        node* n = &m_root;
+        while (!topic.empty())
+        {
+            std::string_view token = next_token(topic);
+            std::unique_ptr<node>& child = is_wildcard(token) ? n->m_wildcard : n->child(token);
+            if (!child)
+            {
+                child = std::make_unique<node>();
+            }
+            n = child.get();
+        }
+        n->m_values.push_back(std::move(v));
+        ++m_size;
+    }
+
+    // returns false if not found
+    bool erase(std::string_view topic, Value const& v)
+    {
+        return erase(m_root,trim_trailing_separator(topic),v);
+    }
+
+    // appends the values of the topics matching the published topic, in no particular order
+    void match(std::string_view published, std::vector<Value>& res) const
+    {
+        match(m_root,trim_trailing_separator(published),res);
+    }
+
+    std::size_t size() const
+    {
+        return m_size;
+    }
+    bool empty() const
+    {
+        return m_size == 0;
+    }
+    void clear()
+    {
+        m_root = node();
+        m_size = 0;
+    }
+
+private:
+    struct node
+    {
+        std::unique_ptr<node>& child(std::string_view token)
+        {
+            auto it = m_children.find(token);
+            if (it == m_children.end())
+            {
+                it = m_children.emplace(std::string(token),std::unique_ptr<node>()).first;
+            }
+            return it->second;
+        }
+        bool unused() const
+        {
+            return m_values.empty() && m_children.empty() && !m_wildcard;
+        }
+        std::map<std::string, std::unique_ptr<node>, std::less<>> m_children;
+        std::unique_ptr<node> m_wildcard;
+        std::vector<Value> m_values;
+    };
+
+    static bool is_wildcard(std::string_view token)
+    {
+        return token.size() == 1 && token.front() == Wildcard;
+    }
+    static std::string_view trim_trailing_separator(std::string_view path)
+    {
+        while (!path.empty() && path.back() == Separator)
+        {
+            path.remove_suffix(1);
+        }
+        return path;
+    }
+    static std::string_view next_token(std::string_view& path)
+    {
+        auto pos = path.find(Separator);
+        std::string_view token = (pos == std::string_view::npos) ? path : path.substr(0, pos);
+        path.remove_prefix(std::min(token.size() + 1, path.size()));
+        return token;
+    }
+
+    static void match(node const& n, std::string_view published, std::vector<Value>& res)
+    {
+        // a subscribed topic ending here matches the published topic or one of its parents
+        res.insert(res.end(),n.m_values.begin(),n.m_values.end());
+        if (published.empty())
+        {
+            return;
+        }
+        std::string_view token = next_token(published);
+        // an empty segment matches no subscribed segment, not even the wildcard
+        if (token.empty())
+        {
+            return;
+        }
+        auto it = n.m_children.find(token);
+        if (it != n.m_children.end())
+        {
+            match(*it->second,published,res);
+        }
+        if (n.m_wildcard)
+        {
+            match(*n.m_wildcard,published,res);
+        }
+    }
+
+    bool erase(node& n, std::string_view topic, Value const& v)
+    {
+        if (topic.empty())
+        {
+            auto it = std::find(n.m_values.begin(),n.m_values.end(),v);
+            if (it == n.m_values.end())
+            {
+                return false;
+            }
+            n.m_values.erase(it);
+            --m_size;
+            return true;
+        }
+        std::string_view token = next_token(topic);
+        if (is_wildcard(token))
+        {
+            if (!n.m_wildcard || !erase(*n.m_wildcard,topic,v))
+            {
+                return false;
+            }
+            if (n.m_wildcard->unused())
+            {
+                n.m_wildcard.reset();
+            }
+            return true;
+        }
+        auto it = n.m_children.find(token);
+        if (it == n.m_children.end() || !erase(*it->second,topic,v))
+        {
+            return false;
+        }
+        if (it->second->unused())
+        {
+            n.m_children.erase(it);
+        }
+        return true;
+    }
+
+    node m_root;
+    std::size_t m_size = 0;
+};
+
+// topics without index: publish checks every subscriber
+struct no_topic_index
+{
+};
+
+// the index a topic type provides for subscribers identified by Value, if any
+template <class Topic, class Value>
+struct topic_index
+{
+    using type = boost::asynchronous::subscription::no_topic_index;
+    static constexpr bool value = false;
+};
+template <class Topic, class Value>
+requires requires { typename Topic::template index_type<Value>; }
+struct topic_index<Topic, Value>
+{
+    using type = typename Topic::template index_type<Value>;
+    static constexpr bool value = true;
+};
+
+}}}
+#endif // BOOST_ASYNCHRONOUS_NOTIFICATION_TOPIC_TRIE_HPP
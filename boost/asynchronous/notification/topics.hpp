@@ -14,6 +14,7 @@
 #include <string>
 #include <string_view>
 
+#include <boost/asynchronous/notification/topic_trie.hpp>
 
 
 namespace boost { namespace asynchronous { namespace subscription
@@ -66,6 +67,10 @@ namespace boost { namespace asynchronous { namespace subscription
     template <char Separator = '/', char Wildcard = '.'>
     struct channel_topic
     {
+        // subscribers are found with a trie instead of calling matches for each of them
+        template <class Value>
+        using index_type = boost::asynchronous::subscription::topic_trie<Value, Separator, Wildcard>;
+
         channel_topic(std::string const& channel)
             :m_topic(channel)
         {
@@ -89,6 +94,10 @@ namespace boost { namespace asynchronous { namespace subscription
         {
             return m_topic;
         }
+        std::string_view view() const
+        {
+            return m_topic;
+        }
     private:
         static std::string_view trim_trailing_slash(std::string_view path) 
         {
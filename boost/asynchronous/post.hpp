@@ -36,6 +36,7 @@
 #include <boost/asynchronous/scheduler/detail/any_continuation.hpp>
 #include <boost/asynchronous/scheduler/tss_scheduler.hpp>
 #include <boost/asynchronous/detail/metafunctions.hpp>
+#include <boost/asynchronous/helpers/task_memory_pool.hpp>
 #include <boost/asynchronous/scheduler/tcp/detail/client_request.hpp>
 
 namespace boost { namespace asynchronous
@@ -576,7 +577,7 @@ auto post_future(S const& scheduler, F const& func,
     -> std::future<decltype(func())>
 {
     using promise_type = std::promise<decltype(func())>;
-    promise_type p;
+    promise_type p(std::allocator_arg,boost::asynchronous::task_allocator<char>());
     std::future<decltype(func())> fu(p.get_future());
 
     struct post_helper
@@ -625,7 +626,7 @@ auto post_future(S const& scheduler, F const& func,
 #endif
     -> std::future<void>
 {
-    std::promise<void> p;
+    std::promise<void> p(std::allocator_arg,boost::asynchronous::task_allocator<char>());
     std::future<void> fu(p.get_future());
 
     struct post_helper
@@ -673,7 +674,7 @@ auto post_future(S const& scheduler, F const& func,
 #endif
 
 {
-    std::promise<typename decltype(func())::return_type> p;
+    std::promise<typename decltype(func())::return_type> p(std::allocator_arg,boost::asynchronous::task_allocator<char>());
     std::future<typename decltype(func())::return_type> fu(p.get_future());
 
     detail::post_future_helper_continuation<typename decltype(func())::return_type,F,typename S::job_type> fct
@@ -705,7 +706,7 @@ auto interruptible_post_future(S const& scheduler, F const& func,
     -> std::tuple<std::future<decltype(func())>,boost::asynchronous::any_interruptible >
 {
     using promise_type = std::promise<decltype(func())>;
-    promise_type p;
+    promise_type p(std::allocator_arg,boost::asynchronous::task_allocator<char>());
     std::future<decltype(func())> fu(p.get_future());
 
     struct post_helper
@@ -740,7 +741,7 @@ auto interruptible_post_future(S const& scheduler, F const& func,
 #endif
     -> std::tuple<std::future<void>,boost::asynchronous::any_interruptible >
 {
-    std::promise<void> p;
+    std::promise<void> p(std::allocator_arg,boost::asynchronous::task_allocator<char>());
     std::future<void> fu(p.get_future());
 
     struct post_helper
@@ -774,7 +775,7 @@ const std::string& task_name = "", std::size_t prio = 0, typename std::enable_if
 #endif
 
 {
-    std::promise<typename decltype(func())::return_type> p;
+    std::promise<typename decltype(func())::return_type> p(std::allocator_arg,boost::asynchronous::task_allocator<char>());
     std::future<typename decltype(func())::return_type> fu(p.get_future());
 
 	detail::post_future_helper_continuation<typename decltype(func())::return_type, F, typename S::job_type> fct
@@ -0,0 +1,544 @@
+// Boost.Asynchronous library
+//  Copyright (C) Christophe Henry 2026
+//
+//  Use, modification and distribution is subject to the Boost
+//  Software License, Version 1.0.  (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// For more information, see http://www.boost.org
+
+// Scheduler proxy bounding the number of jobs in flight (posted and not yet executed) for a servant.
+// Calls made through the proxy beyond the limit are handled according to an overflow_policy.
+// Jobs the servant posts to itself (callbacks, post_self...), as well as its constructor and destructor,
+// are counted but never refused, and a call made from the servant thread never blocks.
+// Usage:
+// auto s = make_bounded_scheduler(servant_scheduler, 1000, boost::asynchronous::overflow_policy::fail);
+// ServantProxy proxy(s, servant args...);
+// std::size_t depth = proxy.get_proxy().get_queue_size()[0];
+
+#ifndef BOOST_ASYNCHRONOUS_SCHEDULER_BOUNDED_SCHEDULER_HPP
+#define BOOST_ASYNCHRONOUS_SCHEDULER_BOUNDED_SCHEDULER_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <boost/thread/thread.hpp>
+
+#include <boost/asynchronous/any_scheduler.hpp>
+#include <boost/asynchronous/any_shared_scheduler_proxy.hpp>
+#include <boost/asynchronous/callable_any.hpp>
+#include <boost/asynchronous/job_traits.hpp>
+#include <boost/asynchronous/scheduler/detail/lockable_weak_scheduler.hpp>
+
+// number of calls executed by a drop_oldest servant before giving other jobs of its scheduler a chance
+#ifndef BOOST_ASYNCHRONOUS_BOUNDED_BATCH
+#define BOOST_ASYNCHRONOUS_BOUNDED_BATCH 64
+#endif
+
+namespace boost { namespace asynchronous
+{
+// what happens to a call made while the limit of jobs in flight is reached
+enum class overflow_policy
+{
+    // the caller waits until a job is executed
+    block,
+    // the call is not executed. A future returned by the call is ready at once with a std::future_error (broken_promise)
+    fail,
+    // the oldest waiting call is not executed (its future gets a broken_promise), the new one is queued.
+    // If all calls in flight are already executing or are the servant's own jobs, the new call is not executed
+
+    drop_oldest,
+    // the call is executed in the calling thread. Only for jobs which may run concurrently, like in a threadpool
+    run_on_caller
+};
+
+struct bounded_scheduler_stats
+{
+    // jobs posted and not yet executed
+    std::size_t in_flight = 0;
+    // highest in_flight since creation or reset_max_queue_size
+    std::size_t max_in_flight = 0;
+    // calls refused, dropped or executed by the caller
+    std::size_t overflows = 0;
+};
+
+namespace detail
+{
+// Seen by the servant as its scheduler. Counts jobs in flight and applies the overflow policy to calls.
+template <class Job>
+class bounded_gate :
+#ifndef BOOST_ASYNCHRONOUS_USE_TYPE_ERASURE
+        public any_shared_scheduler_concept<Job>,
+#endif
+        public std::enable_shared_from_this<bounded_gate<Job> >
+{
+public:
+    typedef Job job_type;
+
+    bounded_gate(boost::asynchronous::any_weak_scheduler<Job> scheduler, std::size_t limit,
+                 boost::asynchronous::overflow_policy policy)
+        : m_scheduler(std::move(scheduler)), m_limit(std::max<std::size_t>(limit,1)), m_policy(policy)
+        , m_in_flight(0), m_max_in_flight(0), m_overflows(0), m_waiting(0), m_pump_posted(false)
+    {}
+
+    // executes a job and counts it as done
+    struct counted_job : public boost::asynchronous::job_traits<Job>::diagnostic_type
+    {
+        counted_job(std::shared_ptr<bounded_gate> gate, Job job)
+            : m_gate(std::move(gate)), m_job(std::move(job))
+        {
+            this->set_name(boost::asynchronous::job_traits<Job>::get_name(m_job));
+        }
+        void operator()()
+        {
+            try
+            {
+                m_job();
+            }
+            catch(...)
+            {
+                m_gate->done();
+                throw;
+            }
+            m_gate->done();
+        }
+        std::shared_ptr<bounded_gate> m_gate;
+        Job m_job;
+    };
+    // drop_oldest: executes the calls waiting in the gate, one job of the scheduler at a time
+    struct pump_job
+    {
+        void operator()()
+        {
+            m_gate->pump(m_prio);
+        }
+        std::shared_ptr<bounded_gate> m_gate;
+        std::size_t m_prio;
+    };
+
+    // not bounded: used by the servant itself
+    void post(job_type job)
+    {
+        post(std::move(job),0);
+    }
+    void post(job_type job, std::size_t prio)
+    {
+        boost::asynchronous::any_shared_scheduler<Job> s = m_scheduler.lock();
+        if (s.is_valid())
+        {
+            update_max_in_flight(add_in_flight() + 1);
+            s.post(Job(counted_job(this->shared_from_this(),std::move(job))),prio);
+        }
+    }
+    boost::asynchronous::any_interruptible interruptible_post(job_type job)
+    {
+        return interruptible_post(std::move(job),0);
+    }
+    boost::asynchronous::any_interruptible interruptible_post(job_type job, std::size_t prio)
+    {
+        boost::asynchronous::any_shared_scheduler<Job> s = m_scheduler.lock();
+        if (s.is_valid())
+        {
+            update_max_in_flight(add_in_flight() + 1);
+            return s.interruptible_post(Job(counted_job(this->shared_from_this(),std::move(job))),prio);
+        }
+        return boost::asynchronous::any_interruptible();
+    }
+
+    // bounded: calls made through the proxy
+    void post_bounded(job_type job, std::size_t prio)
+    {
+        boost::asynchronous::any_shared_scheduler<Job> s = m_scheduler.lock();
+        if (!s.is_valid())
+        {
+            return;
+        }
+        if (m_policy == boost::asynchronous::overflow_policy::drop_oldest)
+        {
+            post_drop_oldest(s,std::move(job),prio);
+            return;
+        }
+        std::size_t n = add_in_flight();
+        while (n >= m_limit && !in_scheduler_thread(s))
+        {
+            m_in_flight.fetch_sub(1);
+            if (m_policy == boost::asynchronous::overflow_policy::block)
+            {
+                wait_for_room();
+                n = add_in_flight();
+                continue;
+            }
+            m_overflows.fetch_add(1);
+            if (m_policy == boost::asynchronous::overflow_policy::run_on_caller)
+            {
+                try
+                {
+                    job();
+                }
+                catch(...)
+                {
+                    // like in a scheduler thread
+                }
+            }
+            // fail: job destroyed without execution
+            return;
+        }
+        update_max_in_flight(n + 1);
+        s.post(Job(counted_job(this->shared_from_this(),std::move(job))),prio);
+    }
+
+    std::vector<boost::thread::id> thread_ids() const
+    {
+        boost::asynchronous::any_shared_scheduler<Job> s = m_scheduler.lock();
+        return s.is_valid() ? s.thread_ids() : std::vector<boost::thread::id>();
+    }
+    std::vector<std::size_t> get_queue_size() const
+    {
+        return std::vector<std::size_t>(1,m_in_flight.load());
+    }
+    std::vector<std::size_t> get_max_queue_size() const
+    {
+        return std::vector<std::size_t>(1,m_max_in_flight.load());
+    }
+    void reset_max_queue_size()
+    {
+        m_max_in_flight.store(m_in_flight.load());
+    }
+    boost::asynchronous::scheduler_diagnostics get_diagnostics(std::size_t pos=0) const
+    {
+        boost::asynchronous::any_shared_scheduler<Job> s = m_scheduler.lock();
+        return s.is_valid() ? s.get_diagnostics(pos) : boost::asynchronous::scheduler_diagnostics();
+    }
+    void register_diagnostics_functor(std::function<void(boost::asynchronous::scheduler_diagnostics)>,
+                                      boost::asynchronous::register_diagnostics_type =
+                                            boost::asynchronous::register_diagnostics_type())
+    {
+    }
+    void clear_diagnostics()
+    {
+    }
+    std::string get_name() const
+    {
+        boost::asynchronous::any_shared_scheduler<Job> s = m_scheduler.lock();
+        return s.is_valid() ? s.get_name() : std::string();
+    }
+    void processor_bind(std::vector<std::tuple<unsigned int,unsigned int>>)
+    {
+    }
+    BOOST_ATTRIBUTE_NODISCARD std::vector<std::future<void>> execute_in_all_threads(boost::asynchronous::any_callable)
+    {
+        return std::vector<std::future<void>>();
+    }
+    void enable_queue(std::size_t, bool) override
+    {
+    }
+
+    boost::asynchronous::bounded_scheduler_stats get_stats() const
+    {
+        boost::asynchronous::bounded_scheduler_stats stats;
+        stats.in_flight = m_in_flight.load();
+        stats.max_in_flight = m_max_in_flight.load();
+        stats.overflows = m_overflows.load();
+        return stats;
+    }
+
+    void done()
+    {
+        m_in_flight.fetch_sub(1);
+        if (m_waiting.load() != 0)
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_cond.notify_all();
+        }
+    }
+
+    void pump(std::size_t prio)
+    {
+        for (std::size_t i = 0; i < BOOST_ASYNCHRONOUS_BOUNDED_BATCH; ++i)
+        {
+            Job job;
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                if (m_calls.empty())
+                {
+                    m_pump_posted = false;
+                    return;
+                }
+                job = std::move(m_calls.front());
+                m_calls.pop_front();
+            }
+            try
+            {
+                job();
+            }
+            catch(...)
+            {
+                // like in a scheduler thread
+            }
+            m_in_flight.fetch_sub(1);
+        }
+        // more calls, give the other jobs of the scheduler a chance
+        boost::asynchronous::any_shared_scheduler<Job> s = m_scheduler.lock();
+        if (s.is_valid())
+        {
+            s.post(typename boost::asynchronous::job_traits<Job>::wrapper_type(
+                       boost::asynchronous::any_callable(pump_job{this->shared_from_this(),prio})),prio);
+        }
+    }
+
+private:
+    // returns the number of jobs in flight before this one
+    std::size_t add_in_flight()
+    {
+        return m_in_flight.fetch_add(1);
+    }
+    void update_max_in_flight(std::size_t n)
+    {
+        std::size_t m = m_max_in_flight.load();
+        while (n > m && !m_max_in_flight.compare_exchange_weak(m,n)){}
+    }
+    bool in_scheduler_thread(boost::asynchronous::any_shared_scheduler<Job> const& s) const
+    {
+        std::vector<boost::thread::id> ids = s.thread_ids();
+        return std::find(ids.begin(),ids.end(),boost::this_thread::get_id()) != ids.end();
+    }
+    void wait_for_room()
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_waiting.fetch_add(1);
+        m_cond.wait(lock,[this](){return m_in_flight.load() < m_limit;});
+        m_waiting.fetch_sub(1);
+    }
+    void post_drop_oldest(boost::asynchronous::any_shared_scheduler<Job> const& s, job_type job, std::size_t prio)
+    {
+        Job dropped;
+        bool post_pump = false;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            // the waiting calls count with the others, the one replacing the oldest keeps the count unchanged
+            if (m_in_flight.load() >= m_limit && !in_scheduler_thread(s))
+            {
+                m_overflows.fetch_add(1);
+                if (m_calls.empty())
+                {
+                    dropped = std::move(job);
+                    return;
+                }
+                dropped = std::move(m_calls.front());
+                m_calls.pop_front();
+            }
+            else
+            {
+                update_max_in_flight(add_in_flight() + 1);
+            }
+            m_calls.push_back(std::move(job));
+            if (!m_pump_posted)
+            {
+                m_pump_posted = true;
+                post_pump = true;
+            }
+        }
+        // destroyed outside the lock, it might post
+        dropped = Job();
+        if (post_pump)
+        {
+            s.post(typename boost::asynchronous::job_traits<Job>::wrapper_type(
+                       boost::asynchronous::any_callable(pump_job{this->shared_from_this(),prio})),prio);
+        }
+    }
+
+    boost::asynchronous::any_weak_scheduler<Job> m_scheduler;
+    const std::size_t m_limit;
+    const boost::asynchronous::overflow_policy m_policy;
+    std::atomic<std::size_t> m_in_flight;
+    std::atomic<std::size_t> m_max_in_flight;
+    std::atomic<std::size_t> m_overflows;
+    std::atomic<std::size_t> m_waiting;
+    std::mutex m_mutex;
+    std::condition_variable m_cond;
+    // drop_oldest only
+    std::deque<Job> m_calls;
+    bool m_pump_posted;
+};
+
+// proxy given to a servant_proxy, keeps the scheduler alive. The gate only has a weak reference,
+// as jobs keep it alive in the scheduler.
+template <class Job>
+class bounded_proxy :
+#ifndef BOOST_ASYNCHRONOUS_USE_TYPE_ERASURE
+        public any_shared_scheduler_proxy_concept<Job>,
+        public internal_scheduler_aspect_concept<Job>,
+#endif
+        public std::enable_shared_from_this<bounded_proxy<Job> >
+{
+public:
+    typedef Job job_type;
+
+    bounded_proxy(boost::asynchronous::any_shared_scheduler_proxy<Job> scheduler, std::size_t limit,
+                  boost::asynchronous::overflow_policy policy)
+        : m_scheduler(std::move(scheduler))
+        , m_gate(std::make_shared<boost::asynchronous::detail::bounded_gate<Job>>(m_scheduler.get_weak_scheduler(),limit,policy))
+    {}
+    void post(job_type job) const
+    {
+        m_gate->post_bounded(std::move(job),0);
+    }
+    void post(job_type job, std::size_t prio) const
+    {
+        m_gate->post_bounded(std::move(job),prio);
+    }
+    // interruptible jobs are counted but not bounded
+    boost::asynchronous::any_interruptible interruptible_post(job_type job) const
+    {
+        return m_gate->interruptible_post(std::move(job));
+    }
+    boost::asynchronous::any_interruptible interruptible_post(job_type job, std::size_t prio) const
+    {
+        return m_gate->interruptible_post(std::move(job),prio);
+    }
+    std::vector<boost::thread::id> thread_ids() const
+    {
+        return m_scheduler.thread_ids();
+    }
+    boost::asynchronous::any_weak_scheduler<job_type> get_weak_scheduler() const
+    {
+        boost::asynchronous::detail::lockable_weak_scheduler<boost::asynchronous::detail::bounded_gate<Job>> w(m_gate);
+        return boost::asynchronous::any_weak_scheduler<job_type>(std::move(w));
+    }
+    bool is_valid() const
+    {
+        return !!m_gate;
+    }
+    // jobs of this servant in flight
+    std::vector<std::size_t> get_queue_size() const
+    {
+        return m_gate->get_queue_size();
+    }
+    std::vector<std::size_t> get_max_queue_size() const
+    {
+        return m_gate->get_max_queue_size();
+    }
+    void reset_max_queue_size()
+    {
+        m_gate->reset_max_queue_size();
+    }
+    boost::asynchronous::scheduler_diagnostics get_diagnostics(std::size_t pos=0) const
+    {
+        return m_scheduler.get_diagnostics(pos);
+    }
+    void clear_diagnostics()
+    {
+        m_scheduler.clear_diagnostics();
+    }
+    boost::asynchronous::internal_scheduler_aspect<job_type> get_internal_scheduler_aspect()
+    {
+        return std::static_pointer_cast<boost::asynchronous::internal_scheduler_aspect_concept<job_type>>(this->shared_from_this());
+    }
+    void set_name(std::string const& name)
+    {
+        m_scheduler.set_name(name);
+    }
+    std::string get_name() const
+    {
+        return m_scheduler.get_name();
+    }
+    void processor_bind(std::vector<std::tuple<unsigned int,unsigned int>> p)
+    {
+        m_scheduler.processor_bind(std::move(p));
+    }
+    BOOST_ATTRIBUTE_NODISCARD std::vector<std::future<void>> execute_in_all_threads(boost::asynchronous::any_callable c)
+    {
+        return m_scheduler.execute_in_all_threads(std::move(c));
+    }
+    std::vector<boost::asynchronous::any_queue_ptr<job_type> > get_queues()
+    {
+        return std::vector<boost::asynchronous::any_queue_ptr<job_type> >();
+    }
+    void set_steal_from_queues(std::vector<boost::asynchronous::any_queue_ptr<job_type> > const&)
+    {
+    }
+
+    std::shared_ptr<boost::asynchronous::detail::bounded_gate<Job>> const& get_gate() const
+    {
+        return m_gate;
+    }
+
+private:
+    mutable boost::asynchronous::any_shared_scheduler_proxy<Job> m_scheduler;
+    std::shared_ptr<boost::asynchronous::detail::bounded_gate<Job>> m_gate;
+};
+
+#ifndef BOOST_ASYNCHRONOUS_USE_TYPE_ERASURE
+template <class Job>
+std::shared_ptr<boost::asynchronous::detail::bounded_gate<Job>>
+get_bounded_gate(boost::asynchronous::any_shared_scheduler_proxy<Job> const& proxy)
+{
+    // get_internal_scheduler_aspect does not modify the proxy but is not const
+    std::shared_ptr<boost::asynchronous::detail::bounded_proxy<Job>> b =
+        std::dynamic_pointer_cast<boost::asynchronous::detail::bounded_proxy<Job>>(
+            const_cast<boost::asynchronous::any_shared_scheduler_proxy<Job>&>(proxy).get_internal_scheduler_aspect());
+    return b ? b->get_gate() : std::shared_ptr<boost::asynchronous::detail::bounded_gate<Job>>();
+}
+#endif
+
+// used by servant_proxy for its servant's constructor and destructor, which must never be refused
+template <class Job>
+void post_unbounded(boost::asynchronous::any_shared_scheduler_proxy<Job> const& proxy, Job job, std::size_t prio)
+{
+#ifndef BOOST_ASYNCHRONOUS_USE_TYPE_ERASURE
+    std::shared_ptr<boost::asynchronous::detail::bounded_gate<Job>> gate = get_bounded_gate(proxy);
+    if (gate)
+    {
+        gate->post(std::move(job),prio);
+        return;
+    }
+#endif
+    proxy.post(std::move(job),prio);
+}
+}
+
+#ifndef BOOST_ASYNCHRONOUS_USE_TYPE_ERASURE
+/*!
+ * \brief Creates a scheduler proxy bounding the number of jobs in flight for the servant using it.
+ * \brief Create one per servant_proxy. Calls made from the servant thread and jobs posted by the servant itself are never refused.
+ * \param scheduler where the servant lives
+ * \param limit maximum number of jobs posted and not yet executed
+ * \param policy what happens to a call made when the limit is reached
+ * \return a proxy to pass to a servant_proxy. It keeps the scheduler alive. Its get_queue_size returns the jobs in flight.
+ */
+template <class Job>
+boost::asynchronous::any_shared_scheduler_proxy<Job>
+make_bounded_scheduler(boost::asynchronous::any_shared_scheduler_proxy<Job> scheduler, std::size_t limit,
+                       boost::asynchronous::overflow_policy policy = boost::asynchronous::overflow_policy::block)
+{
+    std::shared_ptr<boost::asynchronous::detail::bounded_proxy<Job>> p =
+            std::make_shared<boost::asynchronous::detail::bounded_proxy<Job>>(std::move(scheduler),limit,policy);
+    return boost::asynchronous::any_shared_scheduler_proxy<Job>(std::move(p));
+}
+
+/*!
+ * \brief Returns the counters of a scheduler proxy created by make_bounded_scheduler, all 0 for other proxies.
+ */
+template <class Job>
+boost::asynchronous::bounded_scheduler_stats get_bounded_scheduler_stats(boost::asynchronous::any_shared_scheduler_proxy<Job> const& proxy)
+{
+    std::shared_ptr<boost::asynchronous::detail::bounded_gate<Job>> gate = boost::asynchronous::detail::get_bounded_gate(proxy);
+    return gate ? gate->get_stats() : boost::asynchronous::bounded_scheduler_stats();
+}
+#endif
+
+}} // boost::asynchronous
+
+#endif // BOOST_ASYNCHRONOUS_SCHEDULER_BOUNDED_SCHEDULER_HPP
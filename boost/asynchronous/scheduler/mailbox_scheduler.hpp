@@ -0,0 +1,776 @@
+// Boost.Asynchronous library
+//  Copyright (C) Christophe Henry 2026
+//
+//  Use, modification and distribution is subject to the Boost
+//  Software License, Version 1.0.  (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// For more information, see http://www.boost.org
+
+// A threadpool executing servants, each servant having its own mailbox (actor-style) instead of being identified
+// by a priority offset as with multiple_thread_scheduler.
+// Mailboxes are intrusive multiple-producer single-consumer lists. A mailbox becoming non-empty is put into a run queue
+// of the pool, a worker takes it, executes at most a batch of its jobs, then gives it back to the run queue if jobs are
+// left, so that hundreds of servants per thread are served fairly. A mailbox is never executed by two threads at the
+// same time, so a servant is still single-threaded.
+// Usage:
+// auto pool = make_shared_scheduler_proxy<mailbox_scheduler<lockfree_queue<>>>(4);
+// ServantProxy proxy(make_mailbox<mailbox_scheduler<lockfree_queue<>>>(pool), servant args...);
+
+#ifndef BOOST_ASYNCHRONOUS_SCHEDULER_MAILBOX_SCHEDULER_HPP
+#define BOOST_ASYNCHRONOUS_SCHEDULER_MAILBOX_SCHEDULER_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <future>
+#include <limits>
+#include <list>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <boost/lockfree/queue.hpp>
+#include <boost/thread/thread.hpp>
+#include <boost/thread/tss.hpp>
+
+#include <boost/asynchronous/queue/any_queue.hpp>
+#include <boost/asynchronous/scheduler/detail/interruptible_job.hpp>
+#include <boost/asynchronous/scheduler/detail/scheduler_helpers.hpp>
+#include <boost/asynchronous/scheduler/detail/exceptions.hpp>
+#include <boost/asynchronous/detail/any_interruptible.hpp>
+#include <boost/asynchronous/diagnostics/default_loggable_job.hpp>
+#include <boost/asynchronous/job_traits.hpp>
+#include <boost/asynchronous/scheduler/detail/job_diagnostic_closer.hpp>
+#include <boost/asynchronous/detail/any_joinable.hpp>
+#include <boost/asynchronous/queue/lockfree_queue.hpp>
+#include <boost/asynchronous/scheduler/tss_scheduler.hpp>
+#include <boost/asynchronous/scheduler/detail/lockable_weak_scheduler.hpp>
+#include <boost/asynchronous/scheduler/detail/any_continuation.hpp>
+#include <boost/asynchronous/scheduler/cpu_load_policies.hpp>
+#include <boost/asynchronous/any_scheduler.hpp>
+#include <boost/asynchronous/scheduler/detail/execute_in_all_threads.hpp>
+#include <boost/asynchronous/scheduler_shared_proxy.hpp>
+#include <boost/asynchronous/helpers/task_memory_pool.hpp>
+
+// maximum number of jobs of a mailbox executed before the worker goes to the next mailbox
+#ifndef BOOST_ASYNCHRONOUS_MAILBOX_BATCH
+#define BOOST_ASYNCHRONOUS_MAILBOX_BATCH 64
+#endif
+
+namespace boost { namespace asynchronous
+{
+namespace detail
+{
+template <class S>
+class mailbox;
+
+// what the pool shares with its threads and mailboxes. Outlives the scheduler object during shutdown.
+template <class S>
+struct mailbox_pool_state
+{
+    typedef typename S::diag_type diag_type;
+
+    explicit mailbox_pool_state(std::size_t batch)
+        : m_run_queue(128), m_batch(batch)
+    {}
+    void schedule(boost::asynchronous::detail::mailbox<S>* m)
+    {
+        while (!m_run_queue.push(m)){}
+    }
+
+    boost::lockfree::queue<boost::asynchronous::detail::mailbox<S>*> m_run_queue;
+    const std::size_t m_batch;
+    std::vector<boost::thread::id> m_thread_ids;
+    std::shared_ptr<diag_type> m_diagnostics;
+};
+
+// executes a job, taking care of diagnostics. Returns false if the job threw
+template <class Job, class Diag>
+bool execute_mailbox_job(Job& job, std::size_t index, Diag* diagnostics)
+{
+    try
+    {
+        boost::asynchronous::job_traits<Job>::set_started_time(job);
+        boost::asynchronous::job_traits<Job>::set_executing_thread_id(job,boost::this_thread::get_id());
+        boost::asynchronous::job_traits<Job>::add_current_diagnostic(index,job,diagnostics);
+        job();
+        boost::asynchronous::job_traits<Job>::reset_current_diagnostic(index,diagnostics);
+        boost::asynchronous::job_traits<Job>::set_finished_time(job);
+        boost::asynchronous::job_traits<Job>::add_diagnostic(job,diagnostics);
+        return true;
+    }
+    catch(boost::thread_interrupted&)
+    {
+        // task interrupted, no problem, just continue
+    }
+    catch(std::exception&)
+    {
+        boost::asynchronous::job_traits<Job>::set_failed(job);
+        boost::asynchronous::job_traits<Job>::set_finished_time(job);
+        boost::asynchronous::job_traits<Job>::add_diagnostic(job,diagnostics);
+        boost::asynchronous::job_traits<Job>::reset_current_diagnostic(index,diagnostics);
+    }
+    return false;
+}
+
+// Mailbox of a servant. Seen by the servant as its scheduler (its weak scheduler posts here).
+// Jobs are kept in an intrusive MPSC list (D. Vyukov), the count of jobs decides who owns the mailbox:
+// the producer making it go from 0 to 1 puts it into the run queue, the worker executing it keeps it until it goes back to 0.
+template <class S>
+class mailbox :
+#ifndef BOOST_ASYNCHRONOUS_USE_TYPE_ERASURE
+        public any_shared_scheduler_concept<typename S::job_type>,
+#endif
+        public std::enable_shared_from_this<mailbox<S> >
+{
+public:
+    typedef typename S::job_type job_type;
+    typedef mailbox<S> this_type;
+
+    explicit mailbox(std::shared_ptr<boost::asynchronous::detail::mailbox_pool_state<S>> pool)
+        : m_head(&m_stub), m_tail(&m_stub), m_count(0), m_pool(std::move(pool))
+    {}
+    mailbox(mailbox const&) = delete;
+    mailbox& operator=(mailbox const&) = delete;
+    ~mailbox()
+    {
+        node_base* n = m_tail;
+        while (n != nullptr)
+        {
+            node_base* next = n->next.load(std::memory_order_acquire);
+            if (n != &m_stub)
+            {
+                destroy(static_cast<node*>(n));
+            }
+            n = next;
+        }
+    }
+
+    void post(job_type job)
+    {
+        boost::asynchronous::job_traits<job_type>::set_posted_time(job);
+        push(std::move(job));
+    }
+    // priorities have no meaning inside a mailbox
+    void post(job_type job, std::size_t)
+    {
+        post(std::move(job));
+    }
+    boost::asynchronous::any_interruptible interruptible_post(job_type job)
+    {
+        std::shared_ptr<boost::asynchronous::detail::interrupt_state>
+                state = std::make_shared<boost::asynchronous::detail::interrupt_state>();
+        std::shared_ptr<std::promise<boost::thread*> > wpromise = std::make_shared<std::promise<boost::thread*> >();
+        boost::asynchronous::job_traits<job_type>::set_posted_time(job);
+        boost::asynchronous::interruptible_job<job_type,S> ijob(std::move(job),wpromise,state);
+        push(job_type(std::move(ijob)));
+        std::future<boost::thread*> fu = wpromise->get_future();
+        boost::asynchronous::interrupt_helper interruptible(std::move(fu),state);
+        return boost::asynchronous::any_interruptible(interruptible);
+    }
+    boost::asynchronous::any_interruptible interruptible_post(job_type job, std::size_t)
+    {
+        return interruptible_post(std::move(job));
+    }
+    std::vector<boost::thread::id> thread_ids() const
+    {
+        return m_pool->m_thread_ids;
+    }
+    std::vector<std::size_t> get_queue_size() const
+    {
+        return std::vector<std::size_t>(1,m_count.load(std::memory_order_relaxed));
+    }
+    std::vector<std::size_t> get_max_queue_size() const
+    {
+        return get_queue_size();
+    }
+    void reset_max_queue_size()
+    {
+    }
+    boost::asynchronous::scheduler_diagnostics get_diagnostics(std::size_t =0) const
+    {
+        return boost::asynchronous::scheduler_diagnostics(m_pool->m_diagnostics->get_map(),m_pool->m_diagnostics->get_current());
+    }
+    void register_diagnostics_functor(std::function<void(boost::asynchronous::scheduler_diagnostics)>,
+                                      boost::asynchronous::register_diagnostics_type =
+                                            boost::asynchronous::register_diagnostics_type())
+    {
+    }
+    void clear_diagnostics()
+    {
+    }
+    std::string get_name() const
+    {
+        return "mailbox";
+    }
+    void processor_bind(std::vector<std::tuple<unsigned int,unsigned int>>)
+    {
+    }
+    BOOST_ATTRIBUTE_NODISCARD std::vector<std::future<void>> execute_in_all_threads(boost::asynchronous::any_callable)
+    {
+        return std::vector<std::future<void>>();
+    }
+    void enable_queue(std::size_t, bool) override
+    {
+    }
+
+    // called by the worker owning the mailbox: executes at most max_jobs jobs, then gives the mailbox back to the
+    // run queue if jobs are left. The mailbox might be destroyed when this returns.
+    std::size_t process(std::size_t max_jobs, std::size_t index)
+    {
+        const std::size_t count = std::min(m_count.load(std::memory_order_acquire),max_jobs);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            job_type job = pop();
+            boost::asynchronous::detail::execute_mailbox_job(job,index,m_pool->m_diagnostics.get());
+        }
+        // no producer touches m_keep_alive while the count is not 0
+        std::shared_ptr<this_type> keep = std::move(m_keep_alive);
+        if (m_count.fetch_sub(count,std::memory_order_acq_rel) != count)
+        {
+            // still ours, go to the end of the run queue to be fair with other mailboxes
+            m_keep_alive = std::move(keep);
+            m_pool->schedule(this);
+        }
+        return count;
+    }
+
+private:
+    struct node_base
+    {
+        std::atomic<node_base*> next{nullptr};
+    };
+    struct node : public node_base
+    {
+        explicit node(job_type&& j): job(std::move(j)){}
+        job_type job;
+    };
+
+    static void destroy(node* n)
+    {
+        n->~node();
+        boost::asynchronous::task_allocator<node>().deallocate(n,1);
+    }
+    void push(job_type job)
+    {
+        node* n = ::new (boost::asynchronous::task_allocator<node>().allocate(1)) node(std::move(job));
+        node_base* prev = m_head.exchange(n,std::memory_order_acq_rel);
+        prev->next.store(n,std::memory_order_release);
+        if (m_count.fetch_add(1,std::memory_order_acq_rel) == 0)
+        {
+            // we own the mailbox until a worker takes it
+            m_keep_alive = this->shared_from_this();
+            m_pool->schedule(this);
+        }
+    }
+    // only called by the owning worker when the count says a job is there
+    job_type pop()
+    {
+        node_base* tail = m_tail;
+        node_base* next = tail->next.load(std::memory_order_acquire);
+        while (next == nullptr)
+        {
+            // a producer is between exchange and link
+            boost::this_thread::yield();
+            next = tail->next.load(std::memory_order_acquire);
+        }
+        // next becomes the new stub, its job is moved out
+        node* n = static_cast<node*>(next);
+        job_type job = std::move(n->job);
+        m_tail = n;
+        if (tail != &m_stub)
+        {
+            destroy(static_cast<node*>(tail));
+        }
+        return job;
+    }
+
+    node_base m_stub;
+    // producers
+    alignas(64) std::atomic<node_base*> m_head;
+    // consumer
+    alignas(64) node_base* m_tail;
+    std::atomic<std::size_t> m_count;
+    std::shared_ptr<this_type> m_keep_alive;
+    std::shared_ptr<boost::asynchronous::detail::mailbox_pool_state<S>> m_pool;
+};
+
+// proxy given to a servant_proxy: posts go to the mailbox, the rest to the pool.
+// Keeps the pool alive like any scheduler proxy.
+template <class S>
+class mailbox_proxy :
+#ifndef BOOST_ASYNCHRONOUS_USE_TYPE_ERASURE
+        public any_shared_scheduler_proxy_concept<typename S::job_type>,
+        public internal_scheduler_aspect_concept<typename S::job_type>,
+#endif
+        public std::enable_shared_from_this<mailbox_proxy<S> >
+{
+public:
+    typedef typename S::job_type job_type;
+
+    mailbox_proxy(boost::asynchronous::any_shared_scheduler_proxy<job_type> pool,
+                  std::shared_ptr<boost::asynchronous::detail::mailbox<S>> mb)
+        : m_pool(std::move(pool)), m_mailbox(std::move(mb))
+    {}
+    void post(job_type job) const
+    {
+        m_mailbox->post(std::move(job));
+    }
+    void post(job_type job, std::size_t prio) const
+    {
+        m_mailbox->post(std::move(job),prio);
+    }
+    boost::asynchronous::any_interruptible interruptible_post(job_type job) const
+    {
+        return m_mailbox->interruptible_post(std::move(job));
+    }
+    boost::asynchronous::any_interruptible interruptible_post(job_type job, std::size_t prio) const
+    {
+        return m_mailbox->interruptible_post(std::move(job),prio);
+    }
+    std::vector<boost::thread::id> thread_ids() const
+    {
+        return m_pool.thread_ids();
+    }
+    boost::asynchronous::any_weak_scheduler<job_type> get_weak_scheduler() const
+    {
+        boost::asynchronous::detail::lockable_weak_scheduler<boost::asynchronous::detail::mailbox<S>> w(m_mailbox);
+        return boost::asynchronous::any_weak_scheduler<job_type>(std::move(w));
+    }
+    bool is_valid() const
+    {
+        return !!m_mailbox;
+    }
+    std::vector<std::size_t> get_queue_size() const
+    {
+        return m_mailbox->get_queue_size();
+    }
+    std::vector<std::size_t> get_max_queue_size() const
+    {
+        return m_mailbox->get_max_queue_size();
+    }
+    void reset_max_queue_size()
+    {
+    }
+    boost::asynchronous::scheduler_diagnostics get_diagnostics(std::size_t pos=0) const
+    {
+        return m_pool.get_diagnostics(pos);
+    }
+    void clear_diagnostics()
+    {
+    }
+    boost::asynchronous::internal_scheduler_aspect<job_type> get_internal_scheduler_aspect()
+    {
+        return std::static_pointer_cast<boost::asynchronous::internal_scheduler_aspect_concept<job_type>>(this->shared_from_this());
+    }
+    // the pool is shared with other servants, renaming or binding it is left to the pool proxy
+    void set_name(std::string const&)
+    {
+    }
+    std::string get_name() const
+    {
+        return m_pool.get_name();
+    }
+    void processor_bind(std::vector<std::tuple<unsigned int,unsigned int>>)
+    {
+    }
+    BOOST_ATTRIBUTE_NODISCARD std::vector<std::future<void>> execute_in_all_threads(boost::asynchronous::any_callable c)
+    {
+        return m_pool.execute_in_all_threads(std::move(c));
+    }
+    std::vector<boost::asynchronous::any_queue_ptr<job_type> > get_queues()
+    {
+        return std::vector<boost::asynchronous::any_queue_ptr<job_type> >();
+    }
+    void set_steal_from_queues(std::vector<boost::asynchronous::any_queue_ptr<job_type> > const&)
+    {
+    }
+
+private:
+    mutable boost::asynchronous::any_shared_scheduler_proxy<job_type> m_pool;
+    std::shared_ptr<boost::asynchronous::detail::mailbox<S>> m_mailbox;
+};
+}
+
+template<class Q, class CPULoad =
+#ifdef BOOST_ASYNCHRONOUS_NO_SAVING_CPU_LOAD
+         boost::asynchronous::no_cpu_load_saving
+#else
+         boost::asynchronous::default_save_cpu_load<>
+#endif
+         >
+class mailbox_scheduler:
+#ifndef BOOST_ASYNCHRONOUS_USE_TYPE_ERASURE
+                public any_shared_scheduler_concept<typename Q::job_type>
+#endif
+{
+public:
+    typedef boost::asynchronous::mailbox_scheduler<Q,CPULoad> this_type;
+    typedef Q queue_type;
+    typedef typename Q::job_type job_type;
+    typedef typename boost::asynchronous::job_traits<typename Q::job_type>::diagnostic_table_type diag_type;
+    typedef boost::asynchronous::detail::mailbox_pool_state<this_type> pool_state_type;
+
+    /*!
+     * \brief Constructor
+     * \param number_of_workers number of threads
+     * \param batch maximum number of jobs of a mailbox executed before the thread goes to the next mailbox
+     * \param args arguments for the queue used for jobs posted directly to the pool
+     */
+    template<typename... Args>
+    mailbox_scheduler(size_t number_of_workers, std::size_t batch, Args... args)
+        : m_queue(std::make_shared<queue_type>(args...))
+        , m_state(std::make_shared<pool_state_type>(batch))
+        , m_number_of_workers(number_of_workers)
+    {
+        create_private_queues();
+    }
+    template<typename... Args>
+    mailbox_scheduler(size_t number_of_workers, std::size_t batch, std::string const& name, Args... args)
+        : m_queue(std::make_shared<queue_type>(args...))
+        , m_state(std::make_shared<pool_state_type>(batch))
+        , m_number_of_workers(number_of_workers)
+        , m_name(name)
+    {
+        create_private_queues();
+        set_name(name);
+    }
+    explicit mailbox_scheduler(size_t number_of_workers)
+        : m_queue(std::make_shared<queue_type>())
+        , m_state(std::make_shared<pool_state_type>(BOOST_ASYNCHRONOUS_MAILBOX_BATCH))
+        , m_number_of_workers(number_of_workers)
+    {
+        create_private_queues();
+    }
+    void constructor_done(std::weak_ptr<this_type> weak_self)
+    {
+        m_diagnostics = std::make_shared<diag_type>(m_number_of_workers);
+        m_state->m_diagnostics = m_diagnostics;
+        m_thread_ids.reserve(m_number_of_workers);
+        m_group.reset(new boost::thread_group);
+        for (size_t i = 0; i< m_number_of_workers;++i)
+        {
+            std::promise<boost::thread*> new_thread_promise;
+            std::shared_future<boost::thread*> fu = new_thread_promise.get_future();
+            boost::thread* new_thread =
+                    m_group->create_thread(std::bind(&mailbox_scheduler::run,m_queue,m_state,
+                                                       m_private_queues[i],m_diagnostics,fu,weak_self,i));
+            new_thread_promise.set_value(new_thread);
+            m_thread_ids.push_back(new_thread->get_id());
+        }
+        // set before any mailbox exists
+        m_state->m_thread_ids = m_thread_ids;
+    }
+
+    ~mailbox_scheduler()
+    {
+        for (size_t i = 0; i< m_number_of_workers;++i)
+        {
+            auto fct = m_diagnostics_fct;
+            auto diag = m_diagnostics;
+            auto l = [fct,diag]() mutable
+            {
+                if (fct)
+                    fct(boost::asynchronous::scheduler_diagnostics(diag->get_map(),diag->get_current()));
+            };
+            boost::asynchronous::detail::default_termination_task<typename Q::diagnostic_type,boost::thread_group>
+                    ttask(std::move(l));
+            // this task has to be executed last => lowest prio
+            boost::asynchronous::any_callable job(std::move(ttask));
+            m_private_queues[i]->push(std::move(job),std::numeric_limits<std::size_t>::max());
+        }
+    }
+
+    /*!
+     * \brief Creates a mailbox. Usually called through make_mailbox.
+     */
+    std::shared_ptr<boost::asynchronous::detail::mailbox<this_type>> create_mailbox()
+    {
+        return std::make_shared<boost::asynchronous::detail::mailbox<this_type>>(m_state);
+    }
+
+    boost::asynchronous::any_joinable get_worker()const
+    {
+        return boost::asynchronous::any_joinable (boost::asynchronous::detail::worker_wrap<boost::thread_group>(m_group));
+    }
+    std::vector<boost::thread::id> thread_ids()const
+    {
+        return m_thread_ids;
+    }
+    boost::asynchronous::scheduler_diagnostics
+    get_diagnostics(std::size_t =0)const
+    {
+        return boost::asynchronous::scheduler_diagnostics(m_diagnostics->get_map(),m_diagnostics->get_current());
+    }
+    void clear_diagnostics()
+    {
+        m_diagnostics->clear();
+    }
+    void set_steal_from_queues(std::vector<boost::asynchronous::any_queue_ptr<job_type> > const&)
+    {
+        // this scheduler does not steal
+    }
+    void set_name(std::string const& name)
+    {
+        for (size_t i = 0; i< m_number_of_workers;++i)
+        {
+            boost::asynchronous::detail::set_name_task<typename Q::diagnostic_type> ntask(name);
+            boost::asynchronous::any_callable job(std::move(ntask));
+            m_private_queues[i]->push(std::move(job),std::numeric_limits<std::size_t>::max());
+        }
+    }
+    std::string get_name()const
+    {
+        return m_name;
+    }
+    void processor_bind(std::vector<std::tuple<unsigned int/*first core*/,unsigned int/*number of threads*/>> p)
+    {
+        size_t t = 0;
+        for(auto const& v : p)
+        {
+            for (unsigned int i = 0; i< std::get<1>(v) && (t < m_number_of_workers);++i)
+            {
+                boost::asynchronous::detail::processor_bind_task task(std::get<0>(v)+i);
+                boost::asynchronous::any_callable job(std::move(task));
+                m_private_queues[t++]->push(std::move(job),std::numeric_limits<std::size_t>::max());
+            }
+        }
+    }
+    BOOST_ATTRIBUTE_NODISCARD std::vector<std::future<void>> execute_in_all_threads(boost::asynchronous::any_callable c)
+    {
+        std::vector<std::future<void>> res;
+        res.reserve(m_number_of_workers);
+        for (size_t i = 0; i< m_number_of_workers;++i)
+        {
+            std::promise<void> p;
+            auto fu = p.get_future();
+            res.emplace_back(std::move(fu));
+            boost::asynchronous::detail::execute_in_all_threads_task task(c,std::move(p));
+            m_private_queues[i]->push(std::move(task),std::numeric_limits<std::size_t>::max());
+        }
+        return res;
+    }
+    void register_diagnostics_functor(std::function<void(boost::asynchronous::scheduler_diagnostics)> fct,
+                                      boost::asynchronous::register_diagnostics_type =
+                                                    boost::asynchronous::register_diagnostics_type())
+    {
+        m_diagnostics_fct = fct;
+    }
+    std::vector<std::size_t> get_queue_size() const
+    {
+        return m_queue->get_queue_size();
+    }
+    std::vector<std::size_t> get_max_queue_size() const
+    {
+        return m_queue->get_max_queue_size();
+    }
+    void reset_max_queue_size()
+    {
+        m_queue->reset_max_queue_size();
+    }
+    std::vector<boost::asynchronous::any_queue_ptr<job_type> > get_queues()
+    {
+        // this scheduler doesn't give any queues for stealing
+        return std::vector<boost::asynchronous::any_queue_ptr<job_type> >();
+    }
+    // jobs posted to the pool itself (not to a mailbox) are executed by any thread
+    void post(job_type job, std::size_t prio)
+    {
+        boost::asynchronous::job_traits<job_type>::set_posted_time(job);
+        m_queue->push(std::move(job),prio);
+    }
+    void post(job_type job)
+    {
+        post(std::move(job),0);
+    }
+    boost::asynchronous::any_interruptible interruptible_post(job_type job,std::size_t prio)
+    {
+        std::shared_ptr<boost::asynchronous::detail::interrupt_state>
+                state = std::make_shared<boost::asynchronous::detail::interrupt_state>();
+        std::shared_ptr<std::promise<boost::thread*> > wpromise = std::make_shared<std::promise<boost::thread*> >();
+        boost::asynchronous::job_traits<job_type>::set_posted_time(job);
+        boost::asynchronous::interruptible_job<job_type,this_type> ijob(std::move(job),wpromise,state);
+        m_queue->push(std::move(ijob),prio);
+        std::future<boost::thread*> fu = wpromise->get_future();
+        boost::asynchronous::interrupt_helper interruptible(std::move(fu),state);
+        return boost::asynchronous::any_interruptible(interruptible);
+    }
+    boost::asynchronous::any_interruptible interruptible_post(job_type job)
+    {
+        return interruptible_post(std::move(job),0);
+    }
+    void enable_queue(std::size_t queue_prio, bool enable) override
+    {
+        m_queue->enable_queue(queue_prio,enable);
+    }
+
+    // executes a batch of a mailbox or a job posted to the pool, returns true if there was something to do
+    static bool execute_one_job(queue_type* queue, pool_state_type* state, size_t index, CPULoad& cpu_load,
+                                diag_type* diagnostics, std::list<boost::asynchronous::any_continuation>& waiting)
+    {
+        bool done_something = false;
+        boost::asynchronous::detail::mailbox<this_type>* mb = nullptr;
+        if (state->m_run_queue.pop(mb))
+        {
+            cpu_load.popped_job();
+            mb->process(state->m_batch,index);
+            done_something = true;
+        }
+        // jobs posted to the pool get a turn between mailboxes
+        job_type job;
+        bool popped = false;
+        try
+        {
+            popped = queue->try_pop(job);
+        }
+        catch(std::exception&){}
+        if (popped)
+        {
+            cpu_load.popped_job();
+            boost::asynchronous::detail::execute_mailbox_job(job,index,diagnostics);
+            done_something = true;
+        }
+        if (!done_something && !waiting.empty())
+        {
+            // look for waiting tasks
+            for (std::list<boost::asynchronous::any_continuation>::iterator it = waiting.begin(); it != waiting.end();)
+            {
+                if ((*it).is_ready())
+                {
+                    boost::asynchronous::any_continuation c = std::move(*it);
+                    it = waiting.erase(it);
+                    try
+                    {
+                        c();
+                    }
+                    catch(std::exception&){}
+                }
+                else
+                {
+                    ++it;
+                }
+            }
+        }
+        return done_something;
+    }
+
+    static void run(std::shared_ptr<queue_type> queue,
+                    std::shared_ptr<pool_state_type> state,
+                    std::shared_ptr<boost::asynchronous::lockfree_queue<boost::asynchronous::any_callable> > const& private_queue,
+                    std::shared_ptr<diag_type> diagnostics,
+                    std::shared_future<boost::thread*> self,
+                    std::weak_ptr<this_type> this_,
+                    size_t index)
+    {
+        boost::thread* t = self.get();
+        this_type::m_self_thread.reset(new thread_ptr_wrapper(t));
+        // thread scheduler => tss
+        boost::asynchronous::any_weak_scheduler<job_type> self_as_weak = boost::asynchronous::detail::lockable_weak_scheduler<this_type>(this_);
+        boost::asynchronous::get_thread_scheduler<job_type>(self_as_weak,true);
+
+        std::list<boost::asynchronous::any_continuation>& waiting =
+                boost::asynchronous::get_continuations(std::list<boost::asynchronous::any_continuation>(),true);
+
+        CPULoad cpu_load;
+        while(true)
+        {
+            try
+            {
+                {
+                    bool popped = execute_one_job(queue.get(),state.get(),index,cpu_load,diagnostics.get(),waiting);
+                    if (!popped)
+                    {
+                        cpu_load.loop_done_no_job();
+                        // nothing for us to do, give up our time slice
+                        boost::this_thread::yield();
+                    }
+                    // check for shutdown
+                    boost::asynchronous::any_callable djob;
+                    popped = private_queue->try_pop(djob);
+                    if (popped)
+                    {
+                        djob();
+                    }
+                } // job destroyed (for destruction useful)
+                boost::this_thread::interruption_point();
+            }
+            catch(boost::asynchronous::detail::shutdown_exception&)
+            {
+                // we are done, execute jobs posted short before to the end, then shutdown
+                while(execute_one_job(queue.get(),state.get(),index,cpu_load,diagnostics.get(),waiting));
+                delete this_type::m_self_thread.release();
+                return;
+            }
+            catch(boost::thread_interrupted&)
+            {
+                // task interrupted, no problem, just continue
+            }
+            catch(std::exception&)
+            {
+                // TODO, user-defined error
+            }
+        }
+    }
+
+    static boost::thread_specific_ptr<thread_ptr_wrapper> m_self_thread;
+
+private:
+    void create_private_queues()
+    {
+        m_private_queues.reserve(m_number_of_workers);
+        for (size_t i = 0; i< m_number_of_workers;++i)
+        {
+            m_private_queues.push_back(
+                        std::make_shared<boost::asynchronous::lockfree_queue<boost::asynchronous::any_callable> >());
+        }
+    }
+
+    std::shared_ptr<queue_type> m_queue;
+    std::shared_ptr<pool_state_type> m_state;
+    std::shared_ptr<boost::thread_group> m_group;
+    std::vector<boost::thread::id> m_thread_ids;
+    std::shared_ptr<diag_type> m_diagnostics;
+    std::vector<std::shared_ptr<
+                boost::asynchronous::lockfree_queue<boost::asynchronous::any_callable>>> m_private_queues;
+    size_t m_number_of_workers;
+    std::function<void(boost::asynchronous::scheduler_diagnostics)> m_diagnostics_fct;
+    const std::string m_name;
+};
+
+template<class Q,class CPULoad>
+boost::thread_specific_ptr<thread_ptr_wrapper>
+mailbox_scheduler<Q,CPULoad>::m_self_thread;
+
+#ifndef BOOST_ASYNCHRONOUS_USE_TYPE_ERASURE
+/*!
+ * \brief Creates a mailbox in a pool of type S (a mailbox_scheduler) and returns a proxy to it, to pass to a servant_proxy.
+ * \brief Calls to the servant go to its mailbox, without priority offset. Priorities are ignored inside a mailbox.
+ * \param pool proxy returned by make_shared_scheduler_proxy<S>
+ * \return a proxy posting to the new mailbox. It keeps the pool alive.
+ */
+template <class S>
+boost::asynchronous::any_shared_scheduler_proxy<typename S::job_type>
+make_mailbox(boost::asynchronous::any_shared_scheduler_proxy<typename S::job_type> pool)
+{
+    typedef typename S::job_type job_type;
+    std::shared_ptr<boost::asynchronous::detail::scheduler_shared_proxy_impl<S>> impl =
+        std::dynamic_pointer_cast<boost::asynchronous::detail::scheduler_shared_proxy_impl<S>>(pool.get_internal_scheduler_aspect());
+    if (!impl)
+    {
+        throw std::invalid_argument("make_mailbox: pool is not of the given mailbox_scheduler type");
+    }
+    auto mb = impl->m_scheduler->create_mailbox();
+    std::shared_ptr<boost::asynchronous::detail::mailbox_proxy<S>> p =
+            std::make_shared<boost::asynchronous::detail::mailbox_proxy<S>>(std::move(pool),std::move(mb));
+    return boost::asynchronous::any_shared_scheduler_proxy<job_type>(std::move(p));
+}
+#endif
+
+}} // boost::asynchronous
+
+#endif // BOOST_ASYNCHRONOUS_SCHEDULER_MAILBOX_SCHEDULER_HPP
@@ -0,0 +1,640 @@
+// Boost.Asynchronous library
+//  Copyright (C) Christophe Henry 2026
+//
+//  Use, modification and distribution is subject to the Boost
+//  Software License, Version 1.0.  (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// For more information, see http://www.boost.org
+
+// Scheduler proxy allowing a servant to move to another scheduler while running.
+// Jobs are forwarded to the scheduler where the servant currently lives. A migration posts a handoff job
+// to the old scheduler, after the jobs already there. Calls made meanwhile are kept and forwarded to the new scheduler
+// once the handoff job was executed, so that the servant is never executed in two threads and calls stay in order.
+// Usage:
+// ServantProxy proxy(make_migratable_scheduler(scheduler1), servant args...);
+// std::future<bool> moved = proxy.migrate_to(scheduler2);
+
+#ifndef BOOST_ASYNCHRONOUS_SCHEDULER_MIGRATABLE_SCHEDULER_HPP
+#define BOOST_ASYNCHRONOUS_SCHEDULER_MIGRATABLE_SCHEDULER_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <boost/thread/thread.hpp>
+
+#include <boost/asynchronous/any_scheduler.hpp>
+#include <boost/asynchronous/any_shared_scheduler_proxy.hpp>
+#include <boost/asynchronous/callable_any.hpp>
+#include <boost/asynchronous/job_traits.hpp>
+#include <boost/asynchronous/detail/servant_epoch.hpp>
+#include <boost/asynchronous/scheduler/detail/lockable_weak_scheduler.hpp>
+
+namespace boost { namespace asynchronous
+{
+namespace detail
+{
+// Seen by the servant as its scheduler. Forwards jobs to the current scheduler, or keeps them during a migration.
+template <class Job>
+class migration_gate :
+#ifndef BOOST_ASYNCHRONOUS_USE_TYPE_ERASURE
+        public any_shared_scheduler_concept<Job>,
+#endif
+        public std::enable_shared_from_this<migration_gate<Job> >
+{
+public:
+    typedef Job job_type;
+
+    explicit migration_gate(boost::asynchronous::any_weak_scheduler<Job> scheduler)
+        : m_target(std::move(scheduler)), m_moving(false), m_busy(0), m_migrations(0)
+    {}
+
+    // executes a job and adds its duration to the busy time of the servant
+    struct timed_job : public boost::asynchronous::job_traits<Job>::diagnostic_type
+    {
+        timed_job(std::shared_ptr<migration_gate> gate, Job job)
+            : m_gate(std::move(gate)), m_job(std::move(job))
+        {
+            this->set_name(boost::asynchronous::job_traits<Job>::get_name(m_job));
+        }
+        void operator()()
+        {
+            std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+            try
+            {
+                m_job();
+            }
+            catch(...)
+            {
+                m_gate->add_busy(start);
+                throw;
+            }
+            m_gate->add_busy(start);
+        }
+        std::shared_ptr<migration_gate> m_gate;
+        Job m_job;
+    };
+    // shared by the copies of a handoff job. If the old scheduler drops the job without executing it (shutdown),
+    // the servant stays there and the promise is broken.
+    struct handoff_state
+    {
+        handoff_state(std::shared_ptr<migration_gate> gate, std::size_t prio,
+                      std::shared_ptr<std::promise<bool>> done, std::function<void()> moved)
+            : m_gate(std::move(gate)), m_prio(prio), m_done(std::move(done)), m_moved(std::move(moved)), m_executed(false)
+        {}
+        ~handoff_state()
+        {
+            if (!m_executed)
+            {
+                try
+                {
+                    m_gate->cancel();
+                }
+                catch(...)
+                {
+                    // the calls kept during the migration could not be forwarded, they are lost as if the scheduler dropped them
+                }
+            }
+        }
+        std::shared_ptr<migration_gate> m_gate;
+        std::size_t m_prio;
+        std::shared_ptr<std::promise<bool>> m_done;
+        std::function<void()> m_moved;
+        bool m_executed;
+    };
+    // executed in the old scheduler after the jobs posted there before the migration
+    struct handoff_job
+    {
+        void operator()()
+        {
+            m_state->m_executed = true;
+            m_state->m_gate->handoff(m_state->m_prio,m_state->m_done,m_state->m_moved);
+        }
+        std::shared_ptr<handoff_state> m_state;
+    };
+
+    void post(job_type job)
+    {
+        post(std::move(job),0);
+    }
+    void post(job_type job, std::size_t prio)
+    {
+        // declared before the lock, destroyed after it
+        boost::asynchronous::any_shared_scheduler<Job> s;
+        Job dropped;
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_moving)
+        {
+            m_pending.emplace_back(std::move(job),prio);
+            return;
+        }
+        // posted under the lock so that no job reaches the old scheduler after a handoff job
+        s = m_target.lock();
+        if (s.is_valid())
+        {
+            s.post(Job(timed_job(this->shared_from_this(),std::move(job))),prio);
+        }
+        else
+        {
+            dropped = std::move(job);
+        }
+    }
+    // during a migration, the job is executed after it but cannot be interrupted
+    boost::asynchronous::any_interruptible interruptible_post(job_type job)
+    {
+        return interruptible_post(std::move(job),0);
+    }
+    boost::asynchronous::any_interruptible interruptible_post(job_type job, std::size_t prio)
+    {
+        boost::asynchronous::any_shared_scheduler<Job> s;
+        Job dropped;
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_moving)
+        {
+            m_pending.emplace_back(std::move(job),prio);
+            return boost::asynchronous::any_interruptible();
+        }
+        s = m_target.lock();
+        if (s.is_valid())
+        {
+            return s.interruptible_post(Job(timed_job(this->shared_from_this(),std::move(job))),prio);
+        }
+        dropped = std::move(job);
+        return boost::asynchronous::any_interruptible();
+    }
+
+    std::vector<boost::thread::id> thread_ids() const
+    {
+        boost::asynchronous::any_shared_scheduler<Job> s = target();
+        return s.is_valid() ? s.thread_ids() : std::vector<boost::thread::id>();
+    }
+    std::vector<std::size_t> get_queue_size() const
+    {
+        boost::asynchronous::any_shared_scheduler<Job> s = target();
+        return s.is_valid() ? s.get_queue_size() : std::vector<std::size_t>();
+    }
+    std::vector<std::size_t> get_max_queue_size() const
+    {
+        boost::asynchronous::any_shared_scheduler<Job> s = target();
+        return s.is_valid() ? s.get_max_queue_size() : std::vector<std::size_t>();
+    }
+    void reset_max_queue_size()
+    {
+        boost::asynchronous::any_shared_scheduler<Job> s = target();
+        if (s.is_valid())
+        {
+            s.reset_max_queue_size();
+        }
+    }
+    boost::asynchronous::scheduler_diagnostics get_diagnostics(std::size_t pos=0) const
+    {
+        boost::asynchronous::any_shared_scheduler<Job> s = target();
+        return s.is_valid() ? s.get_diagnostics(pos) : boost::asynchronous::scheduler_diagnostics();
+    }
+    void register_diagnostics_functor(std::function<void(boost::asynchronous::scheduler_diagnostics)>,
+                                      boost::asynchronous::register_diagnostics_type =
+                                            boost::asynchronous::register_diagnostics_type())
+    {
+    }
+    void clear_diagnostics()
+    {
+    }
+    std::string get_name() const
+    {
+        boost::asynchronous::any_shared_scheduler<Job> s = target();
+        return s.is_valid() ? s.get_name() : std::string();
+    }
+    void processor_bind(std::vector<std::tuple<unsigned int,unsigned int>>)
+    {
+    }
+    BOOST_ATTRIBUTE_NODISCARD std::vector<std::future<void>> execute_in_all_threads(boost::asynchronous::any_callable)
+    {
+        return std::vector<std::future<void>>();
+    }
+    void enable_queue(std::size_t, bool) override
+    {
+    }
+
+    // called in the old thread, after the last job of the servant there, and in the new thread, before the first one.
+    // If leave returns false, the servant stays in the old thread.
+    void set_migration_hooks(std::function<bool()> leave, std::function<void()> arrive)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_leave = std::move(leave);
+        m_arrive = std::move(arrive);
+    }
+    // false if a migration is already running or the current scheduler is gone. Otherwise done is set when the
+    // servant lives in next, or to false if it stays, and moved is called in the old thread before the servant's first job in next.
+    bool migrate(boost::asynchronous::any_weak_scheduler<Job> next, std::size_t prio, std::shared_ptr<std::promise<bool>> done,
+                 std::function<void()> moved)
+    {
+        // declared before the lock: if the job is dropped by post, the migration is cancelled after it
+        std::shared_ptr<handoff_state> state =
+                std::make_shared<handoff_state>(this->shared_from_this(),prio,std::move(done),std::move(moved));
+        boost::asynchronous::any_shared_scheduler<Job> s;
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_moving)
+        {
+            state->m_executed = true;
+            return false;
+        }
+        s = m_target.lock();
+        if (!s.is_valid())
+        {
+            state->m_executed = true;
+            return false;
+        }
+        m_moving = true;
+        m_next = std::move(next);
+        s.post(typename boost::asynchronous::job_traits<Job>::wrapper_type(
+                   boost::asynchronous::any_callable(handoff_job{state})),prio);
+        return true;
+    }
+    bool is_migrating() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_moving;
+    }
+    // time spent executing jobs of the servant
+    std::chrono::nanoseconds busy_time() const
+    {
+        return std::chrono::nanoseconds(m_busy.load());
+    }
+    std::size_t migrations() const
+    {
+        return m_migrations.load();
+    }
+
+    void handoff(std::size_t prio, std::shared_ptr<std::promise<bool>> done, std::function<void()> const& moved)
+    {
+        std::function<bool()> leave;
+        std::function<void()> arrive;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            leave = m_leave;
+            arrive = m_arrive;
+            // callbacks created in this thread may be checked after it ends
+            std::shared_ptr<boost::asynchronous::detail::servant_epoch_table> const& table =
+                    boost::asynchronous::detail::servant_epoch_table::current();
+            if (std::find(m_tables.begin(),m_tables.end(),table) == m_tables.end())
+            {
+                m_tables.push_back(table);
+            }
+        }
+        if (leave && !leave())
+        {
+            cancel();
+            done->set_value(false);
+            return;
+        }
+        // before the servant can be called in next, so that the proxy does not report the old scheduler after it
+        if (moved)
+        {
+            moved();
+        }
+        boost::asynchronous::any_shared_scheduler<Job> s;
+        std::vector<std::pair<Job,std::size_t>> dropped;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_target = std::move(m_next);
+            m_next = boost::asynchronous::any_weak_scheduler<Job>();
+            s = m_target.lock();
+            if (s.is_valid())
+            {
+                if (arrive)
+                {
+                    s.post(typename boost::asynchronous::job_traits<Job>::wrapper_type(
+                               boost::asynchronous::any_callable(std::move(arrive))),prio);
+                }
+                for (auto& job : m_pending)
+                {
+                    s.post(Job(timed_job(this->shared_from_this(),std::move(job.first))),job.second);
+                }
+                m_pending.clear();
+            }
+            else
+            {
+                dropped.swap(m_pending);
+            }
+            m_moving = false;
+            ++m_migrations;
+        }
+        done->set_value(s.is_valid());
+    }
+    // the servant stays in the current scheduler, the calls kept meanwhile are forwarded there
+    void cancel()
+    {
+        boost::asynchronous::any_shared_scheduler<Job> s;
+        std::vector<std::pair<Job,std::size_t>> dropped;
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_next = boost::asynchronous::any_weak_scheduler<Job>();
+        s = m_target.lock();
+        if (s.is_valid())
+        {
+            for (auto& job : m_pending)
+            {
+                s.post(Job(timed_job(this->shared_from_this(),std::move(job.first))),job.second);
+            }
+            m_pending.clear();
+        }
+        else
+        {
+            dropped.swap(m_pending);
+        }
+        m_moving = false;
+    }
+
+private:
+    boost::asynchronous::any_shared_scheduler<Job> target() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_target.lock();
+    }
+    void add_busy(std::chrono::steady_clock::time_point start)
+    {
+        m_busy.fetch_add(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start).count(),
+                         std::memory_order_relaxed);
+    }
+
+    mutable std::mutex m_mutex;
+    boost::asynchronous::any_weak_scheduler<Job> m_target;
+    boost::asynchronous::any_weak_scheduler<Job> m_next;
+    bool m_moving;
+    // calls made during a migration, with their priority
+    std::vector<std::pair<Job,std::size_t>> m_pending;
+    std::function<bool()> m_leave;
+    std::function<void()> m_arrive;
+    // epoch tables of the threads the servant left
+    std::vector<std::shared_ptr<boost::asynchronous::detail::servant_epoch_table>> m_tables;
+    std::atomic<long long> m_busy;
+    std::atomic<std::size_t> m_migrations;
+};
+
+// proxy given to a servant_proxy, keeps the current scheduler alive, and the previous one until the next migration.
+template <class Job>
+class migratable_proxy :
+#ifndef BOOST_ASYNCHRONOUS_USE_TYPE_ERASURE
+        public any_shared_scheduler_proxy_concept<Job>,
+        public internal_scheduler_aspect_concept<Job>,
+#endif
+        public std::enable_shared_from_this<migratable_proxy<Job> >
+{
+public:
+    typedef Job job_type;
+
+    explicit migratable_proxy(boost::asynchronous::any_shared_scheduler_proxy<Job> scheduler)
+        : m_scheduler(std::move(scheduler))
+        , m_gate(std::make_shared<boost::asynchronous::detail::migration_gate<Job>>(m_scheduler.get_weak_scheduler()))
+    {}
+    void post(job_type job) const
+    {
+        m_gate->post(std::move(job),0);
+    }
+    void post(job_type job, std::size_t prio) const
+    {
+        m_gate->post(std::move(job),prio);
+    }
+    boost::asynchronous::any_interruptible interruptible_post(job_type job) const
+    {
+        return m_gate->interruptible_post(std::move(job));
+    }
+    boost::asynchronous::any_interruptible interruptible_post(job_type job, std::size_t prio) const
+    {
+        return m_gate->interruptible_post(std::move(job),prio);
+    }
+    // threads of the scheduler where the servant currently lives
+    std::vector<boost::thread::id> thread_ids() const
+    {
+        return m_gate->thread_ids();
+    }
+    boost::asynchronous::any_weak_scheduler<job_type> get_weak_scheduler() const
+    {
+        boost::asynchronous::detail::lockable_weak_scheduler<boost::asynchronous::detail::migration_gate<Job>> w(m_gate);
+        return boost::asynchronous::any_weak_scheduler<job_type>(std::move(w));
+    }
+    bool is_valid() const
+    {
+        return !!m_gate;
+    }
+    std::vector<std::size_t> get_queue_size() const
+    {
+        return scheduler().get_queue_size();
+    }
+    std::vector<std::size_t> get_max_queue_size() const
+    {
+        return scheduler().get_max_queue_size();
+    }
+    void reset_max_queue_size()
+    {
+        scheduler().reset_max_queue_size();
+    }
+    boost::asynchronous::scheduler_diagnostics get_diagnostics(std::size_t pos=0) const
+    {
+        return scheduler().get_diagnostics(pos);
+    }
+    void clear_diagnostics()
+    {
+        scheduler().clear_diagnostics();
+    }
+    boost::asynchronous::internal_scheduler_aspect<job_type> get_internal_scheduler_aspect()
+    {
+        return std::static_pointer_cast<boost::asynchronous::internal_scheduler_aspect_concept<job_type>>(this->shared_from_this());
+    }
+    void set_name(std::string const& name)
+    {
+        scheduler().set_name(name);
+    }
+    std::string get_name() const
+    {
+        return scheduler().get_name();
+    }
+    void processor_bind(std::vector<std::tuple<unsigned int,unsigned int>> p)
+    {
+        scheduler().processor_bind(std::move(p));
+    }
+    BOOST_ATTRIBUTE_NODISCARD std::vector<std::future<void>> execute_in_all_threads(boost::asynchronous::any_callable c)
+    {
+        return scheduler().execute_in_all_threads(std::move(c));
+    }
+    std::vector<boost::asynchronous::any_queue_ptr<job_type> > get_queues()
+    {
+        return std::vector<boost::asynchronous::any_queue_ptr<job_type> >();
+    }
+    void set_steal_from_queues(std::vector<boost::asynchronous::any_queue_ptr<job_type> > const&)
+    {
+    }
+
+    // the scheduler where the servant lives
+    boost::asynchronous::any_shared_scheduler_proxy<Job> scheduler() const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_scheduler;
+    }
+    std::future<bool> migrate_to(boost::asynchronous::any_shared_scheduler_proxy<Job> next, std::size_t prio)
+    {
+        std::shared_ptr<std::promise<bool>> done = std::make_shared<std::promise<bool>>();
+        std::future<bool> fu = done->get_future();
+        // next is kept alive by the handoff job, and becomes our scheduler only if the servant moves
+        boost::asynchronous::any_weak_scheduler<Job> weak_next = next.get_weak_scheduler();
+        std::weak_ptr<migratable_proxy> wthis = this->shared_from_this();
+        std::function<void()> moved = [wthis,next]()
+        {
+            std::shared_ptr<migratable_proxy> p = wthis.lock();
+            if (p)
+            {
+                p->moved_to(next);
+            }
+        };
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (m_gate->migrate(std::move(weak_next),prio,done,std::move(moved)))
+            {
+                return fu;
+            }
+        }
+        done->set_value(false);
+        return fu;
+    }
+    std::shared_ptr<boost::asynchronous::detail::migration_gate<Job>> const& get_gate() const
+    {
+        return m_gate;
+    }
+
+private:
+    // called in the old scheduler by the handoff job
+    void moved_to(boost::asynchronous::any_shared_scheduler_proxy<Job> const& next)
+    {
+        // the oldest scheduler is released outside the lock, it might join its threads
+        boost::asynchronous::any_shared_scheduler_proxy<Job> released;
+        std::lock_guard<std::mutex> lock(m_mutex);
+        released = std::move(m_previous);
+        m_previous = std::move(m_scheduler);
+        m_scheduler = next;
+    }
+
+    mutable std::mutex m_mutex;
+    boost::asynchronous::any_shared_scheduler_proxy<Job> m_scheduler;
+    // the scheduler left by the last migration, whose thread finishes the handoff job
+    boost::asynchronous::any_shared_scheduler_proxy<Job> m_previous;
+    std::shared_ptr<boost::asynchronous::detail::migration_gate<Job>> m_gate;
+};
+
+// servants deriving from trackable_servant move their callback tracking with them, or refuse to move
+template <class S>
+auto servant_leave_thread(S& s, int) -> decltype(s.detach_from_thread(), bool())
+{
+    return s.detach_from_thread();
+}
+template <class S>
+bool servant_leave_thread(S&, long)
+{
+    return true;
+}
+template <class S>
+auto servant_arrive_thread(S& s, int) -> decltype(s.attach_to_thread(), void())
+{
+    s.attach_to_thread();
+}
+template <class S>
+void servant_arrive_thread(S&, long)
+{
+}
+
+#ifndef BOOST_ASYNCHRONOUS_USE_TYPE_ERASURE
+template <class Job>
+std::shared_ptr<boost::asynchronous::detail::migratable_proxy<Job>>
+get_migratable_proxy(boost::asynchronous::any_shared_scheduler_proxy<Job> const& proxy)
+{
+    // get_internal_scheduler_aspect does not modify the proxy but is not const
+    return std::dynamic_pointer_cast<boost::asynchronous::detail::migratable_proxy<Job>>(
+                const_cast<boost::asynchronous::any_shared_scheduler_proxy<Job>&>(proxy).get_internal_scheduler_aspect());
+}
+
+// returns the migratable proxy of a servant, with the hooks of the servant set, or nullptr
+template <class Job, class Servant>
+std::shared_ptr<boost::asynchronous::detail::migratable_proxy<Job>>
+prepare_migration(boost::asynchronous::any_shared_scheduler_proxy<Job> const& proxy, std::shared_ptr<Servant> const& servant)
+{
+    std::shared_ptr<boost::asynchronous::detail::migratable_proxy<Job>> m = get_migratable_proxy(proxy);
+    if (m)
+    {
+        // weak: the servant must be destroyed by its destructor job, in its thread
+        std::weak_ptr<Servant> wservant(servant);
+        m->get_gate()->set_migration_hooks(
+                    [wservant]()
+                    {
+                        std::shared_ptr<Servant> s = wservant.lock();
+                        return !s || boost::asynchronous::detail::servant_leave_thread(*s,0);
+                    },
+                    [wservant]()
+                    {
+                        std::shared_ptr<Servant> s = wservant.lock();
+                        if (s)
+                        {
+                            boost::asynchronous::detail::servant_arrive_thread(*s,0);
+                        }
+                    });
+    }
+    return m;
+}
+#endif
+
+// used by servant_proxy::migrate_to
+template <class Job, class Servant>
+std::future<bool> migrate_servant(boost::asynchronous::any_shared_scheduler_proxy<Job> const& proxy, std::shared_ptr<Servant> const& servant,
+                                  boost::asynchronous::any_shared_scheduler_proxy<Job> next, std::size_t prio)
+{
+#ifndef BOOST_ASYNCHRONOUS_USE_TYPE_ERASURE
+    std::shared_ptr<boost::asynchronous::detail::migratable_proxy<Job>> m = prepare_migration(proxy,servant);
+    if (m)
+    {
+        return m->migrate_to(std::move(next),prio);
+    }
+#endif
+    std::promise<bool> refused;
+    refused.set_value(false);
+    return refused.get_future();
+}
+}
+
+#ifndef BOOST_ASYNCHRONOUS_USE_TYPE_ERASURE
+/*!
+ * \brief Creates a scheduler proxy allowing the servant using it to move to another scheduler with servant_proxy::migrate_to.
+ * \brief Create one per servant_proxy. The servant's jobs must all go to a single queue of its scheduler, which is the case
+ * \brief with a single_thread_scheduler and the default priorities.
+ * \param scheduler where the servant lives first
+ * \return a proxy to pass to a servant_proxy. It keeps the current scheduler alive.
+ */
+template <class Job>
+boost::asynchronous::any_shared_scheduler_proxy<Job>
+make_migratable_scheduler(boost::asynchronous::any_shared_scheduler_proxy<Job> scheduler)
+{
+    std::shared_ptr<boost::asynchronous::detail::migratable_proxy<Job>> p =
+            std::make_shared<boost::asynchronous::detail::migratable_proxy<Job>>(std::move(scheduler));
+    return boost::asynchronous::any_shared_scheduler_proxy<Job>(std::move(p));
+}
+
+/*!
+ * \brief Returns the time spent executing the jobs of the servant using a proxy created by make_migratable_scheduler, 0 for other proxies.
+ */
+template <class Job>
+std::chrono::nanoseconds get_servant_busy_time(boost::asynchronous::any_shared_scheduler_proxy<Job> const& proxy)
+{
+    std::shared_ptr<boost::asynchronous::detail::migratable_proxy<Job>> m = boost::asynchronous::detail::get_migratable_proxy(proxy);
+    return m ? m->get_gate()->busy_time() : std::chrono::nanoseconds(0);
+}
+#endif
+
+}} // boost::asynchronous
+
+#endif // BOOST_ASYNCHRONOUS_SCHEDULER_MIGRATABLE_SCHEDULER_HPP
@@ -0,0 +1,478 @@
+// Boost.Asynchronous library
+//  Copyright (C) Christophe Henry 2026
+//
+//  Use, modification and distribution is subject to the Boost
+//  Software License, Version 1.0.  (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// For more information, see http://www.boost.org
+
+// Scheduler proxy for servants whose const members (declared with BOOST_ASYNC_FUTURE_MEMBER_CONST) execute
+// concurrently in a companion threadpool while all other calls execute exclusively in the servant scheduler.
+// Every job posted to the servant (through the proxy or by the servant itself) is a write: it waits for running
+// readers to finish and keeps new readers out while executing. A read requested while writes are pending goes
+// through the servant queue behind them, so that it sees their effects.
+// Usage:
+// auto s = make_reader_parallel_scheduler(servant_scheduler, threadpool);
+// ServantProxy proxy(s, servant args...);
+
+#ifndef BOOST_ASYNCHRONOUS_SCHEDULER_READER_PARALLEL_SCHEDULER_HPP
+#define BOOST_ASYNCHRONOUS_SCHEDULER_READER_PARALLEL_SCHEDULER_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <boost/thread/thread.hpp>
+
+#include <boost/asynchronous/any_scheduler.hpp>
+#include <boost/asynchronous/any_shared_scheduler_proxy.hpp>
+#include <boost/asynchronous/callable_any.hpp>
+#include <boost/asynchronous/job_traits.hpp>
+#include <boost/asynchronous/post.hpp>
+#include <boost/asynchronous/scheduler/detail/lockable_weak_scheduler.hpp>
+
+namespace boost { namespace asynchronous
+{
+namespace detail
+{
+// Seen by the servant as its scheduler. Counts pending writes and running readers, wraps every job into a write.
+template <class Job>
+class reader_writer_gate :
+#ifndef BOOST_ASYNCHRONOUS_USE_TYPE_ERASURE
+        public any_shared_scheduler_concept<Job>,
+#endif
+        public std::enable_shared_from_this<reader_writer_gate<Job> >
+{
+public:
+    typedef Job job_type;
+
+    reader_writer_gate(boost::asynchronous::any_weak_scheduler<Job> scheduler,
+                       boost::asynchronous::any_weak_scheduler<Job> readers)
+        : m_scheduler(std::move(scheduler)), m_readers(std::move(readers))
+        , m_pending_writes(0), m_writing(false), m_running_readers(0), m_parked_readers(0)
+    {}
+
+    // counted in m_pending_writes from post until the write is executed, or destroyed without being executed
+    // (dropped by a stopping scheduler, interrupted before starting...)
+    struct pending_write
+    {
+        explicit pending_write(reader_writer_gate* gate)
+            : m_gate(gate)
+        {
+            m_gate->m_pending_writes.fetch_add(1);
+        }
+        pending_write(pending_write const&) = delete;
+        pending_write& operator=(pending_write const&) = delete;
+        ~pending_write()
+        {
+            done();
+        }
+        void done()
+        {
+            if (!m_done.exchange(true))
+            {
+                m_gate->m_pending_writes.fetch_sub(1);
+            }
+        }
+        reader_writer_gate* m_gate;
+        std::atomic<bool> m_done{false};
+    };
+
+    // executes a job exclusively
+    struct writer_job : public boost::asynchronous::job_traits<Job>::diagnostic_type
+    {
+        writer_job(std::shared_ptr<reader_writer_gate> gate, Job job)
+            : m_gate(std::move(gate)), m_pending(std::make_shared<pending_write>(m_gate.get())), m_job(std::move(job))
+        {
+            this->set_name(boost::asynchronous::job_traits<Job>::get_name(m_job));
+        }
+        void operator()()
+        {
+            m_gate->begin_write();
+            try
+            {
+                m_job();
+            }
+            catch(...)
+            {
+                m_gate->end_write(*m_pending);
+                throw;
+            }
+            m_gate->end_write(*m_pending);
+        }
+        std::shared_ptr<reader_writer_gate> m_gate;
+        // shared by the copies of the job, destroyed before the gate it points to
+        std::shared_ptr<pending_write> m_pending;
+        Job m_job;
+    };
+
+    // executes a read, shared with other reads
+    template <class F, class R>
+    struct reader_job
+    {
+        void operator()()
+        {
+            m_gate->begin_read();
+            try
+            {
+                set_value(std::is_same<R,void>());
+            }
+            catch(...)
+            {
+                m_promise->set_exception(std::current_exception());
+            }
+            m_gate->end_read();
+        }
+        void set_value(std::true_type)
+        {
+            m_func();
+            m_promise->set_value();
+        }
+        void set_value(std::false_type)
+        {
+            m_promise->set_value(m_func());
+        }
+        std::shared_ptr<reader_writer_gate> m_gate;
+        F m_func;
+        std::shared_ptr<std::promise<R>> m_promise;
+    };
+
+    void post(job_type job)
+    {
+        post(std::move(job),0);
+    }
+    void post(job_type job, std::size_t prio)
+    {
+        boost::asynchronous::any_shared_scheduler<Job> s = m_scheduler.lock();
+        if (s.is_valid())
+        {
+            s.post(Job(writer_job(this->shared_from_this(),std::move(job))),prio);
+        }
+    }
+    boost::asynchronous::any_interruptible interruptible_post(job_type job)
+    {
+        return interruptible_post(std::move(job),0);
+    }
+    boost::asynchronous::any_interruptible interruptible_post(job_type job, std::size_t prio)
+    {
+        boost::asynchronous::any_shared_scheduler<Job> s = m_scheduler.lock();
+        if (s.is_valid())
+        {
+            return s.interruptible_post(Job(writer_job(this->shared_from_this(),std::move(job))),prio);
+        }
+        return boost::asynchronous::any_interruptible();
+    }
+    std::vector<boost::thread::id> thread_ids() const
+    {
+        boost::asynchronous::any_shared_scheduler<Job> s = m_scheduler.lock();
+        return s.is_valid() ? s.thread_ids() : std::vector<boost::thread::id>();
+    }
+    std::vector<std::size_t> get_queue_size() const
+    {
+        boost::asynchronous::any_shared_scheduler<Job> s = m_scheduler.lock();
+        return s.is_valid() ? s.get_queue_size() : std::vector<std::size_t>();
+    }
+    std::vector<std::size_t> get_max_queue_size() const
+    {
+        boost::asynchronous::any_shared_scheduler<Job> s = m_scheduler.lock();
+        return s.is_valid() ? s.get_max_queue_size() : std::vector<std::size_t>();
+    }
+    void reset_max_queue_size()
+    {
+    }
+    boost::asynchronous::scheduler_diagnostics get_diagnostics(std::size_t pos=0) const
+    {
+        boost::asynchronous::any_shared_scheduler<Job> s = m_scheduler.lock();
+        return s.is_valid() ? s.get_diagnostics(pos) : boost::asynchronous::scheduler_diagnostics();
+    }
+    void register_diagnostics_functor(std::function<void(boost::asynchronous::scheduler_diagnostics)>,
+                                      boost::asynchronous::register_diagnostics_type =
+                                            boost::asynchronous::register_diagnostics_type())
+    {
+    }
+    void clear_diagnostics()
+    {
+    }
+    std::string get_name() const
+    {
+        boost::asynchronous::any_shared_scheduler<Job> s = m_scheduler.lock();
+        return s.is_valid() ? s.get_name() : std::string();
+    }
+    void processor_bind(std::vector<std::tuple<unsigned int,unsigned int>>)
+    {
+    }
+    BOOST_ATTRIBUTE_NODISCARD std::vector<std::future<void>> execute_in_all_threads(boost::asynchronous::any_callable)
+    {
+        return std::vector<std::future<void>>();
+    }
+    void enable_queue(std::size_t, bool) override
+    {
+    }
+
+    /*!
+     * \brief Executes f in the reader pool, concurrently with other reads, after the writes already posted.
+     * \param readers the reader pool, held by the caller
+     * \return a future to the result of f
+     */
+    template <class F>
+    auto post_read(boost::asynchronous::any_shared_scheduler_proxy<Job> const& readers, F f, std::size_t prio)
+        -> std::future<decltype(f())>
+    {
+        typedef decltype(f()) result_type;
+        std::shared_ptr<std::promise<result_type>> p = std::make_shared<std::promise<result_type>>();
+        std::future<result_type> fu = p->get_future();
+        reader_job<F,result_type> job{this->shared_from_this(),std::move(f),std::move(p)};
+        if (m_pending_writes.load() == 0)
+        {
+            readers.post(typename boost::asynchronous::job_traits<Job>::wrapper_type(
+                             boost::asynchronous::any_callable(std::move(job))),prio);
+        }
+        else
+        {
+            // after the pending writes, move to the reader pool
+            boost::asynchronous::any_shared_scheduler<Job> s = m_scheduler.lock();
+            if (s.is_valid())
+            {
+                boost::asynchronous::any_weak_scheduler<Job> weak_readers = m_readers;
+                auto relay = [weak_readers,job,prio]() mutable
+                {
+                    boost::asynchronous::any_shared_scheduler<Job> r = weak_readers.lock();
+                    if (r.is_valid())
+                    {
+                        r.post(typename boost::asynchronous::job_traits<Job>::wrapper_type(
+                                   boost::asynchronous::any_callable(std::move(job))),prio);
+                    }
+                    else
+                    {
+                        job();
+                    }
+                };
+                s.post(typename boost::asynchronous::job_traits<Job>::wrapper_type(
+                           boost::asynchronous::any_callable(std::move(relay))),prio);
+            }
+        }
+        return fu;
+    }
+
+    // only called in the servant thread, so there is at most one writer.
+    // Readers and writer only take the mutex when they have to wait for each other
+    void begin_write()
+    {
+        m_writing.store(true);
+        if (m_running_readers.load() != 0)
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_wait.wait(lock,[this](){return m_running_readers.load() == 0;});
+        }
+    }
+    void end_write(pending_write& pending)
+    {
+        m_writing.store(false);
+        if (m_parked_readers.load() != 0)
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_wait.notify_all();
+        }
+        pending.done();
+    }
+    void begin_read()
+    {
+        while (true)
+        {
+            m_running_readers.fetch_add(1);
+            if (!m_writing.load())
+            {
+                return;
+            }
+            // let the writer in and wait until it is done
+            end_read();
+            std::unique_lock<std::mutex> lock(m_mutex);
+            ++m_parked_readers;
+            m_wait.wait(lock,[this](){return !m_writing.load();});
+            --m_parked_readers;
+        }
+    }
+    void end_read()
+    {
+        if (m_running_readers.fetch_sub(1) == 1 && m_writing.load())
+        {
+            // the writer waits for the last reader
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_wait.notify_all();
+        }
+    }
+
+private:
+    boost::asynchronous::any_weak_scheduler<Job> m_scheduler;
+    boost::asynchronous::any_weak_scheduler<Job> m_readers;
+    std::atomic<std::size_t> m_pending_writes;
+    std::atomic<bool> m_writing;
+    std::atomic<std::size_t> m_running_readers;
+    std::atomic<std::size_t> m_parked_readers;
+    std::mutex m_mutex;
+    std::condition_variable m_wait;
+};
+
+// proxy given to a servant_proxy, keeps both schedulers alive. The gate only has weak references,
+// as write jobs keep it alive in the servant scheduler.
+template <class Job>
+class reader_parallel_proxy :
+#ifndef BOOST_ASYNCHRONOUS_USE_TYPE_ERASURE
+        public any_shared_scheduler_proxy_concept<Job>,
+        public internal_scheduler_aspect_concept<Job>,
+#endif
+        public std::enable_shared_from_this<reader_parallel_proxy<Job> >
+{
+public:
+    typedef Job job_type;
+
+    reader_parallel_proxy(boost::asynchronous::any_shared_scheduler_proxy<Job> scheduler,
+                          boost::asynchronous::any_shared_scheduler_proxy<Job> readers)
+        : m_scheduler(std::move(scheduler)), m_readers(std::move(readers))
+        , m_gate(std::make_shared<boost::asynchronous::detail::reader_writer_gate<Job>>(
+                     m_scheduler.get_weak_scheduler(),m_readers.get_weak_scheduler()))
+    {}
+    void post(job_type job) const
+    {
+        m_gate->post(std::move(job));
+    }
+    void post(job_type job, std::size_t prio) const
+    {
+        m_gate->post(std::move(job),prio);
+    }
+    boost::asynchronous::any_interruptible interruptible_post(job_type job) const
+    {
+        return m_gate->interruptible_post(std::move(job));
+    }
+    boost::asynchronous::any_interruptible interruptible_post(job_type job, std::size_t prio) const
+    {
+        return m_gate->interruptible_post(std::move(job),prio);
+    }
+    std::vector<boost::thread::id> thread_ids() const
+    {
+        return m_scheduler.thread_ids();
+    }
+    boost::asynchronous::any_weak_scheduler<job_type> get_weak_scheduler() const
+    {
+        boost::asynchronous::detail::lockable_weak_scheduler<boost::asynchronous::detail::reader_writer_gate<Job>> w(m_gate);
+        return boost::asynchronous::any_weak_scheduler<job_type>(std::move(w));
+    }
+    bool is_valid() const
+    {
+        return !!m_gate;
+    }
+    std::vector<std::size_t> get_queue_size() const
+    {
+        return m_scheduler.get_queue_size();
+    }
+    std::vector<std::size_t> get_max_queue_size() const
+    {
+        return m_scheduler.get_max_queue_size();
+    }
+    void reset_max_queue_size()
+    {
+        m_scheduler.reset_max_queue_size();
+    }
+    boost::asynchronous::scheduler_diagnostics get_diagnostics(std::size_t pos=0) const
+    {
+        return m_scheduler.get_diagnostics(pos);
+    }
+    void clear_diagnostics()
+    {
+        m_scheduler.clear_diagnostics();
+    }
+    boost::asynchronous::internal_scheduler_aspect<job_type> get_internal_scheduler_aspect()
+    {
+        return std::static_pointer_cast<boost::asynchronous::internal_scheduler_aspect_concept<job_type>>(this->shared_from_this());
+    }
+    void set_name(std::string const& name)
+    {
+        m_scheduler.set_name(name);
+    }
+    std::string get_name() const
+    {
+        return m_scheduler.get_name();
+    }
+    void processor_bind(std::vector<std::tuple<unsigned int,unsigned int>> p)
+    {
+        m_scheduler.processor_bind(std::move(p));
+    }
+    BOOST_ATTRIBUTE_NODISCARD std::vector<std::future<void>> execute_in_all_threads(boost::asynchronous::any_callable c)
+    {
+        return m_scheduler.execute_in_all_threads(std::move(c));
+    }
+    std::vector<boost::asynchronous::any_queue_ptr<job_type> > get_queues()
+    {
+        return std::vector<boost::asynchronous::any_queue_ptr<job_type> >();
+    }
+    void set_steal_from_queues(std::vector<boost::asynchronous::any_queue_ptr<job_type> > const&)
+    {
+    }
+
+    std::shared_ptr<boost::asynchronous::detail::reader_writer_gate<Job>> const& get_gate() const
+    {
+        return m_gate;
+    }
+    boost::asynchronous::any_shared_scheduler_proxy<Job> const& get_readers() const
+    {
+        return m_readers;
+    }
+
+private:
+    mutable boost::asynchronous::any_shared_scheduler_proxy<Job> m_scheduler;
+    boost::asynchronous::any_shared_scheduler_proxy<Job> m_readers;
+    std::shared_ptr<boost::asynchronous::detail::reader_writer_gate<Job>> m_gate;
+};
+
+// used by BOOST_ASYNC_FUTURE_MEMBER_CONST: executes f in the reader pool if the servant lives in a reader_parallel_proxy,
+// otherwise posts it to the servant scheduler like any call
+template <class Job, class F>
+auto post_reader_future(boost::asynchronous::any_shared_scheduler_proxy<Job> const& proxy, F f, std::size_t prio)
+    -> std::future<decltype(f())>
+{
+#ifndef BOOST_ASYNCHRONOUS_USE_TYPE_ERASURE
+    // get_internal_scheduler_aspect does not modify the proxy but is not const
+    std::shared_ptr<boost::asynchronous::detail::reader_parallel_proxy<Job>> rw =
+        std::dynamic_pointer_cast<boost::asynchronous::detail::reader_parallel_proxy<Job>>(
+            const_cast<boost::asynchronous::any_shared_scheduler_proxy<Job>&>(proxy).get_internal_scheduler_aspect());
+    if (rw)
+    {
+        return rw->get_gate()->post_read(rw->get_readers(),std::move(f),prio);
+    }
+#endif
+    return boost::asynchronous::post_future(proxy,std::move(f),"",prio);
+}
+}
+
+#ifndef BOOST_ASYNCHRONOUS_USE_TYPE_ERASURE
+/*!
+ * \brief Creates a scheduler proxy for a servant whose const members declared with BOOST_ASYNC_FUTURE_MEMBER_CONST
+ * \brief execute concurrently in a companion threadpool. Other calls execute exclusively in the servant scheduler.
+ * \param scheduler where the servant lives and writes execute
+ * \param readers threadpool executing reads
+ * \return a proxy to pass to a servant_proxy. It keeps both schedulers alive.
+ */
+template <class Job>
+boost::asynchronous::any_shared_scheduler_proxy<Job>
+make_reader_parallel_scheduler(boost::asynchronous::any_shared_scheduler_proxy<Job> scheduler,
+                               boost::asynchronous::any_shared_scheduler_proxy<Job> readers)
+{
+    std::shared_ptr<boost::asynchronous::detail::reader_parallel_proxy<Job>> p =
+            std::make_shared<boost::asynchronous::detail::reader_parallel_proxy<Job>>(std::move(scheduler),std::move(readers));
+    return boost::asynchronous::any_shared_scheduler_proxy<Job>(std::move(p));
+}
+#endif
+
+}} // boost::asynchronous
+
+#endif // BOOST_ASYNCHRONOUS_SCHEDULER_READER_PARALLEL_SCHEDULER_HPP
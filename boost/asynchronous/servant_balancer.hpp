@@ -0,0 +1,231 @@
+// Boost.Asynchronous library
+//  Copyright (C) Christophe Henry 2026
+//
+//  Use, modification and distribution is subject to the Boost
+//  Software License, Version 1.0.  (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// For more information, see http://www.boost.org
+
+// Moves servants from the busiest scheduler of a set to the least busy one.
+// The busy time of a scheduler is taken from its diagnostics if its jobs are loggable, otherwise it is the time spent
+// in the servants of the balancer living there. Servants must use a proxy created with make_migratable_scheduler.
+// Usage:
+// servant_balancer<> balancer({scheduler1,scheduler2});
+// balancer.add(proxy1); balancer.add(proxy2);
+// balancer.rebalance(); // periodically, for example from a timer
+
+#ifndef BOOST_ASYNCHRONOUS_SERVANT_BALANCER_HPP
+#define BOOST_ASYNCHRONOUS_SERVANT_BALANCER_HPP
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <tuple>
+#include <vector>
+
+#include <boost/thread/thread.hpp>
+
+#include <boost/asynchronous/any_shared_scheduler_proxy.hpp>
+#include <boost/asynchronous/scheduler_diagnostics.hpp>
+#include <boost/asynchronous/scheduler/migratable_scheduler.hpp>
+
+namespace boost { namespace asynchronous
+{
+namespace detail
+{
+// time spent executing the jobs found in diagnostics
+inline std::chrono::nanoseconds busy_time(boost::asynchronous::scheduler_diagnostics const& diag)
+{
+    std::chrono::nanoseconds busy(0);
+    for (auto const& job : diag.totals())
+    {
+        for (auto const& item : job.second)
+        {
+            busy += std::chrono::duration_cast<std::chrono::nanoseconds>(item.get_finished_time() - item.get_started_time());
+        }
+    }
+    return busy;
+}
+}
+
+#ifndef BOOST_ASYNCHRONOUS_USE_TYPE_ERASURE
+/*!
+ * \brief Balances servants between schedulers, based on their busy time since the previous call to rebalance.
+ * \brief Not thread-safe: rebalance is meant to be called periodically from a single thread.
+ */
+template <class Job = BOOST_ASYNCHRONOUS_DEFAULT_JOB>
+class servant_balancer
+{
+public:
+    /*!
+     * \brief Constructor
+     * \param schedulers where servants can be moved to.
+     * \param imbalance a servant is moved when the busiest scheduler was busy more than imbalance times the least busy one.
+     */
+    servant_balancer(std::vector<boost::asynchronous::any_shared_scheduler_proxy<Job>> schedulers, double imbalance = 1.5)
+        : m_schedulers(std::move(schedulers))
+        , m_imbalance(imbalance)
+        , m_last_busy(m_schedulers.size(),std::chrono::nanoseconds(0))
+        , m_busy(m_schedulers.size(),std::chrono::nanoseconds(0))
+    {
+        for (auto const& s : m_schedulers)
+        {
+            m_thread_ids.push_back(s.thread_ids());
+        }
+    }
+
+    /*!
+     * \brief Adds a servant to balance. The balancer does not keep it alive.
+     * \param proxy a servant_proxy created with a proxy returned by make_migratable_scheduler.
+     * \return false if the proxy cannot migrate.
+     */
+    template <class Proxy>
+    bool add(Proxy const& proxy)
+    {
+        std::shared_ptr<boost::asynchronous::detail::migratable_proxy<Job>> m =
+                boost::asynchronous::detail::prepare_migration(proxy.get_proxy(),proxy.get_servant());
+        if (!m)
+        {
+            return false;
+        }
+        m_servants.push_back(servant_entry{m,m->get_gate()->busy_time(),proxy.get_migration_prio()});
+        return true;
+    }
+
+    /*!
+     * \brief Measures the busy time of every scheduler since the previous call and moves at most one servant
+     * \brief from the busiest to the least busy scheduler, the one bringing them closest.
+     * \return true if a migration was started.
+     */
+    bool rebalance()
+    {
+        std::vector<std::chrono::nanoseconds> from_diagnostics(m_schedulers.size(),std::chrono::nanoseconds(0));
+        for (std::size_t i = 0; i < m_schedulers.size(); ++i)
+        {
+            std::chrono::nanoseconds busy = boost::asynchronous::detail::busy_time(m_schedulers[i].get_diagnostics());
+            // diagnostics cleared in the meantime
+            from_diagnostics[i] = (busy >= m_last_busy[i]) ? busy - m_last_busy[i] : busy;
+            m_last_busy[i] = busy;
+        }
+        std::vector<std::chrono::nanoseconds> from_servants(m_schedulers.size(),std::chrono::nanoseconds(0));
+        // busy time and scheduler of every servant still alive
+        std::vector<std::tuple<std::shared_ptr<boost::asynchronous::detail::migratable_proxy<Job>>,std::chrono::nanoseconds,std::size_t,std::size_t>> candidates;
+        std::vector<servant_entry> alive;
+        for (auto& entry : m_servants)
+        {
+            std::shared_ptr<boost::asynchronous::detail::migratable_proxy<Job>> m = entry.m_proxy.lock();
+            if (!m)
+            {
+                continue;
+            }
+            std::chrono::nanoseconds total = m->get_gate()->busy_time();
+            std::chrono::nanoseconds busy = total - entry.m_last_busy;
+            entry.m_last_busy = total;
+            alive.push_back(entry);
+            std::size_t where = find_scheduler(m->thread_ids());
+            if (where == m_schedulers.size())
+            {
+                continue;
+            }
+            from_servants[where] += busy;
+            if (!m->get_gate()->is_migrating())
+            {
+                candidates.emplace_back(std::move(m),busy,where,entry.m_prio);
+            }
+        }
+        m_servants.swap(alive);
+
+        if (m_schedulers.size() < 2)
+        {
+            return false;
+        }
+        std::size_t busiest = 0;
+        std::size_t idlest = 0;
+        for (std::size_t i = 0; i < m_schedulers.size(); ++i)
+        {
+            m_busy[i] = std::max(from_diagnostics[i],from_servants[i]);
+            if (m_busy[i] > m_busy[busiest])
+            {
+                busiest = i;
+            }
+            if (m_busy[i] < m_busy[idlest])
+            {
+                idlest = i;
+            }
+        }
+        std::chrono::nanoseconds diff = m_busy[busiest] - m_busy[idlest];
+        if (diff.count() <= 0 || m_busy[busiest].count() <= m_imbalance * m_busy[idlest].count())
+        {
+            return false;
+        }
+        // the servant whose move brings both schedulers closest. Moving one busier than the difference makes it worse.
+        std::shared_ptr<boost::asynchronous::detail::migratable_proxy<Job>> best;
+        std::size_t best_prio = 0;
+        std::chrono::nanoseconds best_distance = diff;
+        for (auto const& c : candidates)
+        {
+            std::chrono::nanoseconds busy = std::get<1>(c);
+            if (std::get<2>(c) != busiest || busy.count() <= 0 || busy >= diff)
+            {
+                continue;
+            }
+            std::chrono::nanoseconds distance = (diff - 2 * busy >= std::chrono::nanoseconds(0)) ? diff - 2 * busy : 2 * busy - diff;
+            if (distance < best_distance)
+            {
+                best_distance = distance;
+                best = std::get<0>(c);
+                best_prio = std::get<3>(c);
+            }
+        }
+        if (!best)
+        {
+            return false;
+        }
+        // result not awaited, the servant keeps executing calls in the meantime. The handoff job has the priority
+        // of the servant's jobs, so that it comes after all of them.
+        best->migrate_to(m_schedulers[idlest],best_prio);
+        return true;
+    }
+
+    /*!
+     * \brief Returns the busy time of every scheduler measured by the last rebalance.
+     */
+    std::vector<std::chrono::nanoseconds> const& busy_times() const
+    {
+        return m_busy;
+    }
+
+private:
+    struct servant_entry
+    {
+        std::weak_ptr<boost::asynchronous::detail::migratable_proxy<Job>> m_proxy;
+        std::chrono::nanoseconds m_last_busy;
+        // of the servant's jobs
+        std::size_t m_prio;
+    };
+    std::size_t find_scheduler(std::vector<boost::thread::id> const& ids) const
+    {
+        for (std::size_t i = 0; i < m_thread_ids.size(); ++i)
+        {
+            if (m_thread_ids[i] == ids)
+            {
+                return i;
+            }
+        }
+        return m_schedulers.size();
+    }
+
+    std::vector<boost::asynchronous::any_shared_scheduler_proxy<Job>> m_schedulers;
+    std::vector<std::vector<boost::thread::id>> m_thread_ids;
+    const double m_imbalance;
+    std::vector<servant_entry> m_servants;
+    std::vector<std::chrono::nanoseconds> m_last_busy;
+    std::vector<std::chrono::nanoseconds> m_busy;
+};
+#endif
+
+}} // boost::asynchronous
+
+#endif // BOOST_ASYNCHRONOUS_SERVANT_BALANCER_HPP
@@ -15,6 +15,13 @@
 // BOOST_ASYNC_FUTURE_MEMBER_LOG(member, taskname [,priority]): as above but will be logged with this name if the job type supports it.
 // BOOST_ASYNC_POST_MEMBER(member [,priority]): calls the desired member of the servant, returns nothing
 // BOOST_ASYNC_POST_MEMBER_LOG(member, taskname [,priority]): as above but will be logged with this name if the job type supports it.
+// BOOST_ASYNC_BATCHED_POST_MEMBER(member [,priority]): as BOOST_ASYNC_POST_MEMBER but calls made until the servant executes them share one job.
+// BOOST_ASYNC_BATCH_MEMBER(member [,priority]): as above, the member is called once per batch with a call_batch<Args...>&.
+// Tested in test_servant_proxy_batched.cpp.
+// BOOST_ASYNC_FUTURE_MEMBER_CONST(member [,priority]): as BOOST_ASYNC_FUTURE_MEMBER, executed in parallel with other const members if the servant
+// proxy was created with make_reader_parallel_scheduler. Tested in test_reader_parallel_servant.cpp.
+// A servant_proxy created with make_bounded_scheduler limits the calls in flight. Tested in test_bounded_scheduler.cpp.
+// A servant_proxy created with make_migratable_scheduler can move its servant with migrate_to. Tested in test_migratable_scheduler.cpp.
 // more exotic:
 // BOOST_ASYNC_MEMBER_UNSAFE_CALLBACK(member [,priority]): calls the desired member of the servant, takes as first argument a callback
 // Useful when a servant wants to call a member of another servant and being a trackable_servant, needs no future but a callback.
@@ -39,7 +46,10 @@
 
 #include <boost/thread/thread.hpp>
 
+#include <atomic>
 #include <memory>
+#include <tuple>
+#include <vector>
 #include <boost/type_traits/has_trivial_constructor.hpp>
 #include <boost/mpl/has_xxx.hpp>
 #include <boost/preprocessor/facilities/overload.hpp>
@@ -48,6 +58,10 @@
 #include <boost/asynchronous/post.hpp>
 #include <boost/asynchronous/job_traits.hpp>
 #include <boost/asynchronous/detail/move_bind.hpp>
+#include <boost/asynchronous/detail/call_batcher.hpp>
+#include <boost/asynchronous/scheduler/reader_parallel_scheduler.hpp>
+#include <boost/asynchronous/scheduler/bounded_scheduler.hpp>
+#include <boost/asynchronous/scheduler/migratable_scheduler.hpp>
 
 
 namespace boost { namespace asynchronous
@@ -62,7 +76,7 @@ BOOST_MPL_HAS_XXX_TRAIT_DEF(servant_type)
     template <typename... Args>                                                                                                 \
     void funcname(Args... args)const                                                                                            \
     {                                                                                                                           \
-        auto servant = this->m_servant;                                                                                         \
+        auto servant = this->call_target();                                                                                     \
         std::size_t p = 100000 * this->m_offset_id;                                                                             \
         this->post(typename boost::asynchronous::job_traits<callable_type>::wrapper_type(boost::asynchronous::any_callable      \
         (boost::asynchronous::move_bind([servant](Args... as){servant->funcname(std::move(as)...);},std::move(args)...))),p);   \
@@ -73,7 +87,7 @@ BOOST_MPL_HAS_XXX_TRAIT_DEF(servant_type)
     template <typename... Args>                                                                                                 \
     void funcname(Args... args)const                                                                                            \
     {                                                                                                                           \
-        auto servant = this->m_servant;                                                                                         \
+        auto servant = this->call_target();                                                                                     \
         std::size_t p = prio + 100000 * this->m_offset_id;                                                                      \
         this->post(typename boost::asynchronous::job_traits<callable_type>::wrapper_type(boost::asynchronous::any_callable      \
         (boost::asynchronous::move_bind([servant](Args... as){servant->funcname(std::move(as)...);},std::move(args)...))),p);   \
@@ -87,7 +101,7 @@ BOOST_MPL_HAS_XXX_TRAIT_DEF(servant_type)
     template <typename... Args>                                                                                                             \
     void funcname(Args... args)const                                                                                                        \
     {                                                                                                                                       \
-        auto servant = this->m_servant;                                                                                                     \
+        auto servant = this->call_target();                                                                                                 \
         std::size_t prio = 100000 * this->m_offset_id;                                                                                      \
         typename boost::asynchronous::job_traits<callable_type>::wrapper_type  a(boost::asynchronous::any_callable                          \
                         (boost::asynchronous::move_bind([servant](Args... as){servant->funcname(std::move(as)...);},std::move(args)...)));  \
@@ -100,7 +114,7 @@ BOOST_MPL_HAS_XXX_TRAIT_DEF(servant_type)
     template <typename... Args>                                                                                                             \
     void funcname(Args... args)const                                                                                                        \
     {                                                                                                                                       \
-        auto servant = this->m_servant;                                                                                                     \
+        auto servant = this->call_target();                                                                                                 \
         std::size_t p = prio + 100000 * this->m_offset_id;                                                                                  \
         typename boost::asynchronous::job_traits<callable_type>::wrapper_type  a(boost::asynchronous::any_callable                          \
                         (boost::asynchronous::move_bind([servant](Args... as){servant->funcname(std::move(as)...);},std::move(args)...)));  \
@@ -111,6 +125,51 @@ BOOST_MPL_HAS_XXX_TRAIT_DEF(servant_type)
 #define BOOST_ASYNC_POST_MEMBER_LOG(...)                                                                        \
     BOOST_PP_CAT(BOOST_PP_OVERLOAD(BOOST_ASYNC_POST_MEMBER_LOG_,__VA_ARGS__)(__VA_ARGS__), BOOST_PP_EMPTY())
 
+// calls gathered until the servant executes them: one posted job per batch instead of one per call.
+// Calls keep their order among themselves but can overtake calls to other members made after the first call of the batch.
+// The servant member must not be overloaded.
+#ifndef BOOST_ASYNCHRONOUS_REQUIRE_ALL_ARGUMENTS
+#define BOOST_ASYNC_BATCHED_POST_MEMBER_1(funcname)                                                                             \
+    BOOST_ASYNC_BATCHED_POST_MEMBER_2(funcname,0)
+#endif
+
+#define BOOST_ASYNC_BATCHED_POST_MEMBER_2(funcname,prio)                                                                        \
+    decltype(boost::asynchronous::detail::make_call_batcher<false>(std::shared_ptr<servant_type>(),                            \
+             boost::asynchronous::any_weak_scheduler<callable_type>(),&servant_type::funcname,0))                              \
+        BOOST_PP_CAT(m_batcher_,funcname) = boost::asynchronous::detail::make_call_batcher<false>(this->m_servant,             \
+             this->m_proxy.get_weak_scheduler(),&servant_type::funcname,prio + 100000 * this->m_offset_id,                      \
+             this->m_servant_constructed);                                                                                      \
+    template <typename... Args>                                                                                                 \
+    void funcname(Args&&... args)const                                                                                          \
+    {                                                                                                                           \
+        BOOST_PP_CAT(m_batcher_,funcname)->push(std::forward<Args>(args)...);                                                   \
+    }
+
+#define BOOST_ASYNC_BATCHED_POST_MEMBER(...)                                                                    \
+    BOOST_PP_CAT(BOOST_PP_OVERLOAD(BOOST_ASYNC_BATCHED_POST_MEMBER_,__VA_ARGS__)(__VA_ARGS__), BOOST_PP_EMPTY())
+
+// same as BOOST_ASYNC_BATCHED_POST_MEMBER but the servant member is called once per batch,
+// with a boost::asynchronous::call_batch<Args...>& holding the arguments of every call
+#ifndef BOOST_ASYNCHRONOUS_REQUIRE_ALL_ARGUMENTS
+#define BOOST_ASYNC_BATCH_MEMBER_1(funcname)                                                                                    \
+    BOOST_ASYNC_BATCH_MEMBER_2(funcname,0)
+#endif
+
+#define BOOST_ASYNC_BATCH_MEMBER_2(funcname,prio)                                                                               \
+    decltype(boost::asynchronous::detail::make_call_batcher<true>(std::shared_ptr<servant_type>(),                             \
+             boost::asynchronous::any_weak_scheduler<callable_type>(),&servant_type::funcname,0))                              \
+        BOOST_PP_CAT(m_batcher_,funcname) = boost::asynchronous::detail::make_call_batcher<true>(this->m_servant,              \
+             this->m_proxy.get_weak_scheduler(),&servant_type::funcname,prio + 100000 * this->m_offset_id,                      \
+             this->m_servant_constructed);                                                                                      \
+    template <typename... Args>                                                                                                 \
+    void funcname(Args&&... args)const                                                                                          \
+    {                                                                                                                           \
+        BOOST_PP_CAT(m_batcher_,funcname)->push(std::forward<Args>(args)...);                                                   \
+    }
+
+#define BOOST_ASYNC_BATCH_MEMBER(...)                                                                           \
+    BOOST_PP_CAT(BOOST_PP_OVERLOAD(BOOST_ASYNC_BATCH_MEMBER_,__VA_ARGS__)(__VA_ARGS__), BOOST_PP_EMPTY())
+
 #ifndef BOOST_ASYNCHRONOUS_REQUIRE_ALL_ARGUMENTS
 #ifdef BOOST_NO_CXX14_RETURN_TYPE_DEDUCTION
 #define BOOST_ASYNC_FUTURE_MEMBER_LOG_2(funcname,taskname)                                                                                                  \
@@ -118,7 +177,7 @@ BOOST_MPL_HAS_XXX_TRAIT_DEF(servant_type)
     auto funcname(Args... args)const                                                                                                                        \
         -> std::future<decltype(std::shared_ptr<servant_type>()->funcname(std::move(args)...))>                                                         \
     {                                                                                                                                                       \
-        auto servant = this->m_servant;                                                                                                                     \
+        auto servant = this->call_target();                                                                                                                 \
         std::size_t prio = 100000 * this->m_offset_id;                                                                                                      \
         return boost::asynchronous::post_future(this->m_proxy,                                                                                              \
                 boost::asynchronous::move_bind([servant](Args... as)                                                                                        \
@@ -130,7 +189,7 @@ BOOST_MPL_HAS_XXX_TRAIT_DEF(servant_type)
     template <typename... Args>                                                                                                                             \
     auto funcname(Args... args)const                                                                                                                        \
     {                                                                                                                                                       \
-        auto servant = this->m_servant;                                                                                                                     \
+        auto servant = this->call_target();                                                                                                                 \
         std::size_t prio = 100000 * this->m_offset_id;                                                                                                      \
         return boost::asynchronous::post_future(this->m_proxy,                                                                                              \
                 boost::asynchronous::move_bind([servant](Args... as)                                                                                        \
@@ -146,7 +205,7 @@ BOOST_MPL_HAS_XXX_TRAIT_DEF(servant_type)
     auto funcname(Args... args)const                                                                                                                    \
         -> std::future<decltype(std::shared_ptr<servant_type>()->funcname(std::move(args)...))>                                                     \
     {                                                                                                                                                   \
-        auto servant = this->m_servant;                                                                                                                 \
+        auto servant = this->call_target();                                                                                                             \
         std::size_t p = prio + 100000 * this->m_offset_id;                                                                                              \
         return boost::asynchronous::post_future(this->m_proxy,                                                                                          \
                 boost::asynchronous::move_bind([servant](Args... as)                                                                                    \
@@ -158,7 +217,7 @@ BOOST_MPL_HAS_XXX_TRAIT_DEF(servant_type)
     template <typename... Args>                                                                                                                         \
     auto funcname(Args... args)const                                                                                                                    \
     {                                                                                                                                                   \
-        auto servant = this->m_servant;                                                                                                                 \
+        auto servant = this->call_target();                                                                                                             \
         std::size_t p = prio + 100000 * this->m_offset_id;                                                                                              \
         return boost::asynchronous::post_future(this->m_proxy,                                                                                          \
                 boost::asynchronous::move_bind([servant](Args... as)                                                                                    \
@@ -176,7 +235,7 @@ BOOST_MPL_HAS_XXX_TRAIT_DEF(servant_type)
     auto funcname(Args... args)const                                                                                                                    \
         -> std::future<decltype(std::shared_ptr<servant_type>()->funcname(std::move(args)...))>                                                     \
     {                                                                                                                                                   \
-        auto servant = this->m_servant;                                                                                                                 \
+        auto servant = this->call_target();                                                                                                             \
         std::size_t prio = 100000 * this->m_offset_id;                                                                                                  \
         return boost::asynchronous::post_future(this->m_proxy,                                                                                          \
                 boost::asynchronous::move_bind([servant](Args... as)                                                                                    \
@@ -188,7 +247,7 @@ BOOST_MPL_HAS_XXX_TRAIT_DEF(servant_type)
     template <typename... Args>                                                                                                                         \
     auto funcname(Args... args)const                                                                                                                    \
     {                                                                                                                                                   \
-        auto servant = this->m_servant;                                                                                                                 \
+        auto servant = this->call_target();                                                                                                             \
         std::size_t prio = 100000 * this->m_offset_id;                                                                                                  \
         return boost::asynchronous::post_future(this->m_proxy,                                                                                          \
                 boost::asynchronous::move_bind([servant](Args... as)                                                                                    \
@@ -204,7 +263,7 @@ BOOST_MPL_HAS_XXX_TRAIT_DEF(servant_type)
     auto funcname(Args... args)const                                                                                                                    \
         -> std::future<decltype(std::shared_ptr<servant_type>()->funcname(std::move(args)...))>                                                     \
     {                                                                                                                                                   \
-        auto servant = this->m_servant;                                                                                                                 \
+        auto servant = this->call_target();                                                                                                             \
         std::size_t p = prio + 100000 * this->m_offset_id;                                                                                              \
         return boost::asynchronous::post_future(this->m_proxy,                                                                                          \
                 boost::asynchronous::move_bind([servant](Args... as)                                                                                    \
@@ -216,7 +275,7 @@ BOOST_MPL_HAS_XXX_TRAIT_DEF(servant_type)
     template <typename... Args>                                                                                                                         \
     auto funcname(Args... args)const                                                                                                                    \
     {                                                                                                                                                   \
-        auto servant = this->m_servant;                                                                                                                 \
+        auto servant = this->call_target();                                                                                                             \
         std::size_t p = prio + 100000 * this->m_offset_id;                                                                                              \
         return boost::asynchronous::post_future(this->m_proxy,                                                                                          \
                 boost::asynchronous::move_bind([servant](Args... as)                                                                                    \
@@ -227,6 +286,49 @@ BOOST_MPL_HAS_XXX_TRAIT_DEF(servant_type)
 #define BOOST_ASYNC_FUTURE_MEMBER(...)                                                                          \
     BOOST_PP_CAT(BOOST_PP_OVERLOAD(BOOST_ASYNC_FUTURE_MEMBER_,__VA_ARGS__)(__VA_ARGS__), BOOST_PP_EMPTY())
 
+// const member executed concurrently with other const members in the reader pool of a servant created with
+// make_reader_parallel_scheduler, otherwise as BOOST_ASYNC_FUTURE_MEMBER.
+// Reads do not keep the servant alive, a read executed after the servant destructor gets an empty_servant exception.
+#ifndef BOOST_ASYNCHRONOUS_REQUIRE_ALL_ARGUMENTS
+#define BOOST_ASYNC_FUTURE_MEMBER_CONST_1(funcname)                                                                                                     \
+    BOOST_ASYNC_FUTURE_MEMBER_CONST_2(funcname,0)
+#endif
+
+#ifdef BOOST_NO_CXX14_RETURN_TYPE_DEDUCTION
+#define BOOST_ASYNC_FUTURE_MEMBER_CONST_2(funcname,prio)                                                                                                \
+    template <typename... Args>                                                                                                                         \
+    auto funcname(Args... args)const                                                                                                                    \
+        -> std::future<decltype(std::shared_ptr<servant_type const>()->funcname(std::move(args)...))>                                               \
+    {                                                                                                                                                   \
+        std::weak_ptr<servant_type const> servant = this->m_servant;                                                                                    \
+        std::shared_ptr<bool const> constructed = this->m_servant_constructed;                                                                          \
+        std::size_t p = prio + 100000 * this->m_offset_id;                                                                                              \
+        return boost::asynchronous::detail::post_reader_future(this->m_proxy,                                                                          \
+                boost::asynchronous::move_bind([servant,constructed](Args... as)                                                                        \
+                                    {std::shared_ptr<servant_type const> s = servant.lock();                                                            \
+                                     if (!s || (constructed && !*constructed)) throw boost::asynchronous::empty_servant();                              \
+                                     return s->funcname(std::move(as)...);                                                                              \
+                                    },std::move(args)...),p);                                                                                           \
+    }
+#else
+#define BOOST_ASYNC_FUTURE_MEMBER_CONST_2(funcname,prio)                                                                                                \
+    template <typename... Args>                                                                                                                         \
+    auto funcname(Args... args)const                                                                                                                    \
+    {                                                                                                                                                   \
+        std::weak_ptr<servant_type const> servant = this->m_servant;                                                                                    \
+        std::shared_ptr<bool const> constructed = this->m_servant_constructed;                                                                          \
+        std::size_t p = prio + 100000 * this->m_offset_id;                                                                                              \
+        return boost::asynchronous::detail::post_reader_future(this->m_proxy,                                                                          \
+                boost::asynchronous::move_bind([servant,constructed](Args... as)                                                                        \
+                                    {std::shared_ptr<servant_type const> s = servant.lock();                                                            \
+                                     if (!s || (constructed && !*constructed)) throw boost::asynchronous::empty_servant();                              \
+                                     return s->funcname(std::move(as)...);                                                                              \
+                                    },std::move(args)...),p);                                                                                           \
+    }
+#endif
+#define BOOST_ASYNC_FUTURE_MEMBER_CONST(...)                                                                    \
+    BOOST_PP_CAT(BOOST_PP_OVERLOAD(BOOST_ASYNC_FUTURE_MEMBER_CONST_,__VA_ARGS__)(__VA_ARGS__), BOOST_PP_EMPTY())
+
 #ifndef BOOST_ASYNCHRONOUS_REQUIRE_ALL_ARGUMENTS
 #define BOOST_ASYNC_MEMBER_UNSAFE_CALLBACK_1(funcname)                                                                                              \
     template <typename F,typename... Args>                                                                                                          \
@@ -234,7 +336,7 @@ BOOST_MPL_HAS_XXX_TRAIT_DEF(servant_type)
     -> typename std::enable_if<!std::is_same<decltype(std::shared_ptr<servant_type>()->funcname(std::move(args)...)),void>::value,void>::type       \
     {                                                                                                                                               \
         struct workaround_gcc{typedef decltype(std::shared_ptr<servant_type>()->funcname(std::move(args)...)) servant_return;};                     \
-        auto servant = this->m_servant;                                                                                                             \
+        auto servant = this->call_target();                                                                                                         \
         std::size_t prio = 100000 * this->m_offset_id;                                                                                              \
         using servant_return = typename workaround_gcc::servant_return;                                                                             \
         boost::asynchronous::post_future(this->m_proxy,                                                                                             \
@@ -247,7 +349,7 @@ BOOST_MPL_HAS_XXX_TRAIT_DEF(servant_type)
     auto funcname(F&& cb_func, Args... args)const                                                                                                   \
     -> typename std::enable_if<std::is_same<decltype(std::shared_ptr<servant_type>()->funcname(std::move(args)...)),void>::value,void>::type        \
     {                                                                                                                                               \
-        auto servant = this->m_servant;                                                                                                             \
+        auto servant = this->call_target();                                                                                                         \
         std::size_t prio = 100000 * this->m_offset_id;                                                                                              \
         boost::asynchronous::post_future(this->m_proxy,                                                                                             \
                 boost::asynchronous::move_bind([servant,cb_func](Args... as)                                                                        \
@@ -263,7 +365,7 @@ BOOST_MPL_HAS_XXX_TRAIT_DEF(servant_type)
     -> typename std::enable_if<!std::is_same<decltype(std::shared_ptr<servant_type>()->funcname(std::move(args)...)),void>::value,void>::type       \
     {                                                                                                                                               \
         struct workaround_gcc{typedef decltype(std::shared_ptr<servant_type>()->funcname(std::move(args)...)) servant_return;};                     \
-        auto servant = this->m_servant;                                                                                                             \
+        auto servant = this->call_target();                                                                                                         \
         std::size_t p = prio + 100000 * this->m_offset_id;                                                                                          \
         using servant_return = typename workaround_gcc::servant_return;                                                                             \
         boost::asynchronous::post_future(this->m_proxy,                                                                                             \
@@ -276,7 +378,7 @@ BOOST_MPL_HAS_XXX_TRAIT_DEF(servant_type)
     auto funcname(F&& cb_func, Args... args)const                                                                                                   \
     -> typename std::enable_if<std::is_same<decltype(std::shared_ptr<servant_type>()->funcname(std::move(args)...)),void>::value,void>::type        \
     {                                                                                                                                               \
-        auto servant = this->m_servant;                                                                                                             \
+        auto servant = this->call_target();                                                                                                         \
         std::size_t p = prio + 100000 * this->m_offset_id;                                                                                          \
         boost::asynchronous::post_future(this->m_proxy,                                                                                             \
                 boost::asynchronous::move_bind([servant,cb_func](Args... as)                                                                        \
@@ -301,7 +403,7 @@ BOOST_MPL_HAS_XXX_TRAIT_DEF(servant_type)
     -> typename std::enable_if<!std::is_same<decltype(std::shared_ptr<servant_type>()->funcname(std::move(args)...)),void>::value,void>::type       \
     {                                                                                                                                               \
         struct workaround_gcc{typedef decltype(std::shared_ptr<servant_type>()->funcname(std::move(args)...)) servant_return;};                     \
-        auto servant = this->m_servant;                                                                                                             \
+        auto servant = this->call_target();                                                                                                         \
         std::size_t prio = 100000 * this->m_offset_id;                                                                                              \
         using servant_return = typename workaround_gcc::servant_return;                                                                             \
         boost::asynchronous::post_future(this->m_proxy,                                                                                             \
@@ -314,7 +416,7 @@ BOOST_MPL_HAS_XXX_TRAIT_DEF(servant_type)
     auto funcname(F&& cb_func, Args... args)const                                                                                                   \
     -> typename std::enable_if<std::is_same<decltype(std::shared_ptr<servant_type>()->funcname(std::move(args)...)),void>::value,void>::type        \
     {                                                                                                                                               \
-        auto servant = this->m_servant;                                                                                                             \
+        auto servant = this->call_target();                                                                                                         \
         std::size_t prio = 100000 * this->m_offset_id;                                                                                              \
         boost::asynchronous::post_future(this->m_proxy,                                                                                             \
                 boost::asynchronous::move_bind([servant,cb_func](Args... as)                                                                        \
@@ -330,7 +432,7 @@ BOOST_MPL_HAS_XXX_TRAIT_DEF(servant_type)
     -> typename std::enable_if<!std::is_same<decltype(std::shared_ptr<servant_type>()->funcname(std::move(args)...)),void>::value,void>::type       \
     {                                                                                                                                               \
         struct workaround_gcc{typedef decltype(std::shared_ptr<servant_type>()->funcname(std::move(args)...)) servant_return;};                     \
-        auto servant = this->m_servant;                                                                                                             \
+        auto servant = this->call_target();                                                                                                         \
         std::size_t p = prio + 100000 * this->m_offset_id;                                                                                          \
         using servant_return = typename workaround_gcc::servant_return;                                                                             \
         boost::asynchronous::post_future(this->m_proxy,                                                                                             \
@@ -343,7 +445,7 @@ BOOST_MPL_HAS_XXX_TRAIT_DEF(servant_type)
     auto funcname(F&& cb_func, Args... args)const                                                                                                   \
     -> typename std::enable_if<std::is_same<decltype(std::shared_ptr<servant_type>()->funcname(std::move(args)...)),void>::value,void>::type        \
     {                                                                                                                                               \
-        auto servant = this->m_servant;                                                                                                             \
+        auto servant = this->call_target();                                                                                                         \
         std::size_t p = prio + 100000 * this->m_offset_id;                                                                                          \
         boost::asynchronous::post_future(this->m_proxy,                                                                                             \
                 boost::asynchronous::move_bind([servant,cb_func](Args... as)                                                                        \
@@ -366,7 +468,7 @@ BOOST_MPL_HAS_XXX_TRAIT_DEF(servant_type)
     template <typename F, typename S,typename... Args>                                                                                              \
     void funcname(F&& cb_func,S const& weak_cb_scheduler,std::size_t cb_prio, Args... args)const                                                    \
     {                                                                                                                                               \
-        auto servant = this->m_servant;                                                                                                             \
+        auto servant = this->call_target();                                                                                                         \
         std::size_t prio = 100000 * this->m_offset_id;                                                                                              \
         boost::asynchronous::post_callback(m_proxy,                                                                                                 \
                 boost::asynchronous::move_bind([servant](Args... as)                                                                                \
@@ -379,7 +481,7 @@ BOOST_MPL_HAS_XXX_TRAIT_DEF(servant_type)
     template <typename F, typename S,typename... Args>                                                                                              \
     void funcname(F&& cb_func,S const& weak_cb_scheduler,std::size_t cb_prio, Args... args)const                                                    \
     {                                                                                                                                               \
-        auto servant = this->m_servant;                                                                                                             \
+        auto servant = this->call_target();                                                                                                         \
         std::size_t p = prio + 100000 * this->m_offset_id;                                                                                          \
         boost::asynchronous::post_callback(m_proxy,                                                                                                 \
                 boost::asynchronous::move_bind([servant](Args... as)                                                                                \
@@ -396,7 +498,7 @@ BOOST_MPL_HAS_XXX_TRAIT_DEF(servant_type)
     auto funcname(Args... args)const                                                                                                                \
     -> std::function<decltype(std::shared_ptr<servant_type>()->funcname(std::move(args)...))()>               \
     {                                                                                                                                               \
-        auto servant = m_servant;                                                                                                                   \
+        auto servant = call_target();                                                                                                               \
         return boost::asynchronous::move_bind([servant](Args... as){return servant->funcname(std::move(as)...);},std::move(args)...);               \
     }    
 #else
@@ -404,7 +506,7 @@ BOOST_MPL_HAS_XXX_TRAIT_DEF(servant_type)
     template <typename... Args>                                                                                                                     \
     auto funcname(Args... args)const                                                                                                                \
     {                                                                                                                                               \
-        auto servant = m_servant;                                                                                                                   \
+        auto servant = call_target();                                                                                                               \
         return boost::asynchronous::move_bind([servant](Args... as){return servant->funcname(std::move(as)...);},std::move(args)...);               \
     }
 #endif
@@ -463,6 +565,131 @@ struct empty_servant : public virtual boost::exception, public virtual std::exce
 {
 };
 
+// thrown by a servant_proxy given async_create with a scheduler having several queues, which could execute calls before the constructor
+struct servant_proxy_async_create_unsupported : public virtual boost::exception, public virtual std::exception
+{
+};
+
+namespace detail
+{
+// what calls made through a servant_proxy capture to reach the servant.
+// For a servant created with async_create, checks when the call is executed that the constructor did not throw
+template <class Servant>
+struct servant_call_target
+{
+    Servant* operator->()const
+    {
+        if (m_constructed && !*m_constructed)
+        {
+            throw boost::asynchronous::empty_servant();
+        }
+        return m_servant.get();
+    }
+    std::shared_ptr<Servant> m_servant;
+    // empty unless the servant is created asynchronously
+    std::shared_ptr<bool const> m_constructed;
+};
+}
+
+/*!
+ * \brief Asks a servant_proxy to create its servant asynchronously: the proxy constructor returns at once instead of
+ * \brief waiting for the servant constructor to be executed in the scheduler thread.
+ * \brief Calls made meanwhile are queued in the scheduler behind the constructor and executed in order once the servant exists.
+ * \brief Completion can be waited for with get_future() or notified with an on_created callback.
+ */
+template <class Job = BOOST_ASYNCHRONOUS_DEFAULT_JOB>
+class servant_creation
+{
+public:
+    typedef boost::asynchronous::any_shared_scheduler_proxy<Job> scheduler_proxy_type;
+
+    // reports the end of the construction. Does not hold the scheduler, as it is kept by the constructor job
+    class notifier
+    {
+    public:
+        void set_created()const
+        {
+            m_state->promise.set_value();
+            if (m_state->on_created)
+            {
+                m_state->on_created(boost::asynchronous::expected<void>());
+            }
+        }
+        void set_exception(std::exception_ptr e)const
+        {
+            m_state->promise.set_exception(e);
+            if (m_state->on_created)
+            {
+                m_state->on_created(boost::asynchronous::expected<void>(e));
+            }
+        }
+    private:
+        friend class servant_creation;
+        struct state
+        {
+            std::promise<void> promise;
+            std::function<void(boost::asynchronous::expected<void>)> on_created;
+        };
+        std::shared_ptr<state> m_state;
+    };
+
+    /*!
+     * \brief Constructor
+     * \param s scheduler where the servant will live.
+     * \param on_created called with an expected<void> once the servant is constructed or its constructor threw.
+     * \brief Called in the servant thread, or in the constructing thread if the servant was created at once.
+     */
+    explicit servant_creation(scheduler_proxy_type s,
+                              std::function<void(boost::asynchronous::expected<void>)> on_created =
+                                std::function<void(boost::asynchronous::expected<void>)>())
+        : m_scheduler(std::move(s))
+        , m_notifier()
+    {
+        m_notifier.m_state = std::make_shared<typename notifier::state>();
+        m_notifier.m_state->on_created = std::move(on_created);
+    }
+    /*!
+     * \brief Returns a future set when the servant is constructed. Can be called only once.
+     */
+    std::future<void> get_future()
+    {
+        return m_notifier.m_state->promise.get_future();
+    }
+    scheduler_proxy_type const& get_scheduler()const
+    {
+        return m_scheduler;
+    }
+    notifier const& get_notifier()const
+    {
+        return m_notifier;
+    }
+
+private:
+    scheduler_proxy_type m_scheduler;
+    notifier m_notifier;
+};
+
+/*!
+ * \brief Creates a servant_creation to pass to a servant_proxy constructor instead of a scheduler.
+ * \param s scheduler where the servant will live.
+ */
+template <class Job>
+boost::asynchronous::servant_creation<Job> async_create(boost::asynchronous::any_shared_scheduler_proxy<Job> s)
+{
+    return boost::asynchronous::servant_creation<Job>(std::move(s));
+}
+
+/*!
+ * \brief Creates a servant_creation to pass to a servant_proxy constructor instead of a scheduler.
+ * \param s scheduler where the servant will live.
+ * \param on_created callback taking an expected<void>, called once the servant is constructed or its constructor threw.
+ */
+template <class Job, class F>
+boost::asynchronous::servant_creation<Job> async_create(boost::asynchronous::any_shared_scheduler_proxy<Job> s, F&& on_created)
+{
+    return boost::asynchronous::servant_creation<Job>(std::move(s),std::forward<F>(on_created));
+}
+
 template <class ServantProxy,class Servant, class Callable = BOOST_ASYNCHRONOUS_DEFAULT_JOB,int max_create_wait_ms = 5000>
 class servant_proxy
 {
@@ -483,6 +710,7 @@ protected:
         : m_proxy(p.m_proxy)
         , m_servant(std::dynamic_pointer_cast<typename AnotherProxy::servant_type>(p.m_servant))
         , m_offset_id(0)
+        , m_servant_constructed(p.m_servant_constructed)
     {
     }
 public:
@@ -573,6 +801,53 @@ public:
         }
     }
 
+    /*!
+     * \brief Constructor
+     * \brief Constructs a servant_proxy without waiting for its servant. The servant constructor is posted and the proxy
+     * \brief can be used at once, calls being executed after the servant constructor. This requires calls and constructor
+     * \brief to be posted to the same queue of the scheduler, which is the case with the default priorities. Schedulers with
+     * \brief several queues are therefore rejected with servant_proxy_async_create_unsupported.
+     * \brief If the servant constructor throws, the exception is reported through c. Calls made through the proxy are then not
+     * \brief executed, futures they returned are set with empty_servant.
+     * \brief Servants deriving from enable_shared_from_this cannot be created this way.
+     * \param c servant_creation returned by async_create, holding the scheduler where the servant will execute.
+     * \param args variadic number of parameters, number and type defined by the servant, which will be forwarded to the servant.
+     */
+    template <typename... Args>
+    servant_proxy(boost::asynchronous::servant_creation<callable_type> c, Args... args)
+        : m_proxy(c.get_scheduler())
+        , m_servant()
+        , m_offset_id(0)
+    {
+        if (m_proxy.get_queue_size().size() > 1)
+        {
+            // calls with default priority go to any queue, they could overtake the constructor
+            c.get_notifier().set_exception(std::make_exception_ptr(boost::asynchronous::servant_proxy_async_create_unsupported()));
+            throw boost::asynchronous::servant_proxy_async_create_unsupported();
+        }
+        std::vector<boost::thread::id> ids = m_proxy.thread_ids();
+        if ((std::find(ids.begin(),ids.end(),boost::this_thread::get_id()) != ids.end()) ||
+             boost::has_trivial_constructor<servant_type>::value ||
+             boost::asynchronous::has_simple_ctor<servant_type>::value)
+        {
+            // nothing to wait for
+            try
+            {
+                m_servant = servant_create_helper::template create<servant_type>(m_proxy.get_weak_scheduler(),std::move(args)...);
+            }
+            catch(...)
+            {
+                c.get_notifier().set_exception(std::current_exception());
+                throw;
+            }
+            c.get_notifier().set_created();
+        }
+        else
+        {
+            init_servant_proxy_async(c.get_notifier(),std::move(args)...);
+        }
+    }
+
     // version for multiple_thread_scheduler
     //TODO other ctors
     template <typename... Args>
@@ -609,7 +884,8 @@ public:
             servant_deleter n(std::move(m_servant));
             typename boost::asynchronous::job_traits<callable_type>::wrapper_type  a(std::move(n));
             a.set_name(ServantProxy::get_dtor_name());
-            m_proxy.post(std::move(a),ServantProxy::get_dtor_prio());
+            // never refused by a bounded scheduler
+            boost::asynchronous::detail::post_unbounded(m_proxy,callable_type(std::move(a)),ServantProxy::get_dtor_prio());
             m_servant.reset();
         }
         m_proxy.reset();
@@ -644,6 +920,28 @@ public:
         m_proxy.post(std::move(job),prio + 100000 * m_offset_id);
     }
 
+    /*!
+     * \brief Moves the servant to another scheduler. The proxy must have been created with make_migratable_scheduler.
+     * \brief Jobs already posted are executed in the old scheduler, calls made during the migration are forwarded to the new one,
+     * \brief in order. Safe callbacks created before can still be used.
+     * \param s scheduler where the servant will live.
+     * \brief Servants deriving from trackable_servant stay if they have subscriptions, which belong to their thread.
+     * \return a future set to true once the servant lives in s, false if the proxy cannot migrate, a migration is running
+     * \return or the servant stays. If the old scheduler is shut down before the servant left, the promise is broken.
+     */
+    std::future<bool> migrate_to(scheduler_proxy_type s) const
+    {
+        return boost::asynchronous::detail::migrate_servant(m_proxy,m_servant,std::move(s),get_migration_prio());
+    }
+
+    /*!
+     * \brief Returns the priority of the handoff job posted by migrate_to, the one of the servant's jobs.
+     */
+    std::size_t get_migration_prio() const
+    {
+        return 100000 * m_offset_id;
+    }
+
     /*!
      * \brief Returns the underlying any_shared_scheduler_proxy
      */
@@ -684,9 +982,17 @@ public:
         return m_servant;
     }
 
+    // what calls capture to reach the servant
+    boost::asynchronous::detail::servant_call_target<servant_type> call_target() const
+    {
+        return boost::asynchronous::detail::servant_call_target<servant_type>{m_servant,m_servant_constructed};
+    }
+
     scheduler_proxy_type m_proxy;
     std::shared_ptr<servant_type> m_servant;
     std::size_t m_offset_id;
+    // set if the servant is created with async_create: false until constructed, and for ever if the constructor threw
+    std::shared_ptr<bool const> m_servant_constructed;
 
 private:
     // safe creation of servant in our thread ctor is trivial or told us so
@@ -718,7 +1024,7 @@ private:
                     boost::asynchronous::move_bind(init_helper(p),m_proxy.get_weak_scheduler(),std::move(args)...)));
         a.set_name(ServantProxy::get_ctor_name());
 #ifndef BOOST_NO_RVALUE_REFERENCES
-        post(std::move(a),ServantProxy::get_ctor_prio());
+        boost::asynchronous::detail::post_unbounded(m_proxy,callable_type(std::move(a)),ServantProxy::get_ctor_prio() + 100000 * m_offset_id);
 #else
         post(a,ServantProxy::get_ctor_prio());
 #endif
@@ -732,6 +1038,64 @@ private:
             throw servant_proxy_timeout();
         }
     }
+    typedef typename boost::asynchronous::servant_creation<callable_type>::notifier creation_notifier;
+    // storage for a servant constructed later in the scheduler thread, destroyed with the last call holding it
+    struct deferred_servant
+    {
+        deferred_servant() = default;
+        deferred_servant(deferred_servant const&) = delete;
+        deferred_servant& operator=(deferred_servant const&) = delete;
+        ~deferred_servant()
+        {
+            if (constructed)
+            {
+                reinterpret_cast<servant_type*>(&storage)->~servant_type();
+            }
+        }
+        alignas(servant_type) unsigned char storage[sizeof(servant_type)];
+        bool constructed = false;
+    };
+    // the proxy gets a pointer to the future servant at once, the constructor is posted before any call
+    template <typename... Args>
+    void init_servant_proxy_async(creation_notifier n, Args... args)
+    {
+        std::shared_ptr<deferred_servant> holder = std::make_shared<deferred_servant>();
+        m_servant = std::shared_ptr<servant_type>(holder,reinterpret_cast<servant_type*>(&holder->storage));
+        // calls queued behind a throwing constructor check it and fail with empty_servant
+        m_servant_constructed = std::shared_ptr<bool const>(holder,&holder->constructed);
+        typename boost::asynchronous::job_traits<callable_type>::wrapper_type  a(
+                    boost::asynchronous::any_callable(
+                    boost::asynchronous::move_bind(async_init_helper(std::move(holder),std::move(n)),
+                                                   m_proxy.get_weak_scheduler(),std::move(args)...)));
+        a.set_name(ServantProxy::get_ctor_name());
+        boost::asynchronous::detail::post_unbounded(m_proxy,callable_type(std::move(a)),ServantProxy::get_ctor_prio() + 100000 * m_offset_id);
+    }
+    struct async_init_helper : public boost::asynchronous::job_traits<callable_type>::diagnostic_type
+    {
+        async_init_helper(std::shared_ptr<deferred_servant> holder, creation_notifier n)
+          :boost::asynchronous::job_traits<callable_type>::diagnostic_type(),m_holder(std::move(holder)),m_creation(std::move(n)){}
+        async_init_helper(async_init_helper const& rhs)
+          :boost::asynchronous::job_traits<callable_type>::diagnostic_type(),m_holder(rhs.m_holder),m_creation(rhs.m_creation){}
+        async_init_helper(async_init_helper&& rhs) noexcept
+          :m_holder(std::move(rhs.m_holder)),m_creation(std::move(rhs.m_creation)){}
+        template <typename... Args>
+        void operator()(weak_scheduler_proxy_type proxy,Args... as)const
+        {
+            try
+            {
+                servant_create_helper::template emplace<servant_type>(&m_holder->storage,proxy,std::move(as)...);
+                m_holder->constructed = true;
+            }
+            catch(...)
+            {
+                m_creation.set_exception(std::current_exception());
+                return;
+            }
+            m_creation.set_created();
+        }
+        std::shared_ptr<deferred_servant> m_holder;
+        creation_notifier m_creation;
+    };
     struct init_helper : public boost::asynchronous::job_traits<callable_type>::diagnostic_type
     {
         init_helper(std::shared_ptr<std::promise<std::shared_ptr<servant_type> > > p)
@@ -777,6 +1141,27 @@ private:
             std::shared_ptr<servant_type> res = std::make_shared<servant_type>(std::move(args)...);
             return res;
         }
+        // same as create, in already allocated storage
+        template <typename S,typename... Args>
+        static
+        typename std::enable_if< boost::asynchronous::has_requires_weak_scheduler<S>::value ||
+                                 boost::has_trivial_constructor<S>::value ||
+                                 boost::asynchronous::has_simple_ctor<S>::value,
+        void>::type
+        emplace(void* where, weak_scheduler_proxy_type proxy,Args... args)
+        {
+            ::new (where) servant_type(proxy,std::move(args)...);
+        }
+        template <typename S,typename... Args>
+        static
+        typename std::enable_if<!(boost::asynchronous::has_requires_weak_scheduler<S>::value ||
+                                  boost::has_trivial_constructor<S>::value ||
+                                  boost::asynchronous::has_simple_ctor<S>::value),
+                                void>::type
+        emplace(void* where, weak_scheduler_proxy_type ,Args... args)
+        {
+            ::new (where) servant_type(std::move(args)...);
+        }
     };
 
     struct servant_deleter : public boost::asynchronous::job_traits<callable_type>::diagnostic_type
@@ -851,6 +1236,57 @@ T dynamic_servant_proxy_cast( U const & r ) BOOST_NOEXCEPT
     return T(r);
 }
 
+/*!
+ * \brief Creates count servant proxies without waiting for their servants, which are constructed in parallel
+ * \brief in their schedulers. Servant i lives in schedulers[i % schedulers.size()].
+ * \param schedulers schedulers where servants will live. Must not be empty.
+ * \param count number of servants to create.
+ * \param args parameters passed to every servant.
+ * \return the proxies and a future set when all servants are constructed, or with the first constructor exception.
+ */
+template <class Proxy, class Job, class... Args>
+std::tuple<std::vector<Proxy>,std::future<void>>
+make_servant_proxies(std::vector<boost::asynchronous::any_shared_scheduler_proxy<Job>> const& schedulers,
+                     std::size_t count, Args const&... args)
+{
+    struct all_created
+    {
+        explicit all_created(std::size_t c): remaining(c){}
+        std::atomic<std::size_t> remaining;
+        std::atomic<bool> failed{false};
+        std::promise<void> promise;
+    };
+    auto state = std::make_shared<all_created>(count);
+    std::future<void> fu = state->promise.get_future();
+    if (count == 0)
+    {
+        state->promise.set_value();
+    }
+    std::vector<Proxy> proxies;
+    proxies.reserve(count);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        proxies.emplace_back(
+            boost::asynchronous::async_create(schedulers[i % schedulers.size()],
+                [state](boost::asynchronous::expected<void> res)
+                {
+                    if (res.has_exception())
+                    {
+                        if (!state->failed.exchange(true))
+                        {
+                            state->promise.set_exception(res.get_exception_ptr());
+                        }
+                    }
+                    if (--state->remaining == 0 && !state->failed.load())
+                    {
+                        state->promise.set_value();
+                    }
+                }),
+            args...);
+    }
+    return std::make_tuple(std::move(proxies),std::move(fu));
+}
+
 }} // boost::async
 
 #endif // BOOST_ASYNC_SERVANT_PROXY_H
@@ -0,0 +1,692 @@
+// Boost.Asynchronous library
+//  Copyright (C) Christophe Henry 2026
+//
+//  Use, modification and distribution is subject to the Boost
+//  Software License, Version 1.0.  (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// For more information, see http://www.boost.org
+
+// A set of servants of the same type, each in its own scheduler, holding a partition of the data.
+// Calls are routed by key: a key extractor gives a bucket, a routing table gives the shard owning it.
+// Buckets can be migrated from a hot shard to another one, with their state.
+// Usage:
+// auto shards = make_sharded_servant_proxy<ServantProxy>(4, servant args...);
+// shards.route(key).set(key,value);
+// shards.call(key,[&](ServantProxy const& p){p.set(key,value);}); // same, atomic with migrations
+// std::vector<std::future<std::size_t>> sizes = shards.broadcast([](ServantProxy const& p){return p.size();});
+
+#ifndef BOOST_ASYNCHRONOUS_SHARDED_SERVANT_PROXY_HPP
+#define BOOST_ASYNCHRONOUS_SHARDED_SERVANT_PROXY_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <boost/thread/thread.hpp>
+
+#include <boost/asynchronous/any_shared_scheduler_proxy.hpp>
+#include <boost/asynchronous/callable_any.hpp>
+#include <boost/asynchronous/continuation_task.hpp>
+#include <boost/asynchronous/job_traits.hpp>
+#include <boost/asynchronous/queue/lockfree_queue.hpp>
+#include <boost/asynchronous/scheduler/single_thread_scheduler.hpp>
+#include <boost/asynchronous/scheduler_shared_proxy.hpp>
+
+namespace boost { namespace asynchronous
+{
+// default key extractor: hash of the key
+struct shard_by_hash
+{
+    template <class Key>
+    std::size_t operator()(Key const& k)const
+    {
+        return std::hash<Key>()(k);
+    }
+};
+
+namespace detail
+{
+// migrations are executed one after the other. Jobs posted to the shards only hold this queue, not the shards,
+// so that a scheduler is never destroyed by one of its own jobs.
+struct shard_migration_queue
+{
+    typedef std::function<void(std::shared_ptr<shard_migration_queue> const&)> starter_type;
+
+    // starts s at once if no migration is running
+    void start(std::shared_ptr<shard_migration_queue> const& self, starter_type s)
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (m_migrating)
+            {
+                m_waiting.emplace_back(std::move(s));
+                return;
+            }
+            m_migrating = true;
+        }
+        s(self);
+    }
+    // a migration is done, start the next one
+    void done(std::shared_ptr<shard_migration_queue> const& self)
+    {
+        starter_type next;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (m_waiting.empty())
+            {
+                m_migrating = false;
+                return;
+            }
+            next = std::move(m_waiting.front());
+            m_waiting.pop_front();
+        }
+        next(self);
+    }
+    std::mutex m_mutex;
+    bool m_migrating = false;
+    std::deque<starter_type> m_waiting;
+};
+
+// Scheduler proxy of a shard, through which calls for a migrating bucket are made.
+// While held, jobs are kept. They are posted to the shard after the state of the bucket, so that the shard never waits.
+template <class Job>
+class shard_call_gate :
+#ifndef BOOST_ASYNCHRONOUS_USE_TYPE_ERASURE
+        public any_shared_scheduler_proxy_concept<Job>,
+#endif
+        public std::enable_shared_from_this<shard_call_gate<Job> >
+{
+public:
+    typedef Job job_type;
+
+    explicit shard_call_gate(boost::asynchronous::any_shared_scheduler_proxy<Job> scheduler)
+        : m_scheduler(std::move(scheduler)), m_held(false)
+    {}
+
+    void post(job_type job) const
+    {
+        post(std::move(job),0);
+    }
+    void post(job_type job, std::size_t prio) const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_held)
+        {
+            m_kept.emplace_back(std::move(job),prio);
+            return;
+        }
+        m_scheduler.post(std::move(job),prio);
+    }
+    // while held, the job is executed after the state is inserted but cannot be interrupted
+    boost::asynchronous::any_interruptible interruptible_post(job_type job) const
+    {
+        return interruptible_post(std::move(job),0);
+    }
+    boost::asynchronous::any_interruptible interruptible_post(job_type job, std::size_t prio) const
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_held)
+        {
+            m_kept.emplace_back(std::move(job),prio);
+            return boost::asynchronous::any_interruptible();
+        }
+        return m_scheduler.interruptible_post(std::move(job),prio);
+    }
+    std::vector<boost::thread::id> thread_ids() const
+    {
+        return m_scheduler.thread_ids();
+    }
+    boost::asynchronous::any_weak_scheduler<job_type> get_weak_scheduler() const
+    {
+        return m_scheduler.get_weak_scheduler();
+    }
+    bool is_valid() const
+    {
+        return m_scheduler.is_valid();
+    }
+    std::vector<std::size_t> get_queue_size() const
+    {
+        return m_scheduler.get_queue_size();
+    }
+    std::vector<std::size_t> get_max_queue_size() const
+    {
+        return m_scheduler.get_max_queue_size();
+    }
+    void reset_max_queue_size()
+    {
+        m_scheduler.reset_max_queue_size();
+    }
+    boost::asynchronous::scheduler_diagnostics get_diagnostics(std::size_t pos=0) const
+    {
+        return m_scheduler.get_diagnostics(pos);
+    }
+    void clear_diagnostics()
+    {
+        m_scheduler.clear_diagnostics();
+    }
+    boost::asynchronous::internal_scheduler_aspect<job_type> get_internal_scheduler_aspect()
+    {
+        return m_scheduler.get_internal_scheduler_aspect();
+    }
+    void set_name(std::string const& name)
+    {
+        m_scheduler.set_name(name);
+    }
+    std::string get_name() const
+    {
+        return m_scheduler.get_name();
+    }
+    void processor_bind(std::vector<std::tuple<unsigned int,unsigned int>> p)
+    {
+        m_scheduler.processor_bind(std::move(p));
+    }
+    BOOST_ATTRIBUTE_NODISCARD std::vector<std::future<void>> execute_in_all_threads(boost::asynchronous::any_callable c)
+    {
+        return m_scheduler.execute_in_all_threads(std::move(c));
+    }
+
+    // keeps the jobs posted from now on
+    void hold()
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_held = true;
+    }
+    // posts first, then the jobs kept, and stops keeping them
+    void open(job_type first, std::size_t prio)
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_scheduler.post(std::move(first),prio);
+        for (auto& job : m_kept)
+        {
+            m_scheduler.post(std::move(job.first),job.second);
+        }
+        m_kept.clear();
+        m_held = false;
+    }
+    // the jobs kept are not executed, their futures are broken
+    void drop()
+    {
+        std::vector<std::pair<job_type,std::size_t>> dropped;
+        std::lock_guard<std::mutex> lock(m_mutex);
+        dropped.swap(m_kept);
+        m_held = false;
+    }
+
+private:
+    mutable std::mutex m_mutex;
+    mutable boost::asynchronous::any_shared_scheduler_proxy<Job> m_scheduler;
+    bool m_held;
+    mutable std::vector<std::pair<job_type,std::size_t>> m_kept;
+};
+
+// which shard owns which bucket. Held by migration jobs, which must not hold the shards.
+struct shard_routing
+{
+    shard_routing(std::size_t buckets, std::size_t shards)
+        : m_table(new std::atomic<std::size_t>[buckets])
+        , m_moving(none)
+    {
+        for (std::size_t i = 0; i < buckets; ++i)
+        {
+            m_table[i].store(i % shards,std::memory_order_relaxed);
+        }
+    }
+    static constexpr std::size_t none = static_cast<std::size_t>(-1);
+
+    std::unique_ptr<std::atomic<std::size_t>[]> m_table;
+    // bucket whose state is on its way to its new shard, calls for it go through the gate of the new shard
+    std::atomic<std::size_t> m_moving;
+    // held by call() while posting, by migrations while switching the routing
+    std::shared_mutex m_mutex;
+};
+
+template <class Proxy>
+struct sharded_servant_state
+{
+    typedef typename Proxy::callable_type callable_type;
+
+    sharded_servant_state(std::vector<Proxy> shards, std::size_t buckets)
+        : m_shards(std::move(shards))
+        , m_routing(std::make_shared<boost::asynchronous::detail::shard_routing>(buckets,m_shards.size()))
+        , m_buckets(buckets)
+        , m_migrations(std::make_shared<boost::asynchronous::detail::shard_migration_queue>())
+    {
+        m_gated.reserve(m_shards.size());
+        m_gates.reserve(m_shards.size());
+        for (auto const& shard : m_shards)
+        {
+            m_gates.push_back(std::make_shared<boost::asynchronous::detail::shard_call_gate<callable_type>>(shard.get_proxy()));
+            m_gated.push_back(shard);
+            m_gated.back().m_proxy = boost::asynchronous::any_shared_scheduler_proxy<callable_type>(m_gates.back());
+        }
+    }
+    // the proxy through which calls for a bucket go
+    Proxy const& owner(std::size_t bucket) const
+    {
+        std::size_t shard = m_routing->m_table[bucket].load(std::memory_order_acquire);
+        if (m_routing->m_moving.load(std::memory_order_acquire) == bucket)
+        {
+            return m_gated[shard];
+        }
+        return m_shards[shard];
+    }
+    std::vector<Proxy> m_shards;
+    // same servants, posting through the gates
+    std::vector<Proxy> m_gated;
+    std::vector<std::shared_ptr<boost::asynchronous::detail::shard_call_gate<callable_type>>> m_gates;
+    std::shared_ptr<boost::asynchronous::detail::shard_routing> m_routing;
+    const std::size_t m_buckets;
+    std::shared_ptr<boost::asynchronous::detail::shard_migration_queue> m_migrations;
+};
+
+// Moves the state of a bucket: executed by the old shard, which then posts the insertion to the new one.
+// Shared by the jobs of a migration, the next migration starts when both are gone.
+// If a scheduler drops them without executing them (shutdown), the migration fails.
+template <class Proxy, class Extract, class Insert>
+struct shard_migration
+{
+    typedef typename Proxy::servant_type servant_type;
+    typedef typename Proxy::callable_type callable_type;
+    typedef decltype(std::declval<Extract&>()(std::declval<servant_type&>(),std::size_t(0))) state_type;
+
+    shard_migration(std::shared_ptr<boost::asynchronous::detail::shard_routing> routing, std::size_t bucket, std::size_t from,
+                    std::shared_ptr<servant_type> source, std::shared_ptr<servant_type> target,
+                    std::shared_ptr<boost::asynchronous::detail::shard_call_gate<callable_type>> gate, std::size_t prio,
+                    Extract extract, Insert insert, std::shared_ptr<std::promise<void>> done,
+                    std::shared_ptr<boost::asynchronous::detail::shard_migration_queue> q)
+        : m_routing(std::move(routing)), m_bucket(bucket), m_from(from)
+        , m_source(std::move(source)), m_target(std::move(target)), m_gate(std::move(gate)), m_prio(prio)
+        , m_extract(std::move(extract)), m_insert(std::move(insert)), m_done(std::move(done)), m_queue(std::move(q))
+        , m_extracted(false), m_finished(false)
+    {}
+    ~shard_migration()
+    {
+        try
+        {
+            if (!m_extracted)
+            {
+                cancel(std::make_exception_ptr(std::future_error(std::future_errc::broken_promise)));
+            }
+            else if (!m_finished)
+            {
+                // the state was lost with the new shard
+                m_done->set_exception(std::make_exception_ptr(std::future_error(std::future_errc::broken_promise)));
+            }
+        }
+        catch(...)
+        {
+        }
+        m_queue->done(m_queue);
+    }
+    // in the old shard, after the calls routed to it before the migration
+    static void extract(std::shared_ptr<shard_migration> const& self)
+    {
+        self->m_extracted = true;
+        std::shared_ptr<state_type> state;
+        try
+        {
+            state = std::make_shared<state_type>(self->m_extract(*self->m_source,self->m_bucket));
+        }
+        catch(...)
+        {
+            self->m_source.reset();
+            self->cancel(std::current_exception());
+            return;
+        }
+        self->m_source.reset();
+        // the gate holds the new shard's scheduler, it is released here, not in the new shard
+        std::shared_ptr<boost::asynchronous::detail::shard_call_gate<callable_type>> gate = std::move(self->m_gate);
+        // before the calls kept meanwhile
+        gate->open(typename boost::asynchronous::job_traits<callable_type>::wrapper_type(
+                       boost::asynchronous::any_callable([self,state]()
+                       {
+                           self->insert(std::move(*state));
+                       })),
+                   self->m_prio);
+        self->m_routing->m_moving.store(boost::asynchronous::detail::shard_routing::none,std::memory_order_release);
+    }
+    // in the new shard
+    void insert(state_type&& state)
+    {
+        m_finished = true;
+        try
+        {
+            m_insert(*m_target,std::move(state));
+            m_done->set_value();
+        }
+        catch(...)
+        {
+            m_done->set_exception(std::current_exception());
+        }
+        m_target.reset();
+    }
+    // the state stays in the old shard, and so does the bucket
+    void cancel(std::exception_ptr e)
+    {
+        {
+            std::unique_lock<std::shared_mutex> lock(m_routing->m_mutex);
+            m_routing->m_table[m_bucket].store(m_from,std::memory_order_release);
+            m_routing->m_moving.store(boost::asynchronous::detail::shard_routing::none,std::memory_order_release);
+        }
+        // calls made meanwhile were for the new shard, which did not get the state
+        m_gate->drop();
+        m_gate.reset();
+        m_finished = true;
+        m_done->set_exception(e);
+    }
+
+    std::shared_ptr<boost::asynchronous::detail::shard_routing> m_routing;
+    const std::size_t m_bucket;
+    const std::size_t m_from;
+    std::shared_ptr<servant_type> m_source;
+    std::shared_ptr<servant_type> m_target;
+    std::shared_ptr<boost::asynchronous::detail::shard_call_gate<callable_type>> m_gate;
+    const std::size_t m_prio;
+    Extract m_extract;
+    Insert m_insert;
+    std::shared_ptr<std::promise<void>> m_done;
+    std::shared_ptr<boost::asynchronous::detail::shard_migration_queue> m_queue;
+    bool m_extracted;
+    bool m_finished;
+};
+
+// fan-in of a broadcast
+template <class Proxy, class Func, class R>
+struct broadcast_continuation_task : public boost::asynchronous::continuation_task<std::vector<R>>
+{
+    broadcast_continuation_task(std::shared_ptr<boost::asynchronous::detail::sharded_servant_state<Proxy>> state, Func f)
+        : boost::asynchronous::continuation_task<std::vector<R>>("broadcast")
+        , m_state(std::move(state)), m_func(std::move(f))
+    {}
+    void operator()()
+    {
+        boost::asynchronous::continuation_result<std::vector<R>> task_res = this->this_task_result();
+        std::vector<std::future<R>> fus;
+        try
+        {
+            fus.reserve(m_state->m_shards.size());
+            for (auto const& p : m_state->m_shards)
+            {
+                fus.emplace_back(m_func(p));
+            }
+        }
+        catch(...)
+        {
+            task_res.set_exception(std::current_exception());
+            return;
+        }
+        boost::asynchronous::create_continuation(
+                    [task_res](std::vector<std::future<R>> res)mutable
+                    {
+                        try
+                        {
+                            std::vector<R> v;
+                            v.reserve(res.size());
+                            for (auto& fu : res)
+                            {
+                                v.emplace_back(fu.get());
+                            }
+                            task_res.set_value(std::move(v));
+                        }
+                        catch(...)
+                        {
+                            task_res.set_exception(std::current_exception());
+                        }
+                    },
+                    std::move(fus));
+    }
+    std::shared_ptr<boost::asynchronous::detail::sharded_servant_state<Proxy>> m_state;
+    Func m_func;
+};
+}
+
+/*!
+ * \brief Servant proxies of the same type, each in its own scheduler, sharing data partitioned by key.
+ * \brief Keys are mapped to buckets by KeyExtractor, buckets to shards by a routing table which can be changed with migrate.
+ * \brief Copies share the shards and the routing table.
+ */
+template <class Proxy, class KeyExtractor = boost::asynchronous::shard_by_hash>
+class sharded_servant_proxy
+{
+public:
+    typedef Proxy proxy_type;
+    typedef typename Proxy::servant_type servant_type;
+    typedef typename Proxy::callable_type callable_type;
+
+    /*!
+     * \brief Constructor. Creates one servant per scheduler.
+     * \param schedulers one scheduler per shard
+     * \param buckets number of buckets, the granularity of migrations. 0 means 16 per shard.
+     * \param extractor gives for a key a value used to choose a bucket
+     * \param args arguments forwarded to each servant
+     */
+    template <typename... Args>
+    sharded_servant_proxy(std::vector<boost::asynchronous::any_shared_scheduler_proxy<callable_type>> const& schedulers,
+                          std::size_t buckets, KeyExtractor extractor, Args... args)
+        : m_extractor(std::move(extractor))
+    {
+        if (schedulers.empty())
+        {
+            throw std::invalid_argument("sharded_servant_proxy needs at least one scheduler");
+        }
+        std::vector<Proxy> shards;
+        shards.reserve(schedulers.size());
+        for (auto const& s : schedulers)
+        {
+            shards.emplace_back(s, args...);
+        }
+        if (buckets == 0)
+        {
+            buckets = 16 * schedulers.size();
+        }
+        m_state = std::make_shared<boost::asynchronous::detail::sharded_servant_state<Proxy>>(std::move(shards),buckets);
+    }
+
+    /*!
+     * \brief Returns the number of shards.
+     */
+    std::size_t size()const
+    {
+        return m_state->m_shards.size();
+    }
+    /*!
+     * \brief Returns the number of buckets.
+     */
+    std::size_t bucket_count()const
+    {
+        return m_state->m_buckets;
+    }
+    /*!
+     * \brief Returns the proxy of a shard.
+     */
+    Proxy const& operator[](std::size_t shard)const
+    {
+        return m_state->m_shards[shard];
+    }
+    /*!
+     * \brief Returns the bucket of a key.
+     */
+    template <class Key>
+    std::size_t bucket(Key const& key)const
+    {
+        return m_extractor(key) % m_state->m_buckets;
+    }
+    /*!
+     * \brief Returns the shard currently owning a bucket.
+     */
+    std::size_t shard_of_bucket(std::size_t bucket)const
+    {
+        return m_state->m_routing->m_table[bucket].load(std::memory_order_acquire);
+    }
+    /*!
+     * \brief Returns the proxy of the servant owning a key, to call it: shards.route(key).foo(key,...)
+     * \brief If another thread migrates the bucket between route and the call, the call can reach the old shard
+     * \brief after the state was extracted. Use call() when migrations run concurrently.
+     * \brief While a bucket moves, the proxy returned holds calls back until the new shard has the state.
+     */
+    template <class Key>
+    Proxy const& route(Key const& key)const
+    {
+        return m_state->owner(bucket(key));
+    }
+    /*!
+     * \brief Calls f(proxy) with the proxy of the servant owning a key, atomically with migrations: calls made by f
+     * \brief are executed by the old shard before the state of the bucket is extracted, or by the new shard after it is inserted.
+     * \param f functor taking a Proxy const&, calling it and returning at once. It must not wait for a migration.
+     * \return the result of f
+     */
+    template <class Key, class Func>
+    auto call(Key const& key, Func f)const
+        -> decltype(f(std::declval<Proxy const&>()))
+    {
+        std::shared_lock<std::shared_mutex> lock(m_state->m_routing->m_mutex);
+        return f(m_state->owner(bucket(key)));
+    }
+
+    /*!
+     * \brief Calls f(proxy) for every shard.
+     * \param f functor taking a Proxy const&, usually returning a future
+     * \return the results of f
+     */
+    template <class Func>
+    auto broadcast(Func f)const
+        -> std::vector<decltype(f(std::declval<Proxy const&>()))>
+    {
+        std::vector<decltype(f(std::declval<Proxy const&>()))> res;
+        res.reserve(m_state->m_shards.size());
+        for (auto const& p : m_state->m_shards)
+        {
+            res.emplace_back(f(p));
+        }
+        return res;
+    }
+
+    /*!
+     * \brief Calls f(proxy) for every shard and gathers the results as a continuation task, to be executed in a threadpool,
+     * \brief for example with top_level_continuation, or as sub-task of another continuation.
+     * \param f functor taking a Proxy const& and returning a std::future<R>, R not void
+     * \return a continuation_task<std::vector<R>> holding the results in shard order
+     */
+    template <class Func>
+    auto broadcast_continuation(Func f)const
+        -> boost::asynchronous::detail::broadcast_continuation_task<
+                Proxy,Func,decltype(f(std::declval<Proxy const&>()).get())>
+    {
+        return boost::asynchronous::detail::broadcast_continuation_task<
+                Proxy,Func,decltype(f(std::declval<Proxy const&>()).get())>(m_state,std::move(f));
+    }
+
+    /*!
+     * \brief Moves a bucket and its state to another shard.
+     * \brief Calls routed after migrate returns go to the new shard and are held back until the state was inserted.
+     * \brief Calls made through call() before go to the old shard and are executed before the state is extracted.
+     * \brief A call made on a proxy returned by route() before can reach the old shard after the extraction.
+     * \brief No shard waits for another, migrations are executed one at a time.
+     * \brief If extract throws or the old shard drops the extraction, the bucket stays in the old shard,
+     * \brief calls held back meanwhile are dropped and their futures broken.
+     * \param bucket bucket to move
+     * \param to new shard
+     * \param extract functor State(servant_type&, std::size_t bucket), executed by the old shard, removes the bucket's state
+     * \param insert functor void(servant_type&, State), executed by the new shard
+     * \return a future set when the state is inserted
+     */
+    template <class Extract, class Insert>
+    std::future<void> migrate(std::size_t bucket, std::size_t to, Extract extract, Insert insert)
+    {
+        if (bucket >= m_state->m_buckets || to >= m_state->m_shards.size())
+        {
+            throw std::out_of_range("sharded_servant_proxy::migrate");
+        }
+        std::shared_ptr<std::promise<void>> done = std::make_shared<std::promise<void>>();
+        std::future<void> fu = done->get_future();
+        std::weak_ptr<boost::asynchronous::detail::sharded_servant_state<Proxy>> weak_state = m_state;
+        m_state->m_migrations->start(m_state->m_migrations,
+            [weak_state,bucket,to,extract,insert,done](std::shared_ptr<boost::asynchronous::detail::shard_migration_queue> const& q)
+            {
+                std::shared_ptr<boost::asynchronous::detail::sharded_servant_state<Proxy>> state = weak_state.lock();
+                if (!state)
+                {
+                    done->set_exception(std::make_exception_ptr(std::runtime_error("sharded_servant_proxy destroyed before migration")));
+                    q->done(q);
+                    return;
+                }
+                sharded_servant_proxy::start_migration(*state,q,bucket,to,extract,insert,done);
+            });
+        return fu;
+    }
+
+private:
+    template <class Extract, class Insert>
+    static void start_migration(boost::asynchronous::detail::sharded_servant_state<Proxy>& state,
+                                std::shared_ptr<boost::asynchronous::detail::shard_migration_queue> q,
+                                std::size_t bucket, std::size_t to, Extract extract, Insert insert,
+                                std::shared_ptr<std::promise<void>> done)
+    {
+        boost::asynchronous::detail::shard_routing& routing = *state.m_routing;
+        const std::size_t from = routing.m_table[bucket].load(std::memory_order_acquire);
+        if (from == to)
+        {
+            done->set_value();
+            q->done(q);
+            return;
+        }
+        typedef boost::asynchronous::detail::shard_migration<Proxy,Extract,Insert> migration_type;
+        std::shared_ptr<migration_type> m =
+                std::make_shared<migration_type>(state.m_routing,bucket,from,
+                                                 state.m_shards[from].get_servant(),state.m_shards[to].get_servant(),
+                                                 state.m_gates[to],state.m_shards[to].get_migration_prio(),
+                                                 std::move(extract),std::move(insert),std::move(done),std::move(q));
+        // no call() can be between the switch and the extraction
+        std::unique_lock<std::shared_mutex> lock(routing.m_mutex);
+        // calls routed to the new shard wait in the gate for the state
+        state.m_gates[to]->hold();
+        routing.m_moving.store(bucket,std::memory_order_release);
+        routing.m_table[bucket].store(to,std::memory_order_release);
+        // behind the calls already routed to the old shard
+        state.m_shards[from].post(typename boost::asynchronous::job_traits<callable_type>::wrapper_type(
+                boost::asynchronous::any_callable([m]()
+                {
+                    migration_type::extract(m);
+                })));
+    }
+
+    std::shared_ptr<boost::asynchronous::detail::sharded_servant_state<Proxy>> m_state;
+    KeyExtractor m_extractor;
+};
+
+/*!
+ * \brief Creates a sharded_servant_proxy with shards servants, each in a new scheduler of type Scheduler.
+ * \param shards number of servants
+ * \param args arguments forwarded to each servant
+ */
+template <class Proxy,
+          class Scheduler = boost::asynchronous::single_thread_scheduler<
+                                boost::asynchronous::lockfree_queue<typename Proxy::callable_type>>,
+          typename... Args>
+boost::asynchronous::sharded_servant_proxy<Proxy> make_sharded_servant_proxy(std::size_t shards, Args... args)
+{
+    std::vector<boost::asynchronous::any_shared_scheduler_proxy<typename Proxy::callable_type>> schedulers;
+    schedulers.reserve(shards);
+    for (std::size_t i = 0; i < shards; ++i)
+    {
+        schedulers.push_back(boost::asynchronous::make_shared_scheduler_proxy<Scheduler>());
+    }
+    return boost::asynchronous::sharded_servant_proxy<Proxy>(schedulers,0,boost::asynchronous::shard_by_hash(),args...);
+}
+
+}} // boost::asynchronous
+
+#endif // BOOST_ASYNCHRONOUS_SHARDED_SERVANT_PROXY_HPP
@@ -20,10 +20,13 @@
 #include <boost/asynchronous/callable_any.hpp>
 #include <boost/asynchronous/post.hpp>
 #include <boost/asynchronous/checks.hpp>
+#include <boost/asynchronous/detail/servant_epoch.hpp>
 #include <boost/asynchronous/scheduler/tss_scheduler.hpp>
 #include <boost/asynchronous/detail/move_bind.hpp>
 #include <boost/asynchronous/job_traits.hpp>
 #include <boost/asynchronous/notification/topics.hpp>
+#include <boost/asynchronous/notification/notification_batch.hpp>
+#include <boost/asynchronous/algorithm/parallel_destroy.hpp>
 
 #include <boost/system/error_code.hpp>
 #include <boost/asynchronous/any_scheduler.hpp>
@@ -34,6 +37,54 @@ namespace boost { namespace asynchronous
 //TODO in detail
 struct track{};
 
+namespace detail
+{
+// functor returned by trackable_servant::make_safe_inline_callback
+template <class Func, class JOB>
+struct safe_inline_callback
+{
+    safe_inline_callback(Func f, boost::asynchronous::detail::epoch_token token,
+                         boost::asynchronous::any_weak_scheduler<JOB> scheduler,
+                         bool force_post, std::string const& task_name, std::size_t prio)
+        : m_func(std::move(f))
+        , m_token(std::move(token))
+        , m_scheduler(std::move(scheduler))
+        , m_force_post(force_post)
+        , m_task_name(task_name)
+        , m_prio(prio)
+    {}
+
+    template <typename... Args>
+    void operator()(Args... as)const
+    {
+        // in the servant thread, no need to post
+        if (!m_force_post && m_token.in_owner_thread())
+        {
+            if (m_token.alive())
+            {
+                m_func(std::move(as)...);
+            }
+            return;
+        }
+        boost::asynchronous::any_shared_scheduler<JOB> sched = m_scheduler.lock();
+        if (sched.is_valid())
+        {
+            typename boost::asynchronous::job_traits<JOB>::wrapper_type job(
+                        boost::asynchronous::move_bind(boost::asynchronous::check_alive(m_func,m_token),std::move(as)...));
+            job.set_name(m_task_name);
+            sched.post(std::move(job),m_prio);
+        }
+    }
+
+    mutable Func m_func;
+    boost::asynchronous::detail::epoch_token m_token;
+    boost::asynchronous::any_weak_scheduler<JOB> m_scheduler;
+    bool m_force_post;
+    std::string m_task_name;
+    std::size_t m_prio;
+};
+}
+
 
 // simple class for post and callback management
 // hides threadpool and weak scheduler, adds automatic trackability for callbacks and tasks
@@ -64,6 +115,8 @@ public:
         : m_tracking(std::make_shared<boost::asynchronous::track>())
         , m_scheduler(s)
         , m_worker(w)
+        , m_epoch(make_epoch(m_scheduler))
+        , m_subscriptions(0)
     {}
     /*!
      * \brief Constructor
@@ -79,6 +132,8 @@ public:
         : m_tracking(std::make_shared<boost::asynchronous::track>())
         , m_scheduler(boost::asynchronous::get_thread_scheduler<JOB>())
         , m_worker(w)
+        , m_epoch(make_epoch(m_scheduler))
+        , m_subscriptions(0)
     {}
 
     // copy-ctor and operator= are needed for correct tracking
@@ -89,6 +144,8 @@ public:
         : m_tracking(std::make_shared<boost::asynchronous::track>())
         , m_scheduler(rhs.m_scheduler)
         , m_worker(rhs.m_worker)
+        , m_epoch(make_epoch(m_scheduler))
+        , m_subscriptions(0)
     {
     }
 
@@ -99,7 +156,10 @@ public:
         : m_tracking(std::move(rhs.m_tracking))
         , m_scheduler(std::move(rhs.m_scheduler))
         , m_worker(std::move(rhs.m_worker))
+        , m_epoch(std::move(rhs.m_epoch))
+        , m_subscriptions(rhs.m_subscriptions)
     {
+        rhs.m_subscriptions = 0;
     }
     /*!
      * \brief Destructor.
@@ -118,6 +178,8 @@ public:
             m_tracking = std::make_shared<boost::asynchronous::track>();
             m_scheduler = rhs.m_scheduler;
             m_worker = rhs.m_worker;
+            m_epoch = make_epoch(m_scheduler);
+            m_subscriptions = 0;
         }
         return *this;
     }
@@ -132,6 +194,9 @@ public:
             m_tracking = std::move(rhs.m_tracking);
             m_scheduler = std::move(rhs.m_scheduler);
             m_worker = std::move(rhs.m_worker);
+            m_epoch = std::move(rhs.m_epoch);
+            m_subscriptions = rhs.m_subscriptions;
+            rhs.m_subscriptions = 0;
         }
         return *this;
     }
@@ -174,6 +239,56 @@ public:
         return this->make_safe_callback_helper(boost::asynchronous::make_function(std::move(func)),true,task_name,prio);
     }
 
+    /*!
+     * \brief Makes a callback like make_safe_callback, but returns a typed functor instead of a std::function.
+     * \brief func is stored inline and copied into the posted job, so it must be copyable.
+     * \brief Called from the servant thread, func is called directly, without diagnostics.
+     * \param func a functor will will safely be executed
+     * \param task_name which will be displayed in the diagnostic of the servant's scheduler.
+     * \param prio The priority of the functor within the servant's scheduler.
+     */
+    template<class T>
+    boost::asynchronous::detail::safe_inline_callback<T,JOB> make_safe_inline_callback(T func,
+#ifdef BOOST_ASYNCHRONOUS_REQUIRE_ALL_ARGUMENTS
+                                                     const std::string& task_name, std::size_t prio) const
+#else
+                                                     const std::string& task_name="", std::size_t prio=0) const
+#endif
+    {
+        return boost::asynchronous::detail::safe_inline_callback<T,JOB>(std::move(func),get_epoch_token(),m_scheduler,false,task_name,prio);
+    }
+
+    /*!
+     * \brief Makes a callback like make_safe_post_callback, but returns a typed functor instead of a std::function.
+     * \param func a functor will will safely be executed
+     * \param task_name which will be displayed in the diagnostic of the servant's scheduler.
+     * \param prio The priority of the functor within the servant's scheduler.
+     */
+    template<class T>
+    boost::asynchronous::detail::safe_inline_callback<T,JOB> make_safe_inline_post_callback(T func,
+#ifdef BOOST_ASYNCHRONOUS_REQUIRE_ALL_ARGUMENTS
+                                                     const std::string& task_name, std::size_t prio) const
+#else
+                                                     const std::string& task_name="", std::size_t prio=0) const
+#endif
+    {
+        return boost::asynchronous::detail::safe_inline_callback<T,JOB>(std::move(func),get_epoch_token(),m_scheduler,true,task_name,prio);
+    }
+
+    /*!
+     * \brief Returns what a callback executed in the servant thread needs to check if the servant is still alive.
+     * \brief If the servant was created in the single thread of its scheduler, the check needs no reference counting.
+     * \brief Otherwise, it uses the same tracking as make_check_alive_functor.
+     */
+    boost::asynchronous::detail::epoch_token get_epoch_token()const
+    {
+        if (m_epoch.is_active())
+        {
+            return m_epoch.token();
+        }
+        return boost::asynchronous::detail::epoch_token(std::weak_ptr<void>(m_tracking));
+    }
+
     /*!
      * \brief Returns a functor checking if servant is still alive
      */
@@ -241,7 +356,7 @@ public:
         boost::asynchronous::post_callback(m_worker,
                                         boost::asynchronous::check_alive_before_exec(std::move(func),m_tracking),
                                         m_scheduler,
-                                        boost::asynchronous::check_alive(std::move(cb_func),m_tracking),
+                                        boost::asynchronous::check_alive(std::move(cb_func),get_epoch_token()),
                                         task_name,
                                         post_prio,
                                         cb_prio);
@@ -270,7 +385,7 @@ public:
                                         m_worker,
                                         boost::asynchronous::check_alive_before_exec(std::move(func),m_tracking),
                                         m_scheduler,
-                                        boost::asynchronous::check_alive(std::move(cb_func),m_tracking),
+                                        boost::asynchronous::check_alive(std::move(cb_func),get_epoch_token()),
                                         task_name,
                                         post_prio,
                                         cb_prio);
@@ -295,7 +410,7 @@ public:
         boost::asynchronous::post_callback(wscheduler,
                                         boost::asynchronous::check_alive_before_exec(std::move(func),m_tracking),
                                         m_scheduler,
-                                        boost::asynchronous::check_alive(std::move(cb_func),m_tracking),
+                                        boost::asynchronous::check_alive(std::move(cb_func),get_epoch_token()),
                                         task_name,
                                         post_prio,
                                         cb_prio);
@@ -324,7 +439,7 @@ public:
                                         wscheduler,
                                         boost::asynchronous::check_alive_before_exec(std::move(func),m_tracking),
                                         m_scheduler,
-                                        boost::asynchronous::check_alive(std::move(cb_func),m_tracking),
+                                        boost::asynchronous::check_alive(std::move(cb_func),get_epoch_token()),
                                         task_name,
                                         post_prio,
                                         cb_prio);
@@ -505,7 +620,7 @@ public:
         boost::asynchronous::post_callback(s,
                                         boost::asynchronous::check_alive_before_exec(std::move(func),m_tracking),
                                         m_scheduler,
-                                        boost::asynchronous::check_alive(std::move(cb_func),m_tracking),
+                                        boost::asynchronous::check_alive(std::move(cb_func),get_epoch_token()),
                                         task_name,
                                         post_prio,
                                         cb_prio);
@@ -534,7 +649,7 @@ public:
                                         s,
                                         boost::asynchronous::check_alive_before_exec(std::move(func),m_tracking),
                                         m_scheduler,
-                                        boost::asynchronous::check_alive(std::move(cb_func),m_tracking),
+                                        boost::asynchronous::check_alive(std::move(cb_func),get_epoch_token()),
                                         task_name,
                                         post_prio,
                                         cb_prio);
@@ -552,6 +667,27 @@ public:
         signal.connect(typename Signal::slot_type(make_safe_callback(std::move(slot),task_name,prio)));
     }
 
+    /*!
+     * \brief Takes ownership of an object and destroys it in the worker threadpool without waiting, in parallel if it is a container.
+     * \brief Use it to drop big results (containers of containers, maps...) without stalling the servant thread.
+     * \brief The object is destroyed even if the servant is destroyed in between.
+     * \param obj object to destroy, moved in.
+     * \param cutoff number of outer elements released by a task.
+     * \param task_name which will be displayed in the diagnostic of the worker.
+     * \param prio The priority of the destruction tasks within the threadpool, lowest by default.
+     */
+    template <class T>
+#ifdef BOOST_ASYNCHRONOUS_REQUIRE_ALL_ARGUMENTS
+    void deferred_destroy(T&& obj, long cutoff, const std::string& task_name, std::size_t prio)const
+#else
+    void deferred_destroy(T&& obj, long cutoff=BOOST_ASYNCHRONOUS_DEFERRED_DESTROY_CUTOFF,
+                          const std::string& task_name="deferred_destroy",
+                          std::size_t prio=boost::asynchronous::deferred_destroy_prio)const
+#endif
+    {
+        boost::asynchronous::deferred_destroy(m_worker,std::forward<T>(obj),cutoff,task_name,prio);
+    }
+
     /*!
      * \brief Returns the worker threadpool used by this servant.
      * \return any_shared_scheduler_proxy<WJOB> hiding the threadpool type. WJOB is the Job type of the threadpool.
@@ -580,6 +716,33 @@ public:
         m_scheduler=s;
     }
 
+    /*!
+     * \brief Called by servant_proxy::migrate_to in the thread the servant leaves, after its last job there.
+     * \brief Callbacks created before stay tracked but are not executed in place in this thread any more.
+     * \brief Subscriptions are registered to the scheduler of this thread and cannot follow the servant.
+     * \return false if the servant has subscriptions and stays in this thread.
+     */
+    bool detach_from_thread()
+    {
+        if (m_subscriptions != 0)
+        {
+            return false;
+        }
+        m_epoch.retire();
+        return true;
+    }
+
+    /*!
+     * \brief Called by servant_proxy::migrate_to in the new thread of the servant, before its first job there.
+     */
+    void attach_to_thread()
+    {
+        if (in_single_thread_of(m_scheduler))
+        {
+            m_epoch.attach();
+        }
+    }
+
     /*!
      * \brief Returns the servant scheduler as a weak scheduler.
      * \return boost::asynchronous::any_weak_scheduler<JOB>. JOB is the Job type of the servant scheduler.
@@ -589,36 +752,59 @@ public:
         return m_scheduler;
     }
     template <class Sub, class Event, class Topic, class ReturnType>
-    boost::asynchronous::subscription_token subscribe_helper(Sub sub, Topic const& subscribed_topic, const std::string& task_name, std::size_t prio) const
+    boost::asynchronous::subscription_token subscribe_helper(Sub sub, Topic const& subscribed_topic, const std::string& task_name, std::size_t prio,
+                                                             bool batched = false) const
     {
         auto sched = get_scheduler().lock();
         auto weak = get_scheduler();
         if (sched.is_valid())
         {
+            // the servant cannot migrate until it unsubscribed
+            ++m_subscriptions;
             auto uid = sched.get_uuid();
             // wrap the functor in a wrapper, which will check for servant to be alive,
             // similar to a safe callback. If not alive, subscription will automatically unsubscribe            
             std::weak_ptr<track> tracking(m_tracking);
 
+            // if batched, events for our thread, from all publishers, delivered in batches
+            std::shared_ptr<boost::asynchronous::subscription::notification_batch> batch;
+            if (batched)
+            {
+                batch = boost::asynchronous::subscription::get_notification_batch_(prio);
+            }
+
             // publishing to other schedulers will mean calling this function, 
-            // which will post_future to our scheduler
-            auto wrapped = [tracking, uid, weak, task_name, prio]
+            // which will post_future to our scheduler, or add the event to the next batch posted to it
+            auto wrapped = [tracking, uid, weak, task_name, prio, batch]
             (Event const& ev, Topic const& published_topic)
                 {
                     auto sched = weak.lock();
                     if (sched.is_valid())
                     {
                         // not in our thread, post
-                        boost::asynchronous::post_future(sched,
-                            boost::asynchronous::move_bind(boost::asynchronous::check_alive([weak](Event const& ev, Topic const& published_topic)
+                        auto deliver = boost::asynchronous::check_alive([weak](Event const& ev, Topic const& published_topic)
                                 {
                                     auto sched = weak.lock();
                                     if (sched.is_valid())
                                     {
                                         sched.publish_internal(ev, published_topic);
                                     }
-                                }, tracking), ev, published_topic),
-                            task_name, prio);
+                                }, tracking);
+                        if (batch)
+                        {
+                            batch->post(sched,
+                                [deliver = std::move(deliver), ev, published_topic]()mutable
+                                    {
+                                        deliver(ev, published_topic);
+                                    },
+                                task_name, prio);
+                        }
+                        else
+                        {
+                            boost::asynchronous::post_future(sched,
+                                boost::asynchronous::move_bind(std::move(deliver), ev, published_topic),
+                                task_name, prio);
+                        }
                     }
                     else
                     {
@@ -704,6 +890,24 @@ public:
         return subscribe_helper<Sub, Event, boost::asynchronous::subscription::no_topic, void>(std::move(sub), boost::asynchronous::subscription::no_topic{}, task_name, prio);
     }
 
+    // as subscribe, but events published in other threads are delivered in batches, one job for many events:
+    // faster with many events, but an event can be delivered before jobs posted to our scheduler after the previous one,
+    // for example a call the publisher made to this servant between both publish
+    template <class Sub>
+    boost::asynchronous::subscription_token subscribe_batched(Sub sub,
+#ifdef BOOST_ASYNCHRONOUS_REQUIRE_ALL_ARGUMENTS
+        const std::string& task_name, std::size_t prio) const
+#else
+        const std::string& task_name = "", std::size_t prio = 0) const
+#endif
+    {
+        using traits = boost::asynchronous::function_traits<Sub>;
+        using arg0 = typename traits::template remove_ref_cv_arg_<0>::type;
+        using return_t = typename traits::result_type;
+
+        return subscribe_helper<Sub, arg0, boost::asynchronous::subscription::no_topic, return_t>(std::move(sub), boost::asynchronous::subscription::no_topic{}, task_name, prio, true);
+    }
+
     // in most cases, unsubscribe is not necessary, a servant not processing an event will be removed from the subscribers list
     // unsubscribe is provided only for corner cases or unit tests (test_full_notification)
     template<class Event>
@@ -714,6 +918,10 @@ public:
         {
             sched.template unsubscribe<Event>(token, boost::asynchronous::subscription::no_topic{});
         }
+        if (token.token != -1 && m_subscriptions != 0)
+        {
+            --m_subscriptions;
+        }
     }
 
     template <class Event>
@@ -743,6 +951,22 @@ public:
         return subscribe_helper<Sub, arg0, Topic, return_t>(std::move(sub), topic, task_name, prio);
     }
 
+    template <class Sub, class Topic>
+    requires boost::asynchronous::subscription::topic_concept<Topic>
+    boost::asynchronous::subscription_token subscribe_batched(Sub sub, Topic const& topic,
+#ifdef BOOST_ASYNCHRONOUS_REQUIRE_ALL_ARGUMENTS
+        const std::string& task_name, std::size_t prio) const
+#else
+        const std::string& task_name = "", std::size_t prio = 0) const
+#endif
+    {
+        using traits = boost::asynchronous::function_traits<Sub>;
+        using arg0 = typename traits::template remove_ref_cv_arg_<0>::type;
+        using return_t = typename traits::result_type;
+
+        return subscribe_helper<Sub, arg0, Topic, return_t>(std::move(sub), topic, task_name, prio, true);
+    }
+
     template <class Event, class Sub, class Topic>
     requires boost::asynchronous::subscription::topic_concept<Topic>
     auto subscribe(Sub sub, Topic const& topic,
@@ -768,6 +992,10 @@ public:
         {
             sched.template unsubscribe<Event>(token, topic);
         }
+        if (token.token != -1 && m_subscriptions != 0)
+        {
+            --m_subscriptions;
+        }
     }
 
     template <class Event, class Topic = boost::asynchronous::subscription::no_topic>
@@ -794,6 +1022,60 @@ private:
         Fct m_callable;
     };
 
+    // executes a callback in the servant thread, with diagnostics
+    template <class Fct>
+    static void execute_in_place(Fct f, std::string const& task_name)
+    {
+        auto weak_diagnostics = boost::asynchronous::get_scheduler_diagnostics<JOB>();
+        auto diagnostics = weak_diagnostics.lock();
+        safe_callback_helper<Fct> job_(std::move(f));
+        job_.set_name(task_name);
+        JOB job(job_);
+        try
+        {
+            // log time
+            boost::asynchronous::job_traits<JOB>::set_posted_time(job);
+            boost::asynchronous::job_traits<JOB>::set_started_time(job);
+            // log thread
+            boost::asynchronous::job_traits<JOB>::set_executing_thread_id(job,boost::this_thread::get_id());
+            // log current
+            boost::asynchronous::job_traits<JOB>::add_current_diagnostic(0,job,diagnostics.get());
+
+            job();
+
+            boost::asynchronous::job_traits<JOB>::reset_current_diagnostic(0,diagnostics.get());
+            boost::asynchronous::job_traits<JOB>::set_finished_time(job);
+            boost::asynchronous::job_traits<JOB>::add_diagnostic(job,diagnostics.get());
+        }
+        catch(std::exception&)
+        {
+            boost::asynchronous::job_traits<JOB>::set_failed(job);
+            boost::asynchronous::job_traits<JOB>::set_finished_time(job);
+            boost::asynchronous::job_traits<JOB>::add_diagnostic(job,diagnostics.get());
+            boost::asynchronous::job_traits<JOB>::reset_current_diagnostic(0,diagnostics.get());
+        }
+    }
+
+    // epoch tracking if created in the single thread of our scheduler
+    static boost::asynchronous::detail::servant_epoch make_epoch(boost::asynchronous::any_weak_scheduler<JOB> const& s)
+    {
+        if (in_single_thread_of(s))
+        {
+            return boost::asynchronous::detail::servant_epoch(true);
+        }
+        return boost::asynchronous::detail::servant_epoch();
+    }
+    static bool in_single_thread_of(boost::asynchronous::any_weak_scheduler<JOB> const& s)
+    {
+        boost::asynchronous::any_shared_scheduler<JOB> sched = s.lock();
+        if (sched.is_valid())
+        {
+            std::vector<boost::thread::id> ids = sched.thread_ids();
+            return ids.size() == 1 && ids[0] == boost::this_thread::get_id();
+        }
+        return false;
+    }
+
     template<typename... Args>
     std::function<void(Args... )> make_safe_callback_helper(std::function<void(Args... )> func,
                                                             bool force_post,
@@ -803,7 +1085,7 @@ private:
                                                      const std::string& task_name="", std::size_t prio=0) const
 #endif
     {
-        std::weak_ptr<track> tracking (m_tracking);
+        boost::asynchronous::detail::epoch_token tracking = get_epoch_token();
         boost::asynchronous::any_weak_scheduler<JOB> wscheduler = get_scheduler();
         //TODO functor with move
         std::shared_ptr<std::function<void(Args... )>> func_ptr =
@@ -811,42 +1093,23 @@ private:
 
         std::function<void(Args...)> res = [func_ptr,tracking,wscheduler,force_post,task_name,prio](Args... as)mutable
         {
+            if (!force_post && tracking.in_owner_thread())
+            {
+                // our thread, no need to ask the scheduler
+                execute_in_place(boost::asynchronous::move_bind( boost::asynchronous::check_alive([func_ptr](Args... args){(*func_ptr)(std::move(args)...);},tracking),
+                                                                 std::move(as)...),
+                                 task_name);
+                return;
+            }
             boost::asynchronous::any_shared_scheduler<JOB> sched = wscheduler.lock();
             if (sched.is_valid())
             {
                 std::vector<boost::thread::id> ids = sched.thread_ids();
                 if (!force_post && ids.size() == 1 && (ids[0] == boost::this_thread::get_id()))
                 {
-                    auto weak_diagnostics = boost::asynchronous::get_scheduler_diagnostics<JOB>();
-                    auto diagnostics = weak_diagnostics.lock();
-                    auto f = boost::asynchronous::move_bind( boost::asynchronous::check_alive([func_ptr](Args... args){(*func_ptr)(std::move(args)...);},tracking),
-                                std::move(as)...);
-                    safe_callback_helper<decltype(f)> job_(std::move(f));
-                    job_.set_name(task_name);
-                    JOB job(job_);
-                    try
-                    {
-                        // log time
-                        boost::asynchronous::job_traits<JOB>::set_posted_time(job);
-                        boost::asynchronous::job_traits<JOB>::set_started_time(job);
-                        // log thread
-                        boost::asynchronous::job_traits<JOB>::set_executing_thread_id(job,boost::this_thread::get_id());
-                        // log current
-                        boost::asynchronous::job_traits<JOB>::add_current_diagnostic(0,job,diagnostics.get());
-
-                        job();
-
-                        boost::asynchronous::job_traits<JOB>::reset_current_diagnostic(0,diagnostics.get());
-                        boost::asynchronous::job_traits<JOB>::set_finished_time(job);
-                        boost::asynchronous::job_traits<JOB>::add_diagnostic(job,diagnostics.get());
-                    }
-                    catch(std::exception&)
-                    {
-                        boost::asynchronous::job_traits<JOB>::set_failed(job);
-                        boost::asynchronous::job_traits<JOB>::set_finished_time(job);
-                        boost::asynchronous::job_traits<JOB>::add_diagnostic(job,diagnostics.get());
-                        boost::asynchronous::job_traits<JOB>::reset_current_diagnostic(0,diagnostics.get());
-                    }
+                    execute_in_place(boost::asynchronous::move_bind( boost::asynchronous::check_alive([func_ptr](Args... args){(*func_ptr)(std::move(args)...);},tracking),
+                                                                     std::move(as)...),
+                                     task_name);
                 }
                 else
                 {
@@ -869,6 +1132,10 @@ private:
     boost::asynchronous::any_weak_scheduler<JOB> m_scheduler;
     // our worker pool
     boost::asynchronous::any_shared_scheduler_proxy<WJOB> m_worker;
+    // cheaper tracking for callbacks, if we live in a single thread
+    boost::asynchronous::detail::servant_epoch m_epoch;
+    // subscriptions not unsubscribed, which tie the servant to its thread. Single-shot ones are counted until unsubscribed.
+    mutable std::size_t m_subscriptions;
 };
 
 }}
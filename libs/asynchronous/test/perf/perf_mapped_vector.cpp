@@ -0,0 +1,105 @@
+#include <iostream>
+#include <fstream>
+#include <cstdio>
+#include <numeric>
+#include <vector>
+
+#include <boost/asynchronous/queue/lockfree_queue.hpp>
+#include <boost/asynchronous/scheduler/multiqueue_threadpool_scheduler.hpp>
+#include <boost/asynchronous/scheduler_shared_proxy.hpp>
+#include <boost/asynchronous/container/vector.hpp>
+#include <boost/asynchronous/container/mapped_vector.hpp>
+#include <boost/asynchronous/algorithm/parallel_reduce.hpp>
+
+using namespace std;
+
+// start-up time of a reference table stored in a file: reading it and constructing a vector
+// versus mapping it, then time of a first parallel_reduce pass over the data.
+// For cold cache numbers, drop the page cache between runs (echo 3 > /proc/sys/vm/drop_caches)
+
+long tpsize = 0;
+long tasks = 0;
+std::size_t vec_size=0;
+std::string file_name;
+boost::asynchronous::any_shared_scheduler_proxy<> pool;
+
+double elapsed_ms(std::chrono::high_resolution_clock::time_point start)
+{
+    return std::chrono::nanoseconds(std::chrono::high_resolution_clock::now() - start).count() / 1000000.0;
+}
+
+template <class Iterator>
+double first_pass(Iterator beg, Iterator end)
+{
+    long cutoff = vec_size/tasks;
+    auto start = std::chrono::high_resolution_clock::now();
+    auto fu = boost::asynchronous::post_future(pool,
+    [beg,end,cutoff]()
+    {
+        return boost::asynchronous::parallel_reduce(beg,end,[](double a, double b){return a + b;},cutoff);
+    },"perf_mapped_vector_reduce",0);
+    double sum = fu.get();
+    double duration = elapsed_ms(start);
+    std::cout << "    first parallel_reduce took in ms: " << duration << " (sum=" << sum << ")" << std::endl;
+    return duration;
+}
+
+void test_vector()
+{
+    auto start = std::chrono::high_resolution_clock::now();
+    // read the file, then construct
+    std::ifstream in(file_name,std::ios::binary);
+    in.seekg(sizeof(boost::asynchronous::detail::mapped_vector_header));
+    std::vector<double> buffer(vec_size);
+    in.read(reinterpret_cast<char*>(buffer.data()),vec_size * sizeof(double));
+    boost::asynchronous::vector<double> v(pool,vec_size/tasks,buffer.begin(),buffer.end(),"perf_mapped_vector_ctor",0);
+    std::cout << "read + vector(scheduler,cutoff,first,last) took in ms: " << elapsed_ms(start) << std::endl;
+    first_pass(v.begin(),v.end());
+}
+
+void test_mapped(bool prefetch)
+{
+    auto start = std::chrono::high_resolution_clock::now();
+    auto v = std::make_shared<boost::asynchronous::mapped_vector<double>>(file_name);
+    if (prefetch)
+    {
+        auto fu = boost::asynchronous::post_future(pool,
+        [v]()
+        {
+            return boost::asynchronous::parallel_prefetch(*v,vec_size/tasks);
+        },"perf_mapped_vector_prefetch",0);
+        fu.get();
+    }
+    std::cout << (prefetch ? "mapped_vector + parallel_prefetch took in ms: " : "mapped_vector took in ms: ")
+              << elapsed_ms(start) << std::endl;
+    first_pass(v->cbegin(),v->cend());
+}
+
+int main( int argc, const char *argv[] )
+{
+    tpsize = (argc>1) ? strtol(argv[1],0,0) : boost::thread::hardware_concurrency();
+    tasks = (argc>2) ? strtol(argv[2],0,0) : 64;
+    vec_size = (argc>3) ? strtol(argv[3],0,0) : 100000000;
+    file_name = (argc>4) ? argv[4] : "perf_mapped_vector.data";
+    std::cout << "tpsize=" << tpsize << std::endl;
+    std::cout << "tasks=" << tasks << std::endl;
+    std::cout << "vec_size=" << vec_size << std::endl;
+    std::cout << "file=" << file_name << std::endl;
+    std::cout << std::endl;
+
+    pool = boost::asynchronous::make_shared_scheduler_proxy<
+                      boost::asynchronous::multiqueue_threadpool_scheduler<
+                            boost::asynchronous::lockfree_queue<>>>(tpsize,tasks);
+    {
+        std::vector<double> data(vec_size);
+        std::iota(data.begin(),data.end(),0.0);
+        boost::asynchronous::mapped_vector<double>::save(file_name,data.begin(),data.end());
+    }
+
+    test_vector();
+    test_mapped(false);
+    test_mapped(true);
+
+    std::remove(file_name.c_str());
+    return 0;
+}
@@ -0,0 +1,145 @@
+// Boost.Asynchronous library
+//  Copyright (C) Christophe Henry 2026
+//
+//  Use, modification and distribution is subject to the Boost
+//  Software License, Version 1.0.  (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// For more information, see http://www.boost.org
+
+#include <chrono>
+#include <future>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#include <boost/thread/futures/wait_for_all.hpp>
+
+#include <boost/asynchronous/scheduler/single_thread_scheduler.hpp>
+#include <boost/asynchronous/scheduler/threadpool_scheduler.hpp>
+#include <boost/asynchronous/queue/guarded_deque.hpp>
+#include <boost/asynchronous/scheduler_shared_proxy.hpp>
+#include <boost/asynchronous/servant_proxy.hpp>
+#include <boost/asynchronous/trackable_servant.hpp>
+#include <boost/asynchronous/notification/notification_proxy.hpp>
+
+using namespace std;
+
+// throughput of events published by one servant to subscribers living in other schedulers, subscribed with subscribe_batched.
+// Compile with -DBOOST_ASYNCHRONOUS_NOTIFICATION_BATCH=1 to get one job per event and destination.
+namespace
+{
+struct some_event
+{
+    long data;
+};
+
+struct Subscriber : boost::asynchronous::trackable_servant<>
+{
+    Subscriber(boost::asynchronous::any_weak_scheduler<> scheduler)
+        : boost::asynchronous::trackable_servant<>(scheduler)
+    {
+    }
+    // the future is set when the expected number of events was received
+    std::future<void> expect(long events)
+    {
+        auto p = std::make_shared<std::promise<void>>();
+        auto fu = p->get_future();
+        m_received = 0;
+        subscribe_batched([this, p, events](some_event const&)
+            {
+                if (++m_received == events)
+                {
+                    p->set_value();
+                }
+            });
+        return fu;
+    }
+    long m_received = 0;
+};
+class SubscriberProxy : public boost::asynchronous::servant_proxy<SubscriberProxy, Subscriber>
+{
+public:
+    template <class Scheduler>
+    SubscriberProxy(Scheduler s) :
+        boost::asynchronous::servant_proxy<SubscriberProxy, Subscriber>(s)
+    {}
+    BOOST_ASYNC_FUTURE_MEMBER(expect)
+};
+
+struct Publisher : boost::asynchronous::trackable_servant<>
+{
+    Publisher(boost::asynchronous::any_weak_scheduler<> scheduler)
+        : boost::asynchronous::trackable_servant<>(scheduler)
+    {
+    }
+    void publish_events(long events)
+    {
+        for (long i = 0; i < events; ++i)
+        {
+            this->publish(some_event{ i });
+        }
+    }
+};
+class PublisherProxy : public boost::asynchronous::servant_proxy<PublisherProxy, Publisher>
+{
+public:
+    template <class Scheduler>
+    PublisherProxy(Scheduler s) :
+        boost::asynchronous::servant_proxy<PublisherProxy, Publisher>(s)
+    {}
+    BOOST_ASYNC_FUTURE_MEMBER(publish_events)
+};
+
+boost::asynchronous::any_shared_scheduler_proxy<> make_scheduler()
+{
+    return boost::asynchronous::make_shared_scheduler_proxy<boost::asynchronous::single_thread_scheduler<
+                                                              boost::asynchronous::guarded_deque<>>>();
+}
+}
+
+int main( int argc, const char *argv[] )
+{
+    long subscribers = (argc>1) ? strtol(argv[1],0,0) : 4;
+    long events = (argc>2) ? strtol(argv[2],0,0) : 200000;
+    std::cout << "subscribers=" << subscribers << ", events=" << events
+              << ", events per flush job=" << BOOST_ASYNCHRONOUS_NOTIFICATION_BATCH << std::endl << std::endl;
+
+    auto pool = boost::asynchronous::make_shared_scheduler_proxy<boost::asynchronous::threadpool_scheduler<
+                                                                   boost::asynchronous::guarded_deque<>>>(1);
+    auto notification_ptr = std::make_shared<boost::asynchronous::subscription::notification_proxy<>>(make_scheduler(), pool);
+
+    std::vector<boost::asynchronous::any_shared_scheduler_proxy<>> schedulers;
+    for (long i = 0; i < subscribers + 1; ++i)
+    {
+        schedulers.push_back(make_scheduler());
+    }
+    std::vector<std::future<void>> registered;
+    for (auto& s : schedulers)
+    {
+        registered.emplace_back(boost::asynchronous::subscription::register_scheduler_to_notification(s.get_weak_scheduler(), notification_ptr));
+    }
+    boost::wait_for_all(registered.begin(), registered.end());
+
+    PublisherProxy publisher(schedulers[0]);
+    std::vector<std::unique_ptr<SubscriberProxy>> subs;
+    std::vector<std::future<void>> received;
+    for (long i = 0; i < subscribers; ++i)
+    {
+        subs.push_back(std::make_unique<SubscriberProxy>(schedulers[i + 1]));
+        received.push_back(subs.back()->expect(events).get());
+    }
+    // make sure the subscriptions reached the publisher thread
+    publisher.publish_events(0).get();
+
+    auto start = std::chrono::high_resolution_clock::now();
+    publisher.publish_events(events).get();
+    for (auto& fu : received)
+    {
+        fu.get();
+    }
+    double duration = std::chrono::nanoseconds(std::chrono::high_resolution_clock::now() - start).count() / 1000000.0;
+    std::cout << "took in ms: " << duration
+              << ", deliveries per second: " << static_cast<double>(events * subscribers) * 1000.0 / duration << std::endl;
+    return 0;
+}
@@ -0,0 +1,84 @@
+#include <iostream>
+#include <vector>
+
+#include <boost/asynchronous/queue/lockfree_queue.hpp>
+#include <boost/asynchronous/scheduler/multiqueue_threadpool_scheduler.hpp>
+#include <boost/asynchronous/scheduler_shared_proxy.hpp>
+#include <boost/asynchronous/container/vector.hpp>
+#include <boost/asynchronous/container/numa_allocator.hpp>
+#include <boost/asynchronous/algorithm/parallel_transform.hpp>
+
+using namespace std;
+
+// repeated parallel_transform passes on a vector placed with different NUMA policies.
+// On a 2-node machine, run as is, or simulate a split with for example:
+// numactl --cpunodebind=0,1 ./perf_numa_vector 32 256 100000000 20
+// Worker threads can be bound with processor_bind so that nodes keep the same workers.
+
+long tpsize = 0;
+long tasks = 0;
+std::size_t vec_size=0;
+std::size_t passes=0;
+boost::asynchronous::any_shared_scheduler_proxy<> pool;
+
+typedef boost::asynchronous::vector<double,BOOST_ASYNCHRONOUS_DEFAULT_JOB,false,
+                                    boost::asynchronous::numa_allocator<double>> numa_vector;
+
+double test_passes(boost::asynchronous::numa_policy policy)
+{
+    numa_vector in(pool,vec_size/tasks,vec_size,1.0,"in",0,boost::asynchronous::numa_allocator<double>(policy));
+    numa_vector out(pool,vec_size/tasks,vec_size,0.0,"out",0,boost::asynchronous::numa_allocator<double>(policy));
+    double* in_beg = in.data();
+    double* out_beg = out.data();
+    std::size_t n = vec_size;
+    long cutoff = vec_size/tasks;
+
+    auto start = std::chrono::high_resolution_clock::now();
+    for (std::size_t i = 0; i < passes; ++i)
+    {
+        auto fu = boost::asynchronous::post_future(pool,
+        [in_beg,out_beg,n,cutoff]()
+        {
+            return boost::asynchronous::parallel_transform(in_beg,in_beg+n,out_beg,[](double d){return d * 1.0001 + 0.5;},cutoff);
+        },"perf_numa_transform",0);
+        fu.get();
+        std::swap(in_beg,out_beg);
+    }
+    return (std::chrono::nanoseconds(std::chrono::high_resolution_clock::now() - start).count() / 1000000);
+}
+
+int main( int argc, const char *argv[] )
+{
+    tpsize = (argc>1) ? strtol(argv[1],0,0) : boost::thread::hardware_concurrency();
+    tasks = (argc>2) ? strtol(argv[2],0,0) : 64;
+    vec_size = (argc>3) ? strtol(argv[3],0,0) : 50000000;
+    passes = (argc>4) ? strtol(argv[4],0,0) : 20;
+    std::cout << "tpsize=" << tpsize << std::endl;
+    std::cout << "tasks=" << tasks << std::endl;
+    std::cout << "vec_size=" << vec_size << std::endl;
+    std::cout << "passes=" << passes << std::endl;
+    std::cout << "numa nodes=" << boost::asynchronous::detail::numa_node_count() << std::endl;
+    std::cout << std::endl;
+
+    pool = boost::asynchronous::make_shared_scheduler_proxy<
+                      boost::asynchronous::multiqueue_threadpool_scheduler<
+                            boost::asynchronous::lockfree_queue<>>>(tpsize,tasks);
+
+    double gb = static_cast<double>(passes * vec_size * sizeof(double) * 2) / (1024.0 * 1024.0 * 1024.0);
+
+    double duration_none = test_passes(boost::asynchronous::numa_policy::none);
+    std::cout << "parallel_transform, first touch placement took in ms: " << duration_none
+              << " (" << gb * 1000.0 / duration_none << " GB/s)" << std::endl;
+
+    double duration_interleave = test_passes(boost::asynchronous::numa_policy::interleave);
+    std::cout << "parallel_transform, interleaved placement took in ms: " << duration_interleave
+              << " (" << gb * 1000.0 / duration_interleave << " GB/s)" << std::endl;
+    std::cout << "speedup: " << duration_none / duration_interleave << std::endl;
+
+    double duration_local = test_passes(boost::asynchronous::numa_policy::node_local);
+    std::cout << "parallel_transform, node-local placement took in ms: " << duration_local
+              << " (" << gb * 1000.0 / duration_local << " GB/s)" << std::endl;
+    std::cout << "speedup: " << duration_none / duration_local << std::endl;
+
+    return 0;
+}
@@ -0,0 +1,94 @@
+// Boost.Asynchronous library
+//  Copyright (C) Christophe Henry 2026
+//
+//  Use, modification and distribution is subject to the Boost
+//  Software License, Version 1.0.  (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// For more information, see http://www.boost.org
+
+#include <iostream>
+#include <random>
+#include <vector>
+
+#include <boost/random/mersenne_twister.hpp>
+#include <boost/random/uniform_real_distribution.hpp>
+
+#include <boost/asynchronous/queue/lockfree_queue.hpp>
+#include <boost/asynchronous/scheduler/multiqueue_threadpool_scheduler.hpp>
+#include <boost/asynchronous/scheduler_shared_proxy.hpp>
+#include <boost/asynchronous/algorithm/parallel_generate.hpp>
+#include <boost/asynchronous/helpers/random_provider.hpp>
+
+using namespace std;
+
+// parallel_generate with a per-thread mt19937 (random_provider), whose result depends on scheduling,
+// compared with the reproducible parallel_generate_random
+long tpsize = 0;
+long tasks = 0;
+std::size_t vec_size=0;
+std::size_t loops=0;
+boost::asynchronous::any_shared_scheduler_proxy<> pool;
+
+template <class F>
+void measure(std::string const& name, F f)
+{
+    // warm up caches and thread-local engines
+    f();
+    auto start = std::chrono::high_resolution_clock::now();
+    for (std::size_t i = 0; i < loops; ++i)
+    {
+        f();
+    }
+    double duration = std::chrono::nanoseconds(std::chrono::high_resolution_clock::now() - start).count() / 1000000.0;
+    std::cout << name << " took in ms: " << duration / loops
+              << ", values per second: " << static_cast<double>(vec_size) * 1000.0 * loops / duration << std::endl;
+}
+
+int main( int argc, const char *argv[] )
+{
+    tpsize = (argc>1) ? strtol(argv[1],0,0) : boost::thread::hardware_concurrency();
+    tasks = (argc>2) ? strtol(argv[2],0,0) : 500;
+    vec_size = (argc>3) ? strtol(argv[3],0,0) : 10000000;
+    loops = (argc>4) ? strtol(argv[4],0,0) : 10;
+    std::cout << "tpsize=" << tpsize << std::endl;
+    std::cout << "tasks=" << tasks << std::endl;
+    std::cout << "vec_size=" << vec_size << std::endl << std::endl;
+
+    pool = boost::asynchronous::make_shared_scheduler_proxy<
+                      boost::asynchronous::multiqueue_threadpool_scheduler<
+                            boost::asynchronous::lockfree_queue<>>>(tpsize);
+
+    std::vector<double> data(vec_size);
+    long cutoff = static_cast<long>(vec_size / tasks);
+    double* beg = data.data();
+    double* end = beg + vec_size;
+
+    measure("parallel_generate with random_provider<mt19937>",[beg,end,cutoff]()
+    {
+        auto fu = boost::asynchronous::post_future(pool,
+        [beg,end,cutoff]()
+        {
+            boost::random::uniform_real_distribution<double> distribution(0.0,1.0);
+            return boost::asynchronous::parallel_generate(beg,end,
+                        [distribution]()mutable
+                        {
+                            return boost::asynchronous::random_provider<boost::random::mt19937>::generate(distribution);
+                        },
+                        cutoff);
+        },"perf_generate_random_provider",0);
+        fu.get();
+    });
+
+    measure("parallel_generate_random with philox4x32",[beg,end,cutoff]()
+    {
+        auto fu = boost::asynchronous::post_future(pool,
+        [beg,end,cutoff]()
+        {
+            return boost::asynchronous::parallel_generate_random(beg,end,std::uniform_real_distribution<double>(0.0,1.0),
+                                                                 42,cutoff);
+        },"perf_generate_random_philox",0);
+        fu.get();
+    });
+    return 0;
+}
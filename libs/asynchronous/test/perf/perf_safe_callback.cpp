@@ -0,0 +1,101 @@
+// Boost.Asynchronous library
+//  Copyright (C) Christophe Henry 2026
+//
+//  Use, modification and distribution is subject to the Boost
+//  Software License, Version 1.0.  (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// For more information, see http://www.boost.org
+
+#include <chrono>
+#include <iostream>
+
+#include <boost/asynchronous/queue/lockfree_queue.hpp>
+#include <boost/asynchronous/scheduler/single_thread_scheduler.hpp>
+#include <boost/asynchronous/scheduler_shared_proxy.hpp>
+#include <boost/asynchronous/servant_proxy.hpp>
+#include <boost/asynchronous/trackable_servant.hpp>
+
+using namespace std;
+
+// cost of creating and calling safe callbacks in the servant thread, std::function based compared with typed ones
+struct Servant : boost::asynchronous::trackable_servant<>
+{
+    Servant(boost::asynchronous::any_weak_scheduler<> scheduler)
+        : boost::asynchronous::trackable_servant<>(scheduler)
+    {}
+    long long call_safe_callback(long calls)
+    {
+        auto cb = make_safe_callback([this](int i){m_sum += i;});
+        for (long i = 0; i < calls; ++i)
+        {
+            cb(static_cast<int>(i & 0xFF));
+        }
+        return m_sum;
+    }
+    long long call_inline_callback(long calls)
+    {
+        auto cb = make_safe_inline_callback([this](int i){m_sum += i;});
+        for (long i = 0; i < calls; ++i)
+        {
+            cb(static_cast<int>(i & 0xFF));
+        }
+        return m_sum;
+    }
+    long long create_safe_callback(long calls)
+    {
+        for (long i = 0; i < calls; ++i)
+        {
+            make_safe_callback([this](int i){m_sum += i;})(static_cast<int>(i & 0xFF));
+        }
+        return m_sum;
+    }
+    long long create_inline_callback(long calls)
+    {
+        for (long i = 0; i < calls; ++i)
+        {
+            make_safe_inline_callback([this](int i){m_sum += i;})(static_cast<int>(i & 0xFF));
+        }
+        return m_sum;
+    }
+    long long m_sum = 0;
+};
+
+class ServantProxy : public boost::asynchronous::servant_proxy<ServantProxy,Servant>
+{
+public:
+    template <class Scheduler>
+    ServantProxy(Scheduler s):
+        boost::asynchronous::servant_proxy<ServantProxy,Servant>(s)
+    {}
+    BOOST_ASYNC_FUTURE_MEMBER(call_safe_callback)
+    BOOST_ASYNC_FUTURE_MEMBER(call_inline_callback)
+    BOOST_ASYNC_FUTURE_MEMBER(create_safe_callback)
+    BOOST_ASYNC_FUTURE_MEMBER(create_inline_callback)
+};
+
+template <class F>
+void measure(std::string const& name, long calls, F f)
+{
+    ServantProxy proxy(boost::asynchronous::make_shared_scheduler_proxy<
+                            boost::asynchronous::single_thread_scheduler<
+                                boost::asynchronous::lockfree_queue<>>>());
+    auto start = std::chrono::high_resolution_clock::now();
+    long long sum = f(proxy,calls);
+    double duration = std::chrono::nanoseconds(std::chrono::high_resolution_clock::now() - start).count() / 1000000.0;
+    std::cout << name << " took in ms: " << duration
+              << ", calls per second: " << static_cast<double>(calls) * 1000.0 / duration
+              << " (sum " << sum << ")" << std::endl;
+}
+
+int main( int argc, const char *argv[] )
+{
+    long calls = (argc>1) ? strtol(argv[1],0,0) : 1000000;
+    std::cout << "calls=" << calls << std::endl << std::endl;
+
+    measure("call make_safe_callback",calls,[](ServantProxy const& p, long c){return p.call_safe_callback(c).get();});
+    measure("call make_safe_inline_callback",calls,[](ServantProxy const& p, long c){return p.call_inline_callback(c).get();});
+    measure("create and call make_safe_callback",calls,[](ServantProxy const& p, long c){return p.create_safe_callback(c).get();});
+    measure("create and call make_safe_inline_callback",calls,[](ServantProxy const& p, long c){return p.create_inline_callback(c).get();});
+    return 0;
+}
@@ -0,0 +1,86 @@
+// Boost.Asynchronous library
+//  Copyright (C) Christophe Henry 2026
+//
+//  Use, modification and distribution is subject to the Boost
+//  Software License, Version 1.0.  (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// For more information, see http://www.boost.org
+
+#include <chrono>
+#include <iostream>
+
+#include <boost/asynchronous/queue/lockfree_queue.hpp>
+#include <boost/asynchronous/scheduler/single_thread_scheduler.hpp>
+#include <boost/asynchronous/scheduler_shared_proxy.hpp>
+#include <boost/asynchronous/servant_proxy.hpp>
+
+using namespace std;
+
+// small calls from one producer into one servant, one job per call compared with batched calls
+struct Servant
+{
+    Servant(int){}
+    void add(int i)
+    {
+        m_sum += i;
+    }
+    void add_batched(int i)
+    {
+        m_sum += i;
+    }
+    void add_all(boost::asynchronous::call_batch<int>& batch)
+    {
+        for (auto const& c : batch)
+        {
+            m_sum += std::get<0>(c);
+        }
+    }
+    long long sum()const
+    {
+        return m_sum;
+    }
+    long long m_sum = 0;
+};
+
+class ServantProxy : public boost::asynchronous::servant_proxy<ServantProxy,Servant>
+{
+public:
+    template <class Scheduler>
+    ServantProxy(Scheduler s):
+        boost::asynchronous::servant_proxy<ServantProxy,Servant>(s, 0)
+    {}
+    BOOST_ASYNC_POST_MEMBER(add)
+    BOOST_ASYNC_BATCHED_POST_MEMBER(add_batched)
+    BOOST_ASYNC_BATCH_MEMBER(add_all)
+    BOOST_ASYNC_FUTURE_MEMBER(sum)
+};
+
+template <class F>
+void measure(std::string const& name, long calls, F f)
+{
+    ServantProxy proxy(boost::asynchronous::make_shared_scheduler_proxy<
+                            boost::asynchronous::single_thread_scheduler<
+                                boost::asynchronous::lockfree_queue<>>>(100000));
+    auto start = std::chrono::high_resolution_clock::now();
+    for (long i = 0; i < calls; ++i)
+    {
+        f(proxy,static_cast<int>(i & 0xFF));
+    }
+    long long sum = proxy.sum().get();
+    double duration = std::chrono::nanoseconds(std::chrono::high_resolution_clock::now() - start).count() / 1000000.0;
+    std::cout << name << " took in ms: " << duration
+              << ", calls per second: " << static_cast<double>(calls) * 1000.0 / duration
+              << " (sum " << sum << ")" << std::endl;
+}
+
+int main( int argc, const char *argv[] )
+{
+    long calls = (argc>1) ? strtol(argv[1],0,0) : 10000000;
+    std::cout << "calls=" << calls << std::endl << std::endl;
+
+    measure("BOOST_ASYNC_POST_MEMBER",calls,[](ServantProxy const& p, int i){p.add(i);});
+    measure("BOOST_ASYNC_BATCHED_POST_MEMBER",calls,[](ServantProxy const& p, int i){p.add_batched(i);});
+    measure("BOOST_ASYNC_BATCH_MEMBER",calls,[](ServantProxy const& p, int i){p.add_all(i);});
+    return 0;
+}
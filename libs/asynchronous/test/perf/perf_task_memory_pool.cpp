@@ -0,0 +1,114 @@
+#include <iostream>
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include <boost/asynchronous/queue/lockfree_queue.hpp>
+#include <boost/asynchronous/scheduler/multiqueue_threadpool_scheduler.hpp>
+#include <boost/asynchronous/scheduler_shared_proxy.hpp>
+#include <boost/asynchronous/algorithm/parallel_reduce.hpp>
+#include <boost/asynchronous/algorithm/parallel_sort.hpp>
+
+using namespace std;
+
+// number of global allocations and throughput of algorithms creating many small tasks.
+// Build a second time with -DBOOST_ASYNCHRONOUS_NO_TASK_MEMORY_POOL to compare with global new.
+
+std::atomic<std::size_t> global_allocations{0};
+
+void* operator new(std::size_t size)
+{
+    global_allocations.fetch_add(1,std::memory_order_relaxed);
+    if (void* p = std::malloc(size == 0 ? 1 : size))
+        return p;
+    throw std::bad_alloc();
+}
+void operator delete(void* p) noexcept
+{
+    std::free(p);
+}
+void operator delete(void* p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+long tpsize = 0;
+long tasks = 0;
+std::size_t vec_size=0;
+std::size_t loops=0;
+boost::asynchronous::any_shared_scheduler_proxy<> pool;
+
+template <class F>
+void measure(std::string const& name, F f)
+{
+    // warm up caches
+    f();
+    std::size_t allocations_before = global_allocations.load();
+    auto start = std::chrono::high_resolution_clock::now();
+    for (std::size_t i = 0; i < loops; ++i)
+    {
+        f();
+    }
+    double duration = std::chrono::nanoseconds(std::chrono::high_resolution_clock::now() - start).count() / 1000000.0;
+    std::size_t allocations = global_allocations.load() - allocations_before;
+    std::cout << name << " took in ms: " << duration / loops
+              << ", global allocations per call: " << allocations / loops
+              << ", tasks per second: " << static_cast<double>(tasks) * 1000.0 * loops / duration << std::endl;
+}
+
+int main( int argc, const char *argv[] )
+{
+    tpsize = (argc>1) ? strtol(argv[1],0,0) : boost::thread::hardware_concurrency();
+    tasks = (argc>2) ? strtol(argv[2],0,0) : 100000;
+    vec_size = (argc>3) ? strtol(argv[3],0,0) : 10000000;
+    loops = (argc>4) ? strtol(argv[4],0,0) : 10;
+    std::cout << "tpsize=" << tpsize << std::endl;
+    std::cout << "tasks=" << tasks << std::endl;
+    std::cout << "vec_size=" << vec_size << std::endl;
+#ifdef BOOST_ASYNCHRONOUS_NO_TASK_MEMORY_POOL
+    std::cout << "task memory pool: off" << std::endl;
+#else
+    std::cout << "task memory pool: on" << std::endl;
+#endif
+    std::cout << std::endl;
+
+    pool = boost::asynchronous::make_shared_scheduler_proxy<
+                      boost::asynchronous::multiqueue_threadpool_scheduler<
+                            boost::asynchronous::lockfree_queue<>>>(tpsize);
+
+    std::vector<long> data(vec_size);
+    std::iota(data.begin(),data.end(),0);
+    long cutoff = static_cast<long>(vec_size / tasks);
+    long* beg = data.data();
+    long* end = beg + vec_size;
+
+    measure("parallel_reduce",[beg,end,cutoff]()
+    {
+        auto fu = boost::asynchronous::post_future(pool,
+        [beg,end,cutoff]()
+        {
+            return boost::asynchronous::parallel_reduce(beg,end,[](long a, long b){return a + b;},cutoff);
+        },"perf_task_memory_pool_reduce",0);
+        fu.get();
+    });
+
+    std::vector<long> to_sort(vec_size);
+    std::mt19937 mt(42);
+    measure("parallel_sort",[&to_sort,&data,&mt,cutoff]()
+    {
+        std::shuffle(data.begin(),data.end(),mt);
+        to_sort = data;
+        long* sbeg = to_sort.data();
+        long* send = sbeg + to_sort.size();
+        auto fu = boost::asynchronous::post_future(pool,
+        [sbeg,send,cutoff]()
+        {
+            return boost::asynchronous::parallel_sort(sbeg,send,std::less<long>(),cutoff);
+        },"perf_task_memory_pool_sort",0);
+        fu.get();
+    });
+    return 0;
+}
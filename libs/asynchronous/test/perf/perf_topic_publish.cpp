@@ -0,0 +1,86 @@
+// Boost.Asynchronous library
+//  Copyright (C) Christophe Henry 2026
+//
+//  Use, modification and distribution is subject to the Boost
+//  Software License, Version 1.0.  (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// For more information, see http://www.boost.org
+
+#include <chrono>
+#include <iostream>
+#include <string>
+
+#include <boost/asynchronous/notification/local_subscription.hpp>
+#include <boost/asynchronous/notification/topics.hpp>
+
+using namespace std;
+
+// publish throughput with many subscribers on hierarchical topics, indexed by a trie (channel_topic)
+// compared with checking every subscriber (same topic without index)
+namespace
+{
+struct some_event
+{
+    int data;
+};
+
+using indexed_topic = boost::asynchronous::subscription::channel_topic<>;
+
+// channel_topic without index_type
+struct linear_topic
+{
+    linear_topic(std::string const& channel): m_topic(channel){}
+    bool matches(linear_topic const& t)const
+    {
+        return m_topic.matches(t.m_topic.to_string());
+    }
+    bool operator == (linear_topic const& t) const { return m_topic.to_string() == t.m_topic.to_string(); }
+    bool operator != (linear_topic const& t) const { return !(*this == t); }
+    std::string to_string() const
+    {
+        return m_topic.to_string();
+    }
+    indexed_topic m_topic;
+};
+
+// region/device/sensor: 10 regions, 100 devices, 100 sensors, some of them subscribed with wildcards
+std::string subscribed_topic(long i)
+{
+    std::string region = "region" + std::to_string(i % 10);
+    std::string device = (i % 97 == 0) ? std::string(".") : "device" + std::to_string((i / 10) % 100);
+    return region + "/" + device + "/sensor" + std::to_string(i / 1000);
+}
+
+template <class Topic>
+void measure(std::string const& name, long subscribers, long publishes)
+{
+    boost::asynchronous::subscription::local_subscription<some_event, Topic> subs;
+    long long received = 0;
+    for (long i = 0; i < subscribers; ++i)
+    {
+        subs.subscribe([&received](some_event const& e, Topic const&){received += e.data; return std::optional<bool>(true);},
+                       i, Topic(subscribed_topic(i)));
+    }
+    auto start = std::chrono::high_resolution_clock::now();
+    for (long i = 0; i < publishes; ++i)
+    {
+        subs.publish_internal(some_event{1}, Topic(subscribed_topic(i % subscribers)));
+    }
+    double duration = std::chrono::nanoseconds(std::chrono::high_resolution_clock::now() - start).count() / 1000000.0;
+    std::cout << name << " took in ms: " << duration
+              << ", publishes per second: " << static_cast<double>(publishes) * 1000.0 / duration
+              << " (received " << received << ")" << std::endl;
+}
+}
+
+int main( int argc, const char *argv[] )
+{
+    long subscribers = (argc>1) ? strtol(argv[1],0,0) : 100000;
+    long publishes = (argc>2) ? strtol(argv[2],0,0) : 200;
+    std::cout << "subscribers=" << subscribers << ", publishes=" << publishes << std::endl << std::endl;
+
+    measure<linear_topic>("every subscriber checked",subscribers,publishes);
+    measure<indexed_topic>("trie index",subscribers,publishes * 100);
+    return 0;
+}
@@ -5,6 +5,8 @@
 #include <boost/asynchronous/scheduler/multiqueue_threadpool_scheduler.hpp>
 #include <boost/asynchronous/scheduler_shared_proxy.hpp>
 #include <boost/asynchronous/container/vector.hpp>
+#include <boost/asynchronous/algorithm/parallel_copy.hpp>
+#include <boost/asynchronous/algorithm/parallel_fill.hpp>
 
 using namespace std;
 
@@ -16,6 +18,7 @@ long tpsize = 0;
 long tasks = 0;
 std::size_t vec_size=0;
 std::size_t long_size=10;
+std::size_t buffer_gb=1;
 boost::asynchronous::any_shared_scheduler_proxy<> pool;
 
 //#define COMPLICATED_CONSTRUCTION
@@ -74,10 +77,13 @@ int main( int argc, const char *argv[] )
     tasks = (argc>2) ? strtol(argv[2],0,0) : 64;
     vec_size = (argc>3) ? strtol(argv[3],0,0) : 10000000;
     long_size = (argc>4) ? strtol(argv[4],0,0) : 10;
+    // size in GB of the char buffers used to measure copy / fill bandwidth, 0 to skip
+    buffer_gb = (argc>5) ? strtol(argv[5],0,0) : 1;
     std::cout << "tpsize=" << tpsize << std::endl;
     std::cout << "tasks=" << tasks << std::endl;
     std::cout << "vec_size=" << vec_size << std::endl;
     std::cout << "long_size=" << long_size << std::endl;
+    std::cout << "buffer_gb=" << buffer_gb << std::endl;
     std::cout << std::endl;
 
     // creation std
@@ -163,5 +169,98 @@ int main( int argc, const char *argv[] )
     std::cout << "Resize of boost::asynchronous::vector<LongOne>(" << asyncv.size() << ") took in ms: " << duration2 << std::endl;
     std::cout << "speedup asynchronous: " << duration1 / duration2 << std::endl << std::endl;
 
+    if (buffer_gb == 0)
+    {
+        return 0;
+    }
+    // bandwidth of trivially copyable buffers (memcpy / memset / non-temporal stores)
+    stdv.clear();
+    stdv.shrink_to_fit();
+    asyncv.clear();
+    asyncv.shrink_to_fit();
+    std::size_t buffer_size = buffer_gb * 1024 * 1024 * 1024;
+    double gb = static_cast<double>(buffer_gb);
+    boost::asynchronous::vector<char> bytes(pool,buffer_size/tasks,buffer_size,'a');
+
+    // copy std
+    duration1=0.0;
+    std::vector<char> stdbytes(bytes.begin(),bytes.end());
+    start = std::chrono::high_resolution_clock::now();
+    std::copy(bytes.begin(),bytes.end(),stdbytes.begin());
+    duration1 = (std::chrono::nanoseconds(std::chrono::high_resolution_clock::now() - start).count() / 1000000);
+    std::cout << "std::copy of " << buffer_gb << "GB took in ms: " << duration1 << " (" << gb * 1000.0 / duration1 << " GB/s)" << std::endl;
+
+    // copy asynchronous
+    duration2=0.0;
+    start = std::chrono::high_resolution_clock::now();
+    auto bytes2 = bytes;
+    duration2 = (std::chrono::nanoseconds(std::chrono::high_resolution_clock::now() - start).count() / 1000000);
+    std::cout << "Copy of boost::asynchronous::vector<char> of " << buffer_gb << "GB took in ms: " << duration2
+              << " (" << gb * 1000.0 / duration2 << " GB/s)" << std::endl;
+    std::cout << "speedup asynchronous: " << duration1 / duration2 << std::endl << std::endl;
+
+    duration2=0.0;
+    start = std::chrono::high_resolution_clock::now();
+    {
+        char* beg = bytes.data();
+        char* out = bytes2.data();
+        auto fu = boost::asynchronous::post_future(pool,
+        [beg,out,buffer_size]()
+        {
+            return boost::asynchronous::parallel_copy(beg,beg+buffer_size,out,buffer_size/tasks);
+        },"parallel_copy",0);
+        fu.get();
+    }
+    duration2 = (std::chrono::nanoseconds(std::chrono::high_resolution_clock::now() - start).count() / 1000000);
+    std::cout << "parallel_copy of " << buffer_gb << "GB took in ms: " << duration2 << " (" << gb * 1000.0 / duration2 << " GB/s)" << std::endl;
+    std::cout << "speedup asynchronous: " << duration1 / duration2 << std::endl << std::endl;
+
+    // fill std
+    duration1=0.0;
+    start = std::chrono::high_resolution_clock::now();
+    std::fill(stdbytes.begin(),stdbytes.end(),'b');
+    duration1 = (std::chrono::nanoseconds(std::chrono::high_resolution_clock::now() - start).count() / 1000000);
+    std::cout << "std::fill of " << buffer_gb << "GB took in ms: " << duration1 << " (" << gb * 1000.0 / duration1 << " GB/s)" << std::endl;
+
+    // fill asynchronous
+    duration2=0.0;
+    start = std::chrono::high_resolution_clock::now();
+    {
+        char* beg = bytes.data();
+        auto fu = boost::asynchronous::post_future(pool,
+        [beg,buffer_size]()
+        {
+            return boost::asynchronous::parallel_fill(beg,beg+buffer_size,'b',buffer_size/tasks);
+        },"parallel_fill",0);
+        fu.get();
+    }
+    duration2 = (std::chrono::nanoseconds(std::chrono::high_resolution_clock::now() - start).count() / 1000000);
+    std::cout << "parallel_fill of " << buffer_gb << "GB took in ms: " << duration2 << " (" << gb * 1000.0 / duration2 << " GB/s)" << std::endl;
+    std::cout << "speedup asynchronous: " << duration1 / duration2 << std::endl << std::endl;
+
+    // fill with a non-byte pattern
+    std::vector<int> stdints(buffer_size / sizeof(int));
+    duration1=0.0;
+    start = std::chrono::high_resolution_clock::now();
+    std::fill(stdints.begin(),stdints.end(),0x01020304);
+    duration1 = (std::chrono::nanoseconds(std::chrono::high_resolution_clock::now() - start).count() / 1000000);
+    std::cout << "std::fill of " << buffer_gb << "GB of int took in ms: " << duration1 << " (" << gb * 1000.0 / duration1 << " GB/s)" << std::endl;
+
+    duration2=0.0;
+    start = std::chrono::high_resolution_clock::now();
+    {
+        int* beg = stdints.data();
+        std::size_t n = stdints.size();
+        auto fu = boost::asynchronous::post_future(pool,
+        [beg,n]()
+        {
+            return boost::asynchronous::parallel_fill(beg,beg+n,0x05060708,n/tasks);
+        },"parallel_fill_int",0);
+        fu.get();
+    }
+    duration2 = (std::chrono::nanoseconds(std::chrono::high_resolution_clock::now() - start).count() / 1000000);
+    std::cout << "parallel_fill of " << buffer_gb << "GB of int took in ms: " << duration2 << " (" << gb * 1000.0 / duration2 << " GB/s)" << std::endl;
+    std::cout << "speedup asynchronous: " << duration1 / duration2 << std::endl << std::endl;
+
     return 0;
 }
@@ -0,0 +1,265 @@
+// Boost.Asynchronous library
+//  Copyright (C) Christophe Henry 2026
+//
+//  Use, modification and distribution is subject to the Boost
+//  Software License, Version 1.0.  (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// For more information, see http://www.boost.org
+
+#include <atomic>
+#include <future>
+#include <memory>
+#include <vector>
+
+#include <boost/asynchronous/scheduler/single_thread_scheduler.hpp>
+#include <boost/asynchronous/scheduler/threadpool_scheduler.hpp>
+#include <boost/asynchronous/scheduler/bounded_scheduler.hpp>
+#include <boost/asynchronous/queue/lockfree_queue.hpp>
+#include <boost/asynchronous/scheduler_shared_proxy.hpp>
+#include <boost/asynchronous/servant_proxy.hpp>
+#include <boost/asynchronous/trackable_servant.hpp>
+#include <boost/asynchronous/post.hpp>
+
+#include "test_common.hpp"
+#include <boost/test/unit_test.hpp>
+using namespace boost::asynchronous::test;
+
+namespace
+{
+// main thread id
+boost::thread::id main_thread_id;
+std::vector<boost::thread::id> servant_ids;
+bool servant_dtor = false;
+
+struct Servant : boost::asynchronous::trackable_servant<>
+{
+    Servant(boost::asynchronous::any_weak_scheduler<> scheduler)
+        : boost::asynchronous::trackable_servant<>(scheduler)
+    {
+    }
+    ~Servant()
+    {
+        servant_dtor = true;
+    }
+    // keeps the servant busy until the future is ready
+    void wait(std::shared_future<void> fu)
+    {
+        fu.wait();
+    }
+    // same, telling when it starts
+    void wait_started(std::shared_ptr<std::promise<void>> started, std::shared_future<void> fu)
+    {
+        started->set_value();
+        fu.wait();
+    }
+    int add(int i)
+    {
+        BOOST_CHECK_MESSAGE(contains_id(servant_ids.begin(),servant_ids.end(),boost::this_thread::get_id()),"add not in servant thread");
+        m_values.push_back(i);
+        return i;
+    }
+    // jobs posted by the servant to itself are never refused
+    void add_later(int n)
+    {
+        for (int i = 0; i < n; ++i)
+        {
+            post_self([this,i](){m_values.push_back(i);});
+        }
+    }
+    std::vector<int> values()const
+    {
+        return m_values;
+    }
+    std::vector<int> m_values;
+};
+
+class ServantProxy : public boost::asynchronous::servant_proxy<ServantProxy,Servant>
+{
+public:
+    template <class Scheduler>
+    ServantProxy(Scheduler s):
+        boost::asynchronous::servant_proxy<ServantProxy,Servant>(s)
+    {}
+    BOOST_ASYNC_POST_MEMBER(wait)
+    BOOST_ASYNC_POST_MEMBER(wait_started)
+    BOOST_ASYNC_FUTURE_MEMBER(add)
+    BOOST_ASYNC_POST_MEMBER(add_later)
+    BOOST_ASYNC_FUTURE_MEMBER(values)
+};
+
+boost::asynchronous::any_shared_scheduler_proxy<> make_scheduler(std::size_t limit, boost::asynchronous::overflow_policy policy)
+{
+    auto s = boost::asynchronous::make_shared_scheduler_proxy<boost::asynchronous::single_thread_scheduler<
+                                                                boost::asynchronous::lockfree_queue<>>>();
+    servant_ids = s.thread_ids();
+    return boost::asynchronous::make_bounded_scheduler(s,limit,policy);
+}
+
+// the constructor is counted until its job returns
+void wait_idle(ServantProxy const& proxy)
+{
+    while (proxy.get_proxy().get_queue_size()[0] != 0u)
+    {
+        boost::this_thread::yield();
+    }
+}
+
+bool is_broken_promise(std::future<int>& fu)
+{
+    try
+    {
+        fu.get();
+    }
+    catch(std::future_error& e)
+    {
+        return e.code() == std::future_errc::broken_promise;
+    }
+    return false;
+}
+}
+
+BOOST_AUTO_TEST_CASE( test_bounded_scheduler_fail )
+{
+    main_thread_id = boost::this_thread::get_id();
+    servant_dtor = false;
+    {
+        auto scheduler = make_scheduler(4,boost::asynchronous::overflow_policy::fail);
+        ServantProxy proxy(scheduler);
+        wait_idle(proxy);
+        std::promise<void> p;
+        proxy.wait(p.get_future().share());
+        std::vector<std::future<int>> fus;
+        for (int i = 0; i < 10; ++i)
+        {
+            fus.push_back(proxy.add(i));
+        }
+        // the waiting job and 3 calls are in flight
+        BOOST_CHECK(proxy.get_proxy().get_queue_size()[0] == 4u);
+        // refused calls are ready at once
+        for (int i = 3; i < 10; ++i)
+        {
+            BOOST_CHECK(fus[i].wait_for(std::chrono::seconds(0)) == std::future_status::ready);
+            BOOST_CHECK(is_broken_promise(fus[i]));
+        }
+        p.set_value();
+        for (int i = 0; i < 3; ++i)
+        {
+            BOOST_CHECK(fus[i].get() == i);
+        }
+        BOOST_CHECK((proxy.values().get() == std::vector<int>{0,1,2}));
+        boost::asynchronous::bounded_scheduler_stats stats = boost::asynchronous::get_bounded_scheduler_stats(proxy.get_proxy());
+        BOOST_CHECK(stats.overflows == 7u);
+        BOOST_CHECK(stats.max_in_flight == 4u);
+    }
+    BOOST_CHECK_MESSAGE(servant_dtor,"servant dtor not called.");
+}
+
+BOOST_AUTO_TEST_CASE( test_bounded_scheduler_block )
+{
+    main_thread_id = boost::this_thread::get_id();
+    auto scheduler = make_scheduler(2,boost::asynchronous::overflow_policy::block);
+    ServantProxy proxy(scheduler);
+    wait_idle(proxy);
+    std::promise<void> p;
+    proxy.wait(p.get_future().share());
+    std::atomic<int> posted{0};
+    std::vector<std::future<int>> fus(10);
+    boost::thread producer([&]()
+    {
+        for (int i = 0; i < 10; ++i)
+        {
+            fus[i] = proxy.add(i);
+            ++posted;
+        }
+    });
+    boost::this_thread::sleep(boost::posix_time::milliseconds(100));
+    // blocked after the first call
+    BOOST_CHECK(posted.load() == 1);
+    p.set_value();
+    producer.join();
+    for (int i = 0; i < 10; ++i)
+    {
+        BOOST_CHECK(fus[i].get() == i);
+    }
+    BOOST_CHECK(boost::asynchronous::get_bounded_scheduler_stats(proxy.get_proxy()).max_in_flight <= 2u);
+}
+
+BOOST_AUTO_TEST_CASE( test_bounded_scheduler_drop_oldest )
+{
+    main_thread_id = boost::this_thread::get_id();
+    auto scheduler = make_scheduler(3,boost::asynchronous::overflow_policy::drop_oldest);
+    ServantProxy proxy(scheduler);
+    wait_idle(proxy);
+    std::promise<void> p;
+    std::shared_ptr<std::promise<void>> started = std::make_shared<std::promise<void>>();
+    std::future<void> started_fu = started->get_future();
+    proxy.wait_started(started,p.get_future().share());
+    // the servant executes wait_started, which does not wait in the gate any more but is still in flight
+    started_fu.get();
+    std::vector<std::future<int>> fus;
+    for (int i = 0; i < 10; ++i)
+    {
+        fus.push_back(proxy.add(i));
+    }
+    BOOST_CHECK(boost::asynchronous::get_bounded_scheduler_stats(proxy.get_proxy()).in_flight == 3u);
+    p.set_value();
+    for (int i = 0; i < 8; ++i)
+    {
+        BOOST_CHECK(is_broken_promise(fus[i]));
+    }
+    for (int i = 8; i < 10; ++i)
+    {
+        BOOST_CHECK(fus[i].get() == i);
+    }
+    BOOST_CHECK((proxy.values().get() == std::vector<int>{8,9}));
+    BOOST_CHECK(boost::asynchronous::get_bounded_scheduler_stats(proxy.get_proxy()).overflows == 8u);
+    BOOST_CHECK(boost::asynchronous::get_bounded_scheduler_stats(proxy.get_proxy()).max_in_flight <= 3u);
+}
+
+BOOST_AUTO_TEST_CASE( test_bounded_scheduler_servant_jobs_not_refused )
+{
+    main_thread_id = boost::this_thread::get_id();
+    servant_dtor = false;
+    {
+        auto scheduler = make_scheduler(1,boost::asynchronous::overflow_policy::fail);
+        ServantProxy proxy(scheduler);
+        proxy.add_later(20);
+        // wait for the self posts through a call which might be refused while they are in flight
+        std::vector<int> values;
+        while (values.size() != 20u)
+        {
+            try
+            {
+                values = proxy.values().get();
+            }
+            catch(std::future_error&)
+            {
+            }
+        }
+        BOOST_CHECK(boost::asynchronous::get_bounded_scheduler_stats(proxy.get_proxy()).max_in_flight > 1u);
+        std::promise<void> p;
+        proxy.wait(p.get_future().share());
+        // full: the destructor of the servant is still posted
+        p.set_value();
+    }
+    BOOST_CHECK_MESSAGE(servant_dtor,"servant dtor not called.");
+}
+
+BOOST_AUTO_TEST_CASE( test_bounded_scheduler_run_on_caller )
+{
+    main_thread_id = boost::this_thread::get_id();
+    auto pool = boost::asynchronous::make_shared_scheduler_proxy<boost::asynchronous::threadpool_scheduler<
+                                                                   boost::asynchronous::lockfree_queue<>>>(1);
+    auto bounded = boost::asynchronous::make_bounded_scheduler(pool,1,boost::asynchronous::overflow_policy::run_on_caller);
+    std::promise<void> p;
+    std::shared_future<void> sfu = p.get_future().share();
+    std::future<boost::thread::id> busy = boost::asynchronous::post_future(bounded,[sfu](){sfu.wait();return boost::this_thread::get_id();});
+    std::future<boost::thread::id> fu = boost::asynchronous::post_future(bounded,[](){return boost::this_thread::get_id();});
+    // executed at once by the caller
+    BOOST_CHECK(fu.wait_for(std::chrono::seconds(0)) == std::future_status::ready);
+    BOOST_CHECK(fu.get() == main_thread_id);
+    p.set_value();
+    BOOST_CHECK(busy.get() != main_thread_id);
+    BOOST_CHECK(boost::asynchronous::get_bounded_scheduler_stats(bounded).overflows == 1u);
+}
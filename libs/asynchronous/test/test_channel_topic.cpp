@@ -1,4 +1,7 @@
+#include <algorithm>
 #include <iostream>
+#include <string>
+#include <vector>
 #include <boost/asynchronous/notification/topics.hpp>
 #include <boost/test/unit_test.hpp>
 
@@ -103,3 +106,55 @@ BOOST_AUTO_TEST_CASE(test_channel_topic_wildcard_match)
 }
 
 
+
+BOOST_AUTO_TEST_CASE(test_channel_topic_trie_same_as_matches)
+{
+    std::vector<std::string> subscribed = { "", "ChannelA", "ChannelA/", "ChannelA/ChannelB", "ChannelA/./ChannelB/",
+                                            "./ChannelB", "ChannelA/.", ".", "ChannelA/ChannelBish", "ChannelA//ChannelB",
+                                            "ChannelC/ChannelD/ChannelE", "ChannelA/.."};
+    std::vector<std::string> published = { "ChannelA", "ChannelA/", "ChannelA/ChannelB", "ChannelA/ChannelX/ChannelB",
+                                           "ChannelA/ChannelX/ChannelB/ChannelC/", "ChannelA/ChannelBish", "ChannelB",
+                                           "ChannelX/ChannelB", "ChannelA//ChannelB", "ChannelC/ChannelD", "ChannelA/..", "", "/" };
+    boost::asynchronous::subscription::topic_trie<std::size_t> trie;
+    for (std::size_t i = 0; i < subscribed.size(); ++i)
+    {
+        trie.insert(subscribed[i], i);
+    }
+    BOOST_CHECK(trie.size() == subscribed.size());
+    for (auto const& p : published)
+    {
+        std::vector<std::size_t> found;
+        trie.match(p, found);
+        std::sort(found.begin(), found.end());
+        std::vector<std::size_t> expected;
+        for (std::size_t i = 0; i < subscribed.size(); ++i)
+        {
+            if (topic_t{ subscribed[i] }.matches(p))
+            {
+                expected.push_back(i);
+            }
+        }
+        BOOST_CHECK_MESSAGE(found == expected, "trie differs from matches for " << p);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_channel_topic_trie_erase)
+{
+    boost::asynchronous::subscription::topic_trie<int> trie;
+    trie.insert("ChannelA/./ChannelB", 1);
+    trie.insert("ChannelA/./ChannelB", 2);
+    trie.insert("ChannelA", 3);
+    BOOST_CHECK(!trie.erase("ChannelA/./ChannelB", 3));
+    BOOST_CHECK(!trie.erase("ChannelA/ChannelX", 1));
+    BOOST_CHECK(trie.erase("ChannelA/./ChannelB/", 1));
+    std::vector<int> found;
+    trie.match("ChannelA/ChannelX/ChannelB", found);
+    std::sort(found.begin(), found.end());
+    BOOST_CHECK((found == std::vector<int>{2,3}));
+    BOOST_CHECK(trie.erase("ChannelA/./ChannelB", 2));
+    BOOST_CHECK(trie.erase("ChannelA", 3));
+    BOOST_CHECK(trie.empty());
+    found.clear();
+    trie.match("ChannelA/ChannelX/ChannelB", found);
+    BOOST_CHECK(found.empty());
+}
@@ -240,9 +240,35 @@ struct Servant : boost::asynchronous::trackable_servant<>
         return cb_called_;
     }
 
+    // records the events in the order they are received
+    void record_some_events(bool batched)
+    {
+        auto cb = [this](some_event const& e)
+            {
+                BOOST_CHECK_MESSAGE(main_thread_id != boost::this_thread::get_id(), "notification callback in wrong thread.");
+                received_.push_back(e.data);
+            };
+        token_ = batched ? this->subscribe_batched(std::move(cb)) : this->subscribe(std::move(cb));
+    }
+    std::vector<int> received()const
+    {
+        return received_;
+    }
+    // called directly, between events
+    void add_received(int data)
+    {
+        received_.push_back(data);
+    }
+    // keeps the servant busy until the future is ready
+    void wait(std::shared_future<void> fu)
+    {
+        fu.wait();
+    }
+
     int cb_called_ = 0;
     boost::asynchronous::subscription_token token_;
     boost::asynchronous::subscription_token token2_;
+    std::vector<int> received_;
 
 };
 class ServantProxy : public boost::asynchronous::servant_proxy<ServantProxy,Servant>
@@ -263,6 +289,10 @@ public:
     BOOST_ASYNC_FUTURE_MEMBER(cb_called)
     BOOST_ASYNC_FUTURE_MEMBER(wait_for_some_event_exact_topic)
     BOOST_ASYNC_FUTURE_MEMBER(wait_for_some_event_channel_topic)
+    BOOST_ASYNC_FUTURE_MEMBER(record_some_events)
+    BOOST_ASYNC_FUTURE_MEMBER(received)
+    BOOST_ASYNC_POST_MEMBER(add_received)
+    BOOST_ASYNC_POST_MEMBER(wait)
 };
 
 // pure publisher
@@ -282,6 +312,20 @@ struct Servant2 : boost::asynchronous::trackable_servant<>
     {
         this->publish(some_event{ 42 });
     }
+    void trigger_some_events(int first, int count)
+    {
+        for (int i = first; i < first + count; ++i)
+        {
+            this->publish(some_event{ i });
+        }
+    }
+    // an event, a call to the subscriber, another event
+    void trigger_around_call(std::shared_ptr<ServantProxy> subscriber, int first)
+    {
+        this->publish(some_event{ first });
+        subscriber->add_received(first + 1);
+        this->publish(some_event{ first + 2 });
+    }
     void trigger_some_event_exact_topic(std::string const& topic)
     {
         this->publish(some_event{ 42 }, string_topic{ topic });
@@ -331,6 +375,8 @@ public:
     {}
     BOOST_ASYNC_FUTURE_MEMBER(trigger_some_event)
     BOOST_ASYNC_FUTURE_MEMBER(trigger_some_event_in_threadpool)
+    BOOST_ASYNC_FUTURE_MEMBER(trigger_some_events)
+    BOOST_ASYNC_FUTURE_MEMBER(trigger_around_call)
     BOOST_ASYNC_FUTURE_MEMBER(trigger_some_event_exact_topic)
     BOOST_ASYNC_FUTURE_MEMBER(trigger_some_event_channel_topic)
     BOOST_ASYNC_FUTURE_MEMBER(wait_for_some_event)
@@ -1183,3 +1229,104 @@ BOOST_AUTO_TEST_CASE(test_full_notification_channel_topic_no_match)
         BOOST_FAIL("unexpected exception");
     }
 }
+
+BOOST_AUTO_TEST_CASE(test_full_notification_batched_in_order)
+{
+    auto scheduler1 = boost::asynchronous::make_shared_scheduler_proxy<boost::asynchronous::single_thread_scheduler<
+        boost::asynchronous::guarded_deque<>>>();
+    auto scheduler2 = boost::asynchronous::make_shared_scheduler_proxy<boost::asynchronous::single_thread_scheduler<
+        boost::asynchronous::guarded_deque<>>>();
+    auto scheduler3 = boost::asynchronous::make_shared_scheduler_proxy<boost::asynchronous::single_thread_scheduler<
+        boost::asynchronous::guarded_deque<>>>();
+    auto pool = boost::asynchronous::make_shared_scheduler_proxy<boost::asynchronous::threadpool_scheduler<
+        boost::asynchronous::guarded_deque<>>>(2);
+
+    auto scheduler_notify = boost::asynchronous::make_shared_scheduler_proxy<boost::asynchronous::single_thread_scheduler<
+        boost::asynchronous::guarded_deque<>>>();
+    auto notification_ptr = std::make_shared<boost::asynchronous::subscription::notification_proxy<>>
+        (scheduler_notify, pool);
+
+    std::vector<std::future<void>> notification_futures;
+    notification_futures.emplace_back(boost::asynchronous::subscription::register_scheduler_to_notification(scheduler1.get_weak_scheduler(), notification_ptr));
+    notification_futures.emplace_back(boost::asynchronous::subscription::register_scheduler_to_notification(scheduler2.get_weak_scheduler(), notification_ptr));
+    notification_futures.emplace_back(boost::asynchronous::subscription::register_scheduler_to_notification(scheduler3.get_weak_scheduler(), notification_ptr));
+    boost::wait_for_all(notification_futures.begin(), notification_futures.end());
+
+    std::shared_ptr<ServantProxy> proxy = std::make_shared<ServantProxy>(scheduler1, pool);
+    ServantProxy2 proxy2(scheduler2, pool);
+    ServantProxy2 proxy3(scheduler3, pool);
+
+    try
+    {
+        proxy->record_some_events(true).get();
+        wait_for_subscribe(proxy2);
+        wait_for_subscribe(proxy3);
+        // more events than a single flush delivers, from two publishers
+        proxy2.trigger_some_events(0, 1000).get();
+        proxy3.trigger_some_events(1000, 1000).get();
+        proxy2.trigger_some_events(2000, 1000).get();
+
+        // the events were delivered before a call posted after publishing them
+        std::vector<int> res = proxy->received().get();
+        BOOST_REQUIRE_MESSAGE(res.size() == 3000, "got wrong number of events: " << res.size());
+        for (int i = 0; i < 3000; ++i)
+        {
+            BOOST_REQUIRE_MESSAGE(res[i] == i, "events not in publish order");
+        }
+        proxy->force_unsubscribe().get();
+    }
+    catch (...)
+    {
+        BOOST_FAIL("unexpected exception");
+    }
+}
+
+BOOST_AUTO_TEST_CASE(test_full_notification_in_order_with_calls)
+{
+    auto scheduler1 = boost::asynchronous::make_shared_scheduler_proxy<boost::asynchronous::single_thread_scheduler<
+        boost::asynchronous::guarded_deque<>>>();
+    auto scheduler2 = boost::asynchronous::make_shared_scheduler_proxy<boost::asynchronous::single_thread_scheduler<
+        boost::asynchronous::guarded_deque<>>>();
+    auto pool = boost::asynchronous::make_shared_scheduler_proxy<boost::asynchronous::threadpool_scheduler<
+        boost::asynchronous::guarded_deque<>>>(2);
+
+    auto scheduler_notify = boost::asynchronous::make_shared_scheduler_proxy<boost::asynchronous::single_thread_scheduler<
+        boost::asynchronous::guarded_deque<>>>();
+    auto notification_ptr = std::make_shared<boost::asynchronous::subscription::notification_proxy<>>
+        (scheduler_notify, pool);
+
+    std::vector<std::future<void>> notification_futures;
+    notification_futures.emplace_back(boost::asynchronous::subscription::register_scheduler_to_notification(scheduler1.get_weak_scheduler(), notification_ptr));
+    notification_futures.emplace_back(boost::asynchronous::subscription::register_scheduler_to_notification(scheduler2.get_weak_scheduler(), notification_ptr));
+    boost::wait_for_all(notification_futures.begin(), notification_futures.end());
+
+    std::shared_ptr<ServantProxy> proxy = std::make_shared<ServantProxy>(scheduler1, pool);
+    ServantProxy2 proxy2(scheduler2, pool);
+
+    try
+    {
+        proxy->record_some_events(false).get();
+        wait_for_subscribe(proxy2);
+        // the subscriber is busy while publishing, events and calls wait in its queue
+        std::promise<void> p;
+        proxy->wait(p.get_future().share());
+        for (int i = 0; i < 30; i += 3)
+        {
+            proxy2.trigger_around_call(proxy, i).get();
+        }
+        p.set_value();
+
+        // the call made by the publisher between two events is executed between them
+        std::vector<int> res = proxy->received().get();
+        BOOST_REQUIRE_MESSAGE(res.size() == 30, "got wrong number of events: " << res.size());
+        for (int i = 0; i < 30; ++i)
+        {
+            BOOST_REQUIRE_MESSAGE(res[i] == i, "event overtook a call: " << res[i] << " instead of " << i);
+        }
+        proxy->force_unsubscribe().get();
+    }
+    catch (...)
+    {
+        BOOST_FAIL("unexpected exception");
+    }
+}
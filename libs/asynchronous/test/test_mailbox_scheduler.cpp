@@ -0,0 +1,193 @@
+// Boost.Asynchronous library
+//  Copyright (C) Christophe Henry 2026
+//
+//  Use, modification and distribution is subject to the Boost
+//  Software License, Version 1.0.  (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// For more information, see http://www.boost.org
+
+#include <atomic>
+#include <future>
+#include <vector>
+
+#include <boost/asynchronous/queue/lockfree_queue.hpp>
+#include <boost/asynchronous/scheduler_shared_proxy.hpp>
+#include <boost/asynchronous/scheduler/mailbox_scheduler.hpp>
+#include <boost/asynchronous/scheduler/threadpool_scheduler.hpp>
+
+#include <boost/asynchronous/servant_proxy.hpp>
+#include <boost/asynchronous/post.hpp>
+#include <boost/asynchronous/trackable_servant.hpp>
+
+#include "test_common.hpp"
+#include <boost/test/unit_test.hpp>
+using namespace boost::asynchronous::test;
+
+namespace
+{
+typedef boost::asynchronous::mailbox_scheduler<boost::asynchronous::lockfree_queue<>> pool_type;
+
+// main thread id
+boost::thread::id main_thread_id;
+std::vector<boost::thread::id> tpids;
+std::atomic<int> servants_alive{0};
+
+struct Servant : boost::asynchronous::trackable_servant<>
+{
+    Servant(boost::asynchronous::any_weak_scheduler<> scheduler, int id)
+        : boost::asynchronous::trackable_servant<>(scheduler,
+                                               boost::asynchronous::make_shared_scheduler_proxy<
+                                                   boost::asynchronous::threadpool_scheduler<
+                                                           boost::asynchronous::lockfree_queue<>>>(1))
+        , m_id(id)
+    {
+        ++servants_alive;
+    }
+    ~Servant()
+    {
+        BOOST_CHECK_MESSAGE(main_thread_id!=boost::this_thread::get_id(),"servant dtor not posted.");
+        --servants_alive;
+    }
+    void add(int i)
+    {
+        BOOST_CHECK_MESSAGE(contains_id(tpids.begin(),tpids.end(),boost::this_thread::get_id()),"task executed in the wrong thread");
+        // two threads in the same servant would show here
+        BOOST_CHECK_MESSAGE(m_in_call.fetch_add(1) == 0,"servant called concurrently.");
+        m_calls.push_back(i);
+        --m_in_call;
+    }
+    std::vector<int> calls()const
+    {
+        return m_calls;
+    }
+    // posts back to its own mailbox through the scheduler given to trackable_servant
+    std::future<int> call_back()
+    {
+        std::shared_ptr<std::promise<int>> aPromise = std::make_shared<std::promise<int>>();
+        std::future<int> fu = aPromise->get_future();
+        post_self([this,aPromise](){aPromise->set_value(m_id);});
+        return fu;
+    }
+    void post_self(std::function<void()> f)
+    {
+        boost::asynchronous::any_shared_scheduler<> s = get_scheduler().lock();
+        s.post(boost::asynchronous::any_callable(std::move(f)));
+    }
+    int m_id;
+    std::atomic<int> m_in_call{0};
+    std::vector<int> m_calls;
+};
+
+class ServantProxy : public boost::asynchronous::servant_proxy<ServantProxy,Servant>
+{
+public:
+    template <class Scheduler>
+    ServantProxy(Scheduler s, int id):
+        boost::asynchronous::servant_proxy<ServantProxy,Servant>(s, id)
+    {}
+    BOOST_ASYNC_POST_MEMBER(add)
+    BOOST_ASYNC_FUTURE_MEMBER(calls)
+    BOOST_ASYNC_FUTURE_MEMBER(call_back)
+};
+}
+
+BOOST_AUTO_TEST_CASE( test_mailbox_scheduler_many_servants )
+{
+    main_thread_id = boost::this_thread::get_id();
+    {
+        auto pool = boost::asynchronous::make_shared_scheduler_proxy<pool_type>(2);
+        tpids = pool.thread_ids();
+        // many more servants than threads, each keeps its call order and is never executed by 2 threads at once
+        std::vector<ServantProxy> proxies;
+        for (int i = 0; i < 200; ++i)
+        {
+            proxies.emplace_back(boost::asynchronous::make_mailbox<pool_type>(pool),i);
+        }
+        for (int j = 0; j < 100; ++j)
+        {
+            for (auto& p : proxies)
+            {
+                p.add(j);
+            }
+        }
+        for (auto& p : proxies)
+        {
+            std::vector<int> res = p.calls().get();
+            BOOST_REQUIRE(res.size() == 100u);
+            for (int j = 0; j < 100; ++j)
+            {
+                BOOST_CHECK(res[j] == j);
+            }
+        }
+        BOOST_CHECK(servants_alive.load() == 200);
+    }
+    BOOST_CHECK(servants_alive.load() == 0);
+}
+
+BOOST_AUTO_TEST_CASE( test_mailbox_scheduler_fairness )
+{
+    main_thread_id = boost::this_thread::get_id();
+    {
+        // batch of 4 jobs
+        auto pool = boost::asynchronous::make_shared_scheduler_proxy<pool_type>(1,4);
+        tpids = pool.thread_ids();
+        ServantProxy busy(boost::asynchronous::make_mailbox<pool_type>(pool),0);
+        ServantProxy other(boost::asynchronous::make_mailbox<pool_type>(pool),1);
+        // block the thread until both mailboxes are filled
+        std::promise<void> start;
+        std::shared_future<void> started = start.get_future().share();
+        boost::asynchronous::post_future(pool,[started](){started.wait();});
+        for (int j = 0; j < 10000; ++j)
+        {
+            busy.add(j);
+        }
+        std::future<std::vector<int>> other_calls = other.calls();
+        start.set_value();
+        // the second servant does not wait for the first one to empty its mailbox
+        std::vector<int> res = other_calls.get();
+        BOOST_CHECK(res.empty());
+        std::vector<int> busy_calls = busy.calls().get();
+        BOOST_CHECK(busy_calls.size() == 10000u);
+    }
+    BOOST_CHECK(servants_alive.load() == 0);
+}
+
+BOOST_AUTO_TEST_CASE( test_mailbox_scheduler_servant_scheduler )
+{
+    main_thread_id = boost::this_thread::get_id();
+    {
+        auto pool = boost::asynchronous::make_shared_scheduler_proxy<pool_type>(2);
+        tpids = pool.thread_ids();
+        ServantProxy proxy(boost::asynchronous::make_mailbox<pool_type>(pool),42);
+        std::future<std::future<int>> fu = proxy.call_back();
+        BOOST_CHECK(fu.get().get() == 42);
+        BOOST_CHECK(proxy.get_proxy().thread_ids() == tpids);
+    }
+    BOOST_CHECK(servants_alive.load() == 0);
+}
+
+BOOST_AUTO_TEST_CASE( test_mailbox_scheduler_direct_post )
+{
+    main_thread_id = boost::this_thread::get_id();
+    auto pool = boost::asynchronous::make_shared_scheduler_proxy<pool_type>(3,16,std::string("mailboxes"));
+    tpids = pool.thread_ids();
+    BOOST_CHECK(pool.get_name() == "mailboxes");
+    std::vector<std::future<boost::thread::id>> fus;
+    for (int i = 0; i < 100; ++i)
+    {
+        fus.push_back(boost::asynchronous::post_future(pool,[](){return boost::this_thread::get_id();}));
+    }
+    for (auto& fu : fus)
+    {
+        boost::thread::id id = fu.get();
+        BOOST_CHECK_MESSAGE(contains_id(tpids.begin(),tpids.end(),id),"task executed in the wrong thread");
+    }
+}
+
+BOOST_AUTO_TEST_CASE( test_make_mailbox_wrong_pool )
+{
+    auto pool = boost::asynchronous::make_shared_scheduler_proxy<boost::asynchronous::threadpool_scheduler<
+                                                                    boost::asynchronous::lockfree_queue<>>>(1);
+    BOOST_CHECK_THROW(boost::asynchronous::make_mailbox<pool_type>(pool),std::invalid_argument);
+}
@@ -0,0 +1,149 @@
+// Boost.Asynchronous library
+//  Copyright (C) Christophe Henry 2026
+//
+//  Use, modification and distribution is subject to the Boost
+//  Software License, Version 1.0.  (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// For more information, see http://www.boost.org
+
+#include <cstdio>
+#include <numeric>
+#include <string>
+#include <vector>
+#include <future>
+
+#include <unistd.h>
+
+#include <boost/asynchronous/container/mapped_vector.hpp>
+#include <boost/asynchronous/algorithm/parallel_reduce.hpp>
+#include <boost/asynchronous/algorithm/parallel_sort.hpp>
+#include <boost/asynchronous/queue/lockfree_queue.hpp>
+#include <boost/asynchronous/scheduler_shared_proxy.hpp>
+#include <boost/asynchronous/scheduler/threadpool_scheduler.hpp>
+#include "test_common.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+using namespace boost::asynchronous::test;
+
+namespace
+{
+struct point
+{
+    int x;
+    int y;
+};
+
+// removes the file at end of test
+struct temp_file
+{
+    explicit temp_file(std::string const& n)
+        : name("/tmp/" + n + "_" + std::to_string(::getpid()))
+    {}
+    ~temp_file()
+    {
+        std::remove(name.c_str());
+    }
+    std::string name;
+};
+}
+
+BOOST_AUTO_TEST_CASE( test_mapped_vector_read_only )
+{
+    temp_file f("test_mapped_vector_read_only");
+    std::vector<int> data(100000);
+    std::iota(data.begin(),data.end(),0);
+    boost::asynchronous::mapped_vector<int>::save(f.name,data.begin(),data.end());
+
+    boost::asynchronous::mapped_vector<int> v(f.name);
+    BOOST_CHECK_MESSAGE(v.size() == 100000,"wrong size: " << v.size());
+    BOOST_CHECK_MESSAGE(std::equal(v.begin(),v.end(),data.begin()),"wrong content.");
+    BOOST_CHECK_MESSAGE(reinterpret_cast<std::uintptr_t>(v.data()) % 64 == 0,"data not aligned.");
+    BOOST_CHECK_THROW(v.at(100000),std::out_of_range);
+    v.prefetch();
+
+    boost::asynchronous::mapped_vector<int> moved(std::move(v));
+    BOOST_CHECK_MESSAGE(moved.size() == 100000 && v.empty(),"move failed.");
+
+    // wrong type
+    typedef boost::asynchronous::mapped_vector<float> float_vector;
+    BOOST_CHECK_THROW(float_vector fv(f.name),std::runtime_error);
+    // missing file
+    typedef boost::asynchronous::mapped_vector<int> int_vector;
+    BOOST_CHECK_THROW(int_vector iv(f.name + "_missing"),std::system_error);
+}
+
+BOOST_AUTO_TEST_CASE( test_mapped_vector_no_header )
+{
+    temp_file f("test_mapped_vector_no_header");
+    std::vector<point> data{{1,2},{3,4},{5,6}};
+    boost::asynchronous::mapped_vector<point>::save(f.name,data.begin(),data.end(),false);
+    boost::asynchronous::mapped_vector<point> v(f.name,false);
+    BOOST_CHECK_MESSAGE(v.size() == 3 && v[2].x == 5 && v[2].y == 6,"wrong content.");
+    // 24 bytes are not a whole number of 16 bytes elements
+    struct big_point
+    {
+        point a;
+        point b;
+    };
+    typedef boost::asynchronous::mapped_vector<big_point> big_point_vector;
+    BOOST_CHECK_THROW(big_point_vector bv(f.name,false),std::runtime_error);
+}
+
+BOOST_AUTO_TEST_CASE( test_mapped_vector_writable )
+{
+    temp_file f("test_mapped_vector_writable");
+    std::vector<int> data(1000,1);
+    boost::asynchronous::mapped_vector<int>::save(f.name,data.begin(),data.end());
+    {
+        boost::asynchronous::mapped_vector<int,boost::asynchronous::mapped_vector_mode::copy_on_write> v(f.name);
+        v[0] = 42;
+        BOOST_CHECK_MESSAGE(v[0] == 42,"copy on write failed.");
+    }
+    {
+        boost::asynchronous::mapped_vector<int> v(f.name);
+        BOOST_CHECK_MESSAGE(v[0] == 1,"copy on write changed the file.");
+    }
+    {
+        boost::asynchronous::mapped_vector<int,boost::asynchronous::mapped_vector_mode::read_write> v(f.name);
+        v[0] = 43;
+        v.sync();
+    }
+    boost::asynchronous::mapped_vector<int> v(f.name);
+    BOOST_CHECK_MESSAGE(v[0] == 43,"read_write did not change the file.");
+}
+
+BOOST_AUTO_TEST_CASE( test_mapped_vector_parallel )
+{
+    temp_file f("test_mapped_vector_parallel");
+    std::vector<long> data(1000000);
+    std::iota(data.rbegin(),data.rend(),0);
+    boost::asynchronous::mapped_vector<long>::save(f.name,data.begin(),data.end());
+
+    auto scheduler = boost::asynchronous::make_shared_scheduler_proxy<boost::asynchronous::threadpool_scheduler<
+                                                                        boost::asynchronous::lockfree_queue<>>>(4);
+    auto v = std::make_shared<boost::asynchronous::mapped_vector<long,boost::asynchronous::mapped_vector_mode::copy_on_write>>(f.name);
+    std::future<void> fu = boost::asynchronous::post_future(scheduler,
+    [v]()
+    {
+        return boost::asynchronous::parallel_prefetch(*v,10000);
+    },"test_mapped_vector_parallel_prefetch",0);
+    fu.get();
+
+    std::future<long> fu2 = boost::asynchronous::post_future(scheduler,
+    [v]()
+    {
+        return boost::asynchronous::parallel_reduce(v->cbegin(),v->cend(),[](long a, long b){return a + b;},10000);
+    },"test_mapped_vector_parallel_reduce",0);
+    long sum = fu2.get();
+    BOOST_CHECK_MESSAGE(sum == 999999L * 1000000L / 2,"wrong sum: " << sum);
+
+    fu = boost::asynchronous::post_future(scheduler,
+    [v]()
+    {
+        return boost::asynchronous::parallel_sort(v->begin(),v->end(),std::less<long>(),10000);
+    },"test_mapped_vector_parallel_sort",0);
+    fu.get();
+    BOOST_CHECK_MESSAGE(std::is_sorted(v->begin(),v->end()),"parallel_sort failed.");
+}
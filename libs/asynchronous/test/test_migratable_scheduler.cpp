@@ -0,0 +1,381 @@
+// Boost.Asynchronous library
+//  Copyright (C) Christophe Henry 2026
+//
+//  Use, modification and distribution is subject to the Boost
+//  Software License, Version 1.0.  (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// For more information, see http://www.boost.org
+
+#include <chrono>
+#include <functional>
+#include <future>
+#include <memory>
+#include <string>
+#include <tuple>
+#include <vector>
+
+#include <boost/asynchronous/scheduler/single_thread_scheduler.hpp>
+#include <boost/asynchronous/scheduler/migratable_scheduler.hpp>
+#include <boost/asynchronous/queue/lockfree_queue.hpp>
+#include <boost/asynchronous/scheduler_shared_proxy.hpp>
+#include <boost/asynchronous/servant_proxy.hpp>
+#include <boost/asynchronous/servant_balancer.hpp>
+#include <boost/asynchronous/trackable_servant.hpp>
+#include <boost/asynchronous/post.hpp>
+
+#include "test_common.hpp"
+#include <boost/test/unit_test.hpp>
+
+namespace
+{
+struct some_event
+{
+    int data;
+};
+
+bool servant_dtor = false;
+boost::thread::id dtor_thread;
+
+struct Servant : boost::asynchronous::trackable_servant<>
+{
+    Servant(boost::asynchronous::any_weak_scheduler<> scheduler)
+        : boost::asynchronous::trackable_servant<>(scheduler)
+    {
+    }
+    ~Servant()
+    {
+        servant_dtor = true;
+        dtor_thread = boost::this_thread::get_id();
+    }
+    // keeps the servant busy until the future is ready
+    void wait(std::shared_future<void> fu)
+    {
+        fu.wait();
+    }
+    boost::thread::id add(int i)
+    {
+        m_values.push_back(i);
+        return boost::this_thread::get_id();
+    }
+    std::vector<int> values()const
+    {
+        return m_values;
+    }
+    // busy for ms milliseconds
+    void work(int ms)
+    {
+        auto end = std::chrono::steady_clock::now() + std::chrono::milliseconds(ms);
+        while (std::chrono::steady_clock::now() < end){}
+    }
+    // the callback records the thread executing it
+    std::function<void(int)> get_callback()
+    {
+        return make_safe_callback([this](int i){m_values.push_back(i);m_callback_thread = boost::this_thread::get_id();});
+    }
+    boost::thread::id callback_thread()const
+    {
+        return m_callback_thread;
+    }
+    // jobs posted by the servant to itself follow it
+    void add_later(int i)
+    {
+        post_self([this,i](){m_values.push_back(i);});
+    }
+    // a subscription keeps the servant in its thread
+    boost::asynchronous::subscription_token subscribe_event()
+    {
+        return subscribe([this](some_event const& e){m_values.push_back(e.data);});
+    }
+    void unsubscribe_event(boost::asynchronous::subscription_token token)
+    {
+        unsubscribe<some_event>(token);
+    }
+    std::vector<int> m_values;
+    boost::thread::id m_callback_thread;
+};
+
+class ServantProxy : public boost::asynchronous::servant_proxy<ServantProxy,Servant>
+{
+public:
+    template <class Scheduler>
+    ServantProxy(Scheduler s):
+        boost::asynchronous::servant_proxy<ServantProxy,Servant>(s)
+    {}
+    BOOST_ASYNC_POST_MEMBER(wait)
+    BOOST_ASYNC_FUTURE_MEMBER(add)
+    BOOST_ASYNC_FUTURE_MEMBER(values)
+    BOOST_ASYNC_FUTURE_MEMBER(work)
+    BOOST_ASYNC_FUTURE_MEMBER(get_callback)
+    BOOST_ASYNC_FUTURE_MEMBER(callback_thread)
+    BOOST_ASYNC_POST_MEMBER(add_later)
+    BOOST_ASYNC_FUTURE_MEMBER(subscribe_event)
+    BOOST_ASYNC_FUTURE_MEMBER(unsubscribe_event)
+};
+
+// keeps the posted jobs, and drops them when stopped, like a scheduler shutting down
+struct dropping_scheduler : public boost::asynchronous::any_shared_scheduler_concept<>
+{
+    typedef BOOST_ASYNCHRONOUS_DEFAULT_JOB job_type;
+
+    void post(job_type job) override
+    {
+        m_jobs.push_back(std::move(job));
+    }
+    void post(job_type job, std::size_t) override
+    {
+        m_jobs.push_back(std::move(job));
+    }
+    boost::asynchronous::any_interruptible interruptible_post(job_type job) override
+    {
+        post(std::move(job));
+        return boost::asynchronous::any_interruptible();
+    }
+    boost::asynchronous::any_interruptible interruptible_post(job_type job, std::size_t) override
+    {
+        post(std::move(job));
+        return boost::asynchronous::any_interruptible();
+    }
+    std::vector<boost::thread::id> thread_ids() const override
+    {
+        return std::vector<boost::thread::id>();
+    }
+    std::vector<std::size_t> get_queue_size() const override
+    {
+        return std::vector<std::size_t>(1,m_jobs.size());
+    }
+    std::vector<std::size_t> get_max_queue_size() const override
+    {
+        return std::vector<std::size_t>();
+    }
+    void reset_max_queue_size() override
+    {
+    }
+    boost::asynchronous::scheduler_diagnostics get_diagnostics(std::size_t =0) const override
+    {
+        return boost::asynchronous::scheduler_diagnostics();
+    }
+    void register_diagnostics_functor(std::function<void(boost::asynchronous::scheduler_diagnostics)>,
+                                      boost::asynchronous::register_diagnostics_type =
+                                            boost::asynchronous::register_diagnostics_type()) override
+    {
+    }
+    void clear_diagnostics() override
+    {
+    }
+    std::string get_name() const override
+    {
+        return "dropping_scheduler";
+    }
+    void processor_bind(std::vector<std::tuple<unsigned int,unsigned int>>) override
+    {
+    }
+    std::vector<std::future<void>> execute_in_all_threads(boost::asynchronous::any_callable) override
+    {
+        return std::vector<std::future<void>>();
+    }
+    void enable_queue(std::size_t, bool) override
+    {
+    }
+    // executes the jobs posted so far
+    void run()
+    {
+        std::vector<job_type> jobs;
+        jobs.swap(m_jobs);
+        for (auto& job : jobs)
+        {
+            job();
+        }
+    }
+    void stop()
+    {
+        std::vector<job_type> jobs;
+        jobs.swap(m_jobs);
+    }
+    std::vector<job_type> m_jobs;
+};
+
+boost::asynchronous::any_shared_scheduler_proxy<> make_scheduler()
+{
+    return boost::asynchronous::make_shared_scheduler_proxy<boost::asynchronous::single_thread_scheduler<
+                                                              boost::asynchronous::lockfree_queue<>>>();
+}
+}
+
+BOOST_AUTO_TEST_CASE( test_migratable_scheduler_calls_in_order )
+{
+    servant_dtor = false;
+    boost::thread::id id2;
+    {
+        auto scheduler1 = make_scheduler();
+        auto scheduler2 = make_scheduler();
+        boost::thread::id id1 = scheduler1.thread_ids()[0];
+        id2 = scheduler2.thread_ids()[0];
+        ServantProxy proxy(boost::asynchronous::make_migratable_scheduler(scheduler1));
+        BOOST_CHECK(proxy.add(0).get() == id1);
+        std::promise<void> p;
+        proxy.wait(p.get_future().share());
+        // queued in scheduler1, executed there before the migration
+        std::future<boost::thread::id> before = proxy.add(1);
+        std::future<bool> moved = proxy.migrate_to(scheduler2);
+        // a second migration is refused while one is running
+        BOOST_CHECK(!proxy.migrate_to(scheduler1).get());
+        // kept until the servant left scheduler1
+        std::vector<std::future<boost::thread::id>> after;
+        for (int i = 2; i < 6; ++i)
+        {
+            after.push_back(proxy.add(i));
+        }
+        BOOST_CHECK(moved.wait_for(std::chrono::milliseconds(10)) == std::future_status::timeout);
+        p.set_value();
+        BOOST_CHECK(moved.get());
+        BOOST_CHECK(before.get() == id1);
+        for (auto& fu : after)
+        {
+            BOOST_CHECK(fu.get() == id2);
+        }
+        // the job posted by add_later comes after the first values
+        proxy.add_later(6);
+        proxy.values().get();
+        BOOST_CHECK((proxy.values().get() == std::vector<int>{0,1,2,3,4,5,6}));
+        BOOST_CHECK(proxy.get_proxy().thread_ids()[0] == id2);
+        BOOST_CHECK(boost::asynchronous::get_servant_busy_time(proxy.get_proxy()).count() > 0);
+    }
+    // destroyed in its new thread
+    BOOST_CHECK_MESSAGE(servant_dtor,"servant dtor not called.");
+    BOOST_CHECK(dtor_thread == id2);
+}
+
+BOOST_AUTO_TEST_CASE( test_migratable_scheduler_callbacks )
+{
+    auto scheduler1 = make_scheduler();
+    auto scheduler2 = make_scheduler();
+    boost::thread::id id2 = scheduler2.thread_ids()[0];
+    ServantProxy proxy(boost::asynchronous::make_migratable_scheduler(scheduler1));
+    // created in scheduler1, the servant uses epoch tracking there
+    std::function<void(int)> cb = proxy.get_callback().get();
+    BOOST_CHECK(proxy.migrate_to(scheduler2).get());
+    // called in the old thread: not executed in place any more but in the new thread
+    boost::asynchronous::post_future(scheduler1,[cb](){cb(1);}).get();
+    proxy.values().get();
+    BOOST_CHECK(proxy.callback_thread().get() == id2);
+    // called in the new thread: executed in place
+    boost::asynchronous::post_future(scheduler2,[cb](){cb(2);}).get();
+    BOOST_CHECK(proxy.callback_thread().get() == id2);
+    // a callback created in the new thread
+    std::function<void(int)> cb2 = proxy.get_callback().get();
+    cb2(3);
+    BOOST_CHECK((proxy.values().get() == std::vector<int>{1,2,3}));
+}
+
+BOOST_AUTO_TEST_CASE( test_migratable_scheduler_not_migratable )
+{
+    auto scheduler1 = make_scheduler();
+    auto scheduler2 = make_scheduler();
+    ServantProxy proxy(scheduler1);
+    BOOST_CHECK(!proxy.migrate_to(scheduler2).get());
+    BOOST_CHECK(proxy.add(1).get() == scheduler1.thread_ids()[0]);
+}
+
+BOOST_AUTO_TEST_CASE( test_servant_balancer )
+{
+    auto scheduler1 = make_scheduler();
+    auto scheduler2 = make_scheduler();
+    ServantProxy proxy1(boost::asynchronous::make_migratable_scheduler(scheduler1));
+    ServantProxy proxy2(boost::asynchronous::make_migratable_scheduler(scheduler1));
+    boost::asynchronous::servant_balancer<> balancer({scheduler1,scheduler2});
+    BOOST_CHECK(balancer.add(proxy1));
+    BOOST_CHECK(balancer.add(proxy2));
+    BOOST_CHECK(!balancer.add(ServantProxy(scheduler1)));
+    // both servants busy in scheduler1
+    std::future<void> fu1 = proxy1.work(50);
+    std::future<void> fu2 = proxy2.work(50);
+    fu1.get();
+    fu2.get();
+    // the busy time is added after the future is set
+    proxy1.values().get();
+    proxy2.values().get();
+    BOOST_CHECK(balancer.rebalance());
+    BOOST_CHECK(balancer.busy_times()[0] >= std::chrono::milliseconds(100));
+    // one servant moved
+    boost::thread::id t1 = proxy1.add(1).get();
+    boost::thread::id t2 = proxy2.add(1).get();
+    BOOST_CHECK(t1 != t2);
+    // balanced now
+    fu1 = proxy1.work(20);
+    fu2 = proxy2.work(20);
+    fu1.get();
+    fu2.get();
+    proxy1.values().get();
+    proxy2.values().get();
+    BOOST_CHECK(!balancer.rebalance());
+}
+
+BOOST_AUTO_TEST_CASE( test_migratable_scheduler_subscriptions )
+{
+    auto scheduler1 = boost::asynchronous::make_shared_scheduler_proxy<boost::asynchronous::single_thread_scheduler<
+                                                                         boost::asynchronous::lockfree_queue<>>>(std::string("scheduler1"));
+    auto scheduler2 = make_scheduler();
+    boost::thread::id id1 = scheduler1.thread_ids()[0];
+    boost::thread::id id2 = scheduler2.thread_ids()[0];
+    ServantProxy proxy(boost::asynchronous::make_migratable_scheduler(scheduler1));
+    boost::asynchronous::subscription_token token = proxy.subscribe_event().get();
+    std::promise<void> p;
+    proxy.wait(p.get_future().share());
+    std::future<bool> moved = proxy.migrate_to(scheduler2);
+    // kept during the migration, then executed where the servant stayed
+    std::future<boost::thread::id> during = proxy.add(1);
+    p.set_value();
+    BOOST_CHECK_MESSAGE(!moved.get(),"servant with a subscription migrated.");
+    BOOST_CHECK(during.get() == id1);
+    BOOST_CHECK(proxy.add(2).get() == id1);
+    // the proxy reports the scheduler where the servant stayed
+    BOOST_CHECK(proxy.get_proxy().get_name() == "scheduler1");
+    // free to move once unsubscribed
+    proxy.unsubscribe_event(token).get();
+    BOOST_CHECK(proxy.migrate_to(scheduler2).get());
+    BOOST_CHECK(proxy.add(3).get() == id2);
+    BOOST_CHECK((proxy.values().get() == std::vector<int>{1,2,3}));
+}
+
+BOOST_AUTO_TEST_CASE( test_migratable_scheduler_dropped_handoff )
+{
+    typedef boost::asynchronous::detail::migration_gate<BOOST_ASYNCHRONOUS_DEFAULT_JOB> gate_type;
+    auto scheduler2 = make_scheduler();
+    auto scheduler1 = std::make_shared<dropping_scheduler>();
+    auto gate = std::make_shared<gate_type>(
+                boost::asynchronous::any_weak_scheduler<>(boost::asynchronous::detail::lockable_weak_scheduler<dropping_scheduler>(scheduler1)));
+    auto done = std::make_shared<std::promise<bool>>();
+    std::future<bool> moved = done->get_future();
+    bool moved_called = false;
+    BOOST_CHECK(gate->migrate(scheduler2.get_weak_scheduler(),0,done,[&moved_called](){moved_called = true;}));
+    done.reset();
+    // kept during the migration
+    int executed = 0;
+    gate->post(boost::asynchronous::any_callable([&executed](){++executed;}));
+    BOOST_CHECK(gate->is_migrating());
+    BOOST_CHECK(scheduler1->m_jobs.size() == 1);
+    // the handoff job is dropped: the migration is cancelled and the kept job goes to the old scheduler
+    scheduler1->stop();
+    BOOST_CHECK_MESSAGE(!gate->is_migrating(),"migration still running after its handoff job was dropped.");
+    bool broken = false;
+    try
+    {
+        moved.get();
+    }
+    catch(std::future_error& e)
+    {
+        broken = (e.code() == std::future_errc::broken_promise);
+    }
+    BOOST_CHECK_MESSAGE(broken,"promise of a dropped migration not broken.");
+    BOOST_CHECK(!moved_called);
+    scheduler1->run();
+    BOOST_CHECK(executed == 1);
+    // a new migration can start
+    done = std::make_shared<std::promise<bool>>();
+    moved = done->get_future();
+    BOOST_CHECK(gate->migrate(scheduler2.get_weak_scheduler(),0,done,std::function<void()>()));
+    scheduler1->run();
+    BOOST_CHECK(moved.get());
+    BOOST_CHECK(gate->thread_ids() == scheduler2.thread_ids());
+}
@@ -0,0 +1,185 @@
+// Boost.Asynchronous library
+//  Copyright (C) Christophe Henry 2026
+//
+//  Use, modification and distribution is subject to the Boost
+//  Software License, Version 1.0.  (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// For more information, see http://www.boost.org
+
+// every trivially copyable range uses non-temporal stores, whatever its size
+#define BOOST_ASYNCHRONOUS_NON_TEMPORAL_THRESHOLD 0
+
+#include <algorithm>
+#include <cstdint>
+#include <future>
+#include <memory>
+#include <vector>
+
+#include <boost/asynchronous/queue/lockfree_queue.hpp>
+#include <boost/asynchronous/scheduler_shared_proxy.hpp>
+#include <boost/asynchronous/scheduler/threadpool_scheduler.hpp>
+
+#include <boost/asynchronous/post.hpp>
+#include <boost/asynchronous/algorithm/parallel_copy.hpp>
+#include <boost/asynchronous/algorithm/parallel_move.hpp>
+#include <boost/asynchronous/algorithm/parallel_fill.hpp>
+
+#include "test_common.hpp"
+
+#include <boost/test/unit_test.hpp>
+using namespace boost::asynchronous::test;
+
+namespace
+{
+// 12 bytes: does not divide the 16-byte pattern of streaming fills
+struct triple
+{
+    std::int32_t a;
+    std::int32_t b;
+    std::int32_t c;
+    bool operator==(triple const& rhs) const
+    {
+        return a == rhs.a && b == rhs.b && c == rhs.c;
+    }
+};
+// 16 bytes, a whole streaming store
+struct quad
+{
+    std::int32_t a;
+    std::int32_t b;
+    std::int32_t c;
+    std::int32_t d;
+    bool operator==(quad const& rhs) const
+    {
+        return a == rhs.a && b == rhs.b && c == rhs.c && d == rhs.d;
+    }
+};
+
+template <class T>
+T make_value(std::size_t i)
+{
+    if constexpr (std::is_same_v<T,triple>)
+    {
+        return triple{static_cast<std::int32_t>(i),static_cast<std::int32_t>(i * 3),-static_cast<std::int32_t>(i)};
+    }
+    else if constexpr (std::is_same_v<T,quad>)
+    {
+        return quad{static_cast<std::int32_t>(i),1,static_cast<std::int32_t>(i * 7),-2};
+    }
+    else
+    {
+        return static_cast<T>(i % 113 + 1);
+    }
+}
+
+auto make_scheduler()
+{
+    return boost::asynchronous::make_shared_scheduler_proxy<boost::asynchronous::threadpool_scheduler<
+                                                              boost::asynchronous::lockfree_queue<>>>(4);
+}
+
+// copies or moves between offsets which are not aligned on 16 bytes, checks the destination around the range too
+template <class T, bool Move>
+void check_copy(std::size_t size, std::size_t src_offset, std::size_t dst_offset)
+{
+    auto scheduler = make_scheduler();
+    auto src = std::make_shared<std::vector<T>>(size);
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        (*src)[i] = make_value<T>(i);
+    }
+    auto dst = std::make_shared<std::vector<T>>(size + dst_offset + 2,make_value<T>(999));
+    std::size_t n = size - src_offset - 1;
+    std::future<void> fu = boost::asynchronous::post_future(
+        scheduler,
+        [src,dst,src_offset,dst_offset,n]()
+        {
+            if constexpr (Move)
+            {
+                return boost::asynchronous::parallel_move(src->data() + src_offset,src->data() + src_offset + n,dst->data() + dst_offset,997);
+            }
+            else
+            {
+                return boost::asynchronous::parallel_copy(src->data() + src_offset,src->data() + src_offset + n,dst->data() + dst_offset,997);
+            }
+        },
+        "test_non_temporal_copy",0);
+    fu.get();
+    BOOST_CHECK_MESSAGE(std::equal(src->begin() + src_offset,src->begin() + src_offset + n,dst->begin() + dst_offset),
+                        "non-temporal copy gave wrong result.");
+    BOOST_CHECK_MESSAGE(std::all_of(dst->begin(),dst->begin() + dst_offset,[](T const& v){return v == make_value<T>(999);}),
+                        "non-temporal copy wrote before destination.");
+    BOOST_CHECK_MESSAGE(std::all_of(dst->begin() + dst_offset + n,dst->end(),[](T const& v){return v == make_value<T>(999);}),
+                        "non-temporal copy wrote after destination.");
+}
+
+template <class T>
+void check_fill(std::size_t size, std::size_t offset, T const& value)
+{
+    auto scheduler = make_scheduler();
+    T outside = make_value<T>(998);
+    auto data = std::make_shared<std::vector<T>>(size,outside);
+    std::future<void> fu = boost::asynchronous::post_future(
+        scheduler,
+        [data,offset,value]()
+        {
+            return boost::asynchronous::parallel_fill(data->data() + offset,data->data() + data->size() - 1,value,997);
+        },
+        "test_non_temporal_fill",0);
+    fu.get();
+    BOOST_CHECK_MESSAGE(std::all_of(data->begin() + offset,data->end() - 1,[value](T const& v){return v == value;}),
+                        "Not all elements were set properly.");
+    BOOST_CHECK_MESSAGE(std::all_of(data->begin(),data->begin() + offset,[outside](T const& v){return v == outside;}),
+                        "non-temporal fill wrote before range.");
+    BOOST_CHECK_MESSAGE(data->back() == outside,"non-temporal fill wrote after range.");
+}
+}
+
+BOOST_AUTO_TEST_CASE( test_non_temporal_stores_enabled )
+{
+#ifdef BOOST_ASYNCHRONOUS_SSE2_STREAMING
+    BOOST_CHECK_MESSAGE(boost::asynchronous::detail::use_non_temporal(1),"non-temporal stores not used.");
+#endif
+    BOOST_CHECK_MESSAGE(boost::asynchronous::detail::non_temporal_threshold() == 0,"wrong threshold.");
+}
+
+BOOST_AUTO_TEST_CASE( test_non_temporal_copy )
+{
+    for (std::size_t offset : {0u,1u,3u,7u,15u})
+    {
+        check_copy<char,false>(100003,offset,(offset * 5) % 16);
+        check_copy<int,false>(100003,offset,(offset * 3) % 16);
+        check_copy<double,false>(50001,offset,offset % 4);
+        check_copy<triple,false>(30001,offset,offset % 3);
+    }
+    // shorter than a streaming store
+    check_copy<char,false>(20,1,3);
+}
+
+BOOST_AUTO_TEST_CASE( test_non_temporal_move )
+{
+    for (std::size_t offset : {0u,1u,5u})
+    {
+        check_copy<int,true>(100003,offset,offset * 2);
+        check_copy<quad,true>(20001,offset,offset + 1);
+    }
+}
+
+BOOST_AUTO_TEST_CASE( test_non_temporal_fill )
+{
+    for (std::size_t offset : {0u,1u,3u,7u})
+    {
+        // a single repeated byte is not a memset any more
+        check_fill<char>(100003,offset,'z');
+        check_fill<short>(100003,offset,static_cast<short>(0x0102));
+        check_fill<int>(100003,offset,0x01020304);
+        check_fill<std::int64_t>(50001,offset,0x0102030405060708LL);
+        check_fill<int>(100003,offset,0);
+        // 16 % sizeof(T) != 0
+        check_fill<triple>(30001,offset,triple{1,2,3});
+        check_fill<quad>(20001,offset,quad{1,2,3,4});
+    }
+    // shorter than a streaming store
+    check_fill<int>(5,1,0x01020304);
+}
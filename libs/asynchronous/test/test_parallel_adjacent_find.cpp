@@ -213,3 +213,27 @@ BOOST_AUTO_TEST_CASE( test_parallel_adjacent_find_if )
     }
     BOOST_CHECK_MESSAGE(servant_dtor,"servant dtor not called.");
 }
+
+BOOST_AUTO_TEST_CASE( test_parallel_adjacent_find_many_matches )
+{
+    // many matches everywhere, small cutoff => most tasks right of the first match get cancelled
+    auto data = std::make_shared<std::vector<int>>(100000,1);
+    std::mt19937 mt(42);
+    std::uniform_int_distribution<> dis(0, 1000);
+    std::generate(data->begin(), data->end(), std::bind(dis, std::ref(mt)));
+
+    auto scheduler = boost::asynchronous::make_shared_scheduler_proxy<boost::asynchronous::threadpool_scheduler<
+                                                                        boost::asynchronous::lockfree_queue<>>>(6);
+    for (int i = 0; i < 10; ++i)
+    {
+        std::future<std::vector<int>::iterator> fu = boost::asynchronous::post_future(
+            scheduler,
+            [data]()
+            {
+                return boost::asynchronous::parallel_adjacent_find(data->begin(),data->end(),100);
+            },
+            "test_parallel_adjacent_find_many_matches",0);
+        auto it = std::adjacent_find(data->begin(),data->end());
+        BOOST_CHECK_MESSAGE(it == fu.get(),"parallel_adjacent_find found wrong value.");
+    }
+}
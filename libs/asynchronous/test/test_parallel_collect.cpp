@@ -0,0 +1,94 @@
+// Boost.Asynchronous library
+//  Copyright (C) Christophe Henry 2026
+//
+//  Use, modification and distribution is subject to the Boost
+//  Software License, Version 1.0.  (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// For more information, see http://www.boost.org
+
+#include <vector>
+#include <list>
+#include <numeric>
+#include <string>
+#include <future>
+
+#include <boost/asynchronous/queue/lockfree_queue.hpp>
+#include <boost/asynchronous/scheduler_shared_proxy.hpp>
+#include <boost/asynchronous/scheduler/threadpool_scheduler.hpp>
+
+#include <boost/asynchronous/post.hpp>
+#include <boost/asynchronous/algorithm/parallel_collect.hpp>
+
+#include "test_common.hpp"
+
+#include <boost/test/unit_test.hpp>
+using namespace boost::asynchronous::test;
+
+namespace
+{
+// each element i produces i%5 copies of its string representation
+struct repeat_producer
+{
+    template <class Iterator, class ReturnRange>
+    void operator()(Iterator beg, Iterator end, ReturnRange& out)const
+    {
+        for (; beg != end; ++beg)
+        {
+            for (int j = 0; j < *beg % 5; ++j)
+            {
+                out.push_back(std::to_string(*beg));
+            }
+        }
+    }
+};
+
+std::vector<std::string> repeat(std::vector<int> const& data)
+{
+    std::vector<std::string> res;
+    repeat_producer()(data.begin(),data.end(),res);
+    return res;
+}
+}
+
+BOOST_AUTO_TEST_CASE( test_parallel_collect_variable_output )
+{
+    auto scheduler = boost::asynchronous::make_shared_scheduler_proxy<boost::asynchronous::threadpool_scheduler<
+                                                                        boost::asynchronous::lockfree_queue<>>>(6);
+    auto data = std::make_shared<std::vector<int>>(10000);
+    std::iota(data->begin(),data->end(),0);
+    std::future<std::vector<std::string>> fu = boost::asynchronous::post_future(
+        scheduler,
+        [data]()
+        {
+            return boost::asynchronous::parallel_collect<std::vector<std::string>>(data->begin(),data->end(),repeat_producer(),100);
+        },
+        "test_parallel_collect_variable_output",0);
+    try
+    {
+        BOOST_CHECK_MESSAGE(fu.get() == repeat(*data),"parallel_collect gave wrong result.");
+    }
+    catch(...)
+    {
+        BOOST_FAIL( "unexpected exception" );
+    }
+}
+
+BOOST_AUTO_TEST_CASE( test_parallel_collect_list )
+{
+    // a list cannot be written in parallel, results are concatenated in order
+    auto scheduler = boost::asynchronous::make_shared_scheduler_proxy<boost::asynchronous::threadpool_scheduler<
+                                                                        boost::asynchronous::lockfree_queue<>>>(6);
+    auto data = std::make_shared<std::vector<int>>(10000);
+    std::iota(data->begin(),data->end(),0);
+    std::future<std::list<std::string>> fu = boost::asynchronous::post_future(
+        scheduler,
+        [data]()
+        {
+            return boost::asynchronous::parallel_collect<std::list<std::string>>(data->begin(),data->end(),repeat_producer(),100);
+        },
+        "test_parallel_collect_list",0);
+    auto expected = repeat(*data);
+    auto res = fu.get();
+    BOOST_CHECK_MESSAGE(std::equal(res.begin(),res.end(),expected.begin(),expected.end()),"parallel_collect gave wrong result.");
+}
@@ -247,3 +247,32 @@ BOOST_AUTO_TEST_CASE( test_parallel_copy_continuations )
     BOOST_CHECK_MESSAGE(servant_dtor,"servant dtor not called.");
 }
 
+BOOST_AUTO_TEST_CASE( test_parallel_copy_trivial_unaligned )
+{
+    // trivially copyable elements are copied as bytes, check odd sizes and offsets
+    auto scheduler = boost::asynchronous::make_shared_scheduler_proxy<boost::asynchronous::threadpool_scheduler<
+                                                                        boost::asynchronous::lockfree_queue<>>>(4);
+    auto src = std::make_shared<std::vector<char>>(100003);
+    auto dst = std::make_shared<std::vector<char>>(100003,'x');
+    for (std::size_t i = 0; i < src->size(); ++i)
+    {
+        (*src)[i] = static_cast<char>(i % 251);
+    }
+    std::future<void> fu = boost::asynchronous::post_future(
+        scheduler,
+        [src,dst]()
+        {
+            return boost::asynchronous::parallel_copy(src->data() + 1,src->data() + src->size() - 2,dst->data() + 3,997);
+        },
+        "test_parallel_copy_trivial_unaligned",0);
+    try
+    {
+        fu.get();
+        BOOST_CHECK_MESSAGE(std::equal(src->begin() + 1,src->end() - 2,dst->begin() + 3),"parallel_copy gave wrong result.");
+        BOOST_CHECK_MESSAGE(std::all_of(dst->begin(),dst->begin() + 3,[](char c){return c == 'x';}),"parallel_copy wrote before destination.");
+    }
+    catch(...)
+    {
+        BOOST_FAIL( "unexpected exception" );
+    }
+}
@@ -0,0 +1,179 @@
+// Boost.Asynchronous library
+//  Copyright (C) Christophe Henry 2026
+//
+//  Use, modification and distribution is subject to the Boost
+//  Software License, Version 1.0.  (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// For more information, see http://www.boost.org
+
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+#include <future>
+
+#include <boost/asynchronous/algorithm/parallel_destroy.hpp>
+#include <boost/asynchronous/scheduler/single_thread_scheduler.hpp>
+#include <boost/asynchronous/queue/lockfree_queue.hpp>
+#include <boost/asynchronous/scheduler_shared_proxy.hpp>
+#include <boost/asynchronous/scheduler/threadpool_scheduler.hpp>
+#include <boost/asynchronous/servant_proxy.hpp>
+#include <boost/asynchronous/trackable_servant.hpp>
+#include "test_common.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+using namespace boost::asynchronous::test;
+
+namespace
+{
+std::atomic<int> destroyed{0};
+std::mutex threads_mutex;
+std::set<boost::thread::id> destroying_threads;
+
+// records destruction of non moved-from objects
+struct counted
+{
+    counted() = default;
+    counted(counted const&) = default;
+    counted(counted&& rhs) noexcept : alive(rhs.alive)
+    {
+        rhs.alive = false;
+    }
+    ~counted()
+    {
+        if (alive)
+        {
+            ++destroyed;
+            std::lock_guard<std::mutex> lock(threads_mutex);
+            destroying_threads.insert(boost::this_thread::get_id());
+        }
+    }
+    bool alive = true;
+};
+
+void reset_counters()
+{
+    destroyed = 0;
+    std::lock_guard<std::mutex> lock(threads_mutex);
+    destroying_threads.clear();
+}
+
+bool wait_destroyed(int expected)
+{
+    for (int i = 0; i < 1000 && destroyed.load() != expected; ++i)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    return destroyed.load() == expected;
+}
+
+std::vector<std::vector<counted>> make_nested(int outer, int inner)
+{
+    // built in place, no temporary destroyed
+    std::vector<std::vector<counted>> res;
+    res.reserve(outer);
+    for (int i = 0; i < outer; ++i)
+    {
+        res.emplace_back(inner);
+    }
+    return res;
+}
+
+boost::thread::id servant_thread_id;
+
+struct Servant : boost::asynchronous::trackable_servant<>
+{
+    Servant(boost::asynchronous::any_weak_scheduler<> scheduler,boost::asynchronous::any_shared_scheduler_proxy<> pool)
+        : boost::asynchronous::trackable_servant<>(scheduler,pool)
+    {
+    }
+    void drop_result()
+    {
+        servant_thread_id = boost::this_thread::get_id();
+        auto result = make_nested(1000,10);
+        // the servant thread does not pay for destruction
+        deferred_destroy(std::move(result),100);
+    }
+};
+class ServantProxy : public boost::asynchronous::servant_proxy<ServantProxy,Servant>
+{
+public:
+    template <class Scheduler, class Pool>
+    ServantProxy(Scheduler s, Pool p):
+        boost::asynchronous::servant_proxy<ServantProxy,Servant>(s,p)
+    {}
+    BOOST_ASYNC_FUTURE_MEMBER(drop_result)
+};
+}
+
+BOOST_AUTO_TEST_CASE( test_parallel_destroy_nested )
+{
+    reset_counters();
+    auto scheduler = boost::asynchronous::make_shared_scheduler_proxy<boost::asynchronous::threadpool_scheduler<
+                                                                        boost::asynchronous::lockfree_queue<>>>(4);
+    auto data = std::make_shared<std::vector<std::vector<counted>>>(make_nested(10000,10));
+    std::future<void> fu = boost::asynchronous::post_future(scheduler,
+    [data]()
+    {
+        return boost::asynchronous::parallel_destroy(std::move(*data),100);
+    },"test_parallel_destroy_nested",0);
+    fu.get();
+    BOOST_CHECK_MESSAGE(destroyed.load() == 100000,"wrong number destroyed: " << destroyed.load());
+    std::lock_guard<std::mutex> lock(threads_mutex);
+    BOOST_CHECK_MESSAGE(destroying_threads.count(boost::this_thread::get_id()) == 0,"destroyed in caller thread.");
+}
+
+BOOST_AUTO_TEST_CASE( test_parallel_destroy_map )
+{
+    reset_counters();
+    auto scheduler = boost::asynchronous::make_shared_scheduler_proxy<boost::asynchronous::threadpool_scheduler<
+                                                                        boost::asynchronous::lockfree_queue<>>>(4);
+    auto data = std::make_shared<std::map<std::string,std::vector<counted>>>();
+    for (int i = 0; i < 1000; ++i)
+    {
+        (*data)[std::to_string(i)] = std::vector<counted>(5);
+    }
+    std::future<void> fu = boost::asynchronous::post_future(scheduler,
+    [data]()
+    {
+        return boost::asynchronous::parallel_destroy(std::move(*data),50);
+    },"test_parallel_destroy_map",0);
+    fu.get();
+    BOOST_CHECK_MESSAGE(destroyed.load() == 5000,"wrong number destroyed: " << destroyed.load());
+}
+
+BOOST_AUTO_TEST_CASE( test_deferred_destroy )
+{
+    reset_counters();
+    auto scheduler = boost::asynchronous::make_shared_scheduler_proxy<boost::asynchronous::threadpool_scheduler<
+                                                                        boost::asynchronous::lockfree_queue<>>>(4);
+    auto data = make_nested(1000,10);
+    boost::asynchronous::deferred_destroy(scheduler,std::move(data));
+    // not a container
+    boost::asynchronous::deferred_destroy(scheduler,counted());
+    BOOST_CHECK_MESSAGE(wait_destroyed(10001),"wrong number destroyed: " << destroyed.load());
+    std::lock_guard<std::mutex> lock(threads_mutex);
+    BOOST_CHECK_MESSAGE(destroying_threads.count(boost::this_thread::get_id()) == 0,"destroyed in caller thread.");
+}
+
+BOOST_AUTO_TEST_CASE( test_deferred_destroy_servant )
+{
+    reset_counters();
+    {
+        auto scheduler = boost::asynchronous::make_shared_scheduler_proxy<boost::asynchronous::single_thread_scheduler<
+                                                                            boost::asynchronous::lockfree_queue<>>>();
+        auto pool = boost::asynchronous::make_shared_scheduler_proxy<boost::asynchronous::threadpool_scheduler<
+                                                                        boost::asynchronous::lockfree_queue<>>>(2);
+        ServantProxy proxy(scheduler,pool);
+        proxy.drop_result().get();
+        BOOST_CHECK_MESSAGE(wait_destroyed(10000),"wrong number destroyed: " << destroyed.load());
+    }
+    std::lock_guard<std::mutex> lock(threads_mutex);
+    BOOST_CHECK_MESSAGE(destroying_threads.count(servant_thread_id) == 0,"destroyed in servant thread.");
+}
@@ -286,3 +286,40 @@ BOOST_AUTO_TEST_CASE( test_parallel_equal2_false )
 }
 
 
+
+BOOST_AUTO_TEST_CASE( test_parallel_equal_many_differences )
+{
+    // differences everywhere, small cutoff => the first difference found cancels the remaining tasks
+    auto data = std::make_shared<std::vector<int>>(100000,1);
+    std::mt19937 mt(42);
+    std::uniform_int_distribution<> dis(0, 100);
+    std::generate(data->begin(), data->end(), std::bind(dis, std::ref(mt)));
+    auto data2 = std::make_shared<std::vector<int>>(*data);
+    for (std::size_t i = 500; i < data2->size(); i += 1000)
+    {
+        ++(*data2)[i];
+    }
+    auto same = std::make_shared<std::vector<int>>(*data);
+
+    auto scheduler = boost::asynchronous::make_shared_scheduler_proxy<boost::asynchronous::threadpool_scheduler<
+                                                                        boost::asynchronous::lockfree_queue<>>>(6);
+    for (int i = 0; i < 10; ++i)
+    {
+        std::future<bool> fu = boost::asynchronous::post_future(
+            scheduler,
+            [data,data2]()
+            {
+                return boost::asynchronous::parallel_equal(data->begin(),data->end(),data2->begin(),100);
+            },
+            "test_parallel_equal_many_differences",0);
+        BOOST_CHECK_MESSAGE(!fu.get(),"parallel_equal missed a difference.");
+        std::future<bool> fu2 = boost::asynchronous::post_future(
+            scheduler,
+            [data,same]()
+            {
+                return boost::asynchronous::parallel_equal(data->begin(),data->end(),same->begin(),100);
+            },
+            "test_parallel_equal_many_differences",0);
+        BOOST_CHECK_MESSAGE(fu2.get(),"parallel_equal found a wrong difference.");
+    }
+}
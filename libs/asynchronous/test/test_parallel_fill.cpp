@@ -286,3 +286,27 @@ BOOST_AUTO_TEST_CASE( test_parallel_fill_range3 )
     BOOST_CHECK_MESSAGE(servant_dtor,"servant dtor not called.");
 }
 
+BOOST_AUTO_TEST_CASE( test_parallel_fill_trivial_pattern )
+{
+    // a value which is not made of a single byte, on a range not aligned on 16 bytes
+    auto scheduler = boost::asynchronous::make_shared_scheduler_proxy<boost::asynchronous::threadpool_scheduler<
+                                                                        boost::asynchronous::lockfree_queue<>>>(4);
+    auto data = std::make_shared<std::vector<int>>(100003,1);
+    std::future<void> fu = boost::asynchronous::post_future(
+        scheduler,
+        [data]()
+        {
+            return boost::asynchronous::parallel_fill(data->data() + 1,data->data() + data->size() - 1,0x01020304,997);
+        },
+        "test_parallel_fill_trivial_pattern",0);
+    try
+    {
+        fu.get();
+        BOOST_CHECK_MESSAGE(std::all_of(data->begin() + 1,data->end() - 1,[](int v){return v == 0x01020304;}),"Not all elements were set properly.");
+        BOOST_CHECK_MESSAGE(data->front() == 1 && data->back() == 1,"parallel_fill wrote outside of range.");
+    }
+    catch(...)
+    {
+        BOOST_FAIL( "unexpected exception" );
+    }
+}
@@ -8,6 +8,7 @@
 // For more information, see http://www.boost.org
 
 #include <vector>
+#include <numeric>
 #include <set>
 #include <string>
 #include <future>
@@ -326,3 +327,21 @@ BOOST_AUTO_TEST_CASE( test_parallel_find_all_range3 )
     BOOST_CHECK_MESSAGE(servant_dtor,"servant dtor not called.");
 }
 
+BOOST_AUTO_TEST_CASE( test_parallel_find_all_dense )
+{
+    // most elements found, small cutoff
+    auto scheduler = boost::asynchronous::make_shared_scheduler_proxy<boost::asynchronous::threadpool_scheduler<
+                                                                        boost::asynchronous::lockfree_queue<>>>(6);
+    auto data = std::make_shared<std::vector<int>>(100000);
+    std::iota(data->begin(),data->end(),0);
+    std::future<std::vector<int>> fu = boost::asynchronous::post_future(
+        scheduler,
+        [data]()
+        {
+            return boost::asynchronous::parallel_find_all(data->begin(),data->end(),[](int i){return i % 10 != 0;},100);
+        },
+        "test_parallel_find_all_dense",0);
+    std::vector<int> expected;
+    std::copy_if(data->begin(),data->end(),std::back_inserter(expected),[](int i){return i % 10 != 0;});
+    BOOST_CHECK_MESSAGE(fu.get() == expected,"parallel_find_all gave wrong result.");
+}
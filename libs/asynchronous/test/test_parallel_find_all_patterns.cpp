@@ -0,0 +1,176 @@
+// Boost.Asynchronous library
+//  Copyright (C) Christophe Henry 2026
+//
+//  Use, modification and distribution is subject to the Boost
+//  Software License, Version 1.0.  (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// For more information, see http://www.boost.org
+
+#include <vector>
+#include <string>
+#include <random>
+#include <future>
+
+#include <boost/asynchronous/queue/lockfree_queue.hpp>
+#include <boost/asynchronous/scheduler_shared_proxy.hpp>
+#include <boost/asynchronous/scheduler/threadpool_scheduler.hpp>
+
+#include <boost/asynchronous/post.hpp>
+#include <boost/asynchronous/algorithm/parallel_for.hpp>
+#include <boost/asynchronous/algorithm/parallel_find_all_patterns.hpp>
+
+#include "test_common.hpp"
+
+#include <boost/test/unit_test.hpp>
+using namespace boost::asynchronous::test;
+
+namespace
+{
+typedef std::vector<std::pair<std::size_t,std::size_t>> matches_type;
+
+// naive reference implementation
+template <class Text, class Patterns>
+matches_type find_all_patterns(Text const& text, Patterns const& patterns)
+{
+    matches_type res;
+    for (std::size_t pos = 0; pos < text.size(); ++pos)
+    {
+        for (std::size_t id = 0; id < patterns.size(); ++id)
+        {
+            auto const& p = patterns[id];
+            if (!p.empty() && pos + p.size() <= text.size() && std::equal(p.begin(),p.end(),text.begin() + pos))
+            {
+                res.emplace_back(pos,id);
+            }
+        }
+    }
+    return res;
+}
+
+std::string generate_text(std::size_t size)
+{
+    std::string text(size,'a');
+    std::mt19937 mt(static_cast<unsigned int>(std::time(nullptr)));
+    std::uniform_int_distribution<> dis(0, 3);
+    for (auto& c : text)
+    {
+        c = static_cast<char>('a' + dis(mt));
+    }
+    return text;
+}
+}
+
+BOOST_AUTO_TEST_CASE( test_parallel_find_all_patterns_string )
+{
+    auto scheduler = boost::asynchronous::make_shared_scheduler_proxy<boost::asynchronous::threadpool_scheduler<
+                                                                        boost::asynchronous::lockfree_queue<>>>(6);
+    auto text = std::make_shared<std::string>(generate_text(100000));
+    // overlapping patterns, prefixes and suffixes of each other, one empty and one never found
+    auto patterns = std::make_shared<std::vector<std::string>>(
+                std::vector<std::string>{"abc","bc","c","dddd","abcdabcd","","xyz","cab","a"});
+    std::future<matches_type> fu = boost::asynchronous::post_future(
+        scheduler,
+        [text,patterns]()
+        {
+            return boost::asynchronous::parallel_find_all_patterns(text->begin(),text->end(),*patterns,1000);
+        },
+        "test_parallel_find_all_patterns_string",0);
+    matches_type res;
+    try
+    {
+        res = fu.get();
+    }
+    catch(...)
+    {
+        BOOST_FAIL( "unexpected exception" );
+    }
+    BOOST_CHECK_MESSAGE(!res.empty(),"parallel_find_all_patterns should have found matches.");
+    BOOST_CHECK_MESSAGE(res == find_all_patterns(*text,*patterns),"parallel_find_all_patterns found wrong matches.");
+}
+
+BOOST_AUTO_TEST_CASE( test_parallel_find_all_patterns_single_first_symbol )
+{
+    // all patterns start with the same symbol => the automaton skips using memchr
+    auto scheduler = boost::asynchronous::make_shared_scheduler_proxy<boost::asynchronous::threadpool_scheduler<
+                                                                        boost::asynchronous::lockfree_queue<>>>(6);
+    auto text = std::make_shared<std::vector<char>>();
+    std::string s = generate_text(50000);
+    text->assign(s.begin(),s.end());
+    auto patterns = std::make_shared<std::vector<std::string>>(std::vector<std::string>{"dab","dd","dcba"});
+    std::future<matches_type> fu = boost::asynchronous::post_future(
+        scheduler,
+        [text,patterns]()
+        {
+            return boost::asynchronous::parallel_find_all_patterns(text->begin(),text->end(),*patterns,100);
+        },
+        "test_parallel_find_all_patterns_single_first_symbol",0);
+    matches_type res;
+    try
+    {
+        res = fu.get();
+    }
+    catch(...)
+    {
+        BOOST_FAIL( "unexpected exception" );
+    }
+    BOOST_CHECK_MESSAGE(res == find_all_patterns(*text,*patterns),"parallel_find_all_patterns found wrong matches.");
+}
+
+BOOST_AUTO_TEST_CASE( test_parallel_find_all_patterns_int_continuation )
+{
+    auto scheduler = boost::asynchronous::make_shared_scheduler_proxy<boost::asynchronous::threadpool_scheduler<
+                                                                        boost::asynchronous::lockfree_queue<>>>(6);
+    std::vector<int> data(50000);
+    std::mt19937 mt(static_cast<unsigned int>(std::time(nullptr)));
+    std::uniform_int_distribution<> dis(0, 5);
+    std::generate(data.begin(), data.end(), std::bind(dis, std::ref(mt)));
+    auto patterns = std::make_shared<std::vector<std::vector<int>>>(
+                std::vector<std::vector<int>>{{1,2,3},{3,3},{5,4,3,2}});
+    std::future<matches_type> fu = boost::asynchronous::post_future(
+        scheduler,
+        [data,patterns]()mutable
+        {
+            return boost::asynchronous::parallel_find_all_patterns(
+                        boost::asynchronous::parallel_for(std::move(data),[](int const&){},1000),
+                        *patterns,1000);
+        },
+        "test_parallel_find_all_patterns_int_continuation",0);
+    matches_type res;
+    try
+    {
+        res = fu.get();
+    }
+    catch(...)
+    {
+        BOOST_FAIL( "unexpected exception" );
+    }
+    BOOST_CHECK_MESSAGE(res == find_all_patterns(data,*patterns),"parallel_find_all_patterns found wrong matches.");
+}
+
+BOOST_AUTO_TEST_CASE( test_parallel_find_all_patterns_continuation_exception )
+{
+    auto scheduler = boost::asynchronous::make_shared_scheduler_proxy<boost::asynchronous::threadpool_scheduler<
+                                                                        boost::asynchronous::lockfree_queue<>>>(6);
+    std::vector<int> data(50000,1);
+    auto patterns = std::make_shared<std::vector<std::vector<int>>>(std::vector<std::vector<int>>{{1,2,3}});
+    std::future<matches_type> fu = boost::asynchronous::post_future(
+        scheduler,
+        [data,patterns]()mutable
+        {
+            return boost::asynchronous::parallel_find_all_patterns(
+                        boost::asynchronous::parallel_for(std::move(data),[](int const&){throw std::runtime_error("parallel_for failed");},1000),
+                        *patterns,1000);
+        },
+        "test_parallel_find_all_patterns_continuation_exception",0);
+    bool failed = false;
+    try
+    {
+        fu.get();
+    }
+    catch(std::runtime_error const&)
+    {
+        failed = true;
+    }
+    BOOST_CHECK_MESSAGE(failed,"exception of the continuation not forwarded.");
+}
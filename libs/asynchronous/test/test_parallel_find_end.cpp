@@ -10,6 +10,7 @@
 // For more information, see http://www.boost.org
 
 #include <vector>
+#include <string>
 #include <set>
 #include <random>
 #include <future>
@@ -399,3 +400,41 @@ BOOST_AUTO_TEST_CASE( test_parallel_find_end_continuation )
     }
     BOOST_CHECK_MESSAGE(servant_dtor,"servant dtor not called.");
 }
+
+BOOST_AUTO_TEST_CASE( test_parallel_find_end_bytes_and_long_needles )
+{
+    // char ranges use the byte fast path, long int needles Boyer-Moore-Horspool
+    std::mt19937 mt(static_cast<unsigned int>(std::time(nullptr)));
+    std::uniform_int_distribution<> dis(0, 3);
+    auto text = std::make_shared<std::string>(100000,'a');
+    std::generate(text->begin(), text->end(), [&](){return static_cast<char>('a' + dis(mt));});
+    auto data = std::make_shared<std::vector<int>>(text->begin(),text->end());
+
+    auto scheduler = boost::asynchronous::make_shared_scheduler_proxy<boost::asynchronous::threadpool_scheduler<
+                                                                        boost::asynchronous::lockfree_queue<>>>(6);
+    for (std::size_t len : {1u,2u,3u,5u,9u,17u})
+    {
+        // needle taken from the text so that it is found at least once
+        auto needle = std::make_shared<std::string>(text->substr(text->size() - len - 10,len));
+        auto needle2 = std::make_shared<std::vector<int>>(needle->begin(),needle->end());
+        std::future<std::string::iterator> fu = boost::asynchronous::post_future(
+            scheduler,
+            [text,needle]()
+            {
+                return boost::asynchronous::parallel_find_end(text->begin(),text->end(),needle->begin(),needle->end(),1000);
+            },
+            "test_parallel_find_end_bytes",0);
+        auto it = std::find_end(text->begin(),text->end(),needle->begin(),needle->end());
+        BOOST_CHECK_MESSAGE(it == fu.get(),"parallel_find_end found wrong value in string.");
+
+        std::future<std::vector<int>::iterator> fu2 = boost::asynchronous::post_future(
+            scheduler,
+            [data,needle2]()
+            {
+                return boost::asynchronous::parallel_find_end(data->begin(),data->end(),needle2->begin(),needle2->end(),1000);
+            },
+            "test_parallel_find_end_long_needle",0);
+        auto it2 = std::find_end(data->begin(),data->end(),needle2->begin(),needle2->end());
+        BOOST_CHECK_MESSAGE(it2 == fu2.get(),"parallel_find_end found wrong value in vector.");
+    }
+}
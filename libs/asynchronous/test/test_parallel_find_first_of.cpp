@@ -335,3 +335,28 @@ BOOST_AUTO_TEST_CASE( test_parallel_find_first_of_continuation )
     }
     BOOST_CHECK_MESSAGE(servant_dtor,"servant dtor not called.");
 }
+
+BOOST_AUTO_TEST_CASE( test_parallel_find_first_of_many_matches )
+{
+    // many matches everywhere, small cutoff => most tasks right of the first match get cancelled
+    auto data = std::make_shared<std::vector<int>>(100000,1);
+    std::mt19937 mt(static_cast<unsigned int>(std::time(nullptr)));
+    std::uniform_int_distribution<> dis(0, 100);
+    std::generate(data->begin(), data->end(), std::bind(dis, std::ref(mt)));
+    auto data2 = std::make_shared<std::vector<int>>(std::vector<int>{100,99});
+
+    auto scheduler = boost::asynchronous::make_shared_scheduler_proxy<boost::asynchronous::threadpool_scheduler<
+                                                                        boost::asynchronous::lockfree_queue<>>>(6);
+    for (int i = 0; i < 10; ++i)
+    {
+        std::future<std::vector<int>::iterator> fu = boost::asynchronous::post_future(
+            scheduler,
+            [data,data2]()
+            {
+                return boost::asynchronous::parallel_find_first_of(data->begin(),data->end(),data2->begin(),data2->end(),100);
+            },
+            "test_parallel_find_first_of_many_matches",0);
+        auto it = std::find_first_of(data->begin(),data->end(),data2->begin(),data2->end());
+        BOOST_CHECK_MESSAGE(it == fu.get(),"parallel_find_first_of found wrong value.");
+    }
+}
@@ -0,0 +1,123 @@
+// Boost.Asynchronous library
+//  Copyright (C) Christophe Henry 2026
+//
+//  Use, modification and distribution is subject to the Boost
+//  Software License, Version 1.0.  (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// For more information, see http://www.boost.org
+
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <vector>
+#include <future>
+
+#include <boost/asynchronous/algorithm/parallel_generate.hpp>
+#include <boost/asynchronous/helpers/philox_engine.hpp>
+#include <boost/asynchronous/queue/lockfree_queue.hpp>
+#include <boost/asynchronous/scheduler_shared_proxy.hpp>
+#include <boost/asynchronous/scheduler/threadpool_scheduler.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+namespace
+{
+template <class T, class Distribution>
+std::vector<T> generate_in(std::size_t threads, std::size_t size, Distribution distribution, std::uint64_t seed, long cutoff)
+{
+    auto scheduler = boost::asynchronous::make_shared_scheduler_proxy<boost::asynchronous::threadpool_scheduler<
+                                                                        boost::asynchronous::lockfree_queue<>>>(threads);
+    auto data = std::make_shared<std::vector<T>>(size);
+    std::future<void> fu = boost::asynchronous::post_future(scheduler,
+    [data,distribution,seed,cutoff]()
+    {
+        return boost::asynchronous::parallel_generate_random(data->begin(),data->end(),distribution,seed,cutoff);
+    },"test_parallel_generate_random",0);
+    fu.get();
+    return *data;
+}
+}
+
+// known answers of the Random123 reference implementation
+BOOST_AUTO_TEST_CASE( test_philox4x32_known_answers )
+{
+    typedef boost::asynchronous::philox4x32 engine;
+    BOOST_CHECK((engine::block({{0,0,0,0}},{{0,0}}) ==
+                 engine::counter_type{{0x6627e8d5u,0xe169c58du,0xbc57ac4cu,0x9b00dbd8u}}));
+    BOOST_CHECK((engine::block({{0xffffffffu,0xffffffffu,0xffffffffu,0xffffffffu}},{{0xffffffffu,0xffffffffu}}) ==
+                 engine::counter_type{{0x408f276du,0x41c83b0eu,0xa20bc7c6u,0x6d5451fdu}}));
+    BOOST_CHECK((engine::block({{0x243f6a88u,0x85a308d3u,0x13198a2eu,0x03707344u}},{{0xa4093822u,0x299f31d0u}}) ==
+                 engine::counter_type{{0xd16cfe09u,0x94fdccebu,0x5001e420u,0x24126ea1u}}));
+}
+
+BOOST_AUTO_TEST_CASE( test_philox4x32_discard_and_streams )
+{
+    boost::asynchronous::philox4x32 e1(42,7);
+    std::vector<std::uint32_t> seq;
+    for (int i = 0; i < 23; ++i)
+    {
+        seq.push_back(e1());
+    }
+    for (unsigned long long skip = 0; skip < 20; ++skip)
+    {
+        boost::asynchronous::philox4x32 e2(42,7);
+        e2.discard(skip);
+        BOOST_CHECK_MESSAGE(e2() == seq[skip],"wrong value after discard(" << skip << ")");
+        e2.discard(2);
+        BOOST_CHECK_MESSAGE(e2() == seq[skip + 3],"wrong value after second discard, start " << skip);
+    }
+    boost::asynchronous::philox4x32 e3(42,7);
+    e3.discard(5);
+    boost::asynchronous::philox4x32 e4(42,7);
+    for (int i = 0; i < 5; ++i)
+    {
+        e4();
+    }
+    BOOST_CHECK(e3 == e4);
+
+    boost::asynchronous::philox4x32 other_stream(42,8);
+    boost::asynchronous::philox4x32 other_seed(43,7);
+    BOOST_CHECK(other_stream() != seq[0]);
+    BOOST_CHECK(other_seed() != seq[0]);
+
+    // precomputed first blocks give the same engine
+    std::uint32_t w0[3], w1[3], w2[3], w3[3];
+    boost::asynchronous::philox4x32::first_blocks(42,6,3,w0,w1,w2,w3);
+    boost::asynchronous::philox4x32 e5(42,7,{{w0[1],w1[1],w2[1],w3[1]}});
+    for (int i = 0; i < 10; ++i)
+    {
+        BOOST_CHECK(e5() == seq[i]);
+    }
+}
+
+BOOST_AUTO_TEST_CASE( test_parallel_generate_random_reproducible )
+{
+    std::uniform_int_distribution<int> distribution(0,1000000);
+    std::vector<int> reference(10000);
+    for (std::size_t i = 0; i < reference.size(); ++i)
+    {
+        boost::asynchronous::philox4x32 engine(1234,i);
+        std::uniform_int_distribution<int> d(distribution);
+        reference[i] = d(engine);
+    }
+    BOOST_CHECK(generate_in<int>(1,10000,distribution,1234,10000) == reference);
+    BOOST_CHECK(generate_in<int>(4,10000,distribution,1234,100) == reference);
+    BOOST_CHECK(generate_in<int>(3,10000,distribution,1234,77) == reference);
+    BOOST_CHECK(generate_in<int>(4,10000,distribution,4321,100) != reference);
+}
+
+BOOST_AUTO_TEST_CASE( test_parallel_generate_random_normal )
+{
+    // normal_distribution keeps a second value between calls, it must not leak to the next element
+    std::normal_distribution<double> distribution(5.0,2.0);
+    std::vector<double> v1 = generate_in<double>(1,20001,distribution,99,20001);
+    std::vector<double> v2 = generate_in<double>(4,20001,distribution,99,33);
+    BOOST_CHECK(v1 == v2);
+    double sum = 0.0;
+    for (double d : v1)
+    {
+        sum += d;
+    }
+    BOOST_CHECK_MESSAGE(std::abs(sum / v1.size() - 5.0) < 0.1,"unexpected mean: " << sum / v1.size());
+}
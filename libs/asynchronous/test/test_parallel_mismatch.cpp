@@ -302,3 +302,35 @@ BOOST_AUTO_TEST_CASE( test_parallel_mismatch2_normal )
 }
 
 
+
+BOOST_AUTO_TEST_CASE( test_parallel_mismatch_many_differences )
+{
+    // differences everywhere, small cutoff => most tasks right of the first difference get cancelled
+    auto data = std::make_shared<std::vector<int>>(100000,1);
+    std::mt19937 mt(42);
+    std::uniform_int_distribution<> dis(0, 100);
+    std::generate(data->begin(), data->end(), std::bind(dis, std::ref(mt)));
+    auto data2 = std::make_shared<std::vector<int>>(*data);
+    for (std::size_t i = 1234; i < data2->size(); i += 1000)
+    {
+        ++(*data2)[i];
+    }
+
+    auto scheduler = boost::asynchronous::make_shared_scheduler_proxy<boost::asynchronous::threadpool_scheduler<
+                                                                        boost::asynchronous::lockfree_queue<>>>(6);
+    using iterator = std::vector<int>::iterator;
+    for (int i = 0; i < 10; ++i)
+    {
+        std::future<std::pair<iterator,iterator>> fu = boost::asynchronous::post_future(
+            scheduler,
+            [data,data2]()
+            {
+                return boost::asynchronous::parallel_mismatch(data->begin(),data->end(),data2->begin(),100);
+            },
+            "test_parallel_mismatch_many_differences",0);
+        auto expected = std::mismatch(data->begin(),data->end(),data2->begin());
+        auto res = fu.get();
+        BOOST_CHECK_MESSAGE(expected.first == res.first,"parallel_mismatch found wrong first value.");
+        BOOST_CHECK_MESSAGE(expected.second == res.second,"parallel_mismatch found wrong second value.");
+    }
+}
@@ -10,6 +10,7 @@
 // For more information, see http://www.boost.org
 
 #include <vector>
+#include <string>
 #include <set>
 #include <random>
 #include <future>
@@ -401,3 +402,94 @@ BOOST_AUTO_TEST_CASE( test_parallel_search_continuation )
     }
     BOOST_CHECK_MESSAGE(servant_dtor,"servant dtor not called.");
 }
+
+BOOST_AUTO_TEST_CASE( test_parallel_search_many_matches )
+{
+    // many matches everywhere, small cutoff => most tasks right of the first match get cancelled
+    auto data = std::make_shared<std::vector<int>>(100000,1);
+    std::mt19937 mt(static_cast<unsigned int>(std::time(nullptr)));
+    std::uniform_int_distribution<> dis(0, 10);
+    std::generate(data->begin(), data->end(), std::bind(dis, std::ref(mt)));
+    auto data2 = std::make_shared<std::vector<int>>(std::vector<int>{3,4,5});
+
+    auto scheduler = boost::asynchronous::make_shared_scheduler_proxy<boost::asynchronous::threadpool_scheduler<
+                                                                        boost::asynchronous::lockfree_queue<>>>(6);
+    for (int i = 0; i < 10; ++i)
+    {
+        std::future<std::vector<int>::iterator> fu = boost::asynchronous::post_future(
+            scheduler,
+            [data,data2]()
+            {
+                return boost::asynchronous::parallel_search(data->begin(),data->end(),data2->begin(),data2->end(),100);
+            },
+            "test_parallel_search_many_matches",0);
+        auto it = std::search(data->begin(),data->end(),data2->begin(),data2->end());
+        BOOST_CHECK_MESSAGE(it == fu.get(),"parallel_search found wrong value.");
+    }
+}
+
+BOOST_AUTO_TEST_CASE( test_parallel_search_bytes_and_long_needles )
+{
+    // char ranges use the byte fast path, long int needles Boyer-Moore-Horspool
+    std::mt19937 mt(static_cast<unsigned int>(std::time(nullptr)));
+    std::uniform_int_distribution<> dis(0, 3);
+    auto text = std::make_shared<std::string>(100000,'a');
+    std::generate(text->begin(), text->end(), [&](){return static_cast<char>('a' + dis(mt));});
+    auto data = std::make_shared<std::vector<int>>(text->begin(),text->end());
+
+    auto scheduler = boost::asynchronous::make_shared_scheduler_proxy<boost::asynchronous::threadpool_scheduler<
+                                                                        boost::asynchronous::lockfree_queue<>>>(6);
+    for (std::size_t len : {1u,2u,3u,5u,9u,17u})
+    {
+        // needle taken from the text so that it is found at least once
+        auto needle = std::make_shared<std::string>(text->substr(text->size() - len - 10,len));
+        auto needle2 = std::make_shared<std::vector<int>>(needle->begin(),needle->end());
+        std::future<std::string::iterator> fu = boost::asynchronous::post_future(
+            scheduler,
+            [text,needle]()
+            {
+                return boost::asynchronous::parallel_search(text->begin(),text->end(),needle->begin(),needle->end(),1000);
+            },
+            "test_parallel_search_bytes",0);
+        auto it = std::search(text->begin(),text->end(),needle->begin(),needle->end());
+        BOOST_CHECK_MESSAGE(it == fu.get(),"parallel_search found wrong value in string.");
+
+        std::future<std::vector<int>::iterator> fu2 = boost::asynchronous::post_future(
+            scheduler,
+            [data,needle2]()
+            {
+                return boost::asynchronous::parallel_search(data->begin(),data->end(),needle2->begin(),needle2->end(),1000);
+            },
+            "test_parallel_search_long_needle",0);
+        auto it2 = std::search(data->begin(),data->end(),needle2->begin(),needle2->end());
+        BOOST_CHECK_MESSAGE(it2 == fu2.get(),"parallel_search found wrong value in vector.");
+    }
+}
+
+BOOST_AUTO_TEST_CASE( test_parallel_search_mixed_byte_types )
+{
+    // char and unsigned char compare after promotion, not as bytes: (char)-1 != (unsigned char)255
+    auto text = std::make_shared<std::vector<char>>(100000,'a');
+    for (std::size_t i = 1000; i < text->size(); i += 1000)
+    {
+        (*text)[i] = static_cast<char>(-1);
+    }
+    (*text)[text->size() - 10] = static_cast<char>(127);
+    auto needle = std::make_shared<std::vector<unsigned char>>(std::vector<unsigned char>{255});
+    auto needle2 = std::make_shared<std::vector<unsigned char>>(std::vector<unsigned char>{127});
+
+    auto scheduler = boost::asynchronous::make_shared_scheduler_proxy<boost::asynchronous::threadpool_scheduler<
+                                                                        boost::asynchronous::lockfree_queue<>>>(6);
+    for (auto n : {needle,needle2})
+    {
+        std::future<std::vector<char>::iterator> fu = boost::asynchronous::post_future(
+            scheduler,
+            [text,n]()
+            {
+                return boost::asynchronous::parallel_search(text->begin(),text->end(),n->begin(),n->end(),1000);
+            },
+            "test_parallel_search_mixed_byte_types",0);
+        auto it = std::search(text->begin(),text->end(),n->begin(),n->end());
+        BOOST_CHECK_MESSAGE(it == fu.get(),"parallel_search found wrong value.");
+    }
+}
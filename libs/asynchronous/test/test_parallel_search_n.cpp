@@ -318,3 +318,28 @@ BOOST_AUTO_TEST_CASE( test_parallel_search_n_ok_no_fct )
 }
 
 
+
+BOOST_AUTO_TEST_CASE( test_parallel_search_n_many_matches )
+{
+    // many matches everywhere, small cutoff => most tasks right of the first match get cancelled
+    auto data = std::make_shared<std::vector<int>>(100000,1);
+    std::mt19937 mt(42);
+    std::uniform_int_distribution<> dis(0, 20);
+    std::generate(data->begin(), data->end(), std::bind(dis, std::ref(mt)));
+
+    auto scheduler = boost::asynchronous::make_shared_scheduler_proxy<boost::asynchronous::threadpool_scheduler<
+                                                                        boost::asynchronous::lockfree_queue<>>>(6);
+    for (int i = 0; i < 10; ++i)
+    {
+        std::future<std::vector<int>::iterator> fu = boost::asynchronous::post_future(
+            scheduler,
+            [data]()
+            {
+                return boost::asynchronous::parallel_search_n(data->begin(),data->end(),2,5,100);
+            },
+            "test_parallel_search_n_many_matches",0);
+        auto it = std::search_n(data->begin(),data->end(),2,5);
+        BOOST_CHECK_MESSAGE(it != data->end(),"test data without match.");
+        BOOST_CHECK_MESSAGE(it == fu.get(),"parallel_search_n found wrong value.");
+    }
+}
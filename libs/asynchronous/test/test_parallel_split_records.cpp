@@ -0,0 +1,156 @@
+// Boost.Asynchronous library
+//  Copyright (C) Christophe Henry 2026
+//
+//  Use, modification and distribution is subject to the Boost
+//  Software License, Version 1.0.  (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// For more information, see http://www.boost.org
+
+#include <vector>
+#include <string>
+#include <string_view>
+#include <random>
+#include <future>
+#include <fstream>
+#include <filesystem>
+
+#include <boost/asynchronous/queue/lockfree_queue.hpp>
+#include <boost/asynchronous/scheduler_shared_proxy.hpp>
+#include <boost/asynchronous/scheduler/threadpool_scheduler.hpp>
+
+#include <boost/asynchronous/post.hpp>
+#include <boost/asynchronous/helpers/mapped_file.hpp>
+#include <boost/asynchronous/algorithm/parallel_split_records.hpp>
+#include <boost/asynchronous/algorithm/parallel_count.hpp>
+
+#include "test_common.hpp"
+
+#include <boost/test/unit_test.hpp>
+using namespace boost::asynchronous::test;
+
+namespace
+{
+// serial reference
+std::vector<std::string_view> split(std::string_view text, char delimiter)
+{
+    std::vector<std::string_view> res;
+    while (!text.empty())
+    {
+        auto pos = text.find(delimiter);
+        if (pos == std::string_view::npos)
+        {
+            res.push_back(text);
+            break;
+        }
+        res.push_back(text.substr(0,pos));
+        text.remove_prefix(pos + 1);
+    }
+    return res;
+}
+
+// lines of random length, some of them empty
+std::string generate_lines(std::size_t lines, char delimiter)
+{
+    std::mt19937 mt(static_cast<unsigned int>(std::time(nullptr)));
+    std::uniform_int_distribution<> len(0, 80);
+    std::uniform_int_distribution<> letter(0, 25);
+    std::string text;
+    for (std::size_t i = 0; i < lines; ++i)
+    {
+        int l = len(mt);
+        for (int j = 0; j < l; ++j)
+        {
+            text.push_back(static_cast<char>('a' + letter(mt)));
+        }
+        text.push_back(delimiter);
+    }
+    return text;
+}
+}
+
+BOOST_AUTO_TEST_CASE( test_parallel_split_records_string )
+{
+    auto scheduler = boost::asynchronous::make_shared_scheduler_proxy<boost::asynchronous::threadpool_scheduler<
+                                                                        boost::asynchronous::lockfree_queue<>>>(6);
+    // last record without delimiter
+    auto text = std::make_shared<std::string>(generate_lines(10000,';') + "last");
+    std::future<std::vector<std::string_view>> fu = boost::asynchronous::post_future(
+        scheduler,
+        [text]()
+        {
+            return boost::asynchronous::parallel_split_records(*text,';',1000);
+        },
+        "test_parallel_split_records_string",0);
+    try
+    {
+        auto res = fu.get();
+        BOOST_CHECK_MESSAGE(res == split(*text,';'),"parallel_split_records gave wrong records.");
+        BOOST_CHECK_MESSAGE(res.back() == "last","parallel_split_records lost the last record.");
+    }
+    catch(...)
+    {
+        BOOST_FAIL( "unexpected exception" );
+    }
+}
+
+BOOST_AUTO_TEST_CASE( test_parallel_split_records_mapped_file )
+{
+    auto scheduler = boost::asynchronous::make_shared_scheduler_proxy<boost::asynchronous::threadpool_scheduler<
+                                                                        boost::asynchronous::lockfree_queue<>>>(6);
+    std::string text = generate_lines(20000,'\n');
+    auto path = (std::filesystem::temp_directory_path() / "test_parallel_split_records.txt").string();
+    {
+        std::ofstream out(path,std::ios::binary);
+        out << text;
+    }
+    {
+        auto file = std::make_shared<boost::asynchronous::mapped_file>(path);
+        BOOST_CHECK_MESSAGE(file->view() == text,"mapped_file has wrong content.");
+        // records are given directly to another algorithm
+        std::future<long> fu = boost::asynchronous::post_future(
+            scheduler,
+            [file]()
+            {
+                return boost::asynchronous::parallel_count_if(
+                            boost::asynchronous::parallel_split_records(*file,'\n',4096),
+                            [](std::string_view record){return record.empty();},
+                            1000);
+            },
+            "test_parallel_split_records_mapped_file",0);
+        auto records = split(text,'\n');
+        long empty_records = std::count_if(records.begin(),records.end(),[](std::string_view record){return record.empty();});
+        try
+        {
+            BOOST_CHECK_MESSAGE(fu.get() == empty_records,"parallel_split_records + parallel_count_if gave wrong count.");
+        }
+        catch(...)
+        {
+            BOOST_FAIL( "unexpected exception" );
+        }
+    }
+    std::filesystem::remove(path);
+}
+
+BOOST_AUTO_TEST_CASE( test_parallel_split_records_empty_file )
+{
+    auto scheduler = boost::asynchronous::make_shared_scheduler_proxy<boost::asynchronous::threadpool_scheduler<
+                                                                        boost::asynchronous::lockfree_queue<>>>(2);
+    auto path = (std::filesystem::temp_directory_path() / "test_parallel_split_records_empty.txt").string();
+    {
+        std::ofstream out(path,std::ios::binary);
+    }
+    {
+        auto file = std::make_shared<boost::asynchronous::mapped_file>(path);
+        BOOST_CHECK_MESSAGE(file->empty(),"mapped_file should be empty.");
+        std::future<std::vector<std::string_view>> fu = boost::asynchronous::post_future(
+            scheduler,
+            [file]()
+            {
+                return boost::asynchronous::parallel_split_records(*file,'\n',1000);
+            },
+            "test_parallel_split_records_empty_file",0);
+        BOOST_CHECK_MESSAGE(fu.get().empty(),"no record expected in empty file.");
+    }
+    std::filesystem::remove(path);
+}
@@ -12,6 +12,7 @@
 #include <vector>
 #include <set>
 #include <random>
+#include <numeric>
 #include <future>
 
 #include <boost/asynchronous/scheduler/single_thread_scheduler.hpp>
@@ -139,5 +140,32 @@ BOOST_AUTO_TEST_CASE( test_parallel_swap_ranges )
     BOOST_CHECK_MESSAGE(servant_dtor,"servant dtor not called.");
 }
 
-
-
+BOOST_AUTO_TEST_CASE( test_parallel_swap_ranges_trivial )
+{
+    // trivially copyable elements are swapped by blocks
+    auto scheduler = boost::asynchronous::make_shared_scheduler_proxy<boost::asynchronous::threadpool_scheduler<
+                                                                        boost::asynchronous::lockfree_queue<>>>(4);
+    auto data1 = std::make_shared<std::vector<int>>(10007);
+    auto data2 = std::make_shared<std::vector<int>>(10007);
+    std::iota(data1->begin(),data1->end(),0);
+    std::iota(data2->begin(),data2->end(),100000);
+    auto expected1 = *data2;
+    auto expected2 = *data1;
+    std::future<std::vector<int>::iterator> fu = boost::asynchronous::post_future(
+        scheduler,
+        [data1,data2]()
+        {
+            return boost::asynchronous::parallel_swap_ranges(data1->begin(),data1->end(),data2->begin(),333);
+        },
+        "test_parallel_swap_ranges_trivial",0);
+    try
+    {
+        BOOST_CHECK_MESSAGE(fu.get() == data2->end(),"parallel_swap_ranges returned wrong iterator.");
+        BOOST_CHECK_MESSAGE(*data1 == expected1,"parallel_swap_ranges gave wrong result.");
+        BOOST_CHECK_MESSAGE(*data2 == expected2,"parallel_swap_ranges gave wrong result.");
+    }
+    catch(...)
+    {
+        BOOST_FAIL( "unexpected exception" );
+    }
+}
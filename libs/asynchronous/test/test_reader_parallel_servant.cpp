@@ -0,0 +1,231 @@
+// Boost.Asynchronous library
+//  Copyright (C) Christophe Henry 2026
+//
+//  Use, modification and distribution is subject to the Boost
+//  Software License, Version 1.0.  (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// For more information, see http://www.boost.org
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <map>
+#include <vector>
+
+#include <boost/asynchronous/scheduler/single_thread_scheduler.hpp>
+#include <boost/asynchronous/scheduler/threadpool_scheduler.hpp>
+#include <boost/asynchronous/scheduler/reader_parallel_scheduler.hpp>
+#include <boost/asynchronous/queue/lockfree_queue.hpp>
+#include <boost/asynchronous/scheduler_shared_proxy.hpp>
+#include <boost/asynchronous/servant_proxy.hpp>
+#include <boost/asynchronous/trackable_servant.hpp>
+#include <boost/asynchronous/post.hpp>
+
+#include "test_common.hpp"
+#include <boost/test/unit_test.hpp>
+using namespace boost::asynchronous::test;
+
+namespace
+{
+// main thread id
+boost::thread::id main_thread_id;
+std::vector<boost::thread::id> servant_ids;
+std::vector<boost::thread::id> reader_ids;
+std::atomic<int> readers{0};
+std::atomic<int> max_readers{0};
+std::atomic<int> writers{0};
+bool dtor_in_servant_thread = false;
+
+struct Servant : boost::asynchronous::trackable_servant<>
+{
+    Servant(boost::asynchronous::any_weak_scheduler<> scheduler)
+        : boost::asynchronous::trackable_servant<>(scheduler)
+    {
+    }
+    ~Servant()
+    {
+        dtor_in_servant_thread = contains_id(servant_ids.begin(),servant_ids.end(),boost::this_thread::get_id());
+    }
+    void set(int key, int value)
+    {
+        BOOST_CHECK_MESSAGE(contains_id(servant_ids.begin(),servant_ids.end(),boost::this_thread::get_id()),"write not in servant thread");
+        ++writers;
+        BOOST_CHECK_MESSAGE(readers.load() == 0,"write concurrent with a read");
+        m_table[key] = value;
+        --writers;
+    }
+    // posts a write to itself through the scheduler given to the servant
+    void set_later(int key, int value)
+    {
+        post_self([this,key,value](){set(key,value);});
+    }
+    int get(int key, int sleep_ms)const
+    {
+        BOOST_CHECK_MESSAGE(contains_id(reader_ids.begin(),reader_ids.end(),boost::this_thread::get_id()),"read not in reader pool");
+        int r = ++readers;
+        int m = max_readers.load();
+        while (r > m && !max_readers.compare_exchange_weak(m,r)){}
+        BOOST_CHECK_MESSAGE(writers.load() == 0,"read concurrent with a write");
+        if (sleep_ms > 0)
+        {
+            boost::this_thread::sleep(boost::posix_time::milliseconds(sleep_ms));
+        }
+        auto it = m_table.find(key);
+        int res = (it == m_table.end()) ? -1 : it->second;
+        --readers;
+        return res;
+    }
+    std::size_t size()const
+    {
+        return m_table.size();
+    }
+    std::map<int,int> m_table;
+};
+
+class ServantProxy : public boost::asynchronous::servant_proxy<ServantProxy,Servant>
+{
+public:
+    template <class Scheduler>
+    ServantProxy(Scheduler s):
+        boost::asynchronous::servant_proxy<ServantProxy,Servant>(s)
+    {}
+    BOOST_ASYNC_POST_MEMBER(set)
+    BOOST_ASYNC_POST_MEMBER(set_later)
+    BOOST_ASYNC_FUTURE_MEMBER_CONST(get)
+    // existing macros still work, as writes
+    BOOST_ASYNC_FUTURE_MEMBER(size)
+};
+
+boost::asynchronous::any_shared_scheduler_proxy<> make_scheduler()
+{
+    auto s = boost::asynchronous::make_shared_scheduler_proxy<boost::asynchronous::single_thread_scheduler<
+                                                                boost::asynchronous::lockfree_queue<>>>();
+    auto pool = boost::asynchronous::make_shared_scheduler_proxy<boost::asynchronous::threadpool_scheduler<
+                                                                   boost::asynchronous::lockfree_queue<>>>(4);
+    servant_ids = s.thread_ids();
+    reader_ids = pool.thread_ids();
+    return boost::asynchronous::make_reader_parallel_scheduler(s,pool);
+}
+}
+
+BOOST_AUTO_TEST_CASE( test_reader_parallel_servant_concurrent_reads )
+{
+    main_thread_id = boost::this_thread::get_id();
+    max_readers = 0;
+    {
+        ServantProxy proxy(make_scheduler());
+        proxy.set(1,10);
+        std::vector<std::future<int>> fus;
+        for (int i = 0; i < 8; ++i)
+        {
+            fus.push_back(proxy.get(1,100));
+        }
+        for (auto& fu : fus)
+        {
+            BOOST_CHECK(fu.get() == 10);
+        }
+        BOOST_CHECK_MESSAGE(max_readers.load() > 1,"reads not executed concurrently");
+    }
+    BOOST_CHECK(dtor_in_servant_thread);
+}
+
+BOOST_AUTO_TEST_CASE( test_reader_parallel_servant_read_after_write )
+{
+    main_thread_id = boost::this_thread::get_id();
+    {
+        ServantProxy proxy(make_scheduler());
+        for (int i = 0; i < 500; ++i)
+        {
+            proxy.set(i,i * 2);
+            // a read sees the writes made before
+            BOOST_CHECK(proxy.get(i,0).get() == i * 2);
+        }
+        // interleaved reads and writes without waiting
+        std::vector<std::future<int>> fus;
+        for (int i = 0; i < 500; ++i)
+        {
+            proxy.set(1000,i);
+            fus.push_back(proxy.get(1000,0));
+        }
+        for (int i = 0; i < 500; ++i)
+        {
+            BOOST_CHECK(fus[i].get() >= i);
+        }
+        BOOST_CHECK(proxy.size().get() == 501u);
+    }
+    BOOST_CHECK(dtor_in_servant_thread);
+}
+
+BOOST_AUTO_TEST_CASE( test_reader_parallel_servant_self_post )
+{
+    main_thread_id = boost::this_thread::get_id();
+    {
+        ServantProxy proxy(make_scheduler());
+        std::vector<std::future<int>> fus;
+        for (int i = 0; i < 50; ++i)
+        {
+            // jobs the servant posts to itself are writes too
+            proxy.set_later(i,i);
+            fus.push_back(proxy.get(0,2));
+        }
+        for (auto& fu : fus)
+        {
+            fu.get();
+        }
+        BOOST_CHECK(proxy.size().get() == 50u);
+    }
+    BOOST_CHECK(dtor_in_servant_thread);
+}
+
+BOOST_AUTO_TEST_CASE( test_future_member_const_without_reader_pool )
+{
+    main_thread_id = boost::this_thread::get_id();
+    auto s = boost::asynchronous::make_shared_scheduler_proxy<boost::asynchronous::single_thread_scheduler<
+                                                                boost::asynchronous::lockfree_queue<>>>();
+    servant_ids = s.thread_ids();
+    // reads go to the servant thread like any call
+    reader_ids = servant_ids;
+    {
+        ServantProxy proxy(s);
+        proxy.set(1,10);
+        BOOST_CHECK(proxy.get(1,0).get() == 10);
+    }
+}
+
+BOOST_AUTO_TEST_CASE( test_reader_parallel_servant_dropped_write )
+{
+    main_thread_id = boost::this_thread::get_id();
+    auto s = boost::asynchronous::make_shared_scheduler_proxy<boost::asynchronous::single_thread_scheduler<
+                                                                boost::asynchronous::lockfree_queue<>>>();
+    auto pool = boost::asynchronous::make_shared_scheduler_proxy<boost::asynchronous::threadpool_scheduler<
+                                                                   boost::asynchronous::lockfree_queue<>>>(2);
+    servant_ids = s.thread_ids();
+    reader_ids = pool.thread_ids();
+    {
+        ServantProxy proxy(boost::asynchronous::make_reader_parallel_scheduler(s,pool));
+        proxy.set(1,10);
+
+        // a write interrupted before it starts is never executed
+        std::promise<void> release;
+        std::shared_future<void> released = release.get_future().share();
+        s.post([released](){released.wait();});
+        boost::asynchronous::any_interruptible write =
+            proxy.get_proxy().interruptible_post([](){BOOST_FAIL("interrupted write executed");});
+        write.interrupt();
+        release.set_value();
+        BOOST_CHECK(proxy.size().get() == 1u);
+        // executed after the end of the size() write
+        BOOST_CHECK(proxy.get(1,0).get() == 10);
+
+        // no write pending any more: reads do not wait for the servant thread
+        std::promise<void> release2;
+        std::shared_future<void> released2 = release2.get_future().share();
+        s.post([released2](){released2.wait();});
+        std::future<int> read = proxy.get(1,0);
+        BOOST_CHECK_MESSAGE(read.wait_for(std::chrono::seconds(5)) == std::future_status::ready,
+                            "read waits for a dropped write");
+        release2.set_value();
+        BOOST_CHECK(read.get() == 10);
+    }
+}
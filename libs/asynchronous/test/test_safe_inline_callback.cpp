@@ -0,0 +1,183 @@
+// Boost.Asynchronous library
+//  Copyright (C) Christophe Henry 2026
+//
+//  Use, modification and distribution is subject to the Boost
+//  Software License, Version 1.0.  (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// For more information, see http://www.boost.org
+
+#include <atomic>
+#include <functional>
+#include <future>
+#include <memory>
+#include <vector>
+
+#include <boost/asynchronous/scheduler/single_thread_scheduler.hpp>
+#include <boost/asynchronous/scheduler/threadpool_scheduler.hpp>
+#include <boost/asynchronous/queue/lockfree_queue.hpp>
+#include <boost/asynchronous/scheduler_shared_proxy.hpp>
+#include <boost/asynchronous/servant_proxy.hpp>
+#include <boost/asynchronous/trackable_servant.hpp>
+#include <boost/asynchronous/post.hpp>
+
+#include "test_common.hpp"
+#include <boost/test/unit_test.hpp>
+using namespace boost::asynchronous::test;
+
+namespace
+{
+// main thread id
+boost::thread::id main_thread_id;
+std::vector<boost::thread::id> servant_ids;
+std::atomic<int> calls{0};
+
+typedef std::function<void(int)> callback_type;
+
+struct Servant : boost::asynchronous::trackable_servant<>
+{
+    Servant(boost::asynchronous::any_weak_scheduler<> scheduler)
+        : boost::asynchronous::trackable_servant<>(scheduler,
+                                               boost::asynchronous::make_shared_scheduler_proxy<
+                                                   boost::asynchronous::threadpool_scheduler<
+                                                           boost::asynchronous::lockfree_queue<>>>(2))
+    {
+    }
+    bool is_epoch_tracked()const
+    {
+        return get_epoch_token().is_local();
+    }
+    // a typed callback given to the outside world
+    callback_type get_callback()
+    {
+        return make_safe_inline_callback([this](int i)
+                    {
+                        BOOST_CHECK_MESSAGE(contains_id(servant_ids.begin(),servant_ids.end(),boost::this_thread::get_id()),
+                                            "callback not in servant thread");
+                        m_sum += i;
+                        ++calls;
+                    },"inline_callback");
+    }
+    // called from the threadpool, then in the servant thread
+    std::future<int> from_pool(int n)
+    {
+        std::shared_ptr<std::promise<int>> p = std::make_shared<std::promise<int>>();
+        std::future<int> fu = p->get_future();
+        auto cb = make_safe_inline_callback([this,p,n](int i)
+                    {
+                        BOOST_CHECK_MESSAGE(contains_id(servant_ids.begin(),servant_ids.end(),boost::this_thread::get_id()),
+                                            "callback not in servant thread");
+                        m_sum += i;
+                        if (++m_received == n)
+                        {
+                            p->set_value(m_sum);
+                        }
+                    });
+        for (int i = 0; i < n; ++i)
+        {
+            post_callback([cb,i](){cb(i);},[](boost::asynchronous::expected<void>){});
+        }
+        return fu;
+    }
+    // called in the servant thread, executes at once unless forced to post
+    std::pair<int,int> in_place()
+    {
+        int before = m_sum;
+        auto cb = make_safe_inline_callback([this](int i){m_sum += i;});
+        cb(5);
+        auto posted = make_safe_inline_post_callback([this](int i){m_sum += i;});
+        posted(100);
+        return std::make_pair(before,m_sum);
+    }
+    int sum()const
+    {
+        return m_sum;
+    }
+    int m_sum = 0;
+    int m_received = 0;
+};
+
+class ServantProxy : public boost::asynchronous::servant_proxy<ServantProxy,Servant>
+{
+public:
+    template <class Scheduler>
+    ServantProxy(Scheduler s):
+        boost::asynchronous::servant_proxy<ServantProxy,Servant>(s)
+    {}
+    BOOST_ASYNC_FUTURE_MEMBER(is_epoch_tracked)
+    BOOST_ASYNC_FUTURE_MEMBER(get_callback)
+    BOOST_ASYNC_FUTURE_MEMBER(from_pool)
+    BOOST_ASYNC_FUTURE_MEMBER(in_place)
+    BOOST_ASYNC_FUTURE_MEMBER(sum)
+};
+
+boost::asynchronous::any_shared_scheduler_proxy<> make_scheduler()
+{
+    auto s = boost::asynchronous::make_shared_scheduler_proxy<boost::asynchronous::single_thread_scheduler<
+                                                                boost::asynchronous::lockfree_queue<>>>();
+    servant_ids = s.thread_ids();
+    return s;
+}
+}
+
+BOOST_AUTO_TEST_CASE( test_safe_inline_callback_from_pool )
+{
+    main_thread_id = boost::this_thread::get_id();
+    auto scheduler = make_scheduler();
+    ServantProxy proxy(scheduler);
+    BOOST_CHECK(proxy.is_epoch_tracked().get());
+    BOOST_CHECK(proxy.from_pool(100).get().get() == 4950);
+}
+
+BOOST_AUTO_TEST_CASE( test_safe_inline_callback_in_place )
+{
+    main_thread_id = boost::this_thread::get_id();
+    auto scheduler = make_scheduler();
+    ServantProxy proxy(scheduler);
+    std::pair<int,int> res = proxy.in_place().get();
+    // the posted one is not yet executed
+    BOOST_CHECK(res.first == 0);
+    BOOST_CHECK(res.second == 5);
+    BOOST_CHECK(proxy.sum().get() == 105);
+}
+
+BOOST_AUTO_TEST_CASE( test_safe_inline_callback_after_servant_dtor )
+{
+    main_thread_id = boost::this_thread::get_id();
+    calls = 0;
+    auto scheduler = make_scheduler();
+    callback_type cb;
+    {
+        ServantProxy proxy(scheduler);
+        cb = proxy.get_callback().get();
+        cb(1);
+        BOOST_CHECK(proxy.sum().get() == 1);
+    }
+    // a new servant probably reuses the slot of the old one, the old callback must not call it
+    ServantProxy proxy2(scheduler);
+    callback_type cb2 = proxy2.get_callback().get();
+    cb(1);
+    cb2(10);
+    BOOST_CHECK(proxy2.sum().get() == 10);
+    BOOST_CHECK(calls.load() == 2);
+}
+
+BOOST_AUTO_TEST_CASE( test_safe_inline_callback_not_epoch_tracked )
+{
+    main_thread_id = boost::this_thread::get_id();
+    calls = 0;
+    auto scheduler = make_scheduler();
+    callback_type cb;
+    {
+        // created outside of its scheduler thread: weak_ptr tracking
+        Servant s(scheduler.get_weak_scheduler());
+        BOOST_CHECK(!s.is_epoch_tracked());
+        cb = s.get_callback();
+        cb(1);
+        boost::asynchronous::post_future(scheduler,[](){}).get();
+        BOOST_CHECK(calls.load() == 1);
+    }
+    cb(1);
+    boost::asynchronous::post_future(scheduler,[](){}).get();
+    BOOST_CHECK(calls.load() == 1);
+}
@@ -0,0 +1,149 @@
+// Boost.Asynchronous library
+//  Copyright (C) Christophe Henry 2026
+//
+//  Use, modification and distribution is subject to the Boost
+//  Software License, Version 1.0.  (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// For more information, see http://www.boost.org
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <vector>
+#include <future>
+#include <chrono>
+#include <thread>
+
+#include <boost/asynchronous/helpers/scratch_memory_pool.hpp>
+#include <boost/asynchronous/algorithm/parallel_sort.hpp>
+#include <boost/asynchronous/queue/lockfree_queue.hpp>
+#include <boost/asynchronous/scheduler_shared_proxy.hpp>
+#include <boost/asynchronous/scheduler/threadpool_scheduler.hpp>
+#include "test_common.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+using namespace boost::asynchronous::test;
+
+BOOST_AUTO_TEST_CASE( test_scratch_memory_pool_reuse )
+{
+    boost::asynchronous::scratch_memory_pool pool;
+    char* first = nullptr;
+    {
+        auto buffer = pool.allocate(10000);
+        first = buffer.get();
+        std::memset(buffer.get(),1,10000);
+        BOOST_CHECK_MESSAGE(pool.cached_bytes() == 0,"block in use should not be cached.");
+    }
+    BOOST_CHECK_MESSAGE(pool.cached_bytes() >= 10000,"freed block should be cached.");
+    // same size class
+    auto buffer = pool.allocate(9000);
+    BOOST_CHECK_MESSAGE(buffer.get() == first,"block was not reused.");
+    BOOST_CHECK_MESSAGE(pool.cached_bytes() == 0,"reused block still counted as cached.");
+}
+
+BOOST_AUTO_TEST_CASE( test_scratch_memory_pool_huge_block )
+{
+    boost::asynchronous::scratch_memory_pool pool;
+    const std::size_t size = 3 * 1024 * 1024;
+    auto buffer = pool.allocate(size);
+    // whole buffer usable
+    std::memset(buffer.get(),2,size);
+#if defined(__linux__) && !defined(BOOST_ASYNCHRONOUS_NO_HUGE_PAGES)
+    BOOST_CHECK_MESSAGE(reinterpret_cast<std::uintptr_t>(buffer.get()) % (2 * 1024 * 1024) == 0,"big block not aligned on huge page.");
+#endif
+    buffer.reset();
+    BOOST_CHECK_MESSAGE(pool.cached_bytes() >= size,"freed block should be cached.");
+    pool.release();
+    BOOST_CHECK_MESSAGE(pool.cached_bytes() == 0,"release did not free cached blocks.");
+}
+
+BOOST_AUTO_TEST_CASE( test_scratch_memory_pool_limit )
+{
+    // no more than 8KB kept
+    boost::asynchronous::scratch_memory_pool pool(8192);
+    {
+        auto b1 = pool.allocate(4096);
+        auto b2 = pool.allocate(4096);
+        auto b3 = pool.allocate(4096);
+    }
+    BOOST_CHECK_MESSAGE(pool.cached_bytes() == 8192,"pool kept more than its limit: " << pool.cached_bytes());
+}
+
+BOOST_AUTO_TEST_CASE( test_scratch_memory_pool_outlives_pool )
+{
+    std::shared_ptr<char> buffer;
+    {
+        boost::asynchronous::scratch_memory_pool pool;
+        buffer = pool.allocate(100);
+    }
+    // giving back to a destroyed pool must be safe
+    std::memset(buffer.get(),3,100);
+    buffer.reset();
+}
+
+BOOST_AUTO_TEST_CASE( test_scratch_memory_pool_repeated_sorts )
+{
+    auto scheduler = boost::asynchronous::make_shared_scheduler_proxy<boost::asynchronous::threadpool_scheduler<
+                                                                        boost::asynchronous::lockfree_queue<>>>(4);
+    std::mt19937 mt(42);
+    for (int i = 0; i < 5; ++i)
+    {
+        auto data = std::make_shared<std::vector<int>>(100000);
+        std::generate(data->begin(),data->end(),mt);
+        auto expected = *data;
+        std::sort(expected.begin(),expected.end());
+        std::future<void> fu = boost::asynchronous::post_future(
+            scheduler,
+            [data]()
+            {
+                return boost::asynchronous::parallel_sort(data->begin(),data->end(),std::less<int>(),1500);
+            },
+            "test_scratch_memory_pool_repeated_sorts",0);
+        fu.get();
+        BOOST_CHECK_MESSAGE(*data == expected,"parallel_sort gave wrong result.");
+    }
+    // merge memory went back to the default pool, possibly shortly after the future was set
+    for (int i = 0; i < 100 && boost::asynchronous::scratch_memory_pool::default_pool().cached_bytes() < 100000 * sizeof(int); ++i)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    BOOST_CHECK_MESSAGE(boost::asynchronous::scratch_memory_pool::default_pool().cached_bytes() >= 100000 * sizeof(int),
+                        "merge memory not given back to the pool: " << boost::asynchronous::scratch_memory_pool::default_pool().cached_bytes());
+}
+
+BOOST_AUTO_TEST_CASE( test_scratch_memory_pool_trim )
+{
+    boost::asynchronous::scratch_memory_pool pool;
+    {
+        auto b1 = pool.allocate(4096);
+        auto b2 = pool.allocate(4096);
+        auto b3 = pool.allocate(1024 * 1024);
+    }
+    BOOST_CHECK_MESSAGE(pool.cached_bytes() == 1024 * 1024 + 8192,"freed blocks should be cached.");
+    // biggest blocks freed first
+    pool.trim(10000);
+    BOOST_CHECK_MESSAGE(pool.cached_bytes() == 8192,"trim kept wrong size: " << pool.cached_bytes());
+    pool.trim();
+    BOOST_CHECK_MESSAGE(pool.cached_bytes() == 0,"trim did not free cached blocks.");
+}
+
+BOOST_AUTO_TEST_CASE( test_scratch_memory_pool_set_max_cached )
+{
+    boost::asynchronous::scratch_memory_pool pool;
+    const std::size_t big = 16 * 1024 * 1024;
+    {
+        auto buffer = pool.allocate(big);
+    }
+    // above the default limit
+    BOOST_CHECK_MESSAGE(pool.cached_bytes() == 0,"block bigger than the limit should not be cached.");
+    pool.set_max_cached(2 * big);
+    {
+        auto buffer = pool.allocate(big);
+    }
+    BOOST_CHECK_MESSAGE(pool.cached_bytes() == big,"block should be cached after raising the limit.");
+    pool.set_max_cached(4096);
+    BOOST_CHECK_MESSAGE(pool.cached_bytes() == 0,"lowering the limit did not free cached blocks.");
+}
@@ -0,0 +1,310 @@
+// Boost.Asynchronous library
+//  Copyright (C) Christophe Henry 2026
+//
+//  Use, modification and distribution is subject to the Boost
+//  Software License, Version 1.0.  (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// For more information, see http://www.boost.org
+
+#include <algorithm>
+#include <atomic>
+#include <numeric>
+#include <stdexcept>
+#include <vector>
+#include <future>
+
+#include <boost/iterator/transform_iterator.hpp>
+
+#include <boost/asynchronous/container/segmented_vector.hpp>
+#include <boost/asynchronous/algorithm/parallel_for.hpp>
+#include <boost/asynchronous/algorithm/parallel_reduce.hpp>
+#include <boost/asynchronous/algorithm/parallel_sort.hpp>
+#include <boost/asynchronous/queue/lockfree_queue.hpp>
+#include <boost/asynchronous/scheduler_shared_proxy.hpp>
+#include <boost/asynchronous/scheduler/threadpool_scheduler.hpp>
+#include "test_common.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+using namespace boost::asynchronous::test;
+
+namespace
+{
+typedef boost::asynchronous::segmented_vector<int> seg_vector;
+}
+
+BOOST_AUTO_TEST_CASE( test_segmented_vector_segments )
+{
+    seg_vector v(1000);
+    // rounded to a power of 2
+    BOOST_CHECK_MESSAGE(v.first_segment_size() == 1024,"first segment size should be 1024, got: " << v.first_segment_size());
+    BOOST_CHECK_MESSAGE(v.segment_of(0) == 0 && v.segment_of(1023) == 0,"wrong segment for first elements.");
+    BOOST_CHECK_MESSAGE(v.segment_of(1024) == 1 && v.segment_of(2047) == 1,"wrong segment 1.");
+    BOOST_CHECK_MESSAGE(v.segment_of(2048) == 2 && v.segment_of(4095) == 2,"wrong segment 2.");
+    BOOST_CHECK_MESSAGE(v.segment_start(3) == 4096 && v.segment_size(3) == 4096,"wrong segment 3.");
+    BOOST_CHECK_MESSAGE(v.capacity() == 0,"no segment should be allocated yet.");
+    v.reserve(3000);
+    BOOST_CHECK_MESSAGE(v.capacity() == 4096,"capacity should be 4096, got: " << v.capacity());
+}
+
+BOOST_AUTO_TEST_CASE( test_segmented_vector_push_back_no_move )
+{
+    seg_vector v(16);
+    v.push_back(0);
+    int* first = &v[0];
+    for (int i = 1; i < 10000; ++i)
+    {
+        v.push_back(i);
+    }
+    BOOST_CHECK_MESSAGE(&v[0] == first,"growing moved elements.");
+    BOOST_CHECK_MESSAGE(v.size() == 10000,"wrong size: " << v.size());
+    std::vector<int> expected(10000);
+    std::iota(expected.begin(),expected.end(),0);
+    BOOST_CHECK_MESSAGE(std::equal(v.begin(),v.end(),expected.begin()),"wrong content.");
+    BOOST_CHECK_MESSAGE(v.back() == 9999 && v.at(5000) == 5000,"wrong access.");
+    BOOST_CHECK_THROW(v.at(10000),std::out_of_range);
+
+    seg_vector v2(v);
+    BOOST_CHECK_MESSAGE(v2 == v,"copy differs.");
+    seg_vector v3(std::move(v2));
+    BOOST_CHECK_MESSAGE(v3 == v && v2.empty(),"move failed.");
+    auto it = v3.grow_by(3,-1);
+    BOOST_CHECK_MESSAGE(it - v3.begin() == 10000 && v3.size() == 10003 && v3.back() == -1,"grow_by failed.");
+}
+
+BOOST_AUTO_TEST_CASE( test_segmented_vector_concurrent_push_back )
+{
+    auto scheduler = boost::asynchronous::make_shared_scheduler_proxy<boost::asynchronous::threadpool_scheduler<
+                                                                        boost::asynchronous::lockfree_queue<>>>(4);
+    auto v = std::make_shared<seg_vector>(8);
+    std::vector<std::future<void>> fus;
+    for (int t = 0; t < 8; ++t)
+    {
+        fus.push_back(boost::asynchronous::post_future(scheduler,
+        [v,t]()
+        {
+            for (int i = 0; i < 10000; ++i)
+            {
+                if (i % 100 == 0)
+                {
+                    int values[3] = {t * 10000 + i,t * 10000 + i + 1,t * 10000 + i + 2};
+                    v->grow_by(values,values + 3);
+                    i += 2;
+                }
+                else
+                {
+                    v->push_back(t * 10000 + i);
+                }
+            }
+        },"test_segmented_vector_concurrent_push_back",0));
+    }
+    for (auto& fu : fus)
+    {
+        fu.get();
+    }
+    BOOST_CHECK_MESSAGE(v->size() == 80000,"wrong size: " << v->size());
+    std::vector<int> content(v->begin(),v->end());
+    std::sort(content.begin(),content.end());
+    std::vector<int> expected(80000);
+    std::iota(expected.begin(),expected.end(),0);
+    BOOST_CHECK_MESSAGE(content == expected,"elements lost or duplicated.");
+}
+
+BOOST_AUTO_TEST_CASE( test_segmented_vector_cutoff_on_segments )
+{
+    seg_vector v(1024,0,16);
+    // [0,1024) holds segments 0-6, the boundary closest to the middle is 512
+    auto cut = boost::asynchronous::detail::find_cutoff(v.begin(),10,v.end());
+    BOOST_CHECK_MESSAGE(cut - v.begin() == 512,"cut should be at 512, got: " << (cut - v.begin()));
+    // [100,1000): middle is 550, closest boundary is 512
+    cut = boost::asynchronous::detail::find_cutoff(v.begin() + 100,10,v.begin() + 1000);
+    BOOST_CHECK_MESSAGE(cut - v.begin() == 512,"cut should be at 512, got: " << (cut - v.begin()));
+    // no boundary inside: middle
+    cut = boost::asynchronous::detail::find_cutoff(v.begin() + 600,10,v.begin() + 700);
+    BOOST_CHECK_MESSAGE(cut - v.begin() == 650,"cut should be at 650, got: " << (cut - v.begin()));
+}
+
+BOOST_AUTO_TEST_CASE( test_segmented_vector_parallel_algorithms )
+{
+    auto scheduler = boost::asynchronous::make_shared_scheduler_proxy<boost::asynchronous::threadpool_scheduler<
+                                                                        boost::asynchronous::lockfree_queue<>>>(4);
+    auto v = std::make_shared<seg_vector>(100000,1,1024);
+    // segments being bigger than the cutoff, leaves must stay within a segment
+    auto leaves_crossing = std::make_shared<std::atomic<int>>(0);
+    std::future<void> fu = boost::asynchronous::post_future(scheduler,
+    [v,leaves_crossing]()
+    {
+        return boost::asynchronous::parallel_for(v->begin(),v->end(),
+                                                 [v,leaves_crossing](seg_vector::iterator beg, seg_vector::iterator end)
+                                                 {
+                                                     if (v->segment_of(beg.index()) != v->segment_of(end.index() - 1))
+                                                     {
+                                                         ++(*leaves_crossing);
+                                                     }
+                                                     for (; beg != end; ++beg)
+                                                     {
+                                                         *beg += static_cast<int>(beg.index());
+                                                     }
+                                                 },
+                                                 1000);
+    },"test_segmented_vector_parallel_for",0);
+    fu.get();
+    BOOST_CHECK_MESSAGE(leaves_crossing->load() == 0,"leaves crossing segments: " << leaves_crossing->load());
+
+    std::future<long> fu2 = boost::asynchronous::post_future(scheduler,
+    [v]()
+    {
+        return boost::asynchronous::parallel_reduce(v->cbegin(),v->cend(),[](long a, long b){return a + b;},1000);
+    },"test_segmented_vector_parallel_reduce",0);
+    long sum = fu2.get();
+    BOOST_CHECK_MESSAGE(sum == 100000L + 99999L * 100000L / 2,"wrong sum: " << sum);
+
+    std::future<void> fu3 = boost::asynchronous::post_future(scheduler,
+    [v]()
+    {
+        return boost::asynchronous::parallel_sort(v->begin(),v->end(),std::greater<int>(),1000);
+    },"test_segmented_vector_parallel_sort",0);
+    fu3.get();
+    BOOST_CHECK_MESSAGE(std::is_sorted(v->begin(),v->end(),std::greater<int>()),"parallel_sort gave wrong result.");
+    BOOST_CHECK_MESSAGE(v->front() == 100000 && v->back() == 1,"parallel_sort lost elements.");
+}
+
+namespace
+{
+std::atomic<int> live_throwing{0};
+// throws when copied from a value equal to throw_on
+struct throwing_element
+{
+    static constexpr int throw_on = 13;
+    throwing_element(int v = 0) : value(v)
+    {
+        ++live_throwing;
+    }
+    throwing_element(throwing_element const& rhs) : value(rhs.value)
+    {
+        if (rhs.value == throw_on)
+        {
+            throw std::runtime_error("throwing_element");
+        }
+        ++live_throwing;
+    }
+    ~throwing_element()
+    {
+        --live_throwing;
+    }
+    int value;
+};
+}
+
+BOOST_AUTO_TEST_CASE( test_segmented_vector_throwing_constructor )
+{
+    {
+        boost::asynchronous::segmented_vector<throwing_element> v(16);
+        v.grow_by(10,throwing_element(1));
+        std::vector<throwing_element> source;
+        source.reserve(40);
+        for (int i = 0; i < 40; ++i)
+        {
+            source.emplace_back(i);
+        }
+        int before = live_throwing;
+        bool thrown = false;
+        try
+        {
+            // the 14th element throws, in the second segment
+            v.grow_by(source.begin(),source.end());
+        }
+        catch (std::runtime_error&)
+        {
+            thrown = true;
+        }
+        BOOST_CHECK_MESSAGE(thrown,"exception not forwarded.");
+        BOOST_CHECK_MESSAGE(v.size() == 10,"wrong size after failed grow_by: " << v.size());
+        BOOST_CHECK_MESSAGE(live_throwing == before,"elements built by failed grow_by not destroyed.");
+        // the slots are given back
+        v.grow_by(source.begin(),source.begin() + 13);
+        BOOST_CHECK_MESSAGE(v.size() == 23,"wrong size: " << v.size());
+        BOOST_CHECK_MESSAGE(v[10].value == 0 && v[22].value == 12,"wrong elements after failed grow_by.");
+
+        thrown = false;
+        try
+        {
+            v.grow_by(5,throwing_element(throwing_element::throw_on));
+        }
+        catch (std::runtime_error&)
+        {
+            thrown = true;
+        }
+        BOOST_CHECK_MESSAGE(thrown,"exception not forwarded.");
+        BOOST_CHECK_MESSAGE(v.size() == 23,"wrong size after failed grow_by: " << v.size());
+        thrown = false;
+        try
+        {
+            v.push_back(throwing_element(throwing_element::throw_on));
+        }
+        catch (std::runtime_error&)
+        {
+            thrown = true;
+        }
+        BOOST_CHECK_MESSAGE(thrown,"exception not forwarded.");
+        BOOST_CHECK_MESSAGE(v.size() == 23,"wrong size after failed push_back: " << v.size());
+    }
+    BOOST_CHECK_MESSAGE(live_throwing == 0,"elements leaked: " << live_throwing);
+
+    bool thrown = false;
+    try
+    {
+        boost::asynchronous::segmented_vector<throwing_element> v(100,throwing_element(throwing_element::throw_on),16);
+    }
+    catch (std::runtime_error&)
+    {
+        thrown = true;
+    }
+    BOOST_CHECK_MESSAGE(thrown,"exception not forwarded by constructor.");
+    BOOST_CHECK_MESSAGE(live_throwing == 0,"elements leaked by constructor: " << live_throwing);
+}
+
+BOOST_AUTO_TEST_CASE( test_segmented_vector_concurrent_throwing_grow_by )
+{
+    // int is nothrow default constructible: lock-free, failing slots followed by other reservations are value-initialized
+    typedef boost::asynchronous::segmented_vector<int> vector_type;
+    vector_type v(16);
+    std::atomic<int> failed{0};
+    std::vector<std::future<void>> workers;
+    for (int t = 0; t < 4; ++t)
+    {
+        workers.push_back(std::async(std::launch::async,[&v,&failed,t]()
+        {
+            std::vector<int> source(7,t + 1);
+            for (int i = 0; i < 500; ++i)
+            {
+                auto it = source.begin();
+                auto throwing = boost::make_transform_iterator(source.begin(),[i,it](int const& x) -> int
+                {
+                    if (i % 10 == 0 && &x == &*(it + 3))
+                    {
+                        throw std::runtime_error("failed");
+                    }
+                    return x;
+                });
+                try
+                {
+                    v.grow_by(throwing,throwing + 7);
+                }
+                catch (std::runtime_error&)
+                {
+                    ++failed;
+                }
+            }
+        }));
+    }
+    for (auto& w : workers)
+    {
+        w.get();
+    }
+    BOOST_CHECK_MESSAGE(failed == 4 * 50,"wrong number of failed grow_by: " << failed);
+    std::size_t added = std::count_if(v.begin(),v.end(),[](int x){return x != 0;});
+    BOOST_CHECK_MESSAGE(added == 4 * 450 * 7,"wrong number of added elements: " << added);
+    BOOST_CHECK_MESSAGE(v.size() % 7 == 0 && v.size() >= added,"wrong size: " << v.size());
+}
@@ -0,0 +1,218 @@
+// Boost.Asynchronous library
+//  Copyright (C) Christophe Henry 2026
+//
+//  Use, modification and distribution is subject to the Boost
+//  Software License, Version 1.0.  (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// For more information, see http://www.boost.org
+
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <stdexcept>
+#include <vector>
+
+#include <boost/asynchronous/scheduler/single_thread_scheduler.hpp>
+#include <boost/asynchronous/queue/lockfree_queue.hpp>
+#include <boost/asynchronous/queue/any_queue_container.hpp>
+#include <boost/asynchronous/scheduler_shared_proxy.hpp>
+#include <boost/asynchronous/servant_proxy.hpp>
+#include <boost/asynchronous/post.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+namespace
+{
+// main thread id
+boost::thread::id main_thread_id;
+std::atomic<int> servants_alive{0};
+
+// constructor must be posted and takes a while
+struct Servant
+{
+    Servant(int data, int sleep_ms = 200): m_data(data), m_calls()
+    {
+        BOOST_CHECK_MESSAGE(main_thread_id!=boost::this_thread::get_id(),"servant ctor not posted.");
+        boost::this_thread::sleep(boost::posix_time::milliseconds(sleep_ms));
+        if (data < 0)
+        {
+            throw std::runtime_error("negative data");
+        }
+        ++servants_alive;
+    }
+    ~Servant()
+    {
+        BOOST_CHECK_MESSAGE(main_thread_id!=boost::this_thread::get_id(),"servant dtor not posted.");
+        --servants_alive;
+    }
+    void add(int i)
+    {
+        BOOST_CHECK_MESSAGE(main_thread_id!=boost::this_thread::get_id(),"servant add not posted.");
+        m_calls.push_back(i);
+    }
+    std::vector<int> calls()const
+    {
+        return m_calls;
+    }
+    int data()const
+    {
+        return m_data;
+    }
+    int m_data;
+    std::vector<int> m_calls;
+};
+
+class ServantProxy : public boost::asynchronous::servant_proxy<ServantProxy,Servant>
+{
+public:
+    template <class Scheduler, class... Args>
+    ServantProxy(Scheduler s, Args... args):
+        boost::asynchronous::servant_proxy<ServantProxy,Servant>(s, args...)
+    {}
+
+    BOOST_ASYNC_POST_MEMBER(add)
+    BOOST_ASYNC_FUTURE_MEMBER(calls)
+    BOOST_ASYNC_FUTURE_MEMBER(data)
+};
+
+boost::asynchronous::any_shared_scheduler_proxy<> make_scheduler()
+{
+    return boost::asynchronous::make_shared_scheduler_proxy<boost::asynchronous::single_thread_scheduler<
+                                                              boost::asynchronous::lockfree_queue<>>>();
+}
+}
+
+BOOST_AUTO_TEST_CASE( test_servant_proxy_async_create_calls_in_order )
+{
+    main_thread_id = boost::this_thread::get_id();
+    auto scheduler = make_scheduler();
+    std::future<void> created;
+    {
+        auto creation = boost::asynchronous::async_create(scheduler);
+        created = creation.get_future();
+        auto start = std::chrono::steady_clock::now();
+        ServantProxy proxy(std::move(creation), 42);
+        BOOST_CHECK_MESSAGE(std::chrono::steady_clock::now() - start < std::chrono::milliseconds(150),
+                            "proxy construction waited for the servant.");
+        BOOST_CHECK(created.wait_for(std::chrono::milliseconds(0)) != std::future_status::ready);
+        // calls made before the servant exists are executed after its constructor, in order
+        for (int i = 0; i < 100; ++i)
+        {
+            proxy.add(i);
+        }
+        std::future<std::vector<int>> fu = proxy.calls();
+        std::vector<int> res = fu.get();
+        BOOST_REQUIRE(res.size() == 100u);
+        for (int i = 0; i < 100; ++i)
+        {
+            BOOST_CHECK(res[i] == i);
+        }
+        BOOST_CHECK(proxy.data().get() == 42);
+        BOOST_CHECK(created.wait_for(std::chrono::milliseconds(0)) == std::future_status::ready);
+        created.get();
+    }
+    // destroy the scheduler to be sure the servant is gone
+    scheduler.reset();
+    BOOST_CHECK(servants_alive.load() == 0);
+}
+
+BOOST_AUTO_TEST_CASE( test_servant_proxy_async_create_on_created )
+{
+    main_thread_id = boost::this_thread::get_id();
+    auto scheduler = make_scheduler();
+    std::vector<boost::thread::id> ids = scheduler.thread_ids();
+    std::promise<boost::thread::id> callback_thread;
+    std::future<boost::thread::id> fu = callback_thread.get_future();
+    {
+        ServantProxy proxy(boost::asynchronous::async_create(scheduler,
+                            [&callback_thread](boost::asynchronous::expected<void> res)
+                            {
+                                BOOST_CHECK(!res.has_exception());
+                                callback_thread.set_value(boost::this_thread::get_id());
+                            }),
+                           1, 50);
+        BOOST_CHECK(fu.get() == ids[0]);
+    }
+}
+
+BOOST_AUTO_TEST_CASE( test_servant_proxy_async_create_destroyed_before_created )
+{
+    main_thread_id = boost::this_thread::get_id();
+    auto scheduler = make_scheduler();
+    {
+        ServantProxy proxy(boost::asynchronous::async_create(scheduler), 1);
+        proxy.add(1);
+    }
+    scheduler.reset();
+    BOOST_CHECK(servants_alive.load() == 0);
+}
+
+BOOST_AUTO_TEST_CASE( test_servant_proxy_async_create_throwing_ctor )
+{
+    main_thread_id = boost::this_thread::get_id();
+    auto scheduler = make_scheduler();
+    std::future<void> created;
+    {
+        auto creation = boost::asynchronous::async_create(scheduler);
+        created = creation.get_future();
+        ServantProxy proxy(std::move(creation), -1, 100);
+        // queued before the constructor throws, must not be executed on the storage of the servant
+        BOOST_CHECK(created.wait_for(std::chrono::milliseconds(0)) != std::future_status::ready);
+        for (int i = 0; i < 100; ++i)
+        {
+            proxy.add(i);
+        }
+        std::future<std::vector<int>> calls = proxy.calls();
+        std::future<int> data = proxy.data();
+        BOOST_CHECK_THROW(created.get(),std::runtime_error);
+        BOOST_CHECK_THROW(calls.get(),boost::asynchronous::empty_servant);
+        BOOST_CHECK_THROW(data.get(),boost::asynchronous::empty_servant);
+        // and after
+        BOOST_CHECK_THROW(proxy.data().get(),boost::asynchronous::empty_servant);
+    }
+    scheduler.reset();
+    BOOST_CHECK(servants_alive.load() == 0);
+}
+
+BOOST_AUTO_TEST_CASE( test_servant_proxy_async_create_multiple_queues )
+{
+    main_thread_id = boost::this_thread::get_id();
+    // calls with priority 0 could go to any queue and overtake the constructor
+    auto scheduler = boost::asynchronous::make_shared_scheduler_proxy<boost::asynchronous::single_thread_scheduler<
+                        boost::asynchronous::any_queue_container<>>>(
+                            boost::asynchronous::any_queue_container_config<boost::asynchronous::lockfree_queue<>>(2));
+    auto creation = boost::asynchronous::async_create(scheduler);
+    std::future<void> created = creation.get_future();
+    BOOST_CHECK_THROW(ServantProxy(std::move(creation), 1),boost::asynchronous::servant_proxy_async_create_unsupported);
+    BOOST_CHECK_THROW(created.get(),boost::asynchronous::servant_proxy_async_create_unsupported);
+}
+
+BOOST_AUTO_TEST_CASE( test_make_servant_proxies )
+{
+    main_thread_id = boost::this_thread::get_id();
+    std::vector<boost::asynchronous::any_shared_scheduler_proxy<>> schedulers;
+    for (int i = 0; i < 4; ++i)
+    {
+        schedulers.push_back(make_scheduler());
+    }
+    {
+        auto start = std::chrono::steady_clock::now();
+        auto res = boost::asynchronous::make_servant_proxies<ServantProxy>(schedulers, 8, 7, 100);
+        std::vector<ServantProxy>& proxies = std::get<0>(res);
+        BOOST_CHECK(proxies.size() == 8u);
+        std::get<1>(res).get();
+        // 2 servants per scheduler, constructors executed in parallel in different schedulers
+        auto duration = std::chrono::steady_clock::now() - start;
+        BOOST_CHECK_MESSAGE(duration < std::chrono::milliseconds(600),
+                            "servants not created in parallel: " << std::chrono::duration_cast<std::chrono::milliseconds>(duration).count());
+        BOOST_CHECK(servants_alive.load() == 8);
+        for (std::size_t i = 0; i < proxies.size(); ++i)
+        {
+            BOOST_CHECK(proxies[i].get_proxy().thread_ids() == schedulers[i % 4].thread_ids());
+            BOOST_CHECK(proxies[i].data().get() == 7);
+        }
+    }
+    schedulers.clear();
+    BOOST_CHECK(servants_alive.load() == 0);
+}
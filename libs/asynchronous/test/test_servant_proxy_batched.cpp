@@ -0,0 +1,195 @@
+// Boost.Asynchronous library
+//  Copyright (C) Christophe Henry 2026
+//
+//  Use, modification and distribution is subject to the Boost
+//  Software License, Version 1.0.  (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// For more information, see http://www.boost.org
+
+#include <atomic>
+#include <future>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <boost/asynchronous/scheduler/single_thread_scheduler.hpp>
+#include <boost/asynchronous/queue/lockfree_queue.hpp>
+#include <boost/asynchronous/scheduler_shared_proxy.hpp>
+#include <boost/asynchronous/servant_proxy.hpp>
+#include <boost/asynchronous/post.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+namespace
+{
+// main thread id
+boost::thread::id main_thread_id;
+std::atomic<int> servants_alive{0};
+
+struct Servant
+{
+    Servant(int)
+    {
+        ++servants_alive;
+    }
+    ~Servant()
+    {
+        BOOST_CHECK_MESSAGE(main_thread_id!=boost::this_thread::get_id(),"servant dtor not posted.");
+        --servants_alive;
+    }
+    void add(int i, std::string const& s)
+    {
+        BOOST_CHECK_MESSAGE(main_thread_id!=boost::this_thread::get_id(),"servant add not posted.");
+        if (i < 0)
+        {
+            throw std::runtime_error("negative");
+        }
+        m_calls.push_back(i);
+        m_names.push_back(s);
+    }
+    void add_all(boost::asynchronous::call_batch<int>& batch)
+    {
+        BOOST_CHECK_MESSAGE(main_thread_id!=boost::this_thread::get_id(),"servant add_all not posted.");
+        ++m_batches;
+        for (auto const& c : batch)
+        {
+            m_calls.push_back(std::get<0>(c));
+        }
+    }
+    std::vector<int> calls()const
+    {
+        return m_calls;
+    }
+    std::vector<std::string> names()const
+    {
+        return m_names;
+    }
+    std::size_t batches()const
+    {
+        return m_batches;
+    }
+    void wait(std::shared_future<void> fu)
+    {
+        fu.wait();
+    }
+    std::vector<int> m_calls;
+    std::vector<std::string> m_names;
+    std::size_t m_batches = 0;
+};
+
+class ServantProxy : public boost::asynchronous::servant_proxy<ServantProxy,Servant>
+{
+public:
+    template <class Scheduler, class... Args>
+    ServantProxy(Scheduler s, Args... args):
+        boost::asynchronous::servant_proxy<ServantProxy,Servant>(s, args...)
+    {}
+
+    BOOST_ASYNC_BATCHED_POST_MEMBER(add)
+    BOOST_ASYNC_BATCH_MEMBER(add_all)
+    BOOST_ASYNC_POST_MEMBER(wait)
+    BOOST_ASYNC_FUTURE_MEMBER(calls)
+    BOOST_ASYNC_FUTURE_MEMBER(names)
+    BOOST_ASYNC_FUTURE_MEMBER(batches)
+};
+
+boost::asynchronous::any_shared_scheduler_proxy<> make_scheduler()
+{
+    return boost::asynchronous::make_shared_scheduler_proxy<boost::asynchronous::single_thread_scheduler<
+                                                              boost::asynchronous::lockfree_queue<>>>();
+}
+}
+
+BOOST_AUTO_TEST_CASE( test_servant_proxy_batched_post_in_order )
+{
+    main_thread_id = boost::this_thread::get_id();
+    {
+        ServantProxy proxy(make_scheduler(), 0);
+        for (int i = 0; i < 10000; ++i)
+        {
+            proxy.add(i, std::to_string(i));
+        }
+        std::vector<int> res = proxy.calls().get();
+        BOOST_REQUIRE(res.size() == 10000u);
+        std::vector<std::string> names = proxy.names().get();
+        for (int i = 0; i < 10000; ++i)
+        {
+            BOOST_CHECK(res[i] == i);
+            BOOST_CHECK(names[i] == std::to_string(i));
+        }
+    }
+    BOOST_CHECK(servants_alive.load() == 0);
+}
+
+BOOST_AUTO_TEST_CASE( test_servant_proxy_batched_exception )
+{
+    main_thread_id = boost::this_thread::get_id();
+    {
+        ServantProxy proxy(make_scheduler(), 0);
+        proxy.add(1, "1");
+        proxy.add(-1, "-1");
+        proxy.add(2, "2");
+        std::vector<int> res = proxy.calls().get();
+        BOOST_CHECK((res == std::vector<int>{1,2}));
+    }
+    BOOST_CHECK(servants_alive.load() == 0);
+}
+
+BOOST_AUTO_TEST_CASE( test_servant_proxy_batch_member )
+{
+    main_thread_id = boost::this_thread::get_id();
+    {
+        ServantProxy proxy(make_scheduler(), 0);
+        // block the servant while calls accumulate
+        std::promise<void> block;
+        proxy.wait(block.get_future().share());
+        for (int i = 0; i < 1000; ++i)
+        {
+            proxy.add_all(i);
+        }
+        block.set_value();
+        std::vector<int> res = proxy.calls().get();
+        BOOST_REQUIRE(res.size() == 1000u);
+        for (int i = 0; i < 1000; ++i)
+        {
+            BOOST_CHECK(res[i] == i);
+        }
+        // all calls made while the servant was busy form a single batch
+        BOOST_CHECK(proxy.batches().get() == 1u);
+    }
+    BOOST_CHECK(servants_alive.load() == 0);
+}
+
+BOOST_AUTO_TEST_CASE( test_servant_proxy_batched_many_producers )
+{
+    main_thread_id = boost::this_thread::get_id();
+    {
+        ServantProxy proxy(make_scheduler(), 0);
+        std::vector<std::future<void>> producers;
+        for (int t = 0; t < 4; ++t)
+        {
+            producers.push_back(std::async(std::launch::async,[proxy,t]()
+            {
+                for (int i = 0; i < 1000; ++i)
+                {
+                    proxy.add(t * 1000 + i, "");
+                }
+            }));
+        }
+        for (auto& p : producers)
+        {
+            p.get();
+        }
+        std::vector<int> res = proxy.calls().get();
+        BOOST_REQUIRE(res.size() == 4000u);
+        // order of each producer is kept
+        std::vector<int> last(4,-1);
+        for (int v : res)
+        {
+            BOOST_CHECK(v > last[v / 1000]);
+            last[v / 1000] = v;
+        }
+    }
+    BOOST_CHECK(servants_alive.load() == 0);
+}
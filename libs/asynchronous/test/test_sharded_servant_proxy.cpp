@@ -0,0 +1,344 @@
+// Boost.Asynchronous library
+//  Copyright (C) Christophe Henry 2026
+//
+//  Use, modification and distribution is subject to the Boost
+//  Software License, Version 1.0.  (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// For more information, see http://www.boost.org
+
+#include <chrono>
+#include <future>
+#include <map>
+#include <set>
+#include <stdexcept>
+#include <vector>
+
+#include <boost/asynchronous/scheduler/single_thread_scheduler.hpp>
+#include <boost/asynchronous/scheduler/threadpool_scheduler.hpp>
+#include <boost/asynchronous/queue/lockfree_queue.hpp>
+#include <boost/asynchronous/scheduler_shared_proxy.hpp>
+#include <boost/asynchronous/servant_proxy.hpp>
+#include <boost/asynchronous/sharded_servant_proxy.hpp>
+#include <boost/asynchronous/trackable_servant.hpp>
+#include <boost/asynchronous/post.hpp>
+
+#include "test_common.hpp"
+#include <boost/test/unit_test.hpp>
+using namespace boost::asynchronous::test;
+
+namespace
+{
+// identity, to know which bucket a key goes to
+struct shard_by_value
+{
+    std::size_t operator()(int k)const
+    {
+        return static_cast<std::size_t>(k);
+    }
+};
+
+struct Servant : boost::asynchronous::trackable_servant<>
+{
+    Servant(boost::asynchronous::any_weak_scheduler<> scheduler, int base)
+        : boost::asynchronous::trackable_servant<>(scheduler)
+        , m_base(base)
+    {
+        auto s = scheduler.lock();
+        if (s.is_valid())
+        {
+            m_thread_ids = s.thread_ids();
+        }
+    }
+    void set(int key, int value)
+    {
+        BOOST_CHECK_MESSAGE(contains_id(m_thread_ids.begin(),m_thread_ids.end(),boost::this_thread::get_id()),"set not in servant thread");
+        m_table[key] = value + m_base;
+    }
+    int get(int key)const
+    {
+        auto it = m_table.find(key);
+        return (it == m_table.end()) ? -1 : it->second;
+    }
+    std::size_t size()const
+    {
+        return m_table.size();
+    }
+    std::vector<int> keys()const
+    {
+        std::vector<int> res;
+        for (auto const& v : m_table)
+        {
+            res.push_back(v.first);
+        }
+        return res;
+    }
+    // migration helpers
+    std::map<int,int> extract(std::size_t bucket, std::size_t buckets)
+    {
+        std::map<int,int> res;
+        for (auto it = m_table.begin(); it != m_table.end();)
+        {
+            if (static_cast<std::size_t>(it->first) % buckets == bucket)
+            {
+                res.insert(*it);
+                it = m_table.erase(it);
+            }
+            else
+            {
+                ++it;
+            }
+        }
+        return res;
+    }
+    void insert(std::map<int,int> const& state)
+    {
+        BOOST_CHECK_MESSAGE(contains_id(m_thread_ids.begin(),m_thread_ids.end(),boost::this_thread::get_id()),"insert not in servant thread");
+        m_table.insert(state.begin(),state.end());
+    }
+    int m_base;
+    std::map<int,int> m_table;
+    std::vector<boost::thread::id> m_thread_ids;
+};
+
+class ServantProxy : public boost::asynchronous::servant_proxy<ServantProxy,Servant>
+{
+public:
+    template <class Scheduler>
+    ServantProxy(Scheduler s, int base):
+        boost::asynchronous::servant_proxy<ServantProxy,Servant>(s,base)
+    {}
+    BOOST_ASYNC_POST_MEMBER(set)
+    BOOST_ASYNC_FUTURE_MEMBER(get)
+    BOOST_ASYNC_FUTURE_MEMBER(size)
+    BOOST_ASYNC_FUTURE_MEMBER(keys)
+};
+
+typedef boost::asynchronous::sharded_servant_proxy<ServantProxy,shard_by_value> Shards;
+
+Shards make_shards(std::size_t n, std::size_t buckets)
+{
+    std::vector<boost::asynchronous::any_shared_scheduler_proxy<>> schedulers;
+    for (std::size_t i = 0; i < n; ++i)
+    {
+        schedulers.push_back(boost::asynchronous::make_shared_scheduler_proxy<boost::asynchronous::single_thread_scheduler<
+                                                                                boost::asynchronous::lockfree_queue<>>>());
+    }
+    return Shards(schedulers,buckets,shard_by_value(),0);
+}
+}
+
+BOOST_AUTO_TEST_CASE( test_sharded_servant_proxy_routing )
+{
+    Shards shards = make_shards(4,8);
+    BOOST_CHECK(shards.size() == 4u);
+    BOOST_CHECK(shards.bucket_count() == 8u);
+    for (int i = 0; i < 100; ++i)
+    {
+        shards.route(i).set(i,i);
+    }
+    for (int i = 0; i < 100; ++i)
+    {
+        // the same key always goes to the same shard
+        BOOST_CHECK(shards.route(i).get(i).get() == i);
+    }
+    // data is partitioned: each shard only has its own keys
+    std::vector<std::future<std::vector<int>>> keys = shards.broadcast([](ServantProxy const& p){return p.keys();});
+    BOOST_REQUIRE(keys.size() == 4u);
+    std::size_t total = 0;
+    for (std::size_t s = 0; s < keys.size(); ++s)
+    {
+        std::vector<int> k = keys[s].get();
+        BOOST_CHECK(k.size() == 25u);
+        total += k.size();
+        for (int key : k)
+        {
+            BOOST_CHECK(shards.shard_of_bucket(shards.bucket(key)) == s);
+        }
+    }
+    BOOST_CHECK(total == 100u);
+}
+
+BOOST_AUTO_TEST_CASE( test_sharded_servant_proxy_broadcast_continuation )
+{
+    Shards shards = make_shards(3,0);
+    BOOST_CHECK(shards.bucket_count() == 48u);
+    for (int i = 0; i < 90; ++i)
+    {
+        shards.route(i).set(i,i);
+    }
+    auto pool = boost::asynchronous::make_shared_scheduler_proxy<boost::asynchronous::threadpool_scheduler<
+                                                                   boost::asynchronous::lockfree_queue<>>>(2);
+    std::future<std::vector<std::size_t>> fu = boost::asynchronous::post_future(pool,
+        [shards]()
+        {
+            return boost::asynchronous::top_level_continuation<std::vector<std::size_t>>(
+                        shards.broadcast_continuation([](ServantProxy const& p){return p.size();}));
+        });
+    std::vector<std::size_t> sizes = fu.get();
+    BOOST_REQUIRE(sizes.size() == 3u);
+    BOOST_CHECK(sizes[0] + sizes[1] + sizes[2] == 90u);
+}
+
+BOOST_AUTO_TEST_CASE( test_sharded_servant_proxy_migrate )
+{
+    Shards shards = make_shards(2,4);
+    const std::size_t buckets = shards.bucket_count();
+    for (int i = 0; i < 40; ++i)
+    {
+        shards.route(i).set(i,i);
+    }
+    // bucket 0 is on shard 0, move it
+    BOOST_CHECK(shards.shard_of_bucket(0) == 0u);
+    std::future<void> done = shards.migrate(0,1,
+                    [buckets](Servant& s, std::size_t b){return s.extract(b,buckets);},
+                    [](Servant& s, std::map<int,int> state){s.insert(state);});
+    BOOST_CHECK(shards.shard_of_bucket(0) == 1u);
+    // calls routed after migrate find the state without waiting for the future
+    BOOST_CHECK(shards.route(0).get(0).get() == 0);
+    BOOST_CHECK(shards.route(4).get(4).get() == 4);
+    done.get();
+    BOOST_CHECK(shards[0].size().get() == 10u);
+    BOOST_CHECK(shards[1].size().get() == 30u);
+
+    // several migrations in a row are executed one after the other
+    std::vector<std::future<void>> fus;
+    for (std::size_t b = 0; b < buckets; ++b)
+    {
+        fus.push_back(shards.migrate(b,0,
+                    [buckets](Servant& s, std::size_t b){return s.extract(b,buckets);},
+                    [](Servant& s, std::map<int,int> state){s.insert(state);}));
+    }
+    for (auto& fu : fus)
+    {
+        fu.get();
+    }
+    BOOST_CHECK(shards[0].size().get() == 40u);
+    BOOST_CHECK(shards[1].size().get() == 0u);
+    for (int i = 0; i < 40; ++i)
+    {
+        BOOST_CHECK(shards.route(i).get(i).get() == i);
+    }
+}
+
+BOOST_AUTO_TEST_CASE( test_sharded_servant_proxy_migrate_exception )
+{
+    Shards shards = make_shards(2,2);
+    shards.route(0).set(0,0);
+    std::future<void> done = shards.migrate(0,1,
+                    [](Servant&, std::size_t)->std::map<int,int>{throw std::runtime_error("extract failed");},
+                    [](Servant& s, std::map<int,int> state){s.insert(state);});
+    BOOST_CHECK_THROW(done.get(),std::runtime_error);
+    // the bucket stays in the old shard, which still has the state
+    BOOST_CHECK(shards.shard_of_bucket(0) == 0u);
+    BOOST_CHECK(shards.route(0).get(0).get() == 0);
+    BOOST_CHECK(shards.call(0,[](ServantProxy const& p){return p.get(0);}).get() == 0);
+    shards.route(0).set(2,2);
+    BOOST_CHECK(shards[0].get(2).get() == 2);
+    BOOST_CHECK(shards[1].size().get() == 0u);
+    // the next migration still runs
+    shards.migrate(1,0,
+                    [](Servant& s, std::size_t b){return s.extract(b,2);},
+                    [](Servant& s, std::map<int,int> state){s.insert(state);}).get();
+    BOOST_CHECK_THROW(shards.migrate(2,0,
+                    [](Servant& s, std::size_t b){return s.extract(b,2);},
+                    [](Servant& s, std::map<int,int> state){s.insert(state);}),std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE( test_sharded_servant_proxy_migrate_no_wait )
+{
+    Shards shards = make_shards(2,2);
+    shards.route(0).set(0,0);
+    shards.route(1).set(1,1);
+    // keep the old shard busy
+    std::promise<void> release;
+    std::shared_future<void> released = release.get_future().share();
+    std::future<void> busy = boost::asynchronous::post_future(shards[0].get_proxy(),[released](){released.wait();});
+    std::future<void> done = shards.migrate(0,1,
+                    [](Servant& s, std::size_t b){return s.extract(b,2);},
+                    [](Servant& s, std::map<int,int> state){s.insert(state);});
+    // the new shard does not wait for the extraction
+    BOOST_CHECK(shards.route(1).get(1).get() == 1);
+    // calls for the moving bucket are held back until the state is there
+    shards.route(0).set(2,2);
+    std::future<int> held = shards.call(0,[](ServantProxy const& p){return p.get(0);});
+    BOOST_CHECK(held.wait_for(std::chrono::milliseconds(50)) == std::future_status::timeout);
+    release.set_value();
+    busy.get();
+    done.get();
+    BOOST_CHECK(held.get() == 0);
+    BOOST_CHECK(shards.route(0).get(2).get() == 2);
+    BOOST_CHECK(shards[1].size().get() == 3u);
+    BOOST_CHECK(shards[0].size().get() == 0u);
+}
+
+BOOST_AUTO_TEST_CASE( test_sharded_servant_proxy_call_during_migrations )
+{
+    Shards shards = make_shards(2,2);
+    const std::size_t buckets = shards.bucket_count();
+    // another thread writes keys of bucket 0 while it moves between the shards
+    std::future<void> writer = std::async(std::launch::async,[&shards]()
+    {
+        for (int i = 0; i < 2000; ++i)
+        {
+            shards.call(i * 2,[i](ServantProxy const& p){p.set(i * 2,i);});
+        }
+    });
+    std::vector<std::future<void>> fus;
+    for (std::size_t m = 0; m < 50; ++m)
+    {
+        fus.push_back(shards.migrate(0,(m + 1) % 2,
+                    [buckets](Servant& s, std::size_t b){return s.extract(b,buckets);},
+                    [](Servant& s, std::map<int,int> state){s.insert(state);}));
+    }
+    writer.get();
+    for (auto& fu : fus)
+    {
+        fu.get();
+    }
+    // no write reached a shard after the extraction of its bucket
+    BOOST_CHECK(shards[shards.shard_of_bucket(0)].size().get() == 2000u);
+    BOOST_CHECK(shards[1 - shards.shard_of_bucket(0)].size().get() == 0u);
+    BOOST_CHECK(shards.call(10,[](ServantProxy const& p){return p.get(10);}).get() == 5);
+}
+
+BOOST_AUTO_TEST_CASE( test_sharded_servant_proxy_shared_threads )
+{
+    // no shard waits for another, so they can share a thread
+    auto s = boost::asynchronous::make_shared_scheduler_proxy<boost::asynchronous::single_thread_scheduler<
+                                                                boost::asynchronous::lockfree_queue<>>>();
+    std::vector<boost::asynchronous::any_shared_scheduler_proxy<>> schedulers{s,s};
+    Shards shards(schedulers,4,shard_by_value(),0);
+    shards.route(0).set(0,0);
+    shards.route(4).set(4,4);
+    shards.migrate(0,1,
+                   [](Servant& s, std::size_t b){return s.extract(b,4);},
+                   [](Servant& s, std::map<int,int> state){s.insert(state);}).get();
+    BOOST_CHECK(shards.shard_of_bucket(0) == 1u);
+    BOOST_CHECK(shards.route(4).get(4).get() == 4);
+    BOOST_CHECK(shards[1].size().get() == 2u);
+}
+
+BOOST_AUTO_TEST_CASE( test_make_sharded_servant_proxy )
+{
+    auto shards = boost::asynchronous::make_sharded_servant_proxy<ServantProxy>(4,100);
+    BOOST_CHECK(shards.size() == 4u);
+    for (int i = 0; i < 50; ++i)
+    {
+        shards.route(i).set(i,i);
+    }
+    std::vector<std::future<std::size_t>> sizes = shards.broadcast([](ServantProxy const& p){return p.size();});
+    std::size_t total = 0;
+    for (auto& fu : sizes)
+    {
+        total += fu.get();
+    }
+    BOOST_CHECK(total == 50u);
+    BOOST_CHECK(shards.route(7).get(7).get() == 107);
+    std::set<boost::thread::id> ids;
+    for (std::size_t i = 0; i < shards.size(); ++i)
+    {
+        ids.insert(shards[i].get_proxy().thread_ids()[0]);
+    }
+    BOOST_CHECK(ids.size() == 4u);
+}
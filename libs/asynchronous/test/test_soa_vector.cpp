@@ -0,0 +1,181 @@
+// Boost.Asynchronous library
+//  Copyright (C) Christophe Henry 2026
+//
+//  Use, modification and distribution is subject to the Boost
+//  Software License, Version 1.0.  (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// For more information, see http://www.boost.org
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <future>
+
+#include <boost/asynchronous/container/soa_vector.hpp>
+#include <boost/asynchronous/algorithm/parallel_for.hpp>
+#include <boost/asynchronous/algorithm/parallel_reduce.hpp>
+#include <boost/asynchronous/algorithm/parallel_sort.hpp>
+#include <boost/asynchronous/queue/lockfree_queue.hpp>
+#include <boost/asynchronous/scheduler_shared_proxy.hpp>
+#include <boost/asynchronous/scheduler/threadpool_scheduler.hpp>
+#include "test_common.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+using namespace boost::asynchronous::test;
+
+namespace
+{
+typedef boost::asynchronous::soa_vector<int,double,std::string> records;
+
+// key of a row, works with rows and references
+struct by_id
+{
+    template <class L, class R>
+    bool operator()(L const& lhs, R const& rhs) const
+    {
+        return std::get<0>(lhs) < std::get<0>(rhs);
+    }
+};
+
+// throws when copied from a value equal to throw_on
+struct throwing_field
+{
+    static constexpr int throw_on = 13;
+    throwing_field(int v = 0) : value(v)
+    {}
+    throwing_field(throwing_field const& rhs) : value(rhs.value)
+    {
+        if (rhs.value == throw_on)
+        {
+            throw std::runtime_error("throwing_field");
+        }
+    }
+    throwing_field& operator=(throwing_field const& rhs) = default;
+    bool operator==(throwing_field const& rhs) const
+    {
+        return value == rhs.value;
+    }
+    int value;
+};
+}
+
+BOOST_AUTO_TEST_CASE( test_soa_vector_serial )
+{
+    records r;
+    for (int i = 0; i < 100; ++i)
+    {
+        r.push_back(99 - i,i * 0.5,std::to_string(i));
+    }
+    BOOST_CHECK_MESSAGE(r.size() == 100 && r.column<1>().size() == 100,"wrong size: " << r.size());
+    // each field contiguous
+    BOOST_CHECK_MESSAGE(&r.column<0>()[1] == &r.column<0>()[0] + 1,"column not contiguous.");
+    BOOST_CHECK_MESSAGE(std::get<2>(r[10]) == "10" && std::get<0>(r.at(10)) == 89,"wrong row.");
+    BOOST_CHECK_THROW(r.at(100),std::out_of_range);
+
+    // rows are assignable through references
+    std::get<1>(r[0]) = 42.0;
+    BOOST_CHECK_MESSAGE(r.column<1>()[0] == 42.0,"assignment through reference failed.");
+    records::value_type row = r[5];
+    r[6] = row;
+    BOOST_CHECK_MESSAGE(r.column<2>()[6] == "5" && r.column<0>()[6] == 94,"row assignment failed.");
+
+    // rows can be swapped and sorted with standard algorithms
+    std::sort(r.begin(),r.end(),by_id());
+    BOOST_CHECK_MESSAGE(std::is_sorted(r.column<0>().begin(),r.column<0>().end()),"sort failed.");
+    BOOST_CHECK_MESSAGE(std::get<2>(r[0]) == "99" && std::get<1>(r[99]) == 42.0,"fields not moved together.");
+
+    records copy(r);
+    BOOST_CHECK_MESSAGE(copy == r,"copy differs.");
+    r.pop_back();
+    r.resize(200,records::value_type(1,2.0,"x"));
+    BOOST_CHECK_MESSAGE(r.size() == 200 && r.column<2>()[150] == "x","resize failed.");
+    r.clear();
+    BOOST_CHECK_MESSAGE(r.empty(),"clear failed.");
+}
+
+BOOST_AUTO_TEST_CASE( test_soa_vector_parallel )
+{
+    auto scheduler = boost::asynchronous::make_shared_scheduler_proxy<boost::asynchronous::threadpool_scheduler<
+                                                                        boost::asynchronous::lockfree_queue<>>>(4);
+    auto r = std::make_shared<boost::asynchronous::soa_vector<int,double>>(scheduler,1000,100000,std::make_tuple(1,0.0),
+                                                                           "test_soa_vector_parallel",0);
+    BOOST_CHECK_MESSAGE(r->size() == 100000 && r->column<0>()[99999] == 1,"parallel construction failed.");
+
+    // zip iterators
+    std::future<void> fu = boost::asynchronous::post_future(scheduler,
+    [r]()
+    {
+        return boost::asynchronous::parallel_for(r->begin(),r->end(),
+                                                 [](std::tuple<int&,double&> row)
+                                                 {
+                                                     std::get<1>(row) = std::get<0>(row) * 0.5;
+                                                 },
+                                                 1000);
+    },"test_soa_vector_parallel_for",0);
+    fu.get();
+    BOOST_CHECK_MESSAGE(r->column<1>()[500] == 0.5,"parallel_for on rows failed.");
+
+    // single column, contiguous
+    fu = boost::asynchronous::post_future(scheduler,
+    [r]()
+    {
+        return boost::asynchronous::parallel_for(r->column<0>().begin(),r->column<0>().end(),
+                                                 [](int& i){i = 100000 - i;},
+                                                 1000);
+    },"test_soa_vector_parallel_for_column",0);
+    fu.get();
+    std::future<long> fu2 = boost::asynchronous::post_future(scheduler,
+    [r]()
+    {
+        return boost::asynchronous::parallel_reduce(r->column<0>().begin(),r->column<0>().end(),
+                                                    [](long a, long b){return a + b;},1000);
+    },"test_soa_vector_parallel_reduce",0);
+    long sum = fu2.get();
+    BOOST_CHECK_MESSAGE(sum == 99999L * 100000L,"wrong sum: " << sum);
+
+    // distinct keys, then sort rows in parallel
+    for (int i = 0; i < 100000; ++i)
+    {
+        r->column<0>()[i] = (i * 7919) % 100000;
+        r->column<1>()[i] = r->column<0>()[i] * 2.0;
+    }
+    fu = boost::asynchronous::post_future(scheduler,
+    [r]()
+    {
+        return boost::asynchronous::parallel_sort(r->begin(),r->end(),by_id(),1000);
+    },"test_soa_vector_parallel_sort",0);
+    fu.get();
+    bool ok = true;
+    for (int i = 0; i < 100000; ++i)
+    {
+        ok = ok && r->column<0>()[i] == i && r->column<1>()[i] == i * 2.0;
+    }
+    BOOST_CHECK_MESSAGE(ok,"parallel_sort on rows failed.");
+
+    r->resize(50);
+    BOOST_CHECK_MESSAGE(r->size() == 50 && r->column<1>().size() == 50,"parallel resize failed.");
+}
+
+BOOST_AUTO_TEST_CASE( test_soa_vector_throwing_column )
+{
+    typedef boost::asynchronous::soa_vector<int,std::string,throwing_field> rows;
+    rows r;
+    for (int i = 0; i < 10; ++i)
+    {
+        r.push_back(i,std::to_string(i),throwing_field(i + 100));
+    }
+    // the first 2 columns grow before the third throws
+    BOOST_CHECK_THROW(r.push_back(42,"42",throwing_field(throwing_field::throw_on)),std::runtime_error);
+    BOOST_CHECK_MESSAGE(r.column<0>().size() == 10 && r.column<1>().size() == 10 && r.column<2>().size() == 10,
+                        "columns of different sizes after failed push_back.");
+    BOOST_CHECK_MESSAGE(std::get<1>(r[9]) == "9" && std::get<2>(r[9]).value == 109,"wrong last row after failed push_back.");
+
+    BOOST_CHECK_THROW(r.resize(50,rows::value_type(1,"x",throwing_field(throwing_field::throw_on))),std::runtime_error);
+    BOOST_CHECK_MESSAGE(r.column<0>().size() == 10 && r.column<1>().size() == 10 && r.column<2>().size() == 10,
+                        "columns of different sizes after failed resize.");
+    r.push_back(10,"10",throwing_field(110));
+    BOOST_CHECK_MESSAGE(r.size() == 11 && std::get<0>(r[10]) == 10 && std::get<2>(r[10]).value == 110,"failed push_back after rollback.");
+}
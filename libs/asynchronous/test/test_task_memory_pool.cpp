@@ -0,0 +1,121 @@
+// Boost.Asynchronous library
+//  Copyright (C) Christophe Henry 2026
+//
+//  Use, modification and distribution is subject to the Boost
+//  Software License, Version 1.0.  (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// For more information, see http://www.boost.org
+
+#include <cstring>
+#include <numeric>
+#include <thread>
+#include <vector>
+#include <future>
+
+#include <boost/asynchronous/helpers/task_memory_pool.hpp>
+#include <boost/asynchronous/algorithm/parallel_reduce.hpp>
+#include <boost/asynchronous/queue/lockfree_queue.hpp>
+#include <boost/asynchronous/scheduler_shared_proxy.hpp>
+#include <boost/asynchronous/scheduler/threadpool_scheduler.hpp>
+#include "test_common.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+using namespace boost::asynchronous::test;
+
+#ifndef BOOST_ASYNCHRONOUS_NO_TASK_MEMORY_POOL
+BOOST_AUTO_TEST_CASE( test_task_memory_pool_reuse )
+{
+    void* p = boost::asynchronous::task_memory_pool::allocate(40);
+    std::memset(p,1,40);
+    boost::asynchronous::task_memory_pool::deallocate(p,40);
+    // same size class, same thread: last freed block comes first
+    void* p2 = boost::asynchronous::task_memory_pool::allocate(48);
+    BOOST_CHECK_MESSAGE(p2 == p,"block was not reused.");
+    boost::asynchronous::task_memory_pool::deallocate(p2,48);
+    // big blocks are not pooled
+    void* big = boost::asynchronous::task_memory_pool::allocate(100000);
+    std::memset(big,2,100000);
+    boost::asynchronous::task_memory_pool::deallocate(big,100000);
+}
+#endif
+
+BOOST_AUTO_TEST_CASE( test_task_memory_pool_cross_thread )
+{
+    // allocated in one thread, freed in others
+    const std::size_t count = 100000;
+    std::vector<void*> blocks(count);
+    std::size_t chunks_before = boost::asynchronous::task_memory_pool::chunk_count();
+    for (int round = 0; round < 5; ++round)
+    {
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            blocks[i] = boost::asynchronous::task_memory_pool::allocate(64);
+            std::memset(blocks[i],static_cast<int>(i),64);
+        }
+        std::vector<std::thread> threads;
+        for (std::size_t t = 0; t < 4; ++t)
+        {
+            threads.emplace_back([&blocks,t,count]()
+            {
+                for (std::size_t i = t; i < count; i += 4)
+                {
+                    boost::asynchronous::task_memory_pool::deallocate(blocks[i],64);
+                }
+            });
+        }
+        for (auto& t : threads)
+        {
+            t.join();
+        }
+    }
+#ifndef BOOST_ASYNCHRONOUS_NO_TASK_MEMORY_POOL
+    // blocks freed by other threads came back to the shared pool and were reused
+    std::size_t needed = count * 64 / (64 * 1024) + 1;
+    BOOST_CHECK_MESSAGE(boost::asynchronous::task_memory_pool::chunk_count() - chunks_before <= 2 * needed,
+                        "memory not reused, chunks: " << boost::asynchronous::task_memory_pool::chunk_count() - chunks_before);
+#else
+    (void)chunks_before;
+#endif
+}
+
+BOOST_AUTO_TEST_CASE( test_task_memory_pool_allocator )
+{
+    auto p = std::allocate_shared<std::vector<int>>(boost::asynchronous::task_allocator<std::vector<int>>(),10,3);
+    BOOST_CHECK_MESSAGE(p->size() == 10 && (*p)[9] == 3,"allocate_shared failed.");
+    std::promise<int> pr(std::allocator_arg,boost::asynchronous::task_allocator<char>());
+    auto fu = pr.get_future();
+    pr.set_value(42);
+    BOOST_CHECK_MESSAGE(fu.get() == 42,"promise with task_allocator failed.");
+}
+
+BOOST_AUTO_TEST_CASE( test_task_memory_pool_continuations )
+{
+    auto scheduler = boost::asynchronous::make_shared_scheduler_proxy<boost::asynchronous::threadpool_scheduler<
+                                                                        boost::asynchronous::lockfree_queue<>>>(4);
+    auto data = std::make_shared<std::vector<long>>(1000000);
+    std::iota(data->begin(),data->end(),0);
+    std::size_t chunks = 0;
+    for (int i = 0; i < 10; ++i)
+    {
+        std::future<long> fu = boost::asynchronous::post_future(scheduler,
+        [data]()
+        {
+            return boost::asynchronous::parallel_reduce(data->begin(),data->end(),[](long a, long b){return a + b;},100);
+        },"test_task_memory_pool_continuations",0);
+        long sum = fu.get();
+        BOOST_CHECK_MESSAGE(sum == 999999L * 1000000L / 2,"wrong sum: " << sum);
+        if (i == 0)
+        {
+            chunks = boost::asynchronous::task_memory_pool::chunk_count();
+        }
+    }
+#ifndef BOOST_ASYNCHRONOUS_NO_TASK_MEMORY_POOL
+    // later runs reuse the memory of the first one
+    BOOST_CHECK_MESSAGE(boost::asynchronous::task_memory_pool::chunk_count() <= 2 * chunks,
+                        "task memory not reused: " << chunks << " then " << boost::asynchronous::task_memory_pool::chunk_count());
+#else
+    (void)chunks;
+#endif
+}
@@ -0,0 +1,197 @@
+// Boost.Asynchronous library
+//  Copyright (C) Christophe Henry 2026
+//
+//  Use, modification and distribution is subject to the Boost
+//  Software License, Version 1.0.  (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// For more information, see http://www.boost.org
+
+#include <string>
+#include <utility>
+#include <vector>
+#include <future>
+
+#include <boost/asynchronous/container/unordered_map.hpp>
+#include <boost/asynchronous/algorithm/parallel_for_each.hpp>
+#include <boost/asynchronous/queue/lockfree_queue.hpp>
+#include <boost/asynchronous/scheduler_shared_proxy.hpp>
+#include <boost/asynchronous/scheduler/threadpool_scheduler.hpp>
+#include "test_common.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+using namespace boost::asynchronous::test;
+
+namespace
+{
+typedef boost::asynchronous::unordered_map<int,int> map_type;
+
+// all keys in the same slot cluster, to exercise probing and backward shift deletion
+struct bad_hash
+{
+    std::size_t operator()(int i) const
+    {
+        return static_cast<std::size_t>(i % 3);
+    }
+};
+std::size_t equal_calls = 0;
+// counts comparisons, to measure the probe sequences
+struct counting_equal
+{
+    bool operator()(int lhs, int rhs) const
+    {
+        ++equal_calls;
+        return lhs == rhs;
+    }
+};
+}
+
+BOOST_AUTO_TEST_CASE( test_unordered_map_basic )
+{
+    map_type m(10);
+    BOOST_CHECK_MESSAGE(m.shard_count() == 16,"shard count should be 16, got: " << m.shard_count());
+    BOOST_CHECK_MESSAGE(m.insert(std::make_pair(1,10)),"insert failed.");
+    BOOST_CHECK_MESSAGE(!m.insert(std::make_pair(1,11)),"duplicate key inserted.");
+    BOOST_CHECK_MESSAGE(m.find(1) && *m.find(1) == 10,"wrong value.");
+    BOOST_CHECK_MESSAGE(!m.insert_or_assign(1,12) && *m.find(1) == 12,"insert_or_assign failed.");
+    BOOST_CHECK_MESSAGE(m.emplace(2,20) && m.contains(2),"emplace failed.");
+    BOOST_CHECK_MESSAGE(m.visit(2,[](int& v){v += 1;}) && *m.find(2) == 21,"visit failed.");
+    int seen = 0;
+    BOOST_CHECK_MESSAGE(m.cvisit(2,[&seen](int const& v){seen = v;}) && seen == 21,"cvisit failed.");
+    BOOST_CHECK_MESSAGE(!m.visit(3,[](int&){}),"visit found missing key.");
+    BOOST_CHECK_MESSAGE(m.size() == 2,"wrong size: " << m.size());
+    BOOST_CHECK_MESSAGE(m.erase(1) == 1 && m.erase(1) == 0 && !m.contains(1),"erase failed.");
+
+    map_type copy(m);
+    map_type moved(std::move(m));
+    BOOST_CHECK_MESSAGE(copy.size() == 1 && moved.size() == 1 && m.empty(),"copy or move failed.");
+    m.insert(std::make_pair(5,50));
+    BOOST_CHECK_MESSAGE(m.size() == 1 && *m.find(5) == 50,"moved-from map unusable.");
+    m.clear();
+    BOOST_CHECK_MESSAGE(m.empty(),"clear failed.");
+}
+
+BOOST_AUTO_TEST_CASE( test_unordered_map_collisions )
+{
+    boost::asynchronous::unordered_map<int,std::string,bad_hash> m(1);
+    for (int i = 0; i < 1000; ++i)
+    {
+        m.emplace(i,std::to_string(i));
+    }
+    for (int i = 0; i < 1000; i += 2)
+    {
+        BOOST_CHECK_MESSAGE(m.erase(i) == 1,"erase failed for: " << i);
+    }
+    BOOST_CHECK_MESSAGE(m.size() == 500,"wrong size: " << m.size());
+    for (int i = 0; i < 1000; ++i)
+    {
+        auto v = m.find(i);
+        BOOST_CHECK_MESSAGE(i % 2 == 0 ? !v : (v && *v == std::to_string(i)),"wrong lookup for: " << i);
+    }
+}
+
+BOOST_AUTO_TEST_CASE( test_unordered_map_power_of_2_stride )
+{
+    // std::hash<int> is the identity on most implementations, the keys differ only in their high bits
+    boost::asynchronous::unordered_map<int,int,std::hash<int>,counting_equal> m(4);
+    const int keys = 20000;
+    for (int i = 0; i < keys; ++i)
+    {
+        m.emplace(i << 12,i);
+    }
+    BOOST_CHECK_MESSAGE(m.size() == static_cast<std::size_t>(keys),"wrong size: " << m.size());
+    equal_calls = 0;
+    for (int i = 0; i < keys; ++i)
+    {
+        BOOST_CHECK(*m.find(i << 12) == i);
+    }
+    // a probe sequence of a few slots on average, not a cluster of the whole shard
+    BOOST_CHECK_MESSAGE(equal_calls < 4 * keys,"too many comparisons per lookup: " << equal_calls / keys);
+}
+
+BOOST_AUTO_TEST_CASE( test_unordered_map_concurrent_insert )
+{
+    auto scheduler = boost::asynchronous::make_shared_scheduler_proxy<boost::asynchronous::threadpool_scheduler<
+                                                                        boost::asynchronous::lockfree_queue<>>>(4);
+    auto m = std::make_shared<map_type>();
+    std::vector<std::future<void>> fus;
+    for (int t = 0; t < 8; ++t)
+    {
+        fus.push_back(boost::asynchronous::post_future(scheduler,
+        [m,t]()
+        {
+            for (int i = 0; i < 10000; ++i)
+            {
+                m->insert(std::make_pair(t * 10000 + i,i));
+                // readers concurrent with writers
+                m->contains(i);
+            }
+        },"test_unordered_map_concurrent_insert",0));
+    }
+    for (auto& fu : fus)
+    {
+        fu.get();
+    }
+    BOOST_CHECK_MESSAGE(m->size() == 80000,"wrong size: " << m->size());
+    bool ok = true;
+    for (int k = 0; k < 80000; ++k)
+    {
+        auto v = m->find(k);
+        ok = ok && v && *v == k % 10000;
+    }
+    BOOST_CHECK_MESSAGE(ok,"elements lost.");
+}
+
+BOOST_AUTO_TEST_CASE( test_unordered_map_parallel_operations )
+{
+    auto scheduler = boost::asynchronous::make_shared_scheduler_proxy<boost::asynchronous::threadpool_scheduler<
+                                                                        boost::asynchronous::lockfree_queue<>>>(4);
+    auto m = std::make_shared<map_type>(64);
+    auto data = std::make_shared<std::vector<std::pair<int,int>>>();
+    for (int i = 0; i < 100000; ++i)
+    {
+        data->emplace_back(i,i);
+    }
+    // duplicates are not inserted
+    data->emplace_back(5,-5);
+
+    std::future<std::size_t> fu = boost::asynchronous::post_future(scheduler,
+    [m]()
+    {
+        return boost::asynchronous::parallel_rehash(*m,100000,1000);
+    },"test_unordered_map_parallel_rehash",0);
+    BOOST_CHECK_MESSAGE(fu.get() == 0,"rehash of empty map should see no element.");
+
+    fu = boost::asynchronous::post_future(scheduler,
+    [m,data]()
+    {
+        return boost::asynchronous::parallel_insert(*m,data->begin(),data->end(),1000);
+    },"test_unordered_map_parallel_insert",0);
+    std::size_t inserted = fu.get();
+    BOOST_CHECK_MESSAGE(inserted == 100000 && m->size() == 100000,"wrong number inserted: " << inserted);
+    // first inserted wins, order between tasks is not defined
+    BOOST_CHECK_MESSAGE(*m->find(5) == 5 || *m->find(5) == -5,"wrong value for duplicate key.");
+
+    fu = boost::asynchronous::post_future(scheduler,
+    [m]()
+    {
+        return boost::asynchronous::parallel_for_each(*m,[](int const& k, int& v){v = k * 2;},1000);
+    },"test_unordered_map_parallel_for_each",0);
+    BOOST_CHECK_MESSAGE(fu.get() == 100000,"parallel_for_each did not visit all elements.");
+    BOOST_CHECK_MESSAGE(*m->find(777) == 1554,"parallel_for_each did not update.");
+
+    fu = boost::asynchronous::post_future(scheduler,
+    [m]()
+    {
+        return boost::asynchronous::parallel_erase_if(*m,[](int const& k, int const&){return k % 3 == 0;},1000);
+    },"test_unordered_map_parallel_erase_if",0);
+    std::size_t erased = fu.get();
+    BOOST_CHECK_MESSAGE(erased == 33334 && m->size() == 100000 - 33334,"wrong number erased: " << erased);
+    bool ok = true;
+    for (int k = 0; k < 100000; ++k)
+    {
+        ok = ok && (m->contains(k) == (k % 3 != 0));
+    }
+    BOOST_CHECK_MESSAGE(ok,"parallel_erase_if erased wrong elements.");
+}
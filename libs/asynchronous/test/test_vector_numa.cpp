@@ -0,0 +1,84 @@
+// Boost.Asynchronous library
+//  Copyright (C) Christophe Henry 2026
+//
+//  Use, modification and distribution is subject to the Boost
+//  Software License, Version 1.0.  (See accompanying file
+//  LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt)
+//
+// For more information, see http://www.boost.org
+
+#include <algorithm>
+#include <vector>
+
+#include <boost/asynchronous/container/vector.hpp>
+#include <boost/asynchronous/container/numa_allocator.hpp>
+#include <boost/asynchronous/algorithm/detail/safe_advance.hpp>
+#include <boost/asynchronous/queue/lockfree_queue.hpp>
+#include <boost/asynchronous/scheduler_shared_proxy.hpp>
+#include <boost/asynchronous/scheduler/multiqueue_threadpool_scheduler.hpp>
+#include "test_common.hpp"
+
+#include <boost/test/unit_test.hpp>
+
+using namespace boost::asynchronous::test;
+
+namespace
+{
+// big enough to be mapped and placed
+const std::size_t numa_vector_size = 1024 * 1024;
+
+typedef boost::asynchronous::vector<int,BOOST_ASYNCHRONOUS_DEFAULT_JOB,false,boost::asynchronous::numa_allocator<int>> numa_vector;
+}
+
+BOOST_AUTO_TEST_CASE( test_numa_halving_bounds )
+{
+    // chunks must be the ones parallel algorithms work on
+    std::vector<std::size_t> bounds(1,0);
+    boost::asynchronous::detail::numa_halving_bounds(0,1001,2,bounds);
+    BOOST_CHECK_MESSAGE(bounds.size() == 5,"wrong number of chunks.");
+    std::size_t middle = boost::asynchronous::detail::find_cutoff((std::size_t)0,100,(std::size_t)1001);
+    BOOST_CHECK_MESSAGE(bounds[2] == middle,"chunks not aligned with find_cutoff.");
+    BOOST_CHECK_MESSAGE(bounds[1] == boost::asynchronous::detail::find_cutoff((std::size_t)0,100,middle),"chunks not aligned with find_cutoff.");
+    BOOST_CHECK_MESSAGE(bounds[3] == boost::asynchronous::detail::find_cutoff(middle,100,(std::size_t)1001),"chunks not aligned with find_cutoff.");
+    BOOST_CHECK_MESSAGE(bounds[4] == 1001,"last chunk does not end at end.");
+}
+
+BOOST_AUTO_TEST_CASE( test_vector_numa_interleave )
+{
+    auto scheduler = boost::asynchronous::make_shared_scheduler_proxy<boost::asynchronous::multiqueue_threadpool_scheduler<
+                                                                        boost::asynchronous::lockfree_queue<>>>(4);
+    numa_vector v(scheduler,10000,numa_vector_size,42,"",0,
+                  boost::asynchronous::numa_allocator<int>(boost::asynchronous::numa_policy::interleave));
+    BOOST_CHECK_MESSAGE(v.size() == numa_vector_size,"vector size should be " << numa_vector_size << ", got: " << v.size());
+    BOOST_CHECK_MESSAGE(std::all_of(v.begin(),v.end(),[](int i){return i == 42;}),"vector not filled.");
+    BOOST_CHECK_MESSAGE(v.get_allocator().policy() == boost::asynchronous::numa_policy::interleave,"wrong policy.");
+}
+
+BOOST_AUTO_TEST_CASE( test_vector_numa_node_local_copy_resize )
+{
+    auto scheduler = boost::asynchronous::make_shared_scheduler_proxy<boost::asynchronous::multiqueue_threadpool_scheduler<
+                                                                        boost::asynchronous::lockfree_queue<>>>(4);
+    numa_vector v(scheduler,10000,numa_vector_size,1,"",0,
+                  boost::asynchronous::numa_allocator<int>(boost::asynchronous::numa_policy::node_local));
+    numa_vector v2(v);
+    BOOST_CHECK_MESSAGE(v2 == v,"copy differs from original.");
+    BOOST_CHECK_MESSAGE(v2.get_allocator().policy() == boost::asynchronous::numa_policy::node_local,"copy lost policy.");
+    // reallocates through the allocator
+    v2.resize(numa_vector_size * 2,2);
+    BOOST_CHECK_MESSAGE(v2.size() == numa_vector_size * 2,"wrong size after resize.");
+    BOOST_CHECK_MESSAGE(std::all_of(v2.begin(),v2.begin() + numa_vector_size,[](int i){return i == 1;}),"resize lost elements.");
+    BOOST_CHECK_MESSAGE(std::all_of(v2.begin() + numa_vector_size,v2.end(),[](int i){return i == 2;}),"resize did not fill.");
+    // moved-from vector must still free its memory with the right allocator
+    numa_vector v3(std::move(v2));
+    BOOST_CHECK_MESSAGE(v3.size() == numa_vector_size * 2,"wrong size after move.");
+}
+
+BOOST_AUTO_TEST_CASE( test_vector_numa_small_std )
+{
+    // small vectors are not mapped and do not need a threadpool
+    numa_vector v((std::size_t)100,3,boost::asynchronous::numa_allocator<int>(boost::asynchronous::numa_policy::node_local));
+    BOOST_CHECK_MESSAGE(v.size() == 100,"vector size should be 100, got: " << v.size());
+    BOOST_CHECK_MESSAGE(std::all_of(v.begin(),v.end(),[](int i){return i == 3;}),"vector not filled.");
+    v.push_back(4);
+    BOOST_CHECK_MESSAGE(v.back() == 4,"push_back failed.");
+}